@@ -24,10 +24,48 @@
 #include "DXInputLayout.h"
 #include "DXTexture.h"
 #include "DXShader.h"
+#include "DXReadbackQueue.h"
+#include "DXUploadScheduler.h"
+#include "DXGPUProfiler.h"
+#include "DXTimelineCapture.h"
+#include "DXMemoryTracker.h"
+#include "DXDeviceCaps.h"
+#include "DXMipGenerator.h"
+#include "DXShaderArchive.h"
+#include "geBlockCompression.h"
+#include "geRenderStats.h"
 
 
 namespace geEngineSDK {
 
+  /**
+   * @brief Render target bound to a subset of the slices of an array or cube
+   *        texture. For cube maps slice = cube * 6 + face.
+   */
+  struct RenderTargetSlice
+  {
+    WeakSPtr<Texture> pRenderTarget;
+    uint32 mipLevel = 0;
+    uint32 firstSlice = 0;
+    uint32 numSlices = 1;
+  };
+
+  /**
+   * @brief One record of a batched writeToResources() call.
+   *        The resource is a raw pointer so large batches don't pay for a
+   *        weak pointer lock per record, it must stay alive during the call.
+   */
+  struct ResourceWrite
+  {
+    GraphicsResource* pResource = nullptr;
+    uint32 dstSubRes = 0;
+    GRAPHICS_BOX dstBox;
+    bool bUseBox = false;       //False writes the whole subresource
+    const void* pSrcData = nullptr;
+    uint32 srcRowPitch = 0;
+    uint32 srcDepthPitch = 0;
+  };
+
   class DX11RenderAPI : public RenderAPI
   {
    public:
@@ -86,6 +124,29 @@ namespace geEngineSDK {
                   bool isCubeMap = false,
                   uint32 arraySize = 1) override;
 
+    /**
+     * @brief Creates a sampled texture from RGBA8 pixels. The mips are built
+     *        on the CPU with the default mip filter, and block compressed
+     *        formats compress every mip before the upload.
+     * @param format R8G8B8A8 or B8G8R8A8, BC1, BC3 or BC7 (UNORM or sRGB),
+     *        BC4 or BC5 UNORM. The block compressed formats need a width and
+     *        height multiple of 4.
+     * @param mipLevels 0 for the full chain.
+     */
+    SPtr<Texture>
+    createTextureFromPixels(const TextureImage& image,
+                            GRAPHICS_FORMAT::E format,
+                            uint32 mipLevels = 0,
+                            BC_QUALITY::E quality = BC_QUALITY::kNormal);
+
+    /**
+     * @brief Loads DDS files. The files are mapped and their headers parsed
+     *        in parallel, then the textures are created from the mappings.
+     * @return A texture per path, nullptr for the ones that failed to load.
+     */
+    Vector<SPtr<Texture>>
+    loadTextures(const Vector<Path>& filePaths);
+
     SPtr<VertexDeclaration>
     createVertexDeclaration(const Vector<VertexElement>& elements) override;
 
@@ -178,6 +239,37 @@ namespace geEngineSDK {
     SPtr<ComputeShader>
     createComputeShader(CREATE_SHADER_PARAMS) override;
 
+    /**
+     * @brief Opens an archive of precompiled shaders. The create*Shader
+     *        functions look the shaders up in it before compiling them.
+     *        The initialization opens RenderAPI.ShaderArchive if it's set.
+     */
+    bool
+    openShaderArchive(const Path& filePath);
+
+    /**
+     * @brief Closes the shader archive. The shaders created from it keep
+     *        its mapping until they are released.
+     */
+    void
+    closeShaderArchive();
+
+    const DXShaderArchive&
+    getShaderArchive() const {
+      return m_shaderArchive;
+    }
+
+    /**
+     * @brief Compiles a shader with the same options as the create*Shader
+     *        functions, used to write the shader archives.
+     */
+    bool
+    compileShader(const Path& fileName,
+                  const Vector<ShaderMacro>& macros,
+                  const String& szEntryPoint,
+                  const String& szShaderModel,
+                  ID3DBlob** ppBlob);
+
     /*************************************************************************/
     // Write Functions
     /*************************************************************************/
@@ -190,11 +282,115 @@ namespace geEngineSDK {
                     uint32 srcDepthPitch,
                     uint32 copyFlags = 0) override;
 
+    /**
+     * @brief Writes many (sub)regions in a single pass. Consecutive records
+     *        on the same resource reuse its native handle.
+     */
+    void
+    writeToResources(const ResourceWrite* pWrites,
+                     uint32 numWrites,
+                     uint32 copyFlags = 0);
+
+    void
+    writeToResources(const Vector<ResourceWrite>& writes, uint32 copyFlags = 0) {
+      writeToResources(writes.data(), static_cast<uint32>(writes.size()), copyFlags);
+    }
+
+    /**
+     * @brief Queues an upload that is issued in chunks from present() within
+     *        the per frame upload budget ("UploadBytesPerFrame" in the
+     *        RenderAPI config section).
+     * @return Token to check with getUploadScheduler().isComplete().
+     */
+    UploadToken
+    writeToResourceAsync(const WeakSPtr<GraphicsResource>& pResource,
+                         uint32 dstSubRes,
+                         const GRAPHICS_BOX* pDstBox,
+                         const void* pSrcData,
+                         uint32 srcRowPitch);
+
+    DXUploadScheduler&
+    getUploadScheduler() {
+      return m_uploadScheduler;
+    }
+
+    /**
+     * @brief GPU timing of named scopes, resolved a few frames after present.
+     *        Scopes are recorded on the immediate context.
+     */
+    DXGPUProfiler&
+    getGPUProfiler() {
+      return m_gpuProfiler;
+    }
+
+    /**
+     * @brief Chrome trace capture of the CPU entry points and the GPU scopes.
+     *        Started from the "TimelineCaptureFile" config key or with
+     *        getTimeline().start().
+     */
+    DXTimelineCapture&
+    getTimeline() {
+      return m_timeline;
+    }
+
+    /**
+     * @brief Video memory budget of the process, refreshed on present
+     *        ("MemoryBudgetQueryInterval" frames). Per category and per name
+     *        totals are available through the static DXMemoryTracker calls.
+     */
+    DXMemoryTracker&
+    getMemoryTracker() {
+      return m_memoryTracker;
+    }
+
+    /**
+     * @brief Format support, MSAA levels and feature options, probed in
+     *        initRenderAPI (or loaded from "DeviceCapsCacheFile") and
+     *        read only after that.
+     */
+    const DXDeviceCaps&
+    getDeviceCaps() const {
+      return m_deviceCaps;
+    }
+
+    /**
+     * @brief CPU counters of the last presented frame.
+     */
+    const RenderStats&
+    getRenderStats() const {
+      return m_stats.getLastFrame();
+    }
+
+    /**
+     * @brief Counters of the frame being recorded.
+     */
+    const RenderStats&
+    getCurrentRenderStats() const {
+      return m_stats.getCurrentFrame();
+    }
+
     MappedSubresource
     mapToRead(const WeakSPtr<GraphicsResource>& pTexture,
               uint32 subResource = 0,
               uint32 mapFlags = 0) override;
 
+    /**
+     * @brief Queues a non-blocking readback of a subresource. The data is
+     *        copied to a pooled staging resource and delivered to the
+     *        callback from present() a few frames later.
+     * @return Ticket to poll the request through getReadbackQueue() when no
+     *         callback is given.
+     */
+    ReadbackTicket
+    readbackAsync(const WeakSPtr<GraphicsResource>& pResource,
+                  uint32 subResource = 0,
+                  const DXReadbackQueue::ReadbackFn& pCallback = nullptr);
+
+    DXReadbackQueue&
+    getReadbackQueue() {
+      return m_readbackQueue;
+    }
+
     void
     unmap(const WeakSPtr<GraphicsResource>& pTexture,
           uint32 subResource = 0) override;
@@ -203,9 +399,19 @@ namespace geEngineSDK {
     copyResource(const WeakSPtr<GraphicsResource>& pSrcObj,
                  const WeakSPtr<GraphicsResource>& pDstObj) override;
 
+    /**
+     * @brief Generates the mips with the filter of "MipGenFilter" (Box or
+     *        Kaiser) in the configuration.
+     */
     void
     generateMips(const WeakSPtr<Texture>& pTexture) override;
 
+    /**
+     * @brief Generates the mips with compute shaders, see DXMipGenerator.
+     */
+    void
+    generateMips(const WeakSPtr<Texture>& pTexture, const MipGenerationDesc& mipDesc);
+
     void
     clearRenderTarget(const WeakSPtr<Texture>& pRenderTarget,
                       const LinearColor& color = LinearColor::Black) override;
@@ -229,6 +435,19 @@ namespace geEngineSDK {
     void
     setImmediateContext() override;
 
+    /**
+     * @brief Sends the following calls to another context of the device
+     *        (e.g. a deferred context that records without reaching the
+     *        GPU). setImmediateContext() goes back to the immediate one.
+     */
+    void
+    setActiveContext(D3DDeviceContext* pContext);
+
+    D3DDevice*
+    getDevice() const {
+      return m_pDevice;
+    }
+
     void
     setTopology(PRIMITIVE_TOPOLOGY::E topologyType) override;
 
@@ -333,7 +552,10 @@ namespace geEngineSDK {
 
     template<ShaderStage Stage>
     FORCEINLINE void
-    _setShaderResource(const WeakSPtr<Texture>& pTexture, const uint32 startSlot);
+    _setShaderResource(const WeakSPtr<Texture>& pTexture,
+                       const uint32 startSlot,
+                       const uint32 mostDetailedMip = 0,
+                       const uint32 numMips = DXTexture::ALL_MIPS);
 
     template<ShaderStage Stage>
     FORCEINLINE void
@@ -389,6 +611,16 @@ namespace geEngineSDK {
     csSetShaderResource(const WeakSPtr<Texture>& pTexture,
                         const uint32 startSlot = 0) override;
 
+    /**
+     * @brief Binds only a range of mips of the texture to the compute stage,
+     *        so a mip can be read while the next one is written as a UAV.
+     */
+    void
+    csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot,
+                        const uint32 mostDetailedMip,
+                        const uint32 numMips = 1);
+
     /*************************************************************************/
     // Set Unordered Access Views
     /*************************************************************************/
@@ -396,6 +628,14 @@ namespace geEngineSDK {
     csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
                              const uint32 startSlot = 0) override;
 
+    /**
+     * @brief Binds the unordered access view of a specific mip level.
+     */
+    void
+    csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                             const uint32 startSlot,
+                             const uint32 mipSlice);
+
 
     /*************************************************************************/
     // Set Constant Buffers
@@ -458,6 +698,32 @@ namespace geEngineSDK {
     setRenderTargets(const Vector<RenderTarget>& pTargets,
                      const WeakSPtr<Texture>& pDepthStencilView) override;
 
+    /**
+     * @brief Binds the render targets selecting the depth view mode.
+     * @param bReadOnlyDepth If true binds the read-only depth/stencil view so
+     *        the same depth texture can be sampled through its SRV while it
+     *        is used for depth testing (soft particles, decals, SSAO).
+     *        The bound depth stencil state must have depth writes disabled.
+     */
+    void
+    setRenderTargets(const Vector<RenderTarget>& pTargets,
+                     const WeakSPtr<Texture>& pDepthStencilView,
+                     bool bReadOnlyDepth);
+
+    /**
+     * @brief Binds individual faces/slices of array and cube textures.
+     *        Pass DXTexture::ALL_SLICES as numSlices to bind the whole array
+     *        and select the slice in the shader with SV_RenderTargetArrayIndex.
+     * @param depthFirstSlice First slice of the depth target.
+     * @param depthNumSlices Number of slices of the depth target.
+     */
+    void
+    setRenderTargetSlices(const Vector<RenderTargetSlice>& pTargets,
+                          const WeakSPtr<Texture>& pDepthStencilView,
+                          uint32 depthFirstSlice = 0,
+                          uint32 depthNumSlices = 1,
+                          bool bReadOnlyDepth = false);
+
     void
     setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) override;
 
@@ -499,6 +765,37 @@ namespace geEngineSDK {
     void
     _updateBackBufferTexture();
 
+    /**
+     * @brief Finds the bytecode of a shader in the archive, or compiles it
+     *        if the archive doesn't have it for the expected stage.
+     */
+    bool
+    _getBytecode(DXShader& shader,
+                 const Path& fileName,
+                 const Vector<ShaderMacro>& macros,
+                 const String& szEntryPoint,
+                 const String& szShaderModel,
+                 DXBC_PROGRAM_TYPE::E programType);
+
+    /**
+     * @brief Bytes sent by an update of a subresource, for the statistics.
+     */
+    SIZE_T
+    _getUpdateSize(ID3D11Resource* pGraphRes,
+                   uint32 dstSubRes,
+                   const D3D11_BOX* pBox,
+                   uint32 srcRowPitch,
+                   uint32 srcDepthPitch);
+
+    void
+    _updateSubresource(ID3D11Resource* pGraphRes,
+                       uint32 dstSubRes,
+                       const GRAPHICS_BOX* pDstBox,
+                       const void* pSrcData,
+                       uint32 srcRowPitch,
+                       uint32 srcDepthPitch,
+                       uint32 copyFlags);
+
    private:
     D3DDevice* m_pDevice = nullptr;
 
@@ -513,8 +810,35 @@ namespace geEngineSDK {
     //Helper variables
     bool m_bFullScreen = false;
     ADAPTER_DESC m_selectedAdapterDesc;
+    DXDeviceCaps m_deviceCaps;
+
+    //Compute mip generation and the filter generateMips uses by default
+    DXMipGenerator m_mipGenerator;
+    MipGenerationDesc m_defaultMipDesc;
+
+    //Precompiled shaders, looked up before compiling
+    DXShaderArchive m_shaderArchive;
 
     //Back buffer control
     SPtr<DXTexture> m_pBackBufferTexture;
+
+    //Non-blocking GPU to CPU copies, updated on present
+    DXReadbackQueue m_readbackQueue;
+
+    //Budgeted CPU to GPU copies, issued on present
+    DXUploadScheduler m_uploadScheduler;
+
+    //Timestamp queries, a frame spans from present to present
+    DXGPUProfiler m_gpuProfiler;
+
+    //Compares the tracked allocations with the OS budget
+    DXMemoryTracker m_memoryTracker;
+
+    //Mutable so const entry points (e.g. buffer creation) can record scopes
+    mutable DXTimelineCapture m_timeline;
+
+    //CPU side call counters, published on present
+    RenderStatsCounter m_stats;
+    RenderBindCache m_bindCache;
   };
 } // namespace geEngineSDK
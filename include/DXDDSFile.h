@@ -0,0 +1,89 @@
+/*****************************************************************************/
+/**
+ * @file    DXDDSFile.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   DDS texture files, read from a memory mapping.
+ *
+ * The file is mapped and the subresources of the texture are pointers
+ * inside the mapping, in the D3D11_SUBRESOURCE_DATA order CreateTexture2D
+ * takes (every mip of a slice, then the next slice). Nothing is copied on
+ * the CPU, the driver reads the pages of the file directly.
+ *
+ * - DX10 headers with any DXGI format the table describes, except the
+ *   planar, video and palette ones.
+ * - Legacy headers: the DXTn and ATIn FourCCs, the float FourCCs and the
+ *   usual RGB, luminance and alpha masks.
+ * - Cube maps (all six faces), arrays and cube arrays.
+ *
+ * Volume textures aren't supported, DXTexture is a 2D texture.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include "DXMappedFile.h"
+
+namespace geEngineSDK {
+
+  class DXDDSFile
+  {
+   public:
+    DXDDSFile() = default;
+
+    /**
+     * @brief Maps the file and parses its headers. Errors are logged.
+     */
+    bool
+    open(const Path& filePath);
+
+    /**
+     * @brief Parses a DDS image in memory that outlives this object.
+     * @param name Reported in the errors.
+     */
+    bool
+    parse(const uint8* pData, SIZE_T size, const String& name);
+
+    /**
+     * @brief Unmaps the file. The subresources are invalid afterwards.
+     */
+    void
+    close();
+
+    bool
+    isValid() const {
+      return !m_subresources.empty();
+    }
+
+    /**
+     * @brief Description of an immutable shader resource texture.
+     */
+    const D3D11_TEXTURE2D_DESC&
+    getDesc() const {
+      return m_desc;
+    }
+
+    const Vector<D3D11_SUBRESOURCE_DATA>&
+    getSubresources() const {
+      return m_subresources;
+    }
+
+    bool
+    isCubeMap() const {
+      return m_bIsCubeMap;
+    }
+
+   private:
+    DXMappedFile m_file;
+    D3D11_TEXTURE2D_DESC m_desc;
+    Vector<D3D11_SUBRESOURCE_DATA> m_subresources;
+    bool m_bIsCubeMap = false;
+  };
+} // namespace geEngineSDK
@@ -0,0 +1,146 @@
+/*****************************************************************************/
+/**
+ * @file    DXDeviceCaps.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Format support, MSAA levels and feature options of the device.
+ *
+ * The device is probed once when the render API starts: the support flags
+ * and the multisample levels of every format, and the CheckFeatureSupport
+ * options. The table doesn't change after that, so the hot paths (texture
+ * creation, MSAA queries) read it from any thread without locks.
+ *
+ * The table can be saved next to the identity of the adapter and its
+ * driver; a later start on the same adapter and driver loads it instead of
+ * probing again.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+
+namespace geEngineSDK {
+
+  struct DXFormatCaps
+  {
+    uint32 support = 0;             //D3D11_FORMAT_SUPPORT flags
+    uint32 support2 = 0;            //D3D11_FORMAT_SUPPORT2 flags
+    uint32 sampleCountMask = 0;     //Bit n is set if n + 1 samples are supported
+    uint32 maxSampleCount = 0;      //0 if the format can't be used at all
+    uint32 maxSampleQuality = 0;    //Highest quality level of maxSampleCount
+  };
+
+  /**
+   * @brief Results of CheckFeatureSupport, zeroed when the runtime doesn't
+   *        know the query.
+   */
+  struct DXFeatureCaps
+  {
+    D3D_FEATURE_LEVEL featureLevel;
+    D3D11_FEATURE_DATA_THREADING threading;
+    D3D11_FEATURE_DATA_DOUBLES doubles;
+    D3D11_FEATURE_DATA_D3D10_X_HARDWARE_OPTIONS d3d10XOptions;
+    D3D11_FEATURE_DATA_ARCHITECTURE_INFO architecture;
+    D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT minPrecision;
+#if !USING(DX_VERSION_11_0)
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+#endif
+#if !USING(DX_VERSION_11_0) && !USING(DX_VERSION_11_1)
+    D3D11_FEATURE_DATA_D3D11_OPTIONS1 options1;
+#endif
+#if USING(DX_VERSION_11_3) || USING(DX_VERSION_11_4)
+    D3D11_FEATURE_DATA_D3D11_OPTIONS2 options2;
+    D3D11_FEATURE_DATA_D3D11_OPTIONS3 options3;
+#endif
+  };
+
+  /**
+   * @brief What a saved table must match to be used instead of probing.
+   */
+  struct DXAdapterIdentity
+  {
+    uint32 vendorId = 0;
+    uint32 deviceId = 0;
+    uint32 subSysId = 0;
+    uint32 revision = 0;
+    uint64 driverVersion = 0;       //User mode driver version
+    uint32 featureLevel = 0;
+  };
+
+  class DXDeviceCaps
+  {
+   public:
+    static constexpr uint32 MAGIC = 0x50434447;   //"GDCP"
+    static constexpr uint32 VERSION = 1;
+
+    //Formats up to the last one DXGI defines for Direct3D 11
+    static constexpr uint32 NUM_FORMATS = DXGI_FORMAT_A4B4G4R4_UNORM + 1;
+
+    DXDeviceCaps();
+
+    /**
+     * @brief Queries the device for every format and feature option.
+     */
+    void
+    probe(D3DDevice* pDevice, const DXAdapterIdentity& identity);
+
+    /**
+     * @brief Loads a table saved for the same adapter, driver and version of
+     *        the plugin.
+     * @return False if the file is missing, corrupted or for another adapter.
+     */
+    bool
+    load(const Path& filePath, const DXAdapterIdentity& identity);
+
+    bool
+    save(const Path& filePath) const;
+
+    /**
+     * @brief Identity of the adapter of the device, driver version included.
+     */
+    static DXAdapterIdentity
+    getAdapterIdentity(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL featureLevel);
+
+    bool
+    isValid() const {
+      return m_bValid;
+    }
+
+    const DXAdapterIdentity&
+    getIdentity() const {
+      return m_identity;
+    }
+
+    /**
+     * @brief Capabilities of a format, all zero for unknown values.
+     */
+    const DXFormatCaps&
+    getFormatCaps(DXGI_FORMAT format) const {
+      auto index = static_cast<uint32>(format);
+      return index < NUM_FORMATS ? m_formats[index] : m_formats[DXGI_FORMAT_UNKNOWN];
+    }
+
+    bool
+    hasFormatSupport(DXGI_FORMAT format, uint32 support) const {
+      return (getFormatCaps(format).support & support) == support;
+    }
+
+    const DXFeatureCaps&
+    getFeatures() const {
+      return m_features;
+    }
+
+   private:
+    DXAdapterIdentity m_identity;
+    DXFormatCaps m_formats[NUM_FORMATS];
+    DXFeatureCaps m_features;
+    bool m_bValid = false;
+  };
+} // namespace geEngineSDK
@@ -0,0 +1,318 @@
+/*****************************************************************************/
+/**
+ * @file    DXGPUProfiler.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Hierarchical GPU timing with timestamp queries.
+ *
+ * Scopes are measured with pairs of timestamp queries inside a disjoint
+ * query per frame, optionally with a pipeline statistics query. Results
+ * are read a few frames later without flushing so the CPU never waits for
+ * the GPU.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include <functional>
+
+namespace geEngineSDK {
+
+  /**
+   * @brief Pipeline counters of a scope. Dividing psInvocations by the
+   *        number of pixels of the target gives the overdraw of a pass.
+   */
+  struct GPUPipelineStats
+  {
+    uint64 iaVertices = 0;
+    uint64 iaPrimitives = 0;
+    uint64 vsInvocations = 0;
+    uint64 psInvocations = 0;
+    uint64 cInvocations = 0;    //Primitives sent to the clipper
+    uint64 cPrimitives = 0;     //Primitives that survived clipping
+    uint64 csInvocations = 0;
+
+    GPUPipelineStats&
+    operator+=(const GPUPipelineStats& other) {
+      iaVertices += other.iaVertices;
+      iaPrimitives += other.iaPrimitives;
+      vsInvocations += other.vsInvocations;
+      psInvocations += other.psInvocations;
+      cInvocations += other.cInvocations;
+      cPrimitives += other.cPrimitives;
+      csInvocations += other.csInvocations;
+      return *this;
+    }
+  };
+
+  /**
+   * @brief Time of a scope in a resolved frame. Scopes are stored in the
+   *        order they were opened, so a parent always precedes its children.
+   */
+  struct GPUScopeResult
+  {
+    const char* name = nullptr;
+    uint32 parent = NumLimit::MAX_UINT32;   //Index of the parent scope
+    uint32 depth = 0;
+    float timeMs = 0.0f;
+    uint64 beginTick = 0;   //Raw GPU timestamps, in ticks of the frame frequency
+    uint64 endTick = 0;
+    bool bHasPipelineStats = false;
+    GPUPipelineStats pipelineStats;
+  };
+
+  /**
+   * @brief A GPU timestamp and the CPU performance counter read at the same
+   *        moment, used to place GPU scopes on the CPU timeline.
+   */
+  struct GPUClockCalibration
+  {
+    uint64 gpuTick = 0;
+    uint64 cpuTick = 0;         //QueryPerformanceCounter
+    uint64 cpuFrequency = 0;    //QueryPerformanceFrequency
+  };
+
+  /**
+   * @brief Accumulated times of a scope, identified by its full path
+   *        (e.g. "Frame/GBuffer/Terrain").
+   */
+  struct GPUScopeStats
+  {
+    float minMs = 0.0f;
+    float maxMs = 0.0f;
+    float avgMs = 0.0f;
+    float lastMs = 0.0f;
+    uint32 numSamples = 0;
+    double totalMs = 0.0;
+
+    //Only filled for scopes that collected pipeline statistics
+    GPUPipelineStats lastPipelineStats;
+    GPUPipelineStats totalPipelineStats;
+    uint32 numPipelineSamples = 0;
+  };
+
+  class DXGPUProfiler
+  {
+   public:
+    /**
+     * @brief Receives every resolved frame: its number, its scopes and the
+     *        frequency of its timestamps.
+     */
+    using FrameResolvedFn = std::function<void(uint64,
+                                               const Vector<GPUScopeResult>&,
+                                               uint64)>;
+
+    /**
+     * @param frameLatency Frames between the end of a frame and the read of
+     *        its queries. Results of frames that still aren't available
+     *        when their slot is needed again are dropped.
+     */
+    explicit DXGPUProfiler(uint32 frameLatency = 3)
+      : m_frameLatency(frameLatency)
+    {}
+
+    ~DXGPUProfiler() {
+      release();
+    }
+
+    /**
+     * @brief Creates the per frame queries and opens the first frame.
+     */
+    void
+    init(D3DDevice* pDevice, D3DDeviceContext* pContext);
+
+    void
+    release();
+
+    /**
+     * @brief Closes the current frame, resolves the oldest finished frame
+     *        and opens the next one. Called once per frame (on present).
+     */
+    void
+    newFrame();
+
+    /**
+     * @brief Opens a named scope nested in the currently open one.
+     * @param name Must stay valid until the frame is resolved (use literals).
+     * @param bPipelineStats Also collect pipeline statistics for the scope.
+     *        Ignored while pipeline statistics are disabled.
+     */
+    void
+    beginScope(const char* name, bool bPipelineStats = false);
+
+    void
+    endScope();
+
+    /**
+     * @brief Waits for the GPU to go idle and reads a timestamp together
+     *        with the CPU counter. Stalls the CPU, so it is meant for the
+     *        start of a capture, not for every frame.
+     * @return false if the GPU didn't answer in time.
+     */
+    bool
+    calibrateClocks(GPUClockCalibration& calibration);
+
+    void
+    setFrameResolvedCallback(const FrameResolvedFn& pCallback) {
+      m_pFrameResolvedFn = pCallback;
+    }
+
+    void
+    setEnabled(bool bEnabled) {
+      m_bEnabled = bEnabled;
+    }
+
+    bool
+    isEnabled() const {
+      return m_bEnabled;
+    }
+
+    /**
+     * @brief Enables the collection of pipeline statistics. When enabled
+     *        the frame scope always collects them. Takes effect on the next
+     *        frame, set it before init() to cover the first one.
+     */
+    void
+    setPipelineStatsEnabled(bool bEnabled) {
+      m_bPipelineStatsEnabled = bEnabled;
+    }
+
+    bool
+    isPipelineStatsEnabled() const {
+      return m_bPipelineStatsEnabled;
+    }
+
+    /**
+     * @brief Scope tree of the most recently resolved frame. The first
+     *        entry is the whole frame.
+     */
+    const Vector<GPUScopeResult>&
+    getLastFrame() const {
+      return m_lastFrame;
+    }
+
+    /**
+     * @brief Index of the frame returned by getLastFrame().
+     */
+    uint64
+    getLastFrameNumber() const {
+      return m_lastFrameNumber;
+    }
+
+    /**
+     * @brief Index of the frame being recorded.
+     */
+    uint64
+    getFrameNumber() const {
+      return m_frameNumber;
+    }
+
+    /**
+     * @brief Ticks per second of the timestamps of getLastFrame().
+     */
+    uint64
+    getLastFrameFrequency() const {
+      return m_lastFrameFrequency;
+    }
+
+    const UnorderedMap<String, GPUScopeStats>&
+    getStats() const {
+      return m_stats;
+    }
+
+    void
+    resetStats() {
+      m_stats.clear();
+    }
+
+   private:
+    struct ScopeQueries
+    {
+      const char* name = nullptr;
+      uint32 parent = NumLimit::MAX_UINT32;
+      uint32 depth = 0;
+      ID3D11Query* pBegin = nullptr;
+      ID3D11Query* pEnd = nullptr;
+      ID3D11Query* pStats = nullptr;
+    };
+
+    struct FrameQueries
+    {
+      ID3D11Query* pDisjoint = nullptr;
+      Vector<ScopeQueries> scopes;
+      uint64 frameNumber = 0;
+      bool bPending = false;   //Ended and waiting to be resolved
+    };
+
+    void
+    _beginFrame();
+
+    /**
+     * @return false if the data of the frame isn't available yet.
+     */
+    bool
+    _resolve(FrameQueries& frame);
+
+    void
+    _recycle(FrameQueries& frame);
+
+    ID3D11Query*
+    _acquireQuery(D3D11_QUERY type, Vector<ID3D11Query*>& freeList);
+
+    D3DDevice* m_pDevice = nullptr;
+    D3DDeviceContext* m_pContext = nullptr;
+
+    uint32 m_frameLatency;
+    bool m_bEnabled = true;
+    bool m_bPipelineStatsEnabled = false;
+    bool m_bFrameOpen = false;
+
+    uint64 m_frameNumber = 0;
+    Vector<FrameQueries> m_frames;          //Ring of frameLatency + 1 slots
+    uint32 m_currentScope = NumLimit::MAX_UINT32;
+    Vector<ID3D11Query*> m_freeTimestamps;
+    Vector<ID3D11Query*> m_freeStats;
+
+    Vector<GPUScopeResult> m_lastFrame;
+    uint64 m_lastFrameNumber = 0;
+    uint64 m_lastFrameFrequency = 0;
+    FrameResolvedFn m_pFrameResolvedFn;
+    UnorderedMap<String, GPUScopeStats> m_stats;
+    Vector<String> m_pathScratch;
+    Vector<UINT64> m_timestamps;
+    Vector<D3D11_QUERY_DATA_PIPELINE_STATISTICS> m_pipelineStats;
+  };
+
+  /**
+   * @brief Opens a GPU scope for the lifetime of the object.
+   */
+  class GPUProfileScope
+  {
+   public:
+    GPUProfileScope(DXGPUProfiler& profiler,
+                    const char* name,
+                    bool bPipelineStats = false)
+      : m_profiler(profiler) {
+      m_profiler.beginScope(name, bPipelineStats);
+    }
+
+    ~GPUProfileScope() {
+      m_profiler.endScope();
+    }
+
+    GPUProfileScope(const GPUProfileScope&) = delete;
+    GPUProfileScope&
+    operator=(const GPUProfileScope&) = delete;
+
+   private:
+    DXGPUProfiler& m_profiler;
+  };
+
+} // namespace geEngineSDK
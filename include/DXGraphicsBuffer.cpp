@@ -18,6 +18,8 @@
  */
  /*****************************************************************************/
 #include "DXGraphicsBuffer.h"
+#include "DXMemoryTracker.h"
+#include "geRenderStats.h"
 
 namespace geEngineSDK {
 
@@ -27,6 +29,10 @@ namespace geEngineSDK {
 
     void
     DXVertexBuffer::release() {
+      if (m_pBuffer) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kBuffer);
+        DXMemoryTracker::onReleased(m_pBuffer);
+      }
       safeRelease(m_pBuffer);
     }
 
@@ -36,6 +42,10 @@ namespace geEngineSDK {
 
     void
     DXIndexBuffer::release() {
+      if (m_pBuffer) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kBuffer);
+        DXMemoryTracker::onReleased(m_pBuffer);
+      }
       safeRelease(m_pBuffer);
     }
 
@@ -45,6 +55,10 @@ namespace geEngineSDK {
 
     void
     DXConstantBuffer::release() {
+      if (m_pBuffer) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kBuffer);
+        DXMemoryTracker::onReleased(m_pBuffer);
+      }
       safeRelease(m_pBuffer);
     }
 
@@ -54,6 +68,10 @@ namespace geEngineSDK {
 
     void
     DXStreamOutputBuffer::release() {
+      if (m_pBuffer) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kBuffer);
+        DXMemoryTracker::onReleased(m_pBuffer);
+      }
       safeRelease(m_pBuffer);
     }
 
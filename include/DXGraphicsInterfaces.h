@@ -22,6 +22,8 @@
 #include <geVector4.h>
 #include <geNumericLimits.h>
 
+#include "geRenderStats.h"
+
 namespace geEngineSDK
 {
 
@@ -34,6 +36,9 @@ namespace geEngineSDK
 
     void
     release() override {
+      if (m_pRasterizerState) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kState);
+      }
       safeRelease(m_pRasterizerState);
     }
 
@@ -63,6 +68,9 @@ namespace geEngineSDK
 
     void
     release() override {
+      if (m_pDepthStencilState) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kState);
+      }
       safeRelease(m_pDepthStencilState);
     }
 
@@ -91,6 +99,9 @@ namespace geEngineSDK
 
     void
     release() override {
+      if (m_pBlendState) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kState);
+      }
       safeRelease(m_pBlendState);
     }
 
@@ -121,6 +132,9 @@ namespace geEngineSDK
 
     void
     release() override {
+      if (m_pSampler) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kState);
+      }
       safeRelease(m_pSampler);
     }
     
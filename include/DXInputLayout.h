@@ -20,6 +20,8 @@
 #include "gePrerequisitesRenderAPIDX11.h"
 #include <geInputLayout.h>
 
+#include "geRenderStats.h"
+
 namespace geEngineSDK {
 
   class DXInputLayout : public InputLayout
@@ -32,6 +34,9 @@ namespace geEngineSDK {
 
     void
     release() override {
+      if (m_inputLayout) {
+        RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kInputLayout);
+      }
       safeRelease(m_inputLayout);
     }
 
@@ -0,0 +1,75 @@
+/*****************************************************************************/
+/**
+ * @file    DXMappedFile.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Read only memory mapping of a file.
+ *
+ * The loaders read the assets straight from the pages of the file cache:
+ * the pointers they give to Direct3D point inside the mapping, so the data
+ * is never copied into an intermediate buffer. The mapping must stay open
+ * until the resource is created.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+
+namespace geEngineSDK {
+
+  class DXMappedFile
+  {
+   public:
+    DXMappedFile() = default;
+
+    ~DXMappedFile() {
+      close();
+    }
+
+    DXMappedFile(DXMappedFile&& other);
+
+    DXMappedFile&
+    operator=(DXMappedFile&& other);
+
+    DXMappedFile(const DXMappedFile&) = delete;
+    DXMappedFile&
+    operator=(const DXMappedFile&) = delete;
+
+    /**
+     * @brief Maps the whole file. Empty files can't be mapped.
+     */
+    bool
+    open(const Path& filePath);
+
+    void
+    close();
+
+    bool
+    isOpen() const {
+      return nullptr != m_pData;
+    }
+
+    const uint8*
+    getData() const {
+      return m_pData;
+    }
+
+    SIZE_T
+    getSize() const {
+      return m_size;
+    }
+
+   private:
+    HANDLE m_hFile = INVALID_HANDLE_VALUE;
+    HANDLE m_hMapping = nullptr;
+    const uint8* m_pData = nullptr;
+    SIZE_T m_size = 0;
+  };
+} // namespace geEngineSDK
@@ -0,0 +1,182 @@
+/*****************************************************************************/
+/**
+ * @file    DXMemoryTracker.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Video memory accounting of the resources created by the plugin.
+ *
+ * Every texture, buffer, shader and staging resource reports its size when
+ * it is created and released, so the totals per category and per debug
+ * name are always current. The totals are compared with the budget the OS
+ * gives the process (IDXGIAdapter3::QueryVideoMemoryInfo) so the engine can
+ * drop resources before the driver starts paging them out.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include <functional>
+
+struct IDXGIAdapter3;
+
+namespace geEngineSDK {
+
+  namespace GPU_MEMORY_CATEGORY {
+    enum E {
+      kTexture = 0,
+      kRenderTarget,
+      kDepthStencil,
+      kVertexBuffer,
+      kIndexBuffer,
+      kConstantBuffer,
+      kStreamOutput,
+      kShader,
+      kStaging,
+      kNumCategories
+    };
+  }
+
+  struct GPUMemoryCategoryStats
+  {
+    uint64 bytes = 0;
+    uint64 peakBytes = 0;
+    uint32 count = 0;
+  };
+
+  /**
+   * @brief Video memory budget of the process as reported by the OS.
+   *        Local is the memory of the adapter, non local the system memory
+   *        it can reach.
+   */
+  struct GPUMemoryBudget
+  {
+    bool bValid = false;    //False when IDXGIAdapter3 isn't available
+    uint64 localBudget = 0;
+    uint64 localUsage = 0;
+    uint64 nonLocalBudget = 0;
+    uint64 nonLocalUsage = 0;
+    uint64 trackedBytes = 0;  //Sum of the tracked allocations when queried
+  };
+
+  class DXMemoryTracker
+  {
+   public:
+    /**
+     * @brief Called when the usage goes over the warning ratio of the
+     *        budget, and again when the budget changes while over it.
+     */
+    using BudgetFn = std::function<void(const GPUMemoryBudget&)>;
+
+    DXMemoryTracker() = default;
+
+    ~DXMemoryTracker() {
+      release();
+    }
+
+    /*************************************************************************/
+    // Allocation tracking (global, can be called from any thread)
+    /*************************************************************************/
+
+    /**
+     * @param pResource Native object, used as the key of the allocation.
+     */
+    static void
+    onAllocated(const void* pResource,
+                GPU_MEMORY_CATEGORY::E category,
+                SIZE_T bytes,
+                const String& name = String());
+
+    static void
+    onReleased(const void* pResource);
+
+    static void
+    onRenamed(const void* pResource, const String& name);
+
+    static uint64
+    getTotalBytes();
+
+    static GPUMemoryCategoryStats
+    getCategoryStats(GPU_MEMORY_CATEGORY::E category);
+
+    /**
+     * @brief Bytes per debug name, from the largest to the smallest.
+     *        Unnamed resources are grouped under their category name.
+     */
+    static Vector<std::pair<String, uint64>>
+    getBytesByName(uint32 maxNames = NumLimit::MAX_UINT32);
+
+    static const char*
+    getCategoryName(GPU_MEMORY_CATEGORY::E category);
+
+    /**
+     * @brief Human readable table of the categories and the largest names.
+     */
+    static String
+    getReport(uint32 maxNames = 16);
+
+    /*************************************************************************/
+    // Budget
+    /*************************************************************************/
+
+    /**
+     * @brief Queries the IDXGIAdapter3 interface of the adapter. Without it
+     *        (before Windows 10) the budget stays invalid.
+     * @param queryInterval Frames between two budget queries.
+     * @param warningRatio Fraction of the local budget that triggers the
+     *        callback.
+     */
+    void
+    init(IDXGIAdapter* pAdapter, uint32 queryInterval = 30, float warningRatio = 0.9f);
+
+    void
+    release();
+
+    /**
+     * @brief Refreshes the budget every queryInterval frames. Called on
+     *        present.
+     */
+    void
+    update();
+
+    /**
+     * @brief Queries the budget right away.
+     */
+    const GPUMemoryBudget&
+    queryBudget();
+
+    const GPUMemoryBudget&
+    getBudget() const {
+      return m_budget;
+    }
+
+    /**
+     * @brief True while the local usage is over the warning ratio.
+     */
+    bool
+    isOverBudget() const {
+      return m_bOverBudget;
+    }
+
+    void
+    setBudgetCallback(const BudgetFn& pCallback) {
+      m_pBudgetFn = pCallback;
+    }
+
+   private:
+    IDXGIAdapter3* m_pAdapter = nullptr;
+    uint32 m_queryInterval = 30;
+    uint32 m_framesToQuery = 0;
+    float m_warningRatio = 0.9f;
+    bool m_bOverBudget = false;
+
+    GPUMemoryBudget m_budget;
+    BudgetFn m_pBudgetFn;
+  };
+} // namespace geEngineSDK
@@ -0,0 +1,170 @@
+/*****************************************************************************/
+/**
+ * @file    DXMipGenerator.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Mip chain generation with compute shaders.
+ *
+ * ID3D11DeviceContext::GenerateMips needs the texture to be a render target
+ * created with D3D11_RESOURCE_MISC_GENERATE_MIPS, which costs memory and
+ * disables the color compression of some GPUs. The compute path works on
+ * any texture with a format the device can store through a typed UAV:
+ *
+ * - Box filter: up to four mips per dispatch, the last three reduced in
+ *   groupshared memory.
+ * - Kaiser filter: windowed sinc, sharper than the box, one mip per
+ *   dispatch.
+ * - Alpha coverage: the alpha of every mip is scaled so the fraction of
+ *   texels over the alpha test reference matches the top mip.
+ *
+ * sRGB textures are filtered in linear space: the source is read through an
+ * sRGB view and the result is encoded before it is stored through the UNORM
+ * alias of the same typeless format. Textures without UAV binding are
+ * processed in a scratch copy and the mips are copied back. Cube maps and
+ * arrays process every slice (cube face) in the same dispatches.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include "geTextureKernels.h"
+
+namespace geEngineSDK {
+  class DXDeviceCaps;
+
+  struct MipGenerationDesc
+  {
+    MIP_FILTER::E filter = MIP_FILTER::kBox;
+
+    //Scales the alpha of the mips to keep the coverage of the alpha test
+    bool bPreserveAlphaCoverage = false;
+    float alphaReference = 0.5f;
+
+    //Kaiser window, half width in destination texels and shape
+    float kaiserWidth = 3.0f;
+    float kaiserAlpha = 4.0f;
+  };
+
+  class DXMipGenerator
+  {
+   public:
+    DXMipGenerator() = default;
+
+    ~DXMipGenerator() {
+      release();
+    }
+
+    void
+    init(D3DDevice* pDevice, const DXDeviceCaps* pDeviceCaps);
+
+    void
+    release();
+
+    /**
+     * @brief True if mips of the format can be generated by generate().
+     */
+    bool
+    isSupported(DXGI_FORMAT format) const;
+
+    /**
+     * @brief Fills the mips 1..n of every slice from mip 0.
+     *        The compute shader state of the context is restored afterwards.
+     * @return False if the texture can't be processed (format without typed
+     *         UAV stores, multisampled, not DEFAULT usage or a single mip).
+     */
+    bool
+    generate(D3DDeviceContext* pContext,
+             ID3D11Texture2D* pTexture,
+             const MipGenerationDesc& desc = MipGenerationDesc());
+
+    /**
+     * @brief Releases the scratch textures that weren't used recently.
+     *        Called on present.
+     */
+    void
+    endFrame();
+
+    DXMipGenerator(const DXMipGenerator&) = delete;
+    DXMipGenerator&
+    operator=(const DXMipGenerator&) = delete;
+
+   private:
+    //Mip chain with the views the shaders use, per mip for every slice
+    struct MipTarget
+    {
+      ID3D11Texture2D* pTexture = nullptr;
+      Vector<ID3D11ShaderResourceView*> srvs;
+      Vector<ID3D11UnorderedAccessView*> uavs;
+    };
+
+    struct ScratchTexture
+    {
+      D3D11_TEXTURE2D_DESC desc;
+      DXGI_FORMAT srvFormat = DXGI_FORMAT_UNKNOWN;
+      DXGI_FORMAT uavFormat = DXGI_FORMAT_UNKNOWN;
+      MipTarget target;
+      uint64 lastUsedFrame = 0;
+    };
+
+    bool
+    _getViewFormats(DXGI_FORMAT format, DXGI_FORMAT& srvFormat, DXGI_FORMAT& uavFormat) const;
+
+    void
+    _createViews(MipTarget& target,
+                 const D3D11_TEXTURE2D_DESC& desc,
+                 DXGI_FORMAT srvFormat,
+                 DXGI_FORMAT uavFormat);
+
+    static void
+    _releaseTarget(MipTarget& target);
+
+    ScratchTexture&
+    _getScratch(const D3D11_TEXTURE2D_DESC& desc,
+                DXGI_FORMAT srvFormat,
+                DXGI_FORMAT uavFormat);
+
+    /**
+     * @param entryPoint One of the MIP_SHADER_ENTRY values of the source.
+     * @param npot Bit 0 if the source width is odd, bit 1 for the height.
+     */
+    ID3D11ComputeShader*
+    _getShader(uint32 entryPoint, uint32 filter, uint32 npot, bool bSRGB);
+
+    ID3D11UnorderedAccessView*
+    _getCoverageUAV(uint32 numCounters);
+
+    void
+    _setConstants(D3DDeviceContext* pContext, const void* pData, SIZE_T size);
+
+    bool
+    _generateMips(D3DDeviceContext* pContext,
+                  const MipTarget& target,
+                  const D3D11_TEXTURE2D_DESC& texDesc,
+                  const MipGenerationDesc& desc,
+                  bool bSRGB);
+
+    D3DDevice* m_pDevice = nullptr;
+    const DXDeviceCaps* m_pDeviceCaps = nullptr;
+
+    ID3D11Buffer* m_pConstants = nullptr;
+    ID3D11SamplerState* m_pBilinearClamp = nullptr;
+
+    //Histograms of the alpha coverage passes
+    ID3D11Buffer* m_pCoverage = nullptr;
+    ID3D11UnorderedAccessView* m_pCoverageUAV = nullptr;
+    uint32 m_coverageCounters = 0;
+
+    //Compiled on first use, keyed by entry point and variant
+    UnorderedMap<uint32, ID3D11ComputeShader*> m_shaders;
+
+    Vector<ScratchTexture> m_scratch;
+    uint64 m_frameNumber = 0;
+  };
+} // namespace geEngineSDK
@@ -0,0 +1,202 @@
+/*****************************************************************************/
+/**
+ * @file    DXReadbackQueue.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Asynchronous GPU to CPU readbacks.
+ *
+ * Copies GPU resources into pooled staging resources and tracks the copies
+ * with event queries so the data can be read frames later without stalling
+ * the CPU on a blocking Map.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include <functional>
+
+namespace geEngineSDK {
+
+  /**
+   * @brief Identifies a readback request. Zero is never a valid ticket.
+   */
+  using ReadbackTicket = uint64;
+  static constexpr ReadbackTicket INVALID_READBACK_TICKET = 0;
+
+  /**
+   * @brief Data of a completed readback. Only valid while it is mapped.
+   */
+  struct ReadbackData
+  {
+    const void* pData = nullptr;
+    uint32 rowPitch = 0;
+    uint32 depthPitch = 0;
+    uint32 width = 0;       //In texels for textures, in bytes for buffers
+    uint32 height = 0;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+  };
+
+  namespace READBACK_STATUS {
+    enum E {
+      kInvalid = 0,   //Unknown or already released ticket
+      kPending,       //The GPU hasn't finished the copy yet
+      kReady          //Data can be mapped without waiting
+    };
+  }
+
+  class DXReadbackQueue
+  {
+   public:
+    using ReadbackFn = std::function<void(const ReadbackData&)>;
+
+    /**
+     * @param frameLatency Frames to wait before polling the event query of a
+     *        request. Polling sooner would only report pending copies.
+     * @param framesToKeepUnused Frames a pooled staging resource may stay
+     *        unused before it is released.
+     */
+    explicit DXReadbackQueue(uint32 frameLatency = 2, uint32 framesToKeepUnused = 30)
+      : m_frameLatency(frameLatency),
+        m_framesToKeepUnused(framesToKeepUnused)
+    {}
+
+    ~DXReadbackQueue() {
+      release();
+    }
+
+    void
+    init(D3DDevice* pDevice, D3DDeviceContext* pContext);
+
+    /**
+     * @brief Releases pending requests and every pooled staging resource.
+     */
+    void
+    release();
+
+    /**
+     * @brief Queues a copy of a subresource of a texture or a buffer.
+     * @param pCallback If set, called from update() once the data is
+     *        available. The data is unmapped when the callback returns.
+     *        The callback can request and discard other readbacks.
+     *        Without callback poll with getStatus() and read with map().
+     */
+    ReadbackTicket
+    request(ID3D11Resource* pResource,
+            uint32 subResource = 0,
+            const ReadbackFn& pCallback = nullptr);
+
+    /**
+     * @brief Checks the queued copies and fires the callbacks of the ones
+     *        that completed. Called once per frame.
+     */
+    void
+    update();
+
+    READBACK_STATUS::E
+    getStatus(ReadbackTicket ticket);
+
+    /**
+     * @brief Maps the data of a request without waiting for the GPU.
+     * @return false if the copy hasn't completed yet.
+     */
+    bool
+    map(ReadbackTicket ticket, ReadbackData& outData);
+
+    /**
+     * @brief Unmaps (if needed) and discards a request, returning its
+     *        staging resource to the pool.
+     */
+    void
+    discard(ReadbackTicket ticket);
+
+    uint32
+    getNumPending() const {
+      return static_cast<uint32>(m_requests.size());
+    }
+
+   private:
+    struct StagingKey
+    {
+      D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+      uint32 width = 0;
+      uint32 height = 0;
+      DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+
+      bool
+      operator==(const StagingKey& other) const {
+        return dimension == other.dimension &&
+               width == other.width &&
+               height == other.height &&
+               format == other.format;
+      }
+    };
+
+    struct StagingResource
+    {
+      StagingKey key;
+      ID3D11Resource* pResource = nullptr;
+      uint64 lastUsedFrame = 0;
+      bool bInUse = false;
+    };
+
+    struct Request
+    {
+      ReadbackTicket ticket = INVALID_READBACK_TICKET;
+      ReadbackFn pCallback;
+      ID3D11Query* pQuery = nullptr;
+      ID3D11Resource* pStaging = nullptr;
+      ReadbackData info;    //Size and format of the copied data
+      uint64 issueFrame = 0;
+      bool bReady = false;
+      bool bMapped = false;
+    };
+
+    ID3D11Resource*
+    _acquireStaging(const StagingKey& key);
+
+    ID3D11Query*
+    _acquireQuery();
+
+    bool
+    _poll(Request& request);
+
+    bool
+    _map(Request& request, ReadbackData& outData);
+
+    /**
+     * @brief Recycles the resources of a request and removes it.
+     */
+    void
+    _retire(uint32 requestIndex);
+
+    /**
+     * @brief Unmaps the staging resource of a request and returns it and the
+     *        query to their pools.
+     */
+    void
+    _recycle(Request& req);
+
+    Request*
+    _find(ReadbackTicket ticket, uint32* pOutIndex = nullptr);
+
+    D3DDevice* m_pDevice = nullptr;
+    D3DDeviceContext* m_pContext = nullptr;
+
+    uint32 m_frameLatency;
+    uint32 m_framesToKeepUnused;
+    uint64 m_frameIndex = 0;
+    ReadbackTicket m_nextTicket = 1;
+
+    Vector<Request> m_requests;           //In submission order
+    Vector<StagingResource> m_staging;
+    Vector<ID3D11Query*> m_freeQueries;
+  };
+
+} // namespace geEngineSDK
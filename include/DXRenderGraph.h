@@ -0,0 +1,280 @@
+/*****************************************************************************/
+/**
+ * @file    DXRenderGraph.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Frame graph that schedules passes and transient render targets.
+ *
+ * Passes declare which textures they read and write. On compile the graph
+ * culls the passes that don't contribute to an imported/exported texture,
+ * computes the lifetime of every transient texture and maps transients with
+ * non-overlapping lifetimes and compatible descriptions onto the same
+ * physical texture.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include <geRenderAPI.h>
+#include <functional>
+
+namespace geEngineSDK {
+
+  /**
+   * @brief Handle to a texture declared in the render graph.
+   */
+  using RGTextureHandle = uint32;
+  static constexpr RGTextureHandle RG_INVALID_HANDLE = NumLimit::MAX_UINT32;
+
+  /**
+   * @brief Description of a transient texture. Two transients can share the
+   *        same physical texture only if their descriptions are equal.
+   */
+  struct RGTextureDesc
+  {
+    uint32 width = 0;
+    uint32 height = 0;
+    GRAPHICS_FORMAT::E format = GRAPHICS_FORMAT::kR8G8B8A8_UNORM;
+    uint32 bindFlags = BIND_FLAG::SHADER_RESOURCE | BIND_FLAG::RENDER_TARGET;
+    uint32 mipLevels = 1;
+    uint32 sampleCount = 1;
+
+    bool
+    operator==(const RGTextureDesc& other) const {
+      return width == other.width &&
+             height == other.height &&
+             format == other.format &&
+             bindFlags == other.bindFlags &&
+             mipLevels == other.mipLevels &&
+             sampleCount == other.sampleCount;
+    }
+  };
+
+  class DXRenderGraph
+  {
+   public:
+    /**
+     * @brief Used by the setup function of a pass to declare its resources.
+     */
+    class PassBuilder
+    {
+     public:
+      /**
+       * @brief Declares a new transient texture written by this pass. The
+       *        write is recorded here, the pass doesn't need to declare it.
+       */
+      RGTextureHandle
+      create(const String& name, const RGTextureDesc& desc);
+
+      /**
+       * @brief Declares that the pass samples/reads the texture.
+       */
+      RGTextureHandle
+      read(RGTextureHandle handle);
+
+      /**
+       * @brief Declares that the pass writes the texture as a color target.
+       *        The graph binds all color targets and the depth target of a
+       *        pass before calling its execute function.
+       */
+      RGTextureHandle
+      writeRenderTarget(RGTextureHandle handle, uint32 mipLevel = 0);
+
+      /**
+       * @brief Declares that the pass writes the texture as depth/stencil.
+       */
+      RGTextureHandle
+      writeDepthStencil(RGTextureHandle handle);
+
+      /**
+       * @brief Declares a write that is not a render target (e.g. a UAV).
+       */
+      RGTextureHandle
+      write(RGTextureHandle handle);
+
+      /**
+       * @brief Marks the pass as having effects outside the graph so it is
+       *        never culled.
+       */
+      void
+      setSideEffect();
+
+     private:
+      friend class DXRenderGraph;
+
+      PassBuilder(DXRenderGraph& graph, uint32 passIndex)
+        : m_graph(graph),
+          m_passIndex(passIndex)
+      {}
+
+      DXRenderGraph& m_graph;
+      uint32 m_passIndex;
+    };
+
+    /**
+     * @brief Gives the execute function of a pass access to the physical
+     *        textures assigned to its declared resources.
+     */
+    class PassResources
+    {
+     public:
+      const SPtr<Texture>&
+      getTexture(RGTextureHandle handle) const;
+
+     private:
+      friend class DXRenderGraph;
+
+      explicit PassResources(const DXRenderGraph& graph)
+        : m_graph(graph)
+      {}
+
+      const DXRenderGraph& m_graph;
+    };
+
+    using SetupFn = std::function<void(PassBuilder&)>;
+    using ExecuteFn = std::function<void(RenderAPI&, const PassResources&)>;
+
+    /**
+     * @brief Memory statistics of the last compiled frame.
+     */
+    struct Stats
+    {
+      uint32 numPasses = 0;
+      uint32 numCulledPasses = 0;
+      uint32 numTransients = 0;
+      uint32 numPhysicalTextures = 0;
+      SIZE_T transientBytes = 0;  //Memory required without aliasing
+      SIZE_T physicalBytes = 0;   //Memory actually used by the pool
+    };
+
+    /**
+     * @param framesToKeepUnused Number of frames a pooled physical texture
+     *        may stay unused before it is released.
+     */
+    explicit DXRenderGraph(RenderAPI& renderAPI, uint32 framesToKeepUnused = 3)
+      : m_renderAPI(renderAPI),
+        m_framesToKeepUnused(framesToKeepUnused)
+    {}
+
+    /**
+     * @brief Makes an externally owned texture (e.g. the back buffer) visible
+     *        to the graph. Imported textures are never aliased.
+     */
+    RGTextureHandle
+    importTexture(const String& name, const SPtr<Texture>& pTexture);
+
+    /**
+     * @brief Marks a texture as an output of the graph. Passes that
+     *        contribute to it are kept alive by the culling step.
+     */
+    void
+    exportTexture(RGTextureHandle handle);
+
+    void
+    addPass(const String& name, const SetupFn& setup, const ExecuteFn& execute);
+
+    /**
+     * @brief Culls unused passes, computes lifetimes and assigns physical
+     *        textures from the pool.
+     */
+    void
+    compile();
+
+    /**
+     * @brief Runs the surviving passes in declaration order.
+     */
+    void
+    execute();
+
+    /**
+     * @brief Clears the passes and resources of the frame. The physical
+     *        texture pool is kept for the next frame.
+     */
+    void
+    reset();
+
+    /**
+     * @brief Releases every pooled physical texture.
+     */
+    void
+    releasePool();
+
+    const Stats&
+    getStats() const {
+      return m_stats;
+    }
+
+   private:
+    struct RenderTargetWrite
+    {
+      RGTextureHandle handle;
+      uint32 mipLevel;
+    };
+
+    struct Pass
+    {
+      String name;
+      ExecuteFn execute;
+      Vector<RGTextureHandle> reads;
+      Vector<RGTextureHandle> writes;
+      Vector<RenderTargetWrite> colorTargets;
+      RGTextureHandle depthTarget = RG_INVALID_HANDLE;
+      Vector<RGTextureHandle> toDiscard;  //Transients whose first use is here
+      uint32 refCount = 0;
+      bool bSideEffect = false;
+      bool bCulled = false;
+    };
+
+    struct Resource
+    {
+      String name;
+      RGTextureDesc desc;
+      SPtr<Texture> pTexture;  //Set on import or on physical assignment
+      uint32 producer = NumLimit::MAX_UINT32;
+      uint32 refCount = 0;
+      uint32 firstPass = NumLimit::MAX_UINT32;
+      uint32 lastPass = 0;
+      uint32 physicalIndex = NumLimit::MAX_UINT32;
+      bool bImported = false;
+      bool bExported = false;
+    };
+
+    struct PooledTexture
+    {
+      RGTextureDesc desc;
+      SPtr<Texture> pTexture;
+      uint64 lastUsedFrame = 0;
+      bool bInUse = false;
+    };
+
+    void
+    _cullPasses();
+
+    void
+    _computeLifetimes();
+
+    void
+    _assignPhysicalTextures();
+
+    uint32
+    _acquirePhysical(const RGTextureDesc& desc);
+
+    RenderAPI& m_renderAPI;
+    uint32 m_framesToKeepUnused;
+    uint64 m_frameIndex = 0;
+    bool m_bCompiled = false;
+
+    Vector<Pass> m_passes;
+    Vector<Resource> m_resources;
+    Vector<PooledTexture> m_pool;
+    Stats m_stats;
+  };
+
+} // namespace geEngineSDK
@@ -18,10 +18,51 @@
  */
 /*****************************************************************************/
 #include "gePrerequisitesRenderAPIDX11.h"
+#include "DXMappedFile.h"
 #include <geShader.h>
 
 namespace geEngineSDK {
 
+  /**
+   * @brief Program type in the version token of the SHDR/SHEX chunk of a
+   *        DXBC container.
+   */
+  namespace DXBC_PROGRAM_TYPE {
+    enum E {
+      kPixel = 0,
+      kVertex,
+      kGeometry,
+      kHull,
+      kDomain,
+      kCompute,
+      kUnknown
+    };
+  }
+
+  /**
+   * @brief What the shaders keep of their bytecode once they are created.
+   */
+  namespace SHADER_BYTECODE_MODE {
+    enum E {
+      kKeep = 0,    //The whole blob, debug info and reflection included
+      kStrip,       //The blob without debug info and reflection (D3DStripShader)
+      kRelease      //Only the input signature of the vertex shaders
+    };
+  }
+
+  /**
+   * @brief Input parameter of a vertex shader, the part of the reflection
+   *        createInputLayoutFromShader reads.
+   */
+  struct DXShaderInputParameter
+  {
+    String semanticName;
+    uint32 semanticIndex;
+    uint32 stream;
+    D3D_REGISTER_COMPONENT_TYPE componentType;
+    uint8 mask;
+  };
+
   class DXShader : public Shader
   {
    public:
@@ -34,14 +75,19 @@ namespace geEngineSDK {
     void
     setDebugName(const String& name) override;
 
+    /**
+     * @brief Loads precompiled bytecode (a .cso file). The file is mapped
+     *        and the stage is read from the DXBC container, so the shader
+     *        compiler isn't involved. The shader keeps the mapping, the
+     *        bytecode isn't copied.
+     */
     bool
-    load(const Path& filePath) override {
-      GE_UNREFERENCED_PARAMETER(filePath);
-      return false;
-    }
+    load(const Path& filePath) override;
 
     void
-    unload() override {}
+    unload() override {
+      release();
+    }
 
     bool
     isLoaded() const override {
@@ -53,16 +99,120 @@ namespace geEngineSDK {
       return m_debugName;
     }
 
+    /**
+     * @brief System memory the shader holds: its blob, the input signature
+     *        and the reflected inputs. Mapped bytecode (a loaded file or the
+     *        shader archive) is part of the mapping and isn't counted.
+     *        The driver keeps its own compiled copy.
+     */
+    SIZE_T
+    getMemoryUsage() const override;
+
+    /**
+     * @brief Bytecode the shader was created from: its blob, or the mapping
+     *        of the file or shader archive it was loaded from.
+     */
+    const void*
+    getBytecode() const {
+      return m_pBlob ? m_pBlob->GetBufferPointer() : m_pArchiveBytecode;
+    }
+
+    SIZE_T
+    getBytecodeSize() const {
+      return m_pBlob ? m_pBlob->GetBufferSize() : m_archiveBytecodeSize;
+    }
+
+    /**
+     * @brief What CreateInputLayout validates the layouts against: the input
+     *        signature kept when the bytecode was released, or the bytecode.
+     */
+    const void*
+    getInputSignature() const {
+      return m_pInputSignature ? m_pInputSignature->GetBufferPointer() : getBytecode();
+    }
+
     SIZE_T
-    getMemoryUsage() const override {
-      return 0;
+    getInputSignatureSize() const {
+      return m_pInputSignature ? m_pInputSignature->GetBufferSize() : getBytecodeSize();
     }
 
+    /**
+     * @brief Inputs of a vertex shader, valid after _reflectInputs().
+     */
+    const Vector<DXShaderInputParameter>&
+    getInputParameters() const {
+      return m_inputParameters;
+    }
+
+    DXBC_PROGRAM_TYPE::E
+    getProgramType() const {
+      return m_programType;
+    }
+
+    /**
+     * @brief Stage of a DXBC container, kUnknown if the bytecode isn't valid.
+     */
+    static DXBC_PROGRAM_TYPE::E
+    getProgramType(const void* pBytecode, SIZE_T size);
+
+    /**
+     * @brief Replaces the shader with one created from the bytecode, for the
+     *        stage the bytecode was compiled for. The bytecode isn't copied,
+     *        the shader keeps a reference to the mapping it is in.
+     * @param name Reported in the errors.
+     */
+    bool
+    _createFromBytecode(D3DDevice* pDevice,
+                        const SPtr<DXMappedFile>& pMapping,
+                        const void* pBytecode,
+                        SIZE_T size,
+                        const String& name);
+
+    /**
+     * @brief Device load() creates the shaders on. The render API sets it
+     *        when it starts and clears it when it shuts down.
+     */
+    static void
+    _setLoadDevice(D3DDevice* pDevice);
+
+    /**
+     * @brief Reflects the inputs of the vertex shader, once. It needs the
+     *        reflection data of the bytecode.
+     */
+    bool
+    _reflectInputs();
+
+    /**
+     * @brief Strips or releases the bytecode of the created shader, as the
+     *        bytecode mode says. The inputs of a vertex shader are reflected
+     *        first, and its input signature kept if the bytecode goes.
+     */
+    void
+    _compactBytecode();
+
+    /**
+     * @brief Set by the render API from RenderAPI.ShaderBytecode.
+     */
+    static void
+    _setBytecodeMode(SHADER_BYTECODE_MODE::E mode);
+
    protected:
     friend class DX11RenderAPI;
 
     ID3D11DeviceChild* m_pShader = nullptr;
     ID3DBlob* m_pBlob = nullptr;  //Saved in this to be able to reflect and decompile
+    DXBC_PROGRAM_TYPE::E m_programType = DXBC_PROGRAM_TYPE::kUnknown;
+
+    //In a mapped file (a .cso or the shader archive), kept while the shader
+    //points in it
+    SPtr<DXMappedFile> m_pArchiveMapping;
+    const void* m_pArchiveBytecode = nullptr;
+    SIZE_T m_archiveBytecodeSize = 0;
+
+    //What the input layouts need once the bytecode is stripped or released
+    ID3DBlob* m_pInputSignature = nullptr;
+    Vector<DXShaderInputParameter> m_inputParameters;
+    bool m_bInputsReflected = false;
   };
   
 }
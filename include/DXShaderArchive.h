@@ -0,0 +1,138 @@
+/*****************************************************************************/
+/**
+ * @file    DXShaderArchive.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Single file archive of precompiled shaders.
+ *
+ * The archive replaces the hundreds of bytecode files a shipping build
+ * would otherwise read. It is mapped whole and never copied, the shaders
+ * created from it share the mapping (see getMapping):
+ *
+ * - A header with the number of shaders.
+ * - The index, one entry per shader sorted by key: a lookup is a binary
+ *   search over the mapping.
+ * - The bytecode of every shader, aligned to ALIGNMENT bytes.
+ *
+ * The key is a 64 bit hash of what identifies a compilation: the source
+ * file, the entry point, the shader model and the macros. The archives are
+ * written by geShaderPacker from a manifest with one shader per line:
+ *
+ *   <source file> <entry point> <shader model> [NAME[=VALUE] ...]
+ *
+ * Empty lines and the ones starting with # are skipped.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include "DXMappedFile.h"
+
+#include <geRenderAPI.h>
+
+namespace geEngineSDK {
+
+  /**
+   * @brief A shader of an archive manifest.
+   */
+  struct ShaderArchiveSource
+  {
+    Path fileName;
+    String entryPoint;
+    String shaderModel;
+    Vector<ShaderMacro> macros;
+  };
+
+  struct ShaderArchiveEntry
+  {
+    uint64 key;
+    uint32 offset;    //From the start of the file
+    uint32 size;
+  };
+
+  class DXShaderArchive
+  {
+   public:
+    static constexpr uint32 MAGIC = 0x41534547;   //"GESA"
+    static constexpr uint32 VERSION = 1;
+    static constexpr uint32 ALIGNMENT = 16;
+
+    /**
+     * @brief Maps an archive and validates its index. Errors are logged.
+     */
+    bool
+    open(const Path& filePath);
+
+    /**
+     * @brief Drops the reference of the archive to the mapping. It stays
+     *        mapped until the shaders that point inside it are released.
+     */
+    void
+    close();
+
+    bool
+    isOpen() const {
+      return nullptr != m_pEntries;
+    }
+
+    uint32
+    getNumShaders() const {
+      return m_numEntries;
+    }
+
+    /**
+     * @brief Bytecode of a shader, in the mapping.
+     * @return nullptr if the archive doesn't have it.
+     */
+    const uint8*
+    find(uint64 key, SIZE_T& size) const;
+
+    /**
+     * @brief The mapping find points into. Whoever keeps the bytecode past
+     *        close() must keep a reference to it too.
+     */
+    const SPtr<DXMappedFile>&
+    getMapping() const {
+      return m_pFile;
+    }
+
+    /**
+     * @brief Key of a compilation. The separators of the path and the case
+     *        of its letters don't change it, the order of the macros does.
+     */
+    static uint64
+    makeKey(const Path& fileName,
+            const Vector<ShaderMacro>& macros,
+            const String& entryPoint,
+            const String& shaderModel);
+
+    /**
+     * @brief Writes an archive. The entries are sorted here, the offsets are
+     *        the ones of the blobs in the file.
+     * @param blobs Bytecode of each entry, in the order of the entries.
+     */
+    static bool
+    write(const Path& filePath,
+          Vector<ShaderArchiveEntry> entries,
+          const Vector<const void*>& blobs);
+
+    /**
+     * @brief Reads the shaders of a manifest. Errors are logged with their
+     *        line.
+     */
+    static bool
+    readManifest(const Path& filePath, Vector<ShaderArchiveSource>& sources);
+
+   private:
+    SPtr<DXMappedFile> m_pFile;
+    const ShaderArchiveEntry* m_pEntries = nullptr;
+    uint32 m_numEntries = 0;
+  };
+} // namespace geEngineSDK
@@ -19,12 +19,20 @@
 /*****************************************************************************/
 #include <gePrerequisitesRenderAPIDX11.h>
 #include <geTexture.h>
+#include <geNumericLimits.h>
 
 namespace geEngineSDK {
-  
+  class DXDDSFile;
+
   class DXTexture : public Texture
   {
    public:
+    /**
+     * @brief Used as a mip or slice count to select every remaining one.
+     */
+    static constexpr uint32 ALL_MIPS = NumLimit::MAX_UINT32;
+    static constexpr uint32 ALL_SLICES = NumLimit::MAX_UINT32;
+
     DXTexture() = default;
     virtual ~DXTexture();
 
@@ -43,18 +51,21 @@ namespace geEngineSDK {
     /*************************************************************************/
     // Implementation of the Resource Interface
     /*************************************************************************/
+    /**
+     * @brief Loads a DDS file into an immutable texture. The subresources
+     *        are read from a mapping of the file, without copies.
+     */
     bool
-    load(const Path& filePath) override {
-      GE_UNREFERENCED_PARAMETER(filePath);
-      return false;
-    }
+    load(const Path& filePath) override;
 
     void
-    unload() override {}
+    unload() override {
+      release();
+    }
 
     bool
     isLoaded() const override {
-      return false;
+      return nullptr != m_pTexture;
     }
 
     const String&
@@ -69,13 +80,100 @@ namespace geEngineSDK {
     SIZE_T
     getMemoryUsage() const override;
 
+    /**
+     * @brief Bytes of a texture with the given description: every mip of
+     *        every array slice (cube faces included) times the sample
+     *        count. Block compressed formats are counted per 4x4 block.
+     */
+    static SIZE_T
+    computeMemoryUsage(const D3D11_TEXTURE2D_DESC& desc);
+
     void
     _setDesc(D3D11_TEXTURE2D_DESC& desc);
 
+    /**
+     * @brief Replaces the texture with the one of a parsed DDS file. The old
+     *        texture is kept if the new one can't be created.
+     */
+    bool
+    _createFromDDS(D3DDevice* pDevice, const DXDDSFile& file);
+
+    /**
+     * @brief Device load() creates the textures on. The render API sets it
+     *        when it starts and clears it when it shuts down.
+     */
+    static void
+    _setLoadDevice(D3DDevice* pDevice);
+
     void*
     _getGraphicsResource() const override;
-    
+
+    /*************************************************************************/
+    // Views
+    // Views are created the first time they are requested and cached until
+    // the texture is released.
+    /*************************************************************************/
+
+    /**
+     * @brief Returns a shader resource view of a range of the texture.
+     * @param mostDetailedMip First mip level visible through the view.
+     * @param numMips Number of mip levels, ALL_MIPS for the rest of the chain.
+     * @param firstSlice First array slice visible through the view.
+     * @param numSlices Number of array slices, ALL_SLICES for the rest.
+     * @return The view, or nullptr if the texture can't be sampled.
+     */
+    D3DShaderResourceView*
+    _getSRV(uint32 mostDetailedMip = 0,
+            uint32 numMips = ALL_MIPS,
+            uint32 firstSlice = 0,
+            uint32 numSlices = ALL_SLICES);
+
+    /**
+     * @brief Returns the render target view of a mip level.
+     * @param mipSlice Mip level to render to.
+     * @param firstSlice First array slice. For cube maps slice = cube * 6 + face.
+     * @param numSlices Number of slices. The default view covers the whole
+     *        array so a single pass can select the slice with
+     *        SV_RenderTargetArrayIndex.
+     */
+    D3DRenderTargetView*
+    _getRTV(uint32 mipSlice = 0,
+            uint32 firstSlice = 0,
+            uint32 numSlices = ALL_SLICES);
+
+    /**
+     * @brief Returns the unordered access view of a mip level and slice range.
+     */
+    D3DUnorderedAccessView*
+    _getUAV(uint32 mipSlice = 0,
+            uint32 firstSlice = 0,
+            uint32 numSlices = ALL_SLICES);
+
+    /**
+     * @brief Returns the depth stencil view of the texture.
+     * @param bReadOnly If true returns the view that allows the texture to be
+     *        depth tested and sampled at the same time.
+     * @param firstSlice First array slice (e.g. a shadow cascade or cube face).
+     * @param numSlices Number of slices, ALL_SLICES for layered rendering.
+     */
+    D3DDepthStencilView*
+    _getDSV(bool bReadOnly = false,
+            uint32 firstSlice = 0,
+            uint32 numSlices = ALL_SLICES);
+
    private:
+    /**
+     * @brief Stores what is needed to create the views on demand.
+     */
+    void
+    _initViews(D3DDevice* pDevice,
+               DXGI_FORMAT viewFormat,
+               DXGI_FORMAT srvFormat,
+               DXGI_FORMAT dsvFormat);
+
+    void
+    _releaseViews();
+
 #if USING(GE_DEBUG_MODE)
     String m_debugName;
 #endif
@@ -84,11 +182,24 @@ namespace geEngineSDK {
     friend class DX11RenderAPI;
 
     D3DTexture2D* m_pTexture = nullptr;
+    D3DDevice* m_pDevice = nullptr;
+
+    //Formats used to create the views of the resource
+    DXGI_FORMAT m_viewFormat = DXGI_FORMAT_UNKNOWN;
+    DXGI_FORMAT m_srvFormat = DXGI_FORMAT_UNKNOWN;
+    DXGI_FORMAT m_dsvFormat = DXGI_FORMAT_UNKNOWN;
+
     D3DDepthStencilView* m_pDSV = nullptr;
     D3DDepthStencilView* m_pRO_DSV = nullptr;
-    
-    Vector<D3DShaderResourceView*> m_ppSRV;
-    Vector<D3DRenderTargetView*> m_ppRTV;
-    Vector<D3DUnorderedAccessView*> m_ppUAV;
+
+    D3DShaderResourceView* m_pSRV = nullptr;                      //Whole resource
+    UnorderedMap<uint64, D3DShaderResourceView*> m_srvRanges;     //Sub-ranges
+    Vector<D3DRenderTargetView*> m_ppRTV;                         //Per mip
+    Vector<D3DUnorderedAccessView*> m_ppUAV;                      //Per mip
+
+    //Views of a subset of the array slices / cube faces
+    UnorderedMap<uint64, D3DRenderTargetView*> m_rtvRanges;
+    UnorderedMap<uint64, D3DUnorderedAccessView*> m_uavRanges;
+    UnorderedMap<uint64, D3DDepthStencilView*> m_dsvRanges;
   };
 } // namespace geEngineSDK
@@ -0,0 +1,216 @@
+/*****************************************************************************/
+/**
+ * @file    DXTimelineCapture.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU and GPU timeline of a few frames in Chrome trace format.
+ *
+ * While a capture is running the render API records its entry points
+ * (resource creation, shader compiles, uploads, maps, present) as CPU
+ * scopes, and the GPU scopes of the captured frames are added when the
+ * profiler resolves them. GPU timestamps are moved to the CPU clock with a
+ * calibration taken at the start of the capture, so both tracks line up.
+ * The file is a Chrome trace-event JSON that chrome://tracing and the
+ * Perfetto UI open directly.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+#include "DXGPUProfiler.h"
+
+namespace geEngineSDK {
+
+  class DXTimelineCapture
+  {
+   public:
+    /**
+     * @param maxGPUWaitFrames Frames to wait after the last captured frame
+     *        for its GPU scopes before writing the file without them.
+     */
+    explicit DXTimelineCapture(uint32 maxGPUWaitFrames = 8)
+      : m_maxGPUWaitFrames(maxGPUWaitFrames)
+    {}
+
+    /**
+     * @brief Registers on the profiler to receive the resolved frames.
+     */
+    void
+    init(DXGPUProfiler* pProfiler);
+
+    /**
+     * @brief Writes a capture in progress with the frames recorded so far.
+     */
+    void
+    release();
+
+    /**
+     * @brief Captures numFrames frames after skipping framesToSkip presents.
+     */
+    void
+    start(const Path& filePath, uint32 numFrames, uint32 framesToSkip = 0);
+
+    /**
+     * @brief Closes the current frame. Called on present after the
+     *        profiler opened the next frame.
+     */
+    void
+    endFrame();
+
+    /**
+     * @brief CPU events are only recorded while this is true.
+     */
+    bool
+    isCapturing() const {
+      return m_bCapturing;
+    }
+
+    /**
+     * @brief Capture started and the file isn't written yet.
+     */
+    bool
+    isActive() const {
+      return m_bArmed || m_bCapturing || m_bWaitingGPU;
+    }
+
+    /**
+     * @brief Current value of the CPU clock used by the timeline.
+     */
+    static uint64
+    now();
+
+    /**
+     * @param name Must stay valid until the capture is written (use literals).
+     * @param args Body of a JSON object (e.g. "\"bytes\":256"), may be empty.
+     */
+    void
+    addScope(const char* name,
+             const char* category,
+             uint64 beginTick,
+             uint64 endTick,
+             String args = String());
+
+    void
+    addInstant(const char* name, const char* category, String args = String());
+
+    /**
+     * @brief Counter track, every member of args is drawn as a series.
+     */
+    void
+    addCounter(const char* name, String args);
+
+    /**
+     * @brief Escapes a string to be used as a JSON value.
+     */
+    static String
+    escape(const String& value);
+
+   private:
+    struct TimelineEvent
+    {
+      const char* name = nullptr;
+      const char* category = nullptr;
+      char phase = 'X';             //X: complete, i: instant, C: counter
+      uint32 pid = 0;
+      uint32 tid = 0;
+      int64 beginTick = 0;          //CPU clock
+      int64 durationTicks = 0;
+      String args;
+    };
+
+    void
+    _onGPUFrameResolved(uint64 frameNumber,
+                        const Vector<GPUScopeResult>& scopes,
+                        uint64 frequency);
+
+    void
+    _beginCapture();
+
+    void
+    _finishCapture();
+
+    bool
+    _write() const;
+
+    DXGPUProfiler* m_pProfiler = nullptr;
+    uint32 m_maxGPUWaitFrames;
+
+    Path m_filePath;
+    uint32 m_numFrames = 0;
+    uint32 m_framesToSkip = 0;
+    uint32 m_framesLeft = 0;
+    uint32 m_waitFramesLeft = 0;
+    bool m_bArmed = false;          //Waiting for the first frame
+    bool m_bCapturing = false;
+    bool m_bWaitingGPU = false;     //CPU done, GPU scopes still to come
+
+    uint64 m_cpuFrequency = 1;
+    GPUClockCalibration m_calibration;
+    bool m_bCalibrated = false;
+    uint64 m_startTick = 0;
+    uint64 m_frameBeginTick = 0;
+    uint64 m_firstGPUFrame = 0;
+    uint64 m_lastGPUFrame = 0;
+    uint64 m_frameIndex = 0;
+
+    Vector<TimelineEvent> m_events;
+  };
+
+  /**
+   * @brief Records a CPU scope on the timeline for the lifetime of the
+   *        object. Costs a branch while no capture is running.
+   */
+  class TimelineScope
+  {
+   public:
+    TimelineScope(DXTimelineCapture& capture,
+                  const char* name,
+                  const char* category = "RenderAPI")
+      : m_capture(capture),
+        m_name(name),
+        m_category(category),
+        m_beginTick(capture.isCapturing() ? DXTimelineCapture::now() : 0)
+    {}
+
+    ~TimelineScope() {
+      if (m_beginTick) {
+        m_capture.addScope(m_name,
+                           m_category,
+                           m_beginTick,
+                           DXTimelineCapture::now(),
+                           std::move(m_args));
+      }
+    }
+
+    /**
+     * @brief Only build the arguments when this is true.
+     */
+    bool
+    isActive() const {
+      return 0 != m_beginTick;
+    }
+
+    void
+    setArgs(String args) {
+      m_args = std::move(args);
+    }
+
+    TimelineScope(const TimelineScope&) = delete;
+    TimelineScope&
+    operator=(const TimelineScope&) = delete;
+
+   private:
+    DXTimelineCapture& m_capture;
+    const char* m_name;
+    const char* m_category;
+    uint64 m_beginTick;
+    String m_args;
+  };
+} // namespace geEngineSDK
@@ -6,6 +6,93 @@ namespace geEngineSDK {
 
   namespace TranslateUtils {
     
+    namespace FORMAT_TYPE {
+      enum E {
+        kUnknown = 0,
+        kTypeless,
+        kUNorm,
+        kSNorm,
+        kUInt,
+        kSInt,
+        kFloat,
+        kSharedExp,
+        kDepthStencil,  //Depth and stencil in different representations
+        kVideo,
+        kOpaque
+      };
+    }
+
+    namespace FORMAT_FLAG {
+      enum E {
+        kCompressed = 1 << 0, //BC1-BC7, stored in 4x4 blocks
+        kDepth = 1 << 1,
+        kStencil = 1 << 2,
+        kSRGB = 1 << 3,
+        kTypeless = 1 << 4,
+        kVideo = 1 << 5,
+        kPlanar = 1 << 6,     //Luma and chroma in separate planes
+        kPacked = 1 << 7,     //Two pixels share their chroma (4:2:2)
+        kPalette = 1 << 8
+      };
+    }
+
+    /**
+     * @brief Description of a DXGI_FORMAT. Formats are stored in blocks of
+     *        blockWidth x blockHeight pixels (1x1 for the plain formats),
+     *        a block of a planar format counts the bytes of all its planes.
+     */
+    struct FormatInfo
+    {
+      DXGI_FORMAT format;
+      const char* name;           //Without the DXGI_FORMAT_ prefix
+      uint32 bitsPerPixel;        //Average for block and planar formats
+      uint32 blockWidth;
+      uint32 blockHeight;
+      uint32 bytesPerBlock;
+      const char* channels;       //Components in memory order (e.g. "BGRA")
+      uint32 numChannels;
+      FORMAT_TYPE::E type;
+      DXGI_FORMAT typelessFormat; //Family the views can be created from
+      DXGI_FORMAT srgbFormat;     //sRGB version, or the linear one for sRGB
+      uint32 flags;
+
+      bool
+      hasFlag(FORMAT_FLAG::E flag) const {
+        return 0 != (flags & flag);
+      }
+
+      bool
+      isDepthStencil() const {
+        return 0 != (flags & (FORMAT_FLAG::kDepth | FORMAT_FLAG::kStencil));
+      }
+    };
+
+    /**
+     * @brief Returns the description of a format. Values DXGI doesn't define
+     *        get the description of DXGI_FORMAT_UNKNOWN.
+     */
+    const FormatInfo&
+    getFormatInfo(DXGI_FORMAT format);
+
+    /**
+     * @brief Bytes of a row of blocks of the given width.
+     */
+    SIZE_T
+    getRowPitch(DXGI_FORMAT format, uint32 width);
+
+    /**
+     * @brief Rows of blocks of the given height.
+     */
+    uint32
+    getNumRows(DXGI_FORMAT format, uint32 height);
+
+    /**
+     * @brief Exact size in bytes of a width x height surface, without padding
+     *        between the rows.
+     */
+    SIZE_T
+    getSurfaceSize(DXGI_FORMAT format, uint32 width, uint32 height);
+
     /**
      * @brief Converts a GRAPHICS_FORMAT::E value to the corresponding DXGI_FORMAT value.
      * @param inFormat The input texture format to convert.
@@ -26,9 +113,9 @@ namespace geEngineSDK {
      * @brief Converts a string representation of a format to its corresponding
      *        DXGI_FORMAT enumeration value.
      * @param strFormat The string containing the format to convert.
-     * @return The DXGI_FORMAT value corresponding to the provided string.
-     *         If the string does not match a known format, a default or
-     *         unknown value may be returned.
+     * @return The DXGI_FORMAT value corresponding to the provided string
+     *         (the name without the DXGI_FORMAT_ prefix), or
+     *         DXGI_FORMAT_UNKNOWN if the string does not match a format.
      */
     DXGI_FORMAT
     fromString(const String& strFormat);
@@ -44,11 +131,18 @@ namespace geEngineSDK {
     /**
      * @brief Returns the number of bits per pixel for a given DXGI_FORMAT value.
      * @param format The DXGI_FORMAT value specifying the pixel format.
-     * @return The number of bits per pixel for the specified format.
+     * @return The number of bits per pixel for the specified format, the
+     *         average over a block for compressed, packed and planar formats.
      */
     SIZE_T
     getBitsPerPixel(const DXGI_FORMAT& format);
 
+    /**
+     * @brief Checks if the format is stored in 4x4 compressed blocks (BC1-BC7).
+     */
+    bool
+    isBlockCompressed(const DXGI_FORMAT& format);
+
     /**
      * @brief Converts a VERTEX_ELEMENT_SEMANTIC::E value to its string representation.
      * @param sem The vertex element semantic to convert.
@@ -77,14 +171,16 @@ namespace geEngineSDK {
 
     /**
      * @brief Retrieves the enumeration value corresponding to a given vertex
-     *        element semantic name.
+     *        element semantic name. The match ignores the case, and a
+     *        numeric suffix is read as the semantic index ("TEXCOORD1").
      * @param sem A pointer to a null-terminated string representing the
      *        semantic name.
+     * @param pSemanticIndex Receives the index of the suffix (0 without one).
      * @return The enumeration value of type VERTEX_ELEMENT_SEMANTIC::E that
-     *         matches the provided semantic name.
+     *         matches the provided semantic name, POSITION if none does.
      */
     VERTEX_ELEMENT_SEMANTIC::E
-    get(const char* sem);
+    get(const char* sem, uint32* pSemanticIndex = nullptr);
 
   }
 }
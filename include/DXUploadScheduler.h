@@ -0,0 +1,217 @@
+/*****************************************************************************/
+/**
+ * @file    DXUploadScheduler.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Spreads texture and buffer uploads over several frames.
+ *
+ * Uploads are queued with a copy of their data and issued once per frame in
+ * chunks of rows (or bytes for buffers) through a persistent pool of staging
+ * resources, never exceeding a configurable number of bytes per frame.
+ *
+ * The pool is bounded: once it's full the least recently used staging
+ * resource is rewritten, waiting for the GPU if it still reads it.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "gePrerequisitesRenderAPIDX11.h"
+
+namespace geEngineSDK {
+
+  /**
+   * @brief Identifies an upload. Tokens grow monotonically, zero is invalid.
+   */
+  using UploadToken = uint64;
+  static constexpr UploadToken INVALID_UPLOAD_TOKEN = 0;
+
+  class DXUploadScheduler
+  {
+   public:
+    /**
+     * @param bytesPerFrame Maximum bytes copied to the GPU on each update.
+     * @param frameLatency Frames before a staging resource can be rewritten
+     *        (must cover the frames the GPU may lag behind the CPU).
+     * @param bufferPageSize Size of the staging pages used for buffers.
+     * @param maxStagingSlots Maximum staging resources kept in the pool.
+     */
+    explicit DXUploadScheduler(SIZE_T bytesPerFrame = 8 * 1024 * 1024,
+                               uint32 frameLatency = 3,
+                               uint32 bufferPageSize = 256 * 1024,
+                               uint32 maxStagingSlots = 128)
+      : m_bytesPerFrame(bytesPerFrame),
+        m_frameLatency(frameLatency),
+        m_bufferPageSize(bufferPageSize),
+        m_maxStagingSlots(maxStagingSlots)
+    {}
+
+    ~DXUploadScheduler() {
+      release();
+    }
+
+    void
+    init(D3DDevice* pDevice, D3DDeviceContext* pContext);
+
+    /**
+     * @brief Drops the pending uploads and releases the staging pool.
+     */
+    void
+    release();
+
+    /**
+     * @brief Queues an upload. The data is copied so the caller can free it
+     *        right away.
+     * @param pDstBox Region of the subresource to write, in texels for
+     *        textures and bytes (left/right) for buffers. nullptr writes the
+     *        whole subresource.
+     * @param srcRowPitch Bytes between rows (block rows for compressed
+     *        formats) of the source data. Ignored for buffers.
+     */
+    UploadToken
+    enqueue(ID3D11Resource* pDst,
+            uint32 dstSubRes,
+            const D3D11_BOX* pDstBox,
+            const void* pSrcData,
+            uint32 srcRowPitch);
+
+    /**
+     * @brief Issues the copies of the queued uploads up to the per frame
+     *        budget. At least one chunk is issued per call so uploads
+     *        always make progress. Called once per frame.
+     */
+    void
+    update();
+
+    /**
+     * @brief Issues every pending upload ignoring the budget (e.g. while a
+     *        loading screen is shown). The staging pool doesn't grow past
+     *        its limit, the copies wait for the GPU to release it instead.
+     */
+    void
+    flush();
+
+    /**
+     * @brief True once every copy of the upload has been issued. Commands
+     *        recorded after that see the new data.
+     */
+    bool
+    isComplete(UploadToken token) const {
+      return token != INVALID_UPLOAD_TOKEN && token <= m_lastCompletedToken;
+    }
+
+    void
+    setBytesPerFrame(SIZE_T bytesPerFrame) {
+      m_bytesPerFrame = bytesPerFrame;
+    }
+
+    SIZE_T
+    getBytesPerFrame() const {
+      return m_bytesPerFrame;
+    }
+
+    /**
+     * @brief Bytes waiting to be issued.
+     */
+    SIZE_T
+    getPendingBytes() const {
+      return m_pendingBytes;
+    }
+
+    /**
+     * @brief Bytes issued on the last update or flush.
+     */
+    SIZE_T
+    getLastFrameBytes() const {
+      return m_lastFrameBytes;
+    }
+
+   private:
+    struct StagingKey
+    {
+      D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+      uint32 width = 0;   //Bytes for buffers
+      uint32 height = 0;
+      DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+
+      bool
+      operator==(const StagingKey& other) const {
+        return dimension == other.dimension &&
+               width == other.width &&
+               height == other.height &&
+               format == other.format;
+      }
+    };
+
+    struct StagingSlot
+    {
+      StagingKey key;
+      ID3D11Resource* pResource = nullptr;
+      uint64 lastUsedFrame = 0;
+    };
+
+    struct Upload
+    {
+      UploadToken token = INVALID_UPLOAD_TOKEN;
+      ID3D11Resource* pDst = nullptr;
+      uint32 dstSubRes = 0;
+      D3D11_BOX box;
+      D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+      DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+      uint32 blockWidth = 1;    //Texels per block (4x4 for BC formats)
+      uint32 blockHeight = 1;
+      uint32 rowBytes = 0;      //Bytes of a row of blocks inside the box
+      uint32 numRows = 0;       //Rows of blocks (1 for buffers)
+      uint32 nextRow = 0;       //First row (or byte for buffers) not issued
+      Vector<uint8> data;       //Tightly packed rows
+    };
+
+    /**
+     * @brief Issues the queued uploads in order until the budget runs out.
+     */
+    void
+    _issueUploads(SIZE_T budget);
+
+    /**
+     * @brief Issues the next chunk of an upload.
+     * @return Bytes issued.
+     */
+    SIZE_T
+    _issueChunk(Upload& upload, SIZE_T maxBytes);
+
+    /**
+     * @brief Staging resource to write a chunk to. The free ones are used
+     *        first, then new ones while the pool has room, then the least
+     *        recently used one (which may make the map wait for the GPU).
+     */
+    ID3D11Resource*
+    _acquireStaging(const StagingKey& key);
+
+    ID3D11Resource*
+    _createStaging(const StagingKey& key);
+
+    D3DDevice* m_pDevice = nullptr;
+    D3DDeviceContext* m_pContext = nullptr;
+
+    SIZE_T m_bytesPerFrame;
+    uint32 m_frameLatency;
+    uint32 m_bufferPageSize;
+    uint32 m_maxStagingSlots;
+    uint64 m_frameIndex = 0;
+
+    UploadToken m_nextToken = 1;
+    UploadToken m_lastCompletedToken = 0;
+    SIZE_T m_pendingBytes = 0;
+    SIZE_T m_lastFrameBytes = 0;
+
+    Vector<Upload> m_uploads;       //FIFO, front is the one in progress
+    Vector<StagingSlot> m_staging;  //Least recently used first
+  };
+
+} // namespace geEngineSDK
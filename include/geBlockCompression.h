@@ -0,0 +1,130 @@
+/*****************************************************************************/
+/**
+ * @file    geBlockCompression.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU encoder and decoder of the BC1, BC3, BC4, BC5 and BC7 formats.
+ *
+ * Block compressed textures take a quarter (BC1, BC4) or half (BC3, BC5,
+ * BC7) of the memory of RGBA8, and the sampler reads four to eight times
+ * fewer bytes. The content pipeline compresses every mip of a chain before
+ * the upload:
+ *
+ * - BC1 and BC3 colors: endpoints on the principal axis of the block, then
+ *   refined by least squares. BC1 uses its three color mode for blocks with
+ *   alpha under 128.
+ * - BC4 and BC5: every channel on its own, with the six value mode (0 and
+ *   255 exact) tried for blocks that have them.
+ * - BC7: mode search. The quality picks the modes, the partitions and the
+ *   rotations that are tried (see BC_QUALITY).
+ *
+ * The palette searches use SSE2 or NEON, and the blocks are split in rows
+ * among the worker threads of TextureKernels. Colors are encoded as stored,
+ * sRGB textures are encoded in sRGB space. The decoders follow the Direct3D
+ * specification and check the encoder on platforms without the GPU formats.
+ *
+ * @bug	    The decoder doesn't handle BC7 modes 0 and 2 (three subsets), the
+ *          encoder doesn't write them. Those blocks decode to zero.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include "geTextureKernels.h"
+
+namespace geEngineSDK {
+
+  namespace BC_FORMAT {
+    enum E {
+      kBC1 = 0,   //RGB, 1 bit alpha
+      kBC3,       //RGBA, BC1 colors and BC4 alpha
+      kBC4,       //Red channel
+      kBC5,       //Red and green channels
+      kBC7,       //RGBA
+      kNumFormats
+    };
+  }
+
+  namespace BC_QUALITY {
+    enum E {
+      //BC7 mode 6 only, one refinement
+      kFast = 0,
+
+      //BC7 modes 1, 3 and 6 for opaque blocks, 5, 6 and 7 with alpha, the
+      //best partitions of an estimation
+      kNormal,
+
+      //BC7 modes 1, 3, 4, 5, 6 and 7 with every partition, rotation and
+      //p-bit combination
+      kHigh
+    };
+  }
+
+  namespace BlockCompression {
+    /**
+     * @brief Bytes of a 4x4 block, 8 or 16.
+     */
+    uint32
+    getBytesPerBlock(BC_FORMAT::E format);
+
+    /**
+     * @brief Bytes of a row of blocks of an image width texels wide.
+     */
+    uint32
+    getRowPitch(BC_FORMAT::E format, uint32 width);
+
+    SIZE_T
+    getCompressedSize(BC_FORMAT::E format, uint32 width, uint32 height);
+
+    /**
+     * @brief Compresses an RGBA8 image. BC4 takes the red channel and BC5
+     *        the red and green ones. Blocks past the edge of the image
+     *        repeat its last row and column.
+     * @param pDst Rows of blocks, dstRowPitch bytes from a row to the next.
+     */
+    void
+    compress(const TextureImage& src,
+             BC_FORMAT::E format,
+             BC_QUALITY::E quality,
+             uint8* pDst,
+             uint32 dstRowPitch);
+
+    /**
+     * @brief Compresses every mip of a chain in a single allocation.
+     * @param offsets Receives where each mip starts in data.
+     */
+    void
+    compressMipChain(const TextureMipChain& chain,
+                     BC_FORMAT::E format,
+                     BC_QUALITY::E quality,
+                     Vector<uint8>& data,
+                     Vector<SIZE_T>& offsets);
+
+    /**
+     * @brief Decompresses rows of blocks into an RGBA8 image. BC4 fills
+     *        green and blue with zero, BC5 blue, and both set alpha to 255.
+     */
+    void
+    decompress(const uint8* pSrc,
+               uint32 srcRowPitch,
+               BC_FORMAT::E format,
+               const TextureImage& dst);
+
+    /**
+     * @param pixels The 16 texels of the block in RGBA8, in rows.
+     */
+    void
+    compressBlock(const uint8* pixels,
+                  BC_FORMAT::E format,
+                  BC_QUALITY::E quality,
+                  uint8* pBlock);
+
+    void
+    decompressBlock(const uint8* pBlock, BC_FORMAT::E format, uint8* pixels);
+  }
+} // namespace geEngineSDK
@@ -0,0 +1,298 @@
+/*****************************************************************************/
+/**
+ * @file    geNullCommandStream.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   In-memory stream of the calls made to the null render API.
+ *
+ * Every call of the null render API is stored as a fixed size command that
+ * references resources by id. Variable sized arguments (viewports, render
+ * target lists, clear colors, creation descriptors) live in a side data
+ * pool. The stream doesn't depend on Direct3D so it can be recorded and
+ * inspected on any platform, and it is the record format of the API traces.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geGraphicsTypes.h>
+#include <geVector4.h>
+
+namespace geEngineSDK {
+
+  namespace NULL_COMMAND {
+    enum E : uint16 {
+      kCreateTexture = 0,
+      kCreateVertexDeclaration,
+      kCreateStreamOutputDeclaration,
+      kCreateInputLayout,
+      kCreateInputLayoutFromShader,
+      kCreateVertexBuffer,
+      kCreateStreamOutputBuffer,
+      kCreateIndexBuffer,
+      kCreateConstantBuffer,
+      kCreateRasterizerState,
+      kCreateDepthStencilState,
+      kCreateBlendState,
+      kCreateSamplerState,
+      kCreateShader,
+      kReleaseResource,
+      kBackBuffer,
+      kResizeSwapChain,
+      kSetTopology,
+      kSetViewports,
+      kSetInputLayout,
+      kSetRasterizerState,
+      kSetDepthStencilState,
+      kSetBlendState,
+      kSetVertexBuffer,
+      kSetIndexBuffer,
+      kSetProgram,
+      kSetShaderResource,
+      kSetUnorderedAccess,
+      kSetConstantBuffer,
+      kSetSampler,
+      kSetRenderTargets,
+      kSetStreamOutput,
+      kSavePipelineState,
+      kRestorePipelineState,
+      kWriteResource,
+      kMap,
+      kUnmap,
+      kCopyResource,
+      kResolve,
+      kGenerateMips,
+      kClearRenderTarget,
+      kClearDepthStencil,
+      kDiscardView,
+      kDraw,
+      kDrawIndexed,
+      kDrawInstanced,
+      kDrawAuto,
+      kDispatch,
+      kPresent,
+      kNumCommands
+    };
+  }
+
+  namespace NULL_SHADER_STAGE {
+    enum E : uint8 {
+      kVertex = 0,
+      kPixel,
+      kGeometry,
+      kHull,
+      kDomain,
+      kCompute,
+      kNumStages
+    };
+  }
+
+  /**
+   * @brief A recorded call. The meaning of slot and args depends on the type
+   *        (e.g. for kDrawIndexed args are indexCount, startIndex and
+   *        baseVertex). Resources are referenced by the id they got when they
+   *        were created, zero means unbound.
+   *
+   * Creation commands carry the new id in resourceId:
+   *  - kCreateTexture: args width, height, format, bindFlags. Data is a
+   *    NullTextureCreateInfo.
+   *  - kCreate*Declaration: data is the array of elements.
+   *  - kCreateInputLayout: args declaration id, shader id.
+   *  - kCreateInputLayoutFromShader: args shader id.
+   *  - kCreate*Buffer: args size, usage, then the declaration id (vertex and
+   *    stream output) or the index format. Data is the initial data, if any.
+   *  - kCreateRasterizerState, kCreateDepthStencilState and
+   *    kCreateSamplerState: data is the descriptor.
+   *  - kCreateBlendState: args sample mask. Data is a NullBlendCreateInfo.
+   *  - kCreateShader: stage of the shader, args stream output declaration
+   *    id. Data is the packed file name, entry point, shader model and
+   *    macro name/definition pairs.
+   *  - kBackBuffer: the back buffer of the device got this id.
+   *  - kSavePipelineState: the saved state got this id, it is the
+   *    resourceId of the kRestorePipelineState that restores it.
+   *
+   * kWriteResource args are row pitch, depth pitch, copy flags and whether
+   * the data starts with a GRAPHICS_BOX. The bytes written may follow it,
+   * the null device doesn't store them but traces do.
+   */
+  struct NullCommand
+  {
+    NULL_COMMAND::E type = NULL_COMMAND::kNumCommands;
+    NULL_SHADER_STAGE::E stage = NULL_SHADER_STAGE::kNumStages;
+    uint32 slot = 0;
+    uint32 resourceId = 0;
+    uint32 args[4] = {};
+    uint32 dataOffset = 0;    //Extra arguments in the data pool of the stream
+    uint32 dataSize = 0;
+  };
+
+  /**
+   * @brief Data of kCreateTexture. The args of the command are width,
+   *        height, format and bindFlags as they were passed to createTexture.
+   */
+  struct NullTextureCreateInfo
+  {
+    uint32 mipLevels = 1;
+    uint32 usage = 0;
+    uint32 cpuAccessFlags = 0;
+    uint32 sampleCount = 1;
+    uint32 bMSAA = 0;
+    uint32 bCubeMap = 0;
+    uint32 arraySize = 1;
+  };
+
+  /**
+   * @brief Data of kCreateBlendState, the first arg is the sample mask.
+   */
+  struct NullBlendCreateInfo
+  {
+    BLEND_DESC desc;
+    Vector4 blendFactors;
+  };
+
+  /**
+   * @brief Data of kSetRenderTargets, one per target. The resourceId of the
+   *        command is the depth target and the slot the number of targets.
+   */
+  struct NullRenderTargetBinding
+  {
+    uint32 id = 0;
+    uint32 mipLevel = 0;
+  };
+
+  /**
+   * @brief Problem found while validating a call.
+   */
+  struct NullValidationError
+  {
+    uint32 commandIndex = 0;    //Command that triggered the error
+    String message;
+  };
+
+  class NullCommandStream
+  {
+   public:
+    /**
+     * @param maxStoredErrors Errors after this many are only counted.
+     */
+    explicit NullCommandStream(uint32 maxStoredErrors = 1024)
+      : m_maxStoredErrors(maxStoredErrors)
+    {}
+
+    /**
+     * @brief Appends a command.
+     * @param pData Extra arguments copied to the data pool, can be nullptr.
+     * @return Index of the command in the stream.
+     */
+    uint32
+    record(const NullCommand& command, const void* pData = nullptr, uint32 dataSize = 0);
+
+    /**
+     * @brief Attaches an error to the last recorded command.
+     */
+    void
+    addError(const String& message);
+
+    /**
+     * @brief Drops the commands, the data and the errors. The allocations are
+     *        kept so a steady state frame doesn't allocate.
+     */
+    void
+    clear();
+
+    const Vector<NullCommand>&
+    getCommands() const {
+      return m_commands;
+    }
+
+    uint32
+    getNumCommands() const {
+      return static_cast<uint32>(m_commands.size());
+    }
+
+    /**
+     * @brief Extra arguments of a command, nullptr if it has none.
+     */
+    const void*
+    getData(const NullCommand& command) const {
+      return command.dataSize ? &m_data[command.dataOffset] : nullptr;
+    }
+
+    SIZE_T
+    getDataSize() const {
+      return m_data.size();
+    }
+
+    /**
+     * @brief Raw data pool, the data of every command is at its dataOffset.
+     */
+    const Vector<uint8>&
+    getDataPool() const {
+      return m_data;
+    }
+
+    /**
+     * @brief Replaces the contents with already recorded commands, used when
+     *        a trace is loaded. The errors are dropped.
+     */
+    void
+    assign(Vector<NullCommand>&& commands, Vector<uint8>&& data);
+
+    const Vector<NullValidationError>&
+    getErrors() const {
+      return m_errors;
+    }
+
+    /**
+     * @brief Every error found since the last clear, including the ones that
+     *        weren't stored.
+     */
+    uint32
+    getNumErrors() const {
+      return m_numErrors;
+    }
+
+    /**
+     * @brief Number of recorded commands of a type.
+     */
+    uint32
+    count(NULL_COMMAND::E type) const;
+
+    /**
+     * @brief Name of a command type for logs and dumps.
+     */
+    static const char*
+    getName(NULL_COMMAND::E type);
+
+    /**
+     * @brief Packs a list of strings as consecutive null terminated strings,
+     *        used for the data of the commands that take names and paths.
+     */
+    static void
+    packStrings(const Vector<String>& strings, Vector<uint8>& outData);
+
+    static Vector<String>
+    unpackStrings(const void* pData, uint32 dataSize);
+
+    /**
+     * @brief Alignment of the data of every command, enough for any of the
+     *        descriptors stored there.
+     */
+    static constexpr uint32 DATA_ALIGNMENT = 8;
+
+   private:
+    Vector<NullCommand> m_commands;
+    Vector<uint8> m_data;
+    Vector<NullValidationError> m_errors;
+    uint32 m_numErrors = 0;
+    uint32 m_maxStoredErrors;
+  };
+
+} // namespace geEngineSDK
@@ -0,0 +1,520 @@
+/*****************************************************************************/
+/**
+ * @file    geNullRenderAPI.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Render API that records and validates calls without a GPU.
+ *
+ * Implements the whole RenderAPI interface without touching a device. Every
+ * call is validated against the bound state and recorded in an in-memory
+ * command stream, so the CPU cost of scene submission, state filtering and
+ * batching can be measured (and tested) on machines without Windows or a
+ * GPU. Selected with "NullDevice" in the RenderAPI config section.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geRenderAPI.h>
+
+#include "geNullResources.h"
+#include "geNullCommandStream.h"
+#include "geRenderStats.h"
+
+namespace geEngineSDK {
+
+  class NullRenderAPI : public RenderAPI
+  {
+   public:
+    NullRenderAPI() = default;
+    virtual ~NullRenderAPI();
+
+    /**
+     * @brief Creates the back buffer. The handle is ignored, the size comes
+     *        from "NullBackBufferWidth" and "NullBackBufferHeight".
+     */
+    bool
+    initRenderAPI(void* scrHandle, bool bFullScreen) override;
+
+    bool
+    resizeSwapChain(uint32 newWidth, uint32 newHeight) override;
+
+    bool
+    isMSAAFormatSupported(const GRAPHICS_FORMAT::E format,
+                          int32& samplesPerPixel,
+                          int32& sampleQuality) const override;
+
+    void
+    msaaResolveRenderTarget(const WeakSPtr<Texture>& pSrc,
+                            const WeakSPtr<Texture>& pDst) override;
+
+    void
+    reportLiveObjects() override;
+
+    /*************************************************************************/
+    // Get methods
+    /*************************************************************************/
+    WeakSPtr<Texture>
+    getBackBuffer() const override;
+
+    WeakSPtr<RasterizerState>
+    getCurrentRasterizerState() const override;
+
+    WeakSPtr<DepthStencilState>
+    getCurrentDepthStencilState() const override;
+
+    WeakSPtr<BlendState>
+    getCurrentBlendState() const override;
+
+    WeakSPtr<SamplerState>
+    getCurrentSamplerState(uint32 samplerSlot = 0) const override;
+
+    /*************************************************************************/
+    // Create methods
+    /*************************************************************************/
+    SPtr<Texture>
+    createTexture(uint32 width,
+                  uint32 height,
+                  GRAPHICS_FORMAT::E format,
+                  uint32 bindFlags = BIND_FLAG::SHADER_RESOURCE,
+                  uint32 mipLevels = 1,
+                  RESOURCE_USAGE::E usage = RESOURCE_USAGE::DEFAULT,
+                  uint32 cpuAccessFlags = 0,
+                  uint32 sampleCount = 1,
+                  bool isMSAA = false,
+                  bool isCubeMap = false,
+                  uint32 arraySize = 1) override;
+
+    SPtr<VertexDeclaration>
+    createVertexDeclaration(const Vector<VertexElement>& elements) override;
+
+    SPtr<StreamOutputDeclaration>
+    createStreamOutputDeclaration(const Vector<StreamOutputElement>& elements) override;
+
+    SPtr<InputLayout>
+    createInputLayout(const WeakSPtr<VertexDeclaration>& descArray,
+                      const WeakSPtr<VertexShader>& pVS) override;
+
+    SPtr<InputLayout>
+    createInputLayoutFromShader(const WeakSPtr<VertexShader>& pVS) override;
+
+    SPtr<VertexBuffer>
+    createVertexBuffer(const SPtr<VertexDeclaration>& pDecl,
+                       const SIZE_T sizeInBytes,
+                       const void* pInitialData = nullptr,
+                       const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<StreamOutputBuffer>
+    createStreamOutputBuffer(const SPtr<StreamOutputDeclaration>& pDecl,
+                             const SIZE_T sizeInBytes,
+                             const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<IndexBuffer>
+    createIndexBuffer(const SIZE_T sizeInBytes,
+                      const void* pInitialData = nullptr,
+                      const INDEX_BUFFER_FORMAT::E format = INDEX_BUFFER_FORMAT::R32_UINT,
+                      const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<ConstantBuffer>
+    createConstantBuffer(const SIZE_T sizeInBytes,
+                         const void* pInitialData = nullptr,
+                         const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<RasterizerState>
+    createRasterizerState(const RASTERIZER_DESC& rasterDesc) override;
+
+    SPtr<DepthStencilState>
+    createDepthStencilState(const DEPTH_STENCIL_DESC& depthStencilDesc) override;
+
+    SPtr<BlendState>
+    createBlendState(const BLEND_DESC& blendDesc,
+                     const Vector4 blendFactors = Vector4::ZERO,
+                     const uint32 sampleMask = NumLimit::MAX_UINT32) override;
+
+    SPtr<SamplerState>
+    createSamplerState(const SAMPLER_DESC& samplerDesc) override;
+
+    /*************************************************************************/
+    // Create Shaders
+    // Nothing is compiled, only the shader model is checked against the stage
+    /*************************************************************************/
+    SPtr<VertexShader>
+    createVertexShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<PixelShader>
+    createPixelShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<GeometryShader>
+    createGeometryShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<GeometryShader>
+    createGeometryShaderWithStreamOutput(CREATE_SHADER_PARAMS,
+                                         const SPtr<StreamOutputDeclaration>& pDecl) override;
+
+    SPtr<HullShader>
+    createHullShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<DomainShader>
+    createDomainShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<ComputeShader>
+    createComputeShader(CREATE_SHADER_PARAMS) override;
+
+    /*************************************************************************/
+    // Write Functions
+    /*************************************************************************/
+    void
+    writeToResource(const WeakSPtr<GraphicsResource>& pResource,
+                    uint32 dstSubRes,
+                    const GRAPHICS_BOX* pDstBox,
+                    const void* pSrcData,
+                    uint32 srcRowPitch,
+                    uint32 srcDepthPitch,
+                    uint32 copyFlags = 0) override;
+
+    /**
+     * @brief Staging resources are backed by zeroed system memory so readers
+     *        get a valid pointer.
+     */
+    MappedSubresource
+    mapToRead(const WeakSPtr<GraphicsResource>& pTexture,
+              uint32 subResource = 0,
+              uint32 mapFlags = 0) override;
+
+    void
+    unmap(const WeakSPtr<GraphicsResource>& pTexture,
+          uint32 subResource = 0) override;
+
+    void
+    copyResource(const WeakSPtr<GraphicsResource>& pSrcObj,
+                 const WeakSPtr<GraphicsResource>& pDstObj) override;
+
+    void
+    generateMips(const WeakSPtr<Texture>& pTexture) override;
+
+    void
+    clearRenderTarget(const WeakSPtr<Texture>& pRenderTarget,
+                      const LinearColor& color = LinearColor::Black) override;
+
+    void
+    clearDepthStencil(const WeakSPtr<Texture>& pDepthStencilView,
+                      uint32 flags = CLEAR_FLAG::DEPTH | CLEAR_FLAG::STENCIL,
+                      float depthVal = 1.0f,
+                      uint8 stencilVal = 0U) override;
+
+    void
+    discardView(WeakSPtr<Texture> pTexture) override;
+
+    /**
+     * @brief Ends the frame: the recorded commands and the statistics become
+     *        the ones of the last frame and a new stream is started.
+     */
+    void
+    present() override;
+
+    /*************************************************************************/
+    // Set Objects
+    /*************************************************************************/
+    void
+    setImmediateContext() override;
+
+    void
+    setTopology(PRIMITIVE_TOPOLOGY::E topologyType) override;
+
+    void
+    setViewports(const Vector<GRAPHICS_VIEWPORT>& viewports) override;
+
+    void
+    setInputLayout(const WeakSPtr<InputLayout>& pInputLayout) override;
+
+    void
+    setRasterizerState(const WeakSPtr<RasterizerState>& pRasterizerState) override;
+
+    void
+    setDepthStencilState(const WeakSPtr<DepthStencilState>& pDepthStencilState,
+                         uint32 stencilRef = 0) override;
+
+    void
+    setBlendState(const WeakSPtr<BlendState>& pBlendState) override;
+
+    void
+    setVertexBuffer(const WeakSPtr<VertexBuffer>& pVertexBuffer,
+                    uint32 startSlot = 0,
+                    uint32 offset = 0) override;
+
+    void
+    setIndexBuffer(const WeakSPtr<IndexBuffer>& pIndexBuffer,
+                   uint32 offset = 0) override;
+
+    void
+    vsSetProgram(const WeakSPtr<VertexShader>& pInShader) override;
+
+    void
+    psSetProgram(const WeakSPtr<PixelShader>& pInShader) override;
+
+    void
+    gsSetProgram(const WeakSPtr<GeometryShader>& pInShader) override;
+
+    void
+    hsSetProgram(const WeakSPtr<HullShader>& pInShader) override;
+
+    void
+    dsSetProgram(const WeakSPtr<DomainShader>& pInShader) override;
+
+    void
+    csSetProgram(const WeakSPtr<ComputeShader>& pInShader) override;
+
+    void
+    vsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    psSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    gsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    hsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    dsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                             const uint32 startSlot = 0) override;
+
+    void
+    vsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    psSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    gsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    hsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    dsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    vsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    psSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    gsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    hsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    dsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    csSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    setRenderTargets(const Vector<RenderTarget>& pTargets,
+                     const WeakSPtr<Texture>& pDepthStencilView) override;
+
+    void
+    setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) override;
+
+    /*************************************************************************/
+    // State Management Functions
+    /*************************************************************************/
+    SPtr<PipelineState>
+    savePipelineState() const override;
+
+    void
+    restorePipelineState(const WeakSPtr<PipelineState>& pState) override;
+
+    /*************************************************************************/
+    // Draw Functions
+    /*************************************************************************/
+    void
+    draw(uint32 vertexCount, uint32 startVertexLocation = 0) override;
+
+    void
+    drawIndexed(uint32 indexCount,
+                uint32 startIndexLocation = 0,
+                int32 baseVertexLocation = 0) override;
+
+    void
+    drawInstanced(uint32 vertexCountPerInstance,
+                  uint32 instanceCount,
+                  uint32 startVertexLocation = 0,
+                  uint32 startInstanceLocation = 0) override;
+
+    void
+    drawAuto() override;
+
+    void
+    dispatch(uint32 threadGroupCountX,
+             uint32 threadGroupCountY = 1,
+             uint32 threadGroupCountZ = 1) override;
+
+    /*************************************************************************/
+    // Null device specific
+    /*************************************************************************/
+    /**
+     * @brief Commands recorded since the last present.
+     */
+    const NullCommandStream&
+    getCommandStream() const {
+      return m_commands;
+    }
+
+    /**
+     * @brief Commands of the last presented frame.
+     */
+    const NullCommandStream&
+    getLastFrameCommands() const {
+      return m_lastFrameCommands;
+    }
+
+    /**
+     * @brief With recording disabled calls are only validated and counted,
+     *        which measures the submission cost without the stream growth.
+     */
+    void
+    setRecording(bool bRecording) {
+      m_bRecording = bRecording;
+    }
+
+    void
+    setValidation(bool bValidation) {
+      m_bValidation = bValidation;
+    }
+
+    const RenderStats&
+    getRenderStats() const {
+      return m_stats.getLastFrame();
+    }
+
+    const RenderStats&
+    getCurrentRenderStats() const {
+      return m_stats.getCurrentFrame();
+    }
+
+   private:
+    void
+    _createBackBuffer(uint32 width, uint32 height);
+
+    /**
+     * @brief Assigns an id to a new object. The caller records the creation
+     *        command with the layout documented in NULL_COMMAND.
+     */
+    void
+    _registerObject(NullObject& object, RENDER_STAT_RESOURCE::E type);
+
+    SPtr<NullShader>
+    _createShader(NULL_SHADER_STAGE::E stage,
+                  const char* stagePrefix,
+                  CREATE_SHADER_PARAMS);
+
+    void
+    _setProgram(NULL_SHADER_STAGE::E stage, const WeakSPtr<Shader>& pInShader);
+
+    void
+    _setShaderResource(NULL_SHADER_STAGE::E stage,
+                       const WeakSPtr<Texture>& pTexture,
+                       uint32 startSlot);
+
+    void
+    _setConstantBuffer(NULL_SHADER_STAGE::E stage,
+                       const WeakSPtr<ConstantBuffer>& pBuffer,
+                       uint32 startSlot);
+
+    void
+    _setSampler(NULL_SHADER_STAGE::E stage,
+                const WeakSPtr<SamplerState>& pSampler,
+                uint32 startSlot);
+
+    /**
+     * @brief Checks the state shared by every draw call.
+     */
+    void
+    _validateDraw();
+
+    void
+    _record(NULL_COMMAND::E type,
+            uint32 resourceId = 0,
+            uint32 slot = 0,
+            NULL_SHADER_STAGE::E stage = NULL_SHADER_STAGE::kNumStages,
+            uint32 arg0 = 0,
+            uint32 arg1 = 0,
+            uint32 arg2 = 0,
+            uint32 arg3 = 0,
+            const void* pData = nullptr,
+            uint32 dataSize = 0);
+
+    void
+    _error(const String& message);
+
+    static NullObject*
+    _getObject(const GraphicsResource* pResource) {
+      return pResource ? static_cast<NullObject*>(pResource->_getGraphicsResource()) : nullptr;
+    }
+
+    static uint32
+    _getId(const NullObject* pObject) {
+      return pObject ? pObject->m_nullId : 0;
+    }
+
+    bool
+    _isBoundAsTarget(uint32 textureId) const;
+
+   private:
+    SPtr<NullTexture> m_pBackBufferTexture;
+
+    NullCommandStream m_commands;
+    NullCommandStream m_lastFrameCommands;
+    NullBoundState m_state;
+    uint32 m_nextObjectId = 1;
+    uint32 m_numMappedResources = 0;
+
+    bool m_bRecording = true;
+    bool m_bValidation = true;
+    uint32 m_numLoggedErrors = 0;
+    Vector<uint8> m_scratchData;
+
+    RenderStatsCounter m_stats;
+    RenderBindCache m_bindCache;
+  };
+
+} // namespace geEngineSDK
@@ -0,0 +1,413 @@
+/*****************************************************************************/
+/**
+ * @file    geNullResources.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Resources of the null render API.
+ *
+ * The resources of the null render API don't own any GPU object. They keep
+ * the description needed to validate how they are used and an id that
+ * identifies them in the recorded command stream.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geGraphicsTypes.h>
+#include <geGraphicsInterfaces.h>
+#include <geInputLayout.h>
+#include <geShader.h>
+#include <geTexture.h>
+#include <geVector3.h>
+#include <geVector4.h>
+#include <geNumericLimits.h>
+
+#include "geNullCommandStream.h"
+#include "geRenderStats.h"
+
+namespace geEngineSDK {
+
+  /**
+   * @brief Data shared by every null object. _getGraphicsResource() of the
+   *        null textures and buffers returns a pointer to this.
+   */
+  class NullObject
+  {
+   public:
+    uint32
+    _getNullId() const {
+      return m_nullId;
+    }
+
+   protected:
+    friend class NullRenderAPI;
+
+    /**
+     * @brief Counts the release once, the first time it happens.
+     */
+    void
+    _releaseNullObject() {
+      if (m_nullId) {
+        RenderStatsCounter::onResourceReleased(m_nullType);
+      }
+      m_nullId = 0;
+      m_cpuData.clear();
+      m_cpuData.shrink_to_fit();
+    }
+
+    uint32 m_nullId = 0;
+    RENDER_STAT_RESOURCE::E m_nullType = RENDER_STAT_RESOURCE::kNumResourceTypes;
+    uint32 m_bindFlags = 0;
+    uint32 m_usage = RESOURCE_USAGE::DEFAULT;
+    SIZE_T m_sizeInBytes = 0;     //Only known for buffers
+    uint32 m_numMapped = 0;       //Subresources currently mapped
+    Vector<uint8> m_cpuData;      //Backing memory of mapped staging resources
+  };
+
+  class NullTexture : public Texture, public NullObject
+  {
+   public:
+    NullTexture() = default;
+    virtual ~NullTexture() {
+      release();
+    }
+
+    void
+    moveFrom(Resource& other) override {
+      if (this != &other) {
+        release();
+
+        NullTexture& nullOther = static_cast<NullTexture&>(other);
+        m_nullId = nullOther.m_nullId;
+        m_nullType = nullOther.m_nullType;
+        m_bindFlags = nullOther.m_bindFlags;
+        m_usage = nullOther.m_usage;
+        m_arraySize = nullOther.m_arraySize;
+        m_sampleCount = nullOther.m_sampleCount;
+        m_bHaveAlpha = nullOther.m_bHaveAlpha;
+        m_bIsCubeMap = nullOther.m_bIsCubeMap;
+        m_desc = nullOther.m_desc;
+        setPath(nullOther.getPath());
+        setCookedPath(nullOther.getCookedPath());
+
+        //The id now belongs to this object
+        nullOther.m_nullId = 0;
+      }
+    }
+
+    void
+    release() override {
+      _releaseNullObject();
+      m_desc.bindFlags = 0;
+    }
+
+    Vector3
+    getDimensions() const override {
+      return Vector3(static_cast<float>(m_desc.width),
+                     static_cast<float>(m_desc.height),
+                     1.0f);
+    }
+
+    void
+    setDebugName(const String& name) override {
+      m_name = name;
+    }
+
+    bool
+    load(const Path& filePath) override {
+      GE_UNREFERENCED_PARAMETER(filePath);
+      return false;
+    }
+
+    void
+    unload() override {}
+
+    bool
+    isLoaded() const override {
+      return 0 != m_nullId;
+    }
+
+    const String&
+    getName() const override {
+      return m_name;
+    }
+
+    SIZE_T
+    getMemoryUsage() const override {
+      return 0;
+    }
+
+    void*
+    _getGraphicsResource() const override {
+      return const_cast<NullObject*>(static_cast<const NullObject*>(this));
+    }
+
+   protected:
+    friend class NullRenderAPI;
+
+    uint32 m_arraySize = 1;       //Includes the six faces of cube maps
+    uint32 m_sampleCount = 1;
+    String m_name;
+  };
+
+  /**
+   * @brief Common implementation of the null buffers.
+   */
+  template<class BufferType>
+  class NullBuffer : public BufferType, public NullObject
+  {
+   public:
+    NullBuffer() = default;
+    virtual ~NullBuffer() {
+      release();
+    }
+
+    void
+    release() override {
+      _releaseNullObject();
+    }
+
+    bool
+    load(const Path& filePath) override {
+      GE_UNREFERENCED_PARAMETER(filePath);
+      return false;
+    }
+
+    void
+    unload() override {}
+
+    bool
+    isLoaded() const override {
+      return 0 != m_nullId;
+    }
+
+    const String&
+    getName() const override {
+      static String emptyName;
+      return emptyName;
+    }
+
+    SIZE_T
+    getMemoryUsage() const override {
+      return m_sizeInBytes;
+    }
+
+    void*
+    _getGraphicsResource() const override {
+      return const_cast<NullObject*>(static_cast<const NullObject*>(this));
+    }
+
+    void*
+    _getGraphicsBuffer() const override {
+      return _getGraphicsResource();
+    }
+
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullVertexBuffer : public NullBuffer<VertexBuffer>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullStreamOutputBuffer : public NullBuffer<StreamOutputBuffer>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullIndexBuffer : public NullBuffer<IndexBuffer>
+  {
+   protected:
+    friend class NullRenderAPI;
+    uint32 m_indexSize = sizeof(uint32);
+  };
+
+  class NullConstantBuffer : public NullBuffer<ConstantBuffer>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullShader : public Shader, public NullObject
+  {
+   public:
+    NullShader() = default;
+    virtual ~NullShader() {
+      release();
+    }
+
+    void
+    release() override {
+      _releaseNullObject();
+    }
+
+    void
+    setDebugName(const String& name) override {
+      m_debugName = name;
+    }
+
+    bool
+    load(const Path& filePath) override {
+      GE_UNREFERENCED_PARAMETER(filePath);
+      return false;
+    }
+
+    void
+    unload() override {}
+
+    bool
+    isLoaded() const override {
+      return 0 != m_nullId;
+    }
+
+    const String&
+    getName() const override {
+      return m_debugName;
+    }
+
+    SIZE_T
+    getMemoryUsage() const override {
+      return 0;
+    }
+
+   protected:
+    friend class NullRenderAPI;
+
+    NULL_SHADER_STAGE::E m_stage = NULL_SHADER_STAGE::kNumStages;
+  };
+
+  class NullInputLayout : public InputLayout, public NullObject
+  {
+   public:
+    virtual ~NullInputLayout() {
+      release();
+    }
+
+    void
+    release() override {
+      _releaseNullObject();
+    }
+
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  /**
+   * @brief Common implementation of the null pipeline states.
+   */
+  template<class StateType>
+  class NullState : public StateType, public NullObject
+  {
+   public:
+    virtual ~NullState() {
+      release();
+    }
+
+    void
+    release() override {
+      _releaseNullObject();
+    }
+
+    void
+    setDebugName(const String& name) override {
+      GE_UNREFERENCED_PARAMETER(name);
+    }
+
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullRasterizerState : public NullState<RasterizerState>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullDepthStencilState : public NullState<DepthStencilState>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  class NullBlendState : public NullState<BlendState>
+  {
+   protected:
+    friend class NullRenderAPI;
+    Vector4 m_blendFactors = Vector4::ZERO;
+    uint32 m_sampleMask = NumLimit::MAX_UINT32;
+  };
+
+  class NullSamplerState : public NullState<SamplerState>
+  {
+   protected:
+    friend class NullRenderAPI;
+  };
+
+  /**
+   * @brief What the null device considers bound. Resources are referenced by
+   *        id so a released resource can't be dereferenced by mistake.
+   */
+  struct NullBoundState
+  {
+    static constexpr uint32 MAX_SRVS = 128;
+    static constexpr uint32 MAX_CONSTANT_BUFFERS = 14;
+    static constexpr uint32 MAX_SAMPLERS = 16;
+    static constexpr uint32 MAX_UAVS = 64;
+    static constexpr uint32 MAX_VERTEX_BUFFERS = 32;
+    static constexpr uint32 MAX_RENDER_TARGETS = 8;
+    static constexpr uint32 MAX_VIEWPORTS = 16;
+
+    uint32 shaders[NULL_SHADER_STAGE::kNumStages] = {};
+    uint32 srvs[NULL_SHADER_STAGE::kNumStages][MAX_SRVS] = {};
+    uint32 uavs[MAX_UAVS] = {};
+
+    uint32 vertexBuffers[MAX_VERTEX_BUFFERS] = {};
+    uint32 indexBuffer = 0;
+    SIZE_T indexBufferSize = 0;
+    uint32 indexSize = 0;
+    uint32 indexOffset = 0;
+    uint32 inputLayout = 0;
+    uint32 streamOutput = 0;
+
+    uint32 rasterizerState = 0;
+    uint32 depthStencilState = 0;
+    uint32 blendState = 0;
+    uint32 topology = 0;
+
+    uint32 renderTargets[MAX_RENDER_TARGETS] = {};
+    uint32 numRenderTargets = 0;
+    uint32 depthTarget = 0;
+    uint32 numViewports = 0;
+
+    WeakSPtr<RasterizerState> pRasterizerState;
+    WeakSPtr<DepthStencilState> pDepthStencilState;
+    WeakSPtr<BlendState> pBlendState;
+    WeakSPtr<SamplerState> psSamplers[MAX_SAMPLERS];
+  };
+
+  class NullPipelineState : public PipelineState
+  {
+   public:
+    virtual ~NullPipelineState() {
+      release();
+    }
+
+    void
+    release() override {}
+
+   protected:
+    friend class NullRenderAPI;
+    NullBoundState m_state;
+  };
+
+} // namespace geEngineSDK
@@ -0,0 +1,327 @@
+/*****************************************************************************/
+/**
+ * @file    geRenderStats.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU side counters of the render API calls.
+ *
+ * Counters of draws, dispatches, state binds (and how many of them were
+ * redundant), uploads, resource creation/release and maps. They don't
+ * depend on Direct3D so any backend (including the null one) can use them.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <atomic>
+
+namespace geEngineSDK {
+
+  namespace RENDER_STAT_BIND {
+    enum E {
+      kShader = 0,
+      kShaderResource,
+      kUnorderedAccess,
+      kConstantBuffer,
+      kSampler,
+      kVertexBuffer,
+      kIndexBuffer,
+      kInputLayout,
+      kRasterizerState,
+      kDepthStencilState,
+      kBlendState,
+      kRenderTargets,
+      kViewports,
+      kTopology,
+      kNumBindTypes
+    };
+  }
+
+  namespace RENDER_STAT_RESOURCE {
+    enum E {
+      kTexture = 0,
+      kBuffer,
+      kShader,
+      kState,
+      kInputLayout,
+      kNumResourceTypes
+    };
+  }
+
+  /**
+   * @brief Snapshot of the counters of a frame.
+   */
+  struct RenderStats
+  {
+    uint64 frameIndex = 0;
+
+    uint32 numDrawCalls = 0;
+    uint32 numDispatches = 0;
+    uint32 numClears = 0;
+    uint32 numCopies = 0;
+
+    uint32 binds[RENDER_STAT_BIND::kNumBindTypes] = {};
+    uint32 redundantBinds[RENDER_STAT_BIND::kNumBindTypes] = {};
+
+    uint32 numUploads = 0;
+    uint64 uploadBytes = 0;
+
+    uint32 numMaps = 0;
+    uint32 numUnmaps = 0;
+
+    uint32 created[RENDER_STAT_RESOURCE::kNumResourceTypes] = {};
+    uint32 released[RENDER_STAT_RESOURCE::kNumResourceTypes] = {};
+    uint64 alive[RENDER_STAT_RESOURCE::kNumResourceTypes] = {};
+
+    uint32
+    getTotalBinds() const {
+      uint32 total = 0;
+      for (auto count : binds) {
+        total += count;
+      }
+      return total;
+    }
+
+    uint32
+    getTotalRedundantBinds() const {
+      uint32 total = 0;
+      for (auto count : redundantBinds) {
+        total += count;
+      }
+      return total;
+    }
+  };
+
+  /**
+   * @brief Accumulates the counters of the current frame. The call counters
+   *        belong to the render thread, resource creation and release are
+   *        counted globally since resources can die on any thread.
+   */
+  class RenderStatsCounter
+  {
+   public:
+    FORCEINLINE void
+    onDraw() {
+      ++m_current.numDrawCalls;
+    }
+
+    FORCEINLINE void
+    onDispatch() {
+      ++m_current.numDispatches;
+    }
+
+    FORCEINLINE void
+    onClear() {
+      ++m_current.numClears;
+    }
+
+    FORCEINLINE void
+    onCopy() {
+      ++m_current.numCopies;
+    }
+
+    FORCEINLINE void
+    onBind(RENDER_STAT_BIND::E type, bool bRedundant) {
+      ++m_current.binds[type];
+      m_current.redundantBinds[type] += bRedundant ? 1 : 0;
+    }
+
+    FORCEINLINE void
+    onUpload(SIZE_T bytes) {
+      ++m_current.numUploads;
+      m_current.uploadBytes += bytes;
+    }
+
+    FORCEINLINE void
+    onMap() {
+      ++m_current.numMaps;
+    }
+
+    FORCEINLINE void
+    onUnmap() {
+      ++m_current.numUnmaps;
+    }
+
+    static FORCEINLINE void
+    onResourceCreated(RENDER_STAT_RESOURCE::E type) {
+      s_created[type].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static FORCEINLINE void
+    onResourceReleased(RENDER_STAT_RESOURCE::E type) {
+      s_released[type].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Publishes the counters of the frame that just ended and starts
+     *        a new one.
+     */
+    void
+    endFrame();
+
+    /**
+     * @brief Counters of the last complete frame.
+     */
+    const RenderStats&
+    getLastFrame() const {
+      return m_lastFrame;
+    }
+
+    /**
+     * @brief Counters accumulated so far in the current frame.
+     */
+    const RenderStats&
+    getCurrentFrame() const {
+      return m_current;
+    }
+
+   private:
+    RenderStats m_current;
+    RenderStats m_lastFrame;
+    uint64 m_createdAtFrameStart[RENDER_STAT_RESOURCE::kNumResourceTypes] = {};
+    uint64 m_releasedAtFrameStart[RENDER_STAT_RESOURCE::kNumResourceTypes] = {};
+
+    static std::atomic<uint64> s_created[RENDER_STAT_RESOURCE::kNumResourceTypes];
+    static std::atomic<uint64> s_released[RENDER_STAT_RESOURCE::kNumResourceTypes];
+  };
+
+  /**
+   * @brief Shadow of the bound pipeline state used to tell redundant binds
+   *        apart. Objects are compared by their native handle. Every set
+   *        function returns true if the value was already bound.
+   */
+  class RenderBindCache
+  {
+   public:
+    static constexpr uint32 NUM_STAGES = 6;
+    static constexpr uint32 MAX_SRVS = 128;
+    static constexpr uint32 MAX_CONSTANT_BUFFERS = 14;
+    static constexpr uint32 MAX_SAMPLERS = 16;
+    static constexpr uint32 MAX_UAVS = 64;
+    static constexpr uint32 MAX_VERTEX_BUFFERS = 32;
+    static constexpr uint32 MAX_RENDER_TARGETS = 8;
+    static constexpr uint32 MAX_VIEWPORTS = 16;
+
+    RenderBindCache() {
+      reset();
+    }
+
+    /**
+     * @brief Everything unbound, matches the state after a ClearState.
+     */
+    void
+    reset();
+
+    /**
+     * @brief State unknown (e.g. after restoring a saved pipeline state),
+     *        the next bind of every slot counts as a real change.
+     */
+    void
+    invalidate();
+
+    FORCEINLINE bool
+    setShader(uint32 stage, const void* pShader) {
+      return _set(m_shaders[stage], pShader);
+    }
+
+    FORCEINLINE bool
+    setShaderResource(uint32 stage, uint32 slot, const void* pView) {
+      return slot < MAX_SRVS && _set(m_srvs[stage][slot], pView);
+    }
+
+    FORCEINLINE bool
+    setConstantBuffer(uint32 stage, uint32 slot, const void* pBuffer) {
+      return slot < MAX_CONSTANT_BUFFERS && _set(m_constantBuffers[stage][slot], pBuffer);
+    }
+
+    FORCEINLINE bool
+    setSampler(uint32 stage, uint32 slot, const void* pSampler) {
+      return slot < MAX_SAMPLERS && _set(m_samplers[stage][slot], pSampler);
+    }
+
+    FORCEINLINE bool
+    setUnorderedAccess(uint32 slot, const void* pView) {
+      return slot < MAX_UAVS && _set(m_uavs[slot], pView);
+    }
+
+    bool
+    setVertexBuffer(uint32 slot, const void* pBuffer, uint32 stride, uint32 offset);
+
+    bool
+    setIndexBuffer(const void* pBuffer, uint32 format, uint32 offset);
+
+    FORCEINLINE bool
+    setInputLayout(const void* pLayout) {
+      return _set(m_inputLayout, pLayout);
+    }
+
+    FORCEINLINE bool
+    setRasterizerState(const void* pState) {
+      return _set(m_rasterizerState, pState);
+    }
+
+    bool
+    setDepthStencilState(const void* pState, uint32 stencilRef);
+
+    bool
+    setBlendState(const void* pState, const float blendFactors[4], uint32 sampleMask);
+
+    bool
+    setTopology(uint32 topology);
+
+    bool
+    setRenderTargets(const void* const* ppTargets, uint32 numTargets, const void* pDepth);
+
+    /**
+     * @param pViewports Array of numViewports * 6 floats
+     *        (x, y, width, height, minDepth, maxDepth).
+     */
+    bool
+    setViewports(const float* pViewports, uint32 numViewports);
+
+   private:
+    static FORCEINLINE bool
+    _set(const void*& slot, const void* pValue) {
+      bool bRedundant = slot == pValue;
+      slot = pValue;
+      return bRedundant;
+    }
+
+    const void* m_shaders[NUM_STAGES];
+    const void* m_srvs[NUM_STAGES][MAX_SRVS];
+    const void* m_constantBuffers[NUM_STAGES][MAX_CONSTANT_BUFFERS];
+    const void* m_samplers[NUM_STAGES][MAX_SAMPLERS];
+    const void* m_uavs[MAX_UAVS];
+
+    const void* m_vertexBuffers[MAX_VERTEX_BUFFERS];
+    uint32 m_vertexStrides[MAX_VERTEX_BUFFERS];
+    uint32 m_vertexOffsets[MAX_VERTEX_BUFFERS];
+    const void* m_indexBuffer;
+    uint32 m_indexFormat;
+    uint32 m_indexOffset;
+
+    const void* m_inputLayout;
+    const void* m_rasterizerState;
+    const void* m_depthStencilState;
+    uint32 m_stencilRef;
+    const void* m_blendState;
+    float m_blendFactors[4];
+    uint32 m_sampleMask;
+    uint32 m_topology;
+
+    const void* m_renderTargets[MAX_RENDER_TARGETS];
+    uint32 m_numRenderTargets;
+    const void* m_depthTarget;
+
+    float m_viewports[MAX_VIEWPORTS * 6];
+    uint32 m_numViewports;
+  };
+
+} // namespace geEngineSDK
@@ -0,0 +1,213 @@
+/*****************************************************************************/
+/**
+ * @file    geRenderTrace.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Binary traces of the render API calls and their replay.
+ *
+ * A trace is a list of frames, every frame is a NullCommandStream (fixed size
+ * commands and their data pool). The first frames of a capture are setup
+ * frames: they create every resource that was alive when the capture started
+ * and bind the state that was bound, so the captured frames replay the same
+ * way on any backend. The replayer runs a trace as fast as possible and
+ * reports the CPU time of every frame.
+ *
+ * File layout (little endian, no padding between blocks):
+ *   RenderTraceHeader
+ *   for every frame: RenderTraceFrameHeader, commands, data pool
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geRenderAPI.h>
+
+#include "geNullCommandStream.h"
+
+namespace geEngineSDK {
+
+  struct RenderTraceHeader
+  {
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint32 commandSize = 0;     //sizeof(NullCommand) of the writer
+    uint32 numFrames = 0;
+    uint32 numSetupFrames = 0;
+  };
+
+  struct RenderTraceFrameHeader
+  {
+    uint32 numCommands = 0;
+    uint32 dataSize = 0;
+  };
+
+  /**
+   * @brief What the size of a write depends on, kept for every traced
+   *        resource.
+   */
+  struct RenderTraceResourceInfo
+  {
+    bool bBuffer = false;
+    SIZE_T sizeInBytes = 0;     //Buffers
+    uint32 width = 0;           //Textures
+    uint32 height = 0;
+    uint32 mipLevels = 1;
+    uint32 format = 0;          //GRAPHICS_FORMAT::E
+  };
+
+  class RenderTrace
+  {
+   public:
+    static constexpr uint32 MAGIC = 0x52544547;   //"GETR"
+    static constexpr uint32 VERSION = 1;
+
+    /**
+     * @brief Adds a frame at the end of the trace.
+     * @param bSetup Setup frames must be added before any other frame.
+     */
+    void
+    addFrame(const NullCommandStream& frame, bool bSetup = false);
+
+    void
+    clear();
+
+    bool
+    save(const Path& filePath) const;
+
+    bool
+    load(const Path& filePath);
+
+    const Vector<NullCommandStream>&
+    getFrames() const {
+      return m_frames;
+    }
+
+    uint32
+    getNumFrames() const {
+      return static_cast<uint32>(m_frames.size());
+    }
+
+    uint32
+    getNumSetupFrames() const {
+      return m_numSetupFrames;
+    }
+
+    /**
+     * @brief Bound of the object ids of the trace: one past the highest id
+     *        its commands create. Loaded traces reference no id above it.
+     */
+    uint32
+    getNumObjects() const {
+      return m_numObjects;
+    }
+
+    /**
+     * @brief Bytes read from the source of a writeToResource call, same
+     *        accounting as the DX11 backend (rows or blocks rows times the
+     *        source pitch).
+     */
+    static SIZE_T
+    getWriteSize(const RenderTraceResourceInfo& info,
+                 uint32 dstSubRes,
+                 const GRAPHICS_BOX* pDstBox,
+                 uint32 srcRowPitch,
+                 uint32 srcDepthPitch);
+
+   private:
+    Vector<NullCommandStream> m_frames;
+    uint32 m_numSetupFrames = 0;
+    uint32 m_numObjects = 0;
+  };
+
+  /**
+   * @brief CPU time of the replayed frames.
+   */
+  struct RenderTraceReplayStats
+  {
+    Vector<float> frameTimesMs;   //In replay order
+    uint32 numCommands = 0;
+    float totalMs = 0.0f;
+    float meanMs = 0.0f;
+    float minMs = 0.0f;
+    float p50Ms = 0.0f;
+    float p90Ms = 0.0f;
+    float p95Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+
+    /**
+     * @brief Fills the summary from frameTimesMs (nearest rank percentiles).
+     */
+    void
+    computeSummary();
+  };
+
+  /**
+   * @brief Plays a trace against a render API. The render API must be
+   *        initialized, resources are created on it and released with the
+   *        replayer.
+   */
+  class RenderTraceReplayer
+  {
+   public:
+    explicit RenderTraceReplayer(RenderAPI& renderAPI)
+      : m_renderAPI(renderAPI)
+    {}
+
+    /**
+     * @brief Runs the setup frames once, then every other frame numLoops
+     *        times without throttling. Only the non setup frames are timed.
+     */
+    RenderTraceReplayStats
+    replay(const RenderTrace& trace, uint32 numLoops = 1);
+
+    /**
+     * @brief Releases every object created by the replay.
+     */
+    void
+    reset();
+
+   private:
+    struct ReplayObject
+    {
+      NULL_COMMAND::E createdBy = NULL_COMMAND::kNumCommands;
+      SPtr<void> pObject;
+      RenderTraceResourceInfo info;
+    };
+
+    void
+    _execute(const NullCommandStream& frame, const NullCommand& command);
+
+    void
+    _executeCreate(const NullCommandStream& frame, const NullCommand& command);
+
+    /**
+     * @brief Object of an id, m_nullObject (cleared) if the trace doesn't
+     *        have that id.
+     */
+    ReplayObject&
+    _getObject(uint32 id);
+
+    template<class T>
+    SPtr<T>
+    _get(uint32 id) {
+      return std::static_pointer_cast<T>(_getObject(id).pObject);
+    }
+
+    SPtr<GraphicsResource>
+    _getResource(uint32 id);
+
+    RenderAPI& m_renderAPI;
+    Vector<ReplayObject> m_objects;     //Indexed by id
+    ReplayObject m_nullObject;          //Returned for ids out of the trace
+    Vector<uint8> m_scratch;            //Source of writes without data
+  };
+
+} // namespace geEngineSDK
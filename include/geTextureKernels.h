@@ -0,0 +1,180 @@
+/*****************************************************************************/
+/**
+ * @file    geTextureKernels.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU kernels to prepare texture data for upload.
+ *
+ * writeToResource takes the data of every subresource already converted,
+ * so the content pipeline builds the mip chains and converts the formats
+ * on the CPU before the upload:
+ *
+ * - Mip chains with the box or Kaiser filter. sRGB images are filtered in
+ *   linear space.
+ * - RGBA8 <-> BGRA8 swizzle.
+ * - float32 -> float16 conversion.
+ * - sRGB <-> linear conversion.
+ *
+ * The kernels use SSE2 (AVX2 and F16C when the CPU has them, checked at
+ * run time) or NEON, and split the work in rows or runs of pixels among
+ * worker threads. They don't depend on Direct3D, so any platform (and the
+ * tools) can use them.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <functional>
+
+namespace geEngineSDK {
+
+  namespace MIP_FILTER {
+    enum E {
+      kBox = 0,
+      kKaiser,
+      kNumFilters
+    };
+  }
+
+  namespace TEXTURE_PIXEL_FORMAT {
+    enum E {
+      kRGBA8 = 0,       //UNORM, filtered as stored
+      kRGBA8SRGB,       //UNORM with sRGB colors, filtered in linear space
+      kRGBA32F,
+      kNumFormats
+    };
+  }
+
+  /**
+   * @brief Pixels of an image (or a mip) in CPU memory.
+   */
+  struct TextureImage
+  {
+    uint8* pData = nullptr;
+    uint32 width = 0;
+    uint32 height = 0;
+    uint32 rowPitch = 0;    //Bytes from a row to the next
+  };
+
+  /**
+   * @brief Every mip of an image in one allocation, mip 0 included, with
+   *        rows tightly packed. mips[i] is subresource i of the texture.
+   */
+  struct TextureMipChain
+  {
+    TEXTURE_PIXEL_FORMAT::E format = TEXTURE_PIXEL_FORMAT::kRGBA8;
+    Vector<uint8> data;
+    Vector<TextureImage> mips;
+  };
+
+  namespace TextureKernels {
+    /**
+     * @brief Instruction set the kernels use on this CPU ("AVX2", "SSE2",
+     *        "NEON" or "Scalar").
+     */
+    const char*
+    getInstructionSet();
+
+    /**
+     * @brief Forces the scalar versions of the box filter, swizzle and half
+     *        conversion, to compare their results and speed with the SIMD
+     *        ones.
+     */
+    void
+    setSIMDEnabled(bool bEnabled);
+
+    bool
+    isSIMDEnabled();
+
+    /**
+     * @brief Worker threads the kernels use, 0 for one per hardware thread.
+     */
+    void
+    setNumThreads(uint32 numThreads);
+
+    uint32
+    getNumThreads();
+
+    /**
+     * @brief Runs fn(begin, end) over [0, count) in ranges of at least
+     *        minPerTask items spread among the worker threads. Small counts
+     *        run on the calling thread.
+     */
+    void
+    parallelFor(uint32 count,
+                uint32 minPerTask,
+                const std::function<void(uint32, uint32)>& fn);
+
+    uint32
+    getBytesPerPixel(TEXTURE_PIXEL_FORMAT::E format);
+
+    /**
+     * @brief Mips of a full chain down to 1x1.
+     */
+    uint32
+    getNumMips(uint32 width, uint32 height);
+
+    /**
+     * @brief Filters src into dst, which must be about half its size (the
+     *        size of the next mip). Odd sizes weight the source texels by
+     *        the area the destination texel covers.
+     */
+    void
+    downsample(const TextureImage& src,
+               const TextureImage& dst,
+               TEXTURE_PIXEL_FORMAT::E format,
+               MIP_FILTER::E filter = MIP_FILTER::kBox);
+
+    /**
+     * @brief Builds the mip chain of an image, each mip filtered from the
+     *        previous one.
+     * @param numMips Mips of the chain, mip 0 included. 0 for a full chain.
+     */
+    void
+    generateMipChain(const TextureImage& top,
+                     TEXTURE_PIXEL_FORMAT::E format,
+                     MIP_FILTER::E filter,
+                     uint32 numMips,
+                     TextureMipChain& chain);
+
+    /**
+     * @brief Swaps the red and blue channels. The same call converts BGRA8
+     *        to RGBA8. pSrc and pDst may be the same buffer.
+     */
+    void
+    swizzleRGBA8ToBGRA8(const uint8* pSrc, uint8* pDst, SIZE_T numPixels);
+
+    /**
+     * @brief Converts to IEEE half precision, rounding to nearest even.
+     *        Values over the half range become infinity.
+     */
+    void
+    convertFloatToHalf(const float* pSrc, uint16* pDst, SIZE_T count);
+
+    /**
+     * @brief RGBA8 sRGB to RGBA32F linear. Alpha is linear in both.
+     */
+    void
+    convertSRGBToLinear(const uint8* pSrc, float* pDst, SIZE_T numPixels);
+
+    /**
+     * @brief RGBA32F linear to RGBA8 sRGB. Alpha is linear in both.
+     *        The results are the ones of rounding the exact curve.
+     */
+    void
+    convertLinearToSRGB(const float* pSrc, uint8* pDst, SIZE_T numPixels);
+
+    float
+    floatFromHalf(uint16 value);
+
+    uint16
+    halfFromFloat(float value);
+  }
+} // namespace geEngineSDK
@@ -0,0 +1,585 @@
+/*****************************************************************************/
+/**
+ * @file    geTraceRenderAPI.h
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Render API that captures the calls made to another one.
+ *
+ * Forwards every call to the wrapped backend and, during the configured
+ * frame range, records it (with the data needed to create the resources)
+ * into a RenderTrace that is saved when the range ends. Enabled by setting
+ * "TraceCaptureFile" in the RenderAPI config section, the range is given by
+ * "TraceCaptureFirstFrame" and "TraceCaptureNumFrames".
+ *
+ * Backend specific methods (the ones that aren't part of RenderAPI) aren't
+ * reachable through the wrapper and aren't captured.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+#pragma once
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geRenderAPI.h>
+#include <geNumericLimits.h>
+#include <type_traits>
+
+#include "geNullCommandStream.h"
+#include "geRenderTrace.h"
+
+namespace geEngineSDK {
+
+  class TraceRenderAPI : public RenderAPI
+  {
+   public:
+    /**
+     * @param pBackend Render API that does the work, owned by the wrapper.
+     */
+    explicit TraceRenderAPI(SPtr<RenderAPI> pBackend);
+    virtual ~TraceRenderAPI();
+
+    bool
+    initRenderAPI(void* scrHandle, bool bFullScreen) override;
+
+    bool
+    resizeSwapChain(uint32 newWidth, uint32 newHeight) override;
+
+    bool
+    isMSAAFormatSupported(const GRAPHICS_FORMAT::E format,
+                          int32& samplesPerPixel,
+                          int32& sampleQuality) const override;
+
+    void
+    msaaResolveRenderTarget(const WeakSPtr<Texture>& pSrc,
+                            const WeakSPtr<Texture>& pDst) override;
+
+    void
+    reportLiveObjects() override;
+
+    /*************************************************************************/
+    // Get methods
+    /*************************************************************************/
+    WeakSPtr<Texture>
+    getBackBuffer() const override;
+
+    WeakSPtr<RasterizerState>
+    getCurrentRasterizerState() const override;
+
+    WeakSPtr<DepthStencilState>
+    getCurrentDepthStencilState() const override;
+
+    WeakSPtr<BlendState>
+    getCurrentBlendState() const override;
+
+    WeakSPtr<SamplerState>
+    getCurrentSamplerState(uint32 samplerSlot = 0) const override;
+
+    /*************************************************************************/
+    // Create methods
+    /*************************************************************************/
+    SPtr<Texture>
+    createTexture(uint32 width,
+                  uint32 height,
+                  GRAPHICS_FORMAT::E format,
+                  uint32 bindFlags = BIND_FLAG::SHADER_RESOURCE,
+                  uint32 mipLevels = 1,
+                  RESOURCE_USAGE::E usage = RESOURCE_USAGE::DEFAULT,
+                  uint32 cpuAccessFlags = 0,
+                  uint32 sampleCount = 1,
+                  bool isMSAA = false,
+                  bool isCubeMap = false,
+                  uint32 arraySize = 1) override;
+
+    SPtr<VertexDeclaration>
+    createVertexDeclaration(const Vector<VertexElement>& elements) override;
+
+    SPtr<StreamOutputDeclaration>
+    createStreamOutputDeclaration(const Vector<StreamOutputElement>& elements) override;
+
+    SPtr<InputLayout>
+    createInputLayout(const WeakSPtr<VertexDeclaration>& descArray,
+                      const WeakSPtr<VertexShader>& pVS) override;
+
+    SPtr<InputLayout>
+    createInputLayoutFromShader(const WeakSPtr<VertexShader>& pVS) override;
+
+    SPtr<VertexBuffer>
+    createVertexBuffer(const SPtr<VertexDeclaration>& pDecl,
+                       const SIZE_T sizeInBytes,
+                       const void* pInitialData = nullptr,
+                       const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<StreamOutputBuffer>
+    createStreamOutputBuffer(const SPtr<StreamOutputDeclaration>& pDecl,
+                             const SIZE_T sizeInBytes,
+                             const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<IndexBuffer>
+    createIndexBuffer(const SIZE_T sizeInBytes,
+                      const void* pInitialData = nullptr,
+                      const INDEX_BUFFER_FORMAT::E format = INDEX_BUFFER_FORMAT::R32_UINT,
+                      const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<ConstantBuffer>
+    createConstantBuffer(const SIZE_T sizeInBytes,
+                         const void* pInitialData = nullptr,
+                         const uint32 usage = RESOURCE_USAGE::DEFAULT) override;
+
+    SPtr<RasterizerState>
+    createRasterizerState(const RASTERIZER_DESC& rasterDesc) override;
+
+    SPtr<DepthStencilState>
+    createDepthStencilState(const DEPTH_STENCIL_DESC& depthStencilDesc) override;
+
+    SPtr<BlendState>
+    createBlendState(const BLEND_DESC& blendDesc,
+                     const Vector4 blendFactors = Vector4::ZERO,
+                     const uint32 sampleMask = NumLimit::MAX_UINT32) override;
+
+    SPtr<SamplerState>
+    createSamplerState(const SAMPLER_DESC& samplerDesc) override;
+
+    /*************************************************************************/
+    // Create Shaders
+    /*************************************************************************/
+    SPtr<VertexShader>
+    createVertexShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<PixelShader>
+    createPixelShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<GeometryShader>
+    createGeometryShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<GeometryShader>
+    createGeometryShaderWithStreamOutput(CREATE_SHADER_PARAMS,
+                                         const SPtr<StreamOutputDeclaration>& pDecl) override;
+
+    SPtr<HullShader>
+    createHullShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<DomainShader>
+    createDomainShader(CREATE_SHADER_PARAMS) override;
+
+    SPtr<ComputeShader>
+    createComputeShader(CREATE_SHADER_PARAMS) override;
+
+    /*************************************************************************/
+    // Write Functions
+    /*************************************************************************/
+    void
+    writeToResource(const WeakSPtr<GraphicsResource>& pResource,
+                    uint32 dstSubRes,
+                    const GRAPHICS_BOX* pDstBox,
+                    const void* pSrcData,
+                    uint32 srcRowPitch,
+                    uint32 srcDepthPitch,
+                    uint32 copyFlags = 0) override;
+
+    MappedSubresource
+    mapToRead(const WeakSPtr<GraphicsResource>& pTexture,
+              uint32 subResource = 0,
+              uint32 mapFlags = 0) override;
+
+    void
+    unmap(const WeakSPtr<GraphicsResource>& pTexture,
+          uint32 subResource = 0) override;
+
+    void
+    copyResource(const WeakSPtr<GraphicsResource>& pSrcObj,
+                 const WeakSPtr<GraphicsResource>& pDstObj) override;
+
+    void
+    generateMips(const WeakSPtr<Texture>& pTexture) override;
+
+    void
+    clearRenderTarget(const WeakSPtr<Texture>& pRenderTarget,
+                      const LinearColor& color = LinearColor::Black) override;
+
+    void
+    clearDepthStencil(const WeakSPtr<Texture>& pDepthStencilView,
+                      uint32 flags = CLEAR_FLAG::DEPTH | CLEAR_FLAG::STENCIL,
+                      float depthVal = 1.0f,
+                      uint8 stencilVal = 0U) override;
+
+    void
+    discardView(WeakSPtr<Texture> pTexture) override;
+
+    /**
+     * @brief Ends the frame. Starts, extends or finishes (and saves) the
+     *        capture depending on the frame number.
+     */
+    void
+    present() override;
+
+    /*************************************************************************/
+    // Set Objects
+    /*************************************************************************/
+    void
+    setImmediateContext() override;
+
+    void
+    setTopology(PRIMITIVE_TOPOLOGY::E topologyType) override;
+
+    void
+    setViewports(const Vector<GRAPHICS_VIEWPORT>& viewports) override;
+
+    void
+    setInputLayout(const WeakSPtr<InputLayout>& pInputLayout) override;
+
+    void
+    setRasterizerState(const WeakSPtr<RasterizerState>& pRasterizerState) override;
+
+    void
+    setDepthStencilState(const WeakSPtr<DepthStencilState>& pDepthStencilState,
+                         uint32 stencilRef = 0) override;
+
+    void
+    setBlendState(const WeakSPtr<BlendState>& pBlendState) override;
+
+    void
+    setVertexBuffer(const WeakSPtr<VertexBuffer>& pVertexBuffer,
+                    uint32 startSlot = 0,
+                    uint32 offset = 0) override;
+
+    void
+    setIndexBuffer(const WeakSPtr<IndexBuffer>& pIndexBuffer,
+                   uint32 offset = 0) override;
+
+    void
+    vsSetProgram(const WeakSPtr<VertexShader>& pInShader) override;
+
+    void
+    psSetProgram(const WeakSPtr<PixelShader>& pInShader) override;
+
+    void
+    gsSetProgram(const WeakSPtr<GeometryShader>& pInShader) override;
+
+    void
+    hsSetProgram(const WeakSPtr<HullShader>& pInShader) override;
+
+    void
+    dsSetProgram(const WeakSPtr<DomainShader>& pInShader) override;
+
+    void
+    csSetProgram(const WeakSPtr<ComputeShader>& pInShader) override;
+
+    void
+    vsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    psSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    gsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    hsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    dsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                             const uint32 startSlot = 0) override;
+
+    void
+    vsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    psSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    gsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    hsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    dsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    csSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                        const uint32 startSlot = 0) override;
+
+    void
+    vsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    psSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    gsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    hsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    dsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    csSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                 const uint32 startSlot = 0) override;
+
+    void
+    setRenderTargets(const Vector<RenderTarget>& pTargets,
+                     const WeakSPtr<Texture>& pDepthStencilView) override;
+
+    void
+    setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) override;
+
+    /*************************************************************************/
+    // State Management Functions
+    /*************************************************************************/
+    SPtr<PipelineState>
+    savePipelineState() const override;
+
+    void
+    restorePipelineState(const WeakSPtr<PipelineState>& pState) override;
+
+    /*************************************************************************/
+    // Draw Functions
+    /*************************************************************************/
+    void
+    draw(uint32 vertexCount, uint32 startVertexLocation = 0) override;
+
+    void
+    drawIndexed(uint32 indexCount,
+                uint32 startIndexLocation = 0,
+                int32 baseVertexLocation = 0) override;
+
+    void
+    drawInstanced(uint32 vertexCountPerInstance,
+                  uint32 instanceCount,
+                  uint32 startVertexLocation = 0,
+                  uint32 startInstanceLocation = 0) override;
+
+    void
+    drawAuto() override;
+
+    void
+    dispatch(uint32 threadGroupCountX,
+             uint32 threadGroupCountY = 1,
+             uint32 threadGroupCountZ = 1) override;
+
+    /*************************************************************************/
+    // Trace specific
+    /*************************************************************************/
+    /**
+     * @brief Captures numFrames frames starting at the next present, the
+     *        trace is saved to filePath when they are done.
+     */
+    void
+    startCapture(const Path& filePath, uint32 numFrames);
+
+    bool
+    isCapturing() const {
+      return m_bCapturing;
+    }
+
+    RenderAPI&
+    getBackend() {
+      return *m_pBackend;
+    }
+
+   private:
+    /**
+     * @brief Everything needed to recreate a live object at the start of a
+     *        capture.
+     */
+    struct TraceObject
+    {
+      const void* pKey = nullptr;
+      WeakSPtr<void> pObject;
+      NullCommand createCommand;
+      Vector<uint8> createData;
+      RenderTraceResourceInfo info;
+    };
+
+    /**
+     * @brief Last bind of a slot, replayed at the start of a capture.
+     */
+    struct TraceBind
+    {
+      uint64 sequence = 0;      //Binds are replayed in their original order
+      NullCommand command;
+      Vector<uint8> data;
+    };
+
+    /**
+     * @brief Objects are identified by the address of the complete object
+     *        so the same resource seen through different bases (e.g. a
+     *        Texture and a GraphicsResource) gets the same id.
+     */
+    template<class T>
+    static const void*
+    _getKey(const T* pObject) {
+      return _getKey(pObject, std::is_polymorphic<T>());
+    }
+
+    template<class T>
+    static const void*
+    _getKey(const T* pObject, std::true_type) {
+      return dynamic_cast<const void*>(pObject);
+    }
+
+    template<class T>
+    static const void*
+    _getKey(const T* pObject, std::false_type) {
+      return pObject;
+    }
+
+    template<class T>
+    uint32
+    _getId(const WeakSPtr<T>& pObject) const {
+      return pObject.expired() ? 0 : _getId(_getKey(pObject.lock().get()));
+    }
+
+    template<class T>
+    uint32
+    _getId(const SPtr<T>& pObject) const {
+      return pObject ? _getId(_getKey(pObject.get())) : 0;
+    }
+
+    uint32
+    _getId(const void* pKey) const;
+
+    /**
+     * @brief Gives an id to a new object and keeps its creation command.
+     */
+    template<class T>
+    uint32
+    _registerObject(const SPtr<T>& pObject,
+                    NULL_COMMAND::E type,
+                    NULL_SHADER_STAGE::E stage,
+                    uint32 arg0,
+                    uint32 arg1,
+                    uint32 arg2,
+                    uint32 arg3,
+                    const void* pData,
+                    SIZE_T dataSize) const {
+      if (!pObject) {
+        return 0;
+      }
+      return _registerObject(_getKey(pObject.get()),
+                             pObject,
+                             type,
+                             stage,
+                             arg0, arg1, arg2, arg3,
+                             pData,
+                             dataSize);
+    }
+
+    uint32
+    _registerObject(const void* pKey,
+                    WeakSPtr<void> pObject,
+                    NULL_COMMAND::E type,
+                    NULL_SHADER_STAGE::E stage,
+                    uint32 arg0,
+                    uint32 arg1,
+                    uint32 arg2,
+                    uint32 arg3,
+                    const void* pData,
+                    SIZE_T dataSize) const;
+
+    /**
+     * @brief Gives an id to the current back buffer if it doesn't have one.
+     */
+    uint32
+    _registerBackBuffer() const;
+
+    template<class T>
+    SPtr<T>
+    _createShader(SPtr<T> pShader,
+                  NULL_SHADER_STAGE::E stage,
+                  uint32 soDeclarationId,
+                  CREATE_SHADER_PARAMS);
+
+    void
+    _record(NULL_COMMAND::E type,
+            uint32 resourceId = 0,
+            uint32 slot = 0,
+            NULL_SHADER_STAGE::E stage = NULL_SHADER_STAGE::kNumStages,
+            uint32 arg0 = 0,
+            uint32 arg1 = 0,
+            uint32 arg2 = 0,
+            uint32 arg3 = 0,
+            const void* pData = nullptr,
+            uint32 dataSize = 0) const;
+
+    /**
+     * @brief Records a bind and remembers it as the last one of its slot.
+     */
+    void
+    _recordBind(NULL_COMMAND::E type,
+                uint32 resourceId,
+                uint32 slot = 0,
+                NULL_SHADER_STAGE::E stage = NULL_SHADER_STAGE::kNumStages,
+                uint32 arg0 = 0,
+                uint32 arg1 = 0,
+                const void* pData = nullptr,
+                uint32 dataSize = 0);
+
+    /**
+     * @brief Starts the capture with a setup frame: creation of the live
+     *        objects and the binds that are in effect.
+     */
+    void
+    _beginCapture();
+
+    /**
+     * @brief Forgets the objects that were released since the last call.
+     */
+    void
+    _collectReleasedObjects();
+
+    void
+    _finishCapture();
+
+   private:
+    SPtr<RenderAPI> m_pBackend;
+
+    //savePipelineState() and getBackBuffer() are const but are recorded
+    mutable NullCommandStream m_commands;
+    mutable UnorderedMap<const void*, uint32> m_ids;
+    mutable UnorderedMap<uint32, TraceObject> m_objects;
+    mutable uint32 m_nextId = 1;
+
+    UnorderedMap<uint64, TraceBind> m_binds;
+    mutable UnorderedMap<uint32, UnorderedMap<uint64, TraceBind>> m_savedBinds;
+    uint64 m_bindSequence = 0;
+    Vector<uint8> m_scratchData;
+
+    RenderTrace m_trace;
+    Path m_captureFile;
+    uint64 m_frameIndex = 0;
+    uint64 m_captureStartFrame = NumLimit::MAX_UINT64;
+    uint32 m_numFramesToCapture = 0;
+    bool m_bCapturing = false;
+  };
+
+} // namespace geEngineSDK
@@ -20,6 +20,7 @@
 #include "DX11RenderAPI.h"
 #include "DXGraphicsBuffer.h"
 #include "DXTranslateUtils.h"
+#include "DXDDSFile.h"
 
 #include <geGameConfig.h>
 #include <geMath.h>
@@ -199,6 +200,46 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     GE_ASSERT(m_pImmediateDC);
 
+    //Probing every format takes a while, a table saved on a previous start
+    //on the same adapter and driver is used instead when there is one
+    auto adapterIdentity = DXDeviceCaps::getAdapterIdentity(vecAdapters[adapterIndex],
+                                                            selectedFeatureLevel);
+    String capsFile = config.get<String>("RenderAPI", "DeviceCapsCacheFile", "");
+    if (capsFile.empty() || !m_deviceCaps.load(Path(capsFile), adapterIdentity)) {
+      m_deviceCaps.probe(m_pDevice, adapterIdentity);
+      if (!capsFile.empty()) {
+        m_deviceCaps.save(Path(capsFile));
+      }
+    }
+
+    m_mipGenerator.init(m_pDevice, &m_deviceCaps);
+    DXTexture::_setLoadDevice(m_pDevice);
+    DXShader::_setLoadDevice(m_pDevice);
+
+    String bytecodeMode = config.get<String>("RenderAPI", "ShaderBytecode", "Keep");
+    StringUtil::toUpperCase(bytecodeMode);
+    if ("STRIP" == bytecodeMode) {
+      DXShader::_setBytecodeMode(SHADER_BYTECODE_MODE::kStrip);
+    }
+    else if ("RELEASE" == bytecodeMode) {
+      DXShader::_setBytecodeMode(SHADER_BYTECODE_MODE::kRelease);
+    }
+    else {
+      DXShader::_setBytecodeMode(SHADER_BYTECODE_MODE::kKeep);
+    }
+
+    m_defaultMipDesc = MipGenerationDesc();
+    String mipGenFilter = config.get<String>("RenderAPI", "MipGenFilter", "Box");
+    StringUtil::toUpperCase(mipGenFilter);
+    if ("KAISER" == mipGenFilter) {
+      m_defaultMipDesc.filter = MIP_FILTER::kKaiser;
+    }
+
+    String shaderArchive = config.get<String>("RenderAPI", "ShaderArchive", "");
+    if (!shaderArchive.empty()) {
+      openShaderArchive(Path(shaderArchive));
+    }
+
     //Create a swap chain
 #if USING(DX_VERSION_11_0)
     DXGI_SWAP_CHAIN_DESC scDesc;
@@ -304,6 +345,29 @@ namespace geEngineSDK {
     throwIfFailed(dxgiDevice->SetMaximumFrameLatency(MaximumFrameLatency));
 
     setImmediateContext();
+    m_readbackQueue.init(m_pDevice, m_pImmediateDC);
+
+    m_uploadScheduler.init(m_pDevice, m_pImmediateDC);
+    m_uploadScheduler.setBytesPerFrame(
+      config.get<uint32>("RenderAPI", "UploadBytesPerFrame", 8 * 1024 * 1024));
+
+    //Before init, which opens the scope of the first frame
+    m_gpuProfiler.setPipelineStatsEnabled(
+      config.get<uint32>("RenderAPI", "GPUPipelineStatistics", 0) != 0);
+    m_gpuProfiler.init(m_pDevice, m_pImmediateDC);
+
+    m_memoryTracker.init(
+      dxgiAdapter,
+      config.get<uint32>("RenderAPI", "MemoryBudgetQueryInterval", 30),
+      config.get<uint32>("RenderAPI", "MemoryBudgetWarningPercent", 90) / 100.0f);
+
+    m_timeline.init(&m_gpuProfiler);
+    String timelineFile = config.get<String>("RenderAPI", "TimelineCaptureFile", "");
+    if (!timelineFile.empty()) {
+      m_timeline.start(Path(timelineFile),
+                       config.get<uint32>("RenderAPI", "TimelineCaptureNumFrames", 1),
+                       config.get<uint32>("RenderAPI", "TimelineCaptureFirstFrame", 0));
+    }
 
     //Get the required interfaces for the screen and targets
     _updateBackBufferTexture();
@@ -355,6 +419,15 @@ namespace geEngineSDK {
   DX11RenderAPI::~DX11RenderAPI() {
     //Cleanup all the member objects in order
     m_pBackBufferTexture = nullptr;
+    DXTexture::_setLoadDevice(nullptr);
+    DXShader::_setLoadDevice(nullptr);
+    m_shaderArchive.close();
+    m_timeline.release();
+    m_mipGenerator.release();
+    m_memoryTracker.release();
+    m_gpuProfiler.release();
+    m_uploadScheduler.release();
+    m_readbackQueue.release();
     safeRelease(m_pSwapChain);
 
     m_pActiveContext = nullptr;
@@ -374,8 +447,10 @@ namespace geEngineSDK {
       return false;
     }
 
+    TimelineScope timelineScope(m_timeline, "ResizeSwapChain");
     m_pBackBufferTexture->release();
     m_pImmediateDC->ClearState();
+    m_bindCache.reset();
 
     DXGI_SWAP_CHAIN_DESC scDesc;
     m_pSwapChain->GetDesc(&scDesc);
@@ -394,55 +469,24 @@ namespace geEngineSDK {
   DX11RenderAPI::isMSAAFormatSupported(const GRAPHICS_FORMAT::E format,
                                        int32& samplesPerPixel,
                                        int32& sampleQuality) const {
-    GE_ASSERT(m_pDevice);
-
-    SPtr<DXTexture> pBackBuffer = ge_shared_ptr_new<DXTexture>();
-
-#if USING(GE_CPP17_OR_LATER)
-    static UnorderedMap<GRAPHICS_FORMAT::E, Optional<pair<int32, int32>>> s_msaaCache;
-    auto it = s_msaaCache.find(format);
-    if (it != s_msaaCache.end()) {
-      if(it->second.has_value()) {
-        samplesPerPixel = it->second->first;
-        sampleQuality = it->second->second;
-        return true;
-      }
-      return true;
-    }
-#endif
+    GE_ASSERT(m_deviceCaps.isValid());
 
     samplesPerPixel = 1;
     sampleQuality = 0;
-    const DXGI_FORMAT dxFormat = TranslateUtils::get(format);
 
+    const DXGI_FORMAT dxFormat = TranslateUtils::get(format);
     if (dxFormat == DXGI_FORMAT_UNKNOWN) {
       return false;
     }
 
-    //Iterate to determine the maximum sample count supported for the format
-    for (int32 i = D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT; i > 0; --i) {
-      uint32 quality;
-      HRESULT hr = E_FAIL;
-#if USING(DX_VERSION_11_0)
-      hr = m_pDevice->CheckMultisampleQualityLevels(dxFormat, i, &quality);
-#else
-      hr = m_pDevice->CheckMultisampleQualityLevels1(dxFormat, i, 0, &quality);
-#endif
-      if (SUCCEEDED(hr)) {
-        if (quality > 0) {
-          samplesPerPixel = i;
-          sampleQuality = quality - 1;
-#if USING(GE_CPP17_OR_LATER)
-          s_msaaCache[format] = make_pair(samplesPerPixel, sampleQuality);
-#endif
-          return true;
-        }
-      }
+    const DXFormatCaps& formatCaps = m_deviceCaps.getFormatCaps(dxFormat);
+    if (0 == formatCaps.maxSampleCount) {
+      return false;
     }
-#if USING(GE_CPP17_OR_LATER)
-    s_msaaCache[format] = NullOpt;
-#endif
-    return false;
+
+    samplesPerPixel = static_cast<int32>(formatCaps.maxSampleCount);
+    sampleQuality = static_cast<int32>(formatCaps.maxSampleQuality);
+    return true;
   }
 
   void
@@ -459,6 +503,7 @@ namespace geEngineSDK {
 
     auto dstFormat = TranslateUtils::get(pDstObj->getDesc().format);
 
+    m_stats.onCopy();
     m_pActiveContext->ResolveSubresource(pDstObj->m_pTexture, 0,
                                          pSrcObj->m_pTexture, 0,
                                          dstFormat);
@@ -489,6 +534,18 @@ namespace geEngineSDK {
                                bool isCubeMap,
                                uint32 arraySize) {
     GE_ASSERT(m_pDevice);
+    TimelineScope timelineScope(m_timeline, "CreateTexture", "Resource");
+    if (timelineScope.isActive()) {
+      timelineScope.setArgs(StringUtil::format("\"width\":{0},\"height\":{1},\"format\":{2},"
+                                               "\"mips\":{3},\"arraySize\":{4}",
+                                               width,
+                                               height,
+                                               static_cast<uint32>(format),
+                                               mipLevels,
+                                               arraySize));
+    }
+    //The view dimensions are taken from the sample count of the resource
+    GE_UNREFERENCED_PARAMETER(isMSAA);
 
     auto pTexture = ge_shared_ptr_new<DXTexture>();
 
@@ -544,135 +601,181 @@ namespace geEngineSDK {
     tDesc.CPUAccessFlags = cpuAccessFlags;
     tDesc.MiscFlags = isCubeMap ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
 
-    bool autogenMipmaps = false;
-    if (mipLevels != 1 && usage != RESOURCE_USAGE::STAGING) {
-      //Check if the format supports mipmaps
-      uint32 fmtSupport = 0;
-      HRESULT hr = m_pDevice->CheckFormatSupport(tex_format, &fmtSupport);
-      if (SUCCEEDED(hr) && (fmtSupport & D3D11_FORMAT_SUPPORT_MIP_AUTOGEN)) {
-        //If we want mipmaps, we REQUIRE that it is binded as a render target too
-        tDesc.BindFlags |= D3D11_BIND_RENDER_TARGET;
-        tDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
-        if (mipLevels == 0) {
-          mipLevels = static_cast<uint32>(Math::log2(float(Math::max(width, height)))) + 1;
-          autogenMipmaps = true;
-        }
-      }
-    }
-
+    //Mips are generated with compute shaders (DXMipGenerator), the texture
+    //doesn't need to be a render target for that
     throwIfFailed(m_pDevice->CreateTexture2D(&tDesc,
                                              nullptr,
                                              &pTexture->m_pTexture));
 
-    if (bindFlags & D3D11_BIND_RENDER_TARGET && !isCubeMap) {
-#if !USING(DX_VERSION_11_3) && !USING(DX_VERSION_11_4)
-      D3D11_RENDER_TARGET_VIEW_DESC rDesc;
-#else
-      D3D11_RENDER_TARGET_VIEW_DESC1 rDesc;
-#endif
-      rDesc.Format = tex_format;
-      rDesc.ViewDimension = (sampleCount > 1 || isMSAA) ?
-        D3D11_RTV_DIMENSION_TEXTURE2DMS : D3D11_RTV_DIMENSION_TEXTURE2D;
-
-      pTexture->m_ppRTV.resize(mipLevels);
-      for (uint32 i = 0; i < mipLevels; ++i) {
-        rDesc.Texture2D.MipSlice = i;
-#if USING(DX_VERSION_11_3) || USING(DX_VERSION_11_4)
-        rDesc.Texture2D.PlaneSlice = 0;
-        throwIfFailed(m_pDevice->CreateRenderTargetView1(pTexture->m_pTexture,
-                                                         &rDesc,
-                                                         &pTexture->m_ppRTV[i]));
-#else
-        throwIfFailed(m_pDevice->CreateRenderTargetView(pTexture->m_pTexture,
-                                                        &rDesc,
-                                                        &pTexture->m_ppRTV[i]));
-#endif          
-      }
-    }
+    //Read back the description to get the real values of defaulted fields
+    pTexture->m_pTexture->GetDesc(&tDesc);
 
-    if (bindFlags & D3D11_BIND_DEPTH_STENCIL && !isCubeMap) {
-      D3D11_DEPTH_STENCIL_VIEW_DESC descDSV;
-      ge_zero_out(descDSV);
+    //Views are created on demand, only the formats to use are stored here
+    pTexture->_initViews(m_pDevice, tex_format, srv_format, dsv_format);
 
-      descDSV.Flags = 0;
-      descDSV.Format = dsv_format;
-      descDSV.ViewDimension = (sampleCount > 1 || isMSAA) ?
-        D3D11_DSV_DIMENSION_TEXTURE2DMS : D3D11_DSV_DIMENSION_TEXTURE2D;
-      descDSV.Texture2D.MipSlice = 0;
+    pTexture->m_desc = TranslateUtils::get(tDesc);
+    pTexture->m_bIsCubeMap = isCubeMap;
 
-      throwIfFailed(m_pDevice->CreateDepthStencilView(pTexture->m_pTexture,
-        &descDSV,
-        &pTexture->m_pDSV));
+    GPU_MEMORY_CATEGORY::E memCategory = GPU_MEMORY_CATEGORY::kTexture;
+    if (tDesc.BindFlags & D3D11_BIND_DEPTH_STENCIL) {
+      memCategory = GPU_MEMORY_CATEGORY::kDepthStencil;
+    }
+    else if (tDesc.BindFlags & (D3D11_BIND_RENDER_TARGET | D3D11_BIND_UNORDERED_ACCESS)) {
+      memCategory = GPU_MEMORY_CATEGORY::kRenderTarget;
+    }
+    else if (D3D11_USAGE_STAGING == tDesc.Usage) {
+      memCategory = GPU_MEMORY_CATEGORY::kStaging;
+    }
+    DXMemoryTracker::onAllocated(pTexture->m_pTexture,
+                                 memCategory,
+                                 DXTexture::computeMemoryUsage(tDesc));
 
-      descDSV.Flags |= D3D11_DSV_READ_ONLY_DEPTH;
-      if (DXGI_FORMAT_D24_UNORM_S8_UINT == dsv_format) {
-        descDSV.Flags |= D3D11_DSV_READ_ONLY_STENCIL;
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kTexture);
+    return pTexture;
+  }
+
+  namespace {
+    bool
+    getBlockFormat(DXGI_FORMAT format, BC_FORMAT::E& blockFormat) {
+      switch (format) {
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC1_UNORM_SRGB:
+          blockFormat = BC_FORMAT::kBC1;
+          return true;
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC3_UNORM_SRGB:
+          blockFormat = BC_FORMAT::kBC3;
+          return true;
+        case DXGI_FORMAT_BC4_UNORM:
+          blockFormat = BC_FORMAT::kBC4;
+          return true;
+        case DXGI_FORMAT_BC5_UNORM:
+          blockFormat = BC_FORMAT::kBC5;
+          return true;
+        case DXGI_FORMAT_BC7_UNORM:
+        case DXGI_FORMAT_BC7_UNORM_SRGB:
+          blockFormat = BC_FORMAT::kBC7;
+          return true;
+        default:
+          return false;
       }
+    }
+  }
+
+  SPtr<Texture>
+  DX11RenderAPI::createTextureFromPixels(const TextureImage& image,
+                                         GRAPHICS_FORMAT::E format,
+                                         uint32 mipLevels,
+                                         BC_QUALITY::E quality) {
+    GE_ASSERT(image.pData && image.width > 0 && image.height > 0);
+
+    const DXGI_FORMAT dxFormat = TranslateUtils::get(format);
+    const auto& formatInfo = TranslateUtils::getFormatInfo(dxFormat);
+    const bool bBGRA = DXGI_FORMAT_B8G8R8A8_UNORM == dxFormat ||
+                       DXGI_FORMAT_B8G8R8A8_UNORM_SRGB == dxFormat;
+
+    BC_FORMAT::E blockFormat = BC_FORMAT::kBC1;
+    const bool bCompressed = getBlockFormat(dxFormat, blockFormat);
+    if (!bCompressed && !bBGRA &&
+        DXGI_FORMAT_R8G8B8A8_UNORM != dxFormat &&
+        DXGI_FORMAT_R8G8B8A8_UNORM_SRGB != dxFormat) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Can't create a texture of format {0} from RGBA8 pixels",
+             formatInfo.name);
+      return nullptr;
+    }
 
-      throwIfFailed(m_pDevice->CreateDepthStencilView(pTexture->m_pTexture,
-        &descDSV,
-        &pTexture->m_pRO_DSV));
+    //Direct3D only pads the small mips, the top one must be whole blocks
+    if (bCompressed && (0 != image.width % 4 || 0 != image.height % 4)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Block compressed textures need dimensions multiple of 4, got {0}x{1}",
+             image.width,
+             image.height);
+      return nullptr;
     }
 
-    if (bindFlags & D3D11_BIND_UNORDERED_ACCESS && !isCubeMap) {
-      D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
-      uavDesc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2D;
-      uavDesc.Format = tex_format;
+    TimelineScope timelineScope(m_timeline, "CreateTextureFromPixels", "Resource");
+
+    //sRGB colors are filtered in linear space, and block encoded as stored
+    const auto pixelFormat = formatInfo.hasFlag(TranslateUtils::FORMAT_FLAG::kSRGB) ?
+                               TEXTURE_PIXEL_FORMAT::kRGBA8SRGB :
+                               TEXTURE_PIXEL_FORMAT::kRGBA8;
+    TextureMipChain chain;
+    TextureKernels::generateMipChain(image,
+                                     pixelFormat,
+                                     m_defaultMipDesc.filter,
+                                     mipLevels,
+                                     chain);
+    const auto numMips = static_cast<uint32>(chain.mips.size());
+
+    auto pTexture = createTexture(image.width,
+                                  image.height,
+                                  format,
+                                  BIND_FLAG::SHADER_RESOURCE,
+                                  numMips);
+    if (!pTexture) {
+      return nullptr;
+    }
 
-      pTexture->m_ppUAV.resize(mipLevels);
-      for (uint32 i = 0; i < mipLevels; ++i) {
-        uavDesc.Texture2D.MipSlice = i;
-        throwIfFailed(m_pDevice->CreateUnorderedAccessView(pTexture->m_pTexture,
-                                                           &uavDesc,
-                                                           &pTexture->m_ppUAV[i]));
+    if (bCompressed) {
+      Vector<uint8> blocks;
+      Vector<SIZE_T> offsets;
+      BlockCompression::compressMipChain(chain, blockFormat, quality, blocks, offsets);
+      for (uint32 i = 0; i < numMips; ++i) {
+        writeToResource(pTexture,
+                        i,
+                        nullptr,
+                        blocks.data() + offsets[i],
+                        BlockCompression::getRowPitch(blockFormat, chain.mips[i].width),
+                        0);
       }
+      return pTexture;
     }
 
-    if (bindFlags & D3D11_BIND_SHADER_RESOURCE) {
-      pTexture->m_ppSRV.resize(1); //mipLevels
-
-      D3D11_SHADER_RESOURCE_VIEW_DESC sDesc = CD3D11_SHADER_RESOURCE_VIEW_DESC();
-      sDesc.Format = srv_format;
+    if (bBGRA) {
+      TextureKernels::swizzleRGBA8ToBGRA8(chain.data.data(),
+                                          chain.data.data(),
+                                          chain.data.size() / 4);
+    }
+    for (uint32 i = 0; i < numMips; ++i) {
+      writeToResource(pTexture, i, nullptr, chain.mips[i].pData, chain.mips[i].rowPitch, 0);
+    }
+    return pTexture;
+  }
 
-      if (isCubeMap) {
-        if (arraySize > 1) {
-          sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY;
-          sDesc.TextureCubeArray.First2DArrayFace = 0;
-          sDesc.TextureCubeArray.NumCubes = arraySize;
-          sDesc.TextureCubeArray.MostDetailedMip = 0;
-          sDesc.TextureCubeArray.MipLevels = mipLevels;
-        }
-        else {
-          sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
-          sDesc.TextureCube.MipLevels = mipLevels;
-          sDesc.TextureCube.MostDetailedMip = 0;
-          sDesc.TextureCubeArray.MipLevels = mipLevels;
-        }
+  Vector<SPtr<Texture>>
+  DX11RenderAPI::loadTextures(const Vector<Path>& filePaths) {
+    GE_ASSERT(m_pDevice);
+    TimelineScope timelineScope(m_timeline, "LoadTextures", "Resource");
+
+    //Mapping the files and parsing the headers doesn't need the device
+    const auto numFiles = static_cast<uint32>(filePaths.size());
+    Vector<DXDDSFile> files(numFiles);
+    TextureKernels::parallelFor(numFiles, 1, [&](uint32 begin, uint32 end) {
+      for (uint32 i = begin; i < end; ++i) {
+        files[i].open(filePaths[i]);
       }
-      else {
-        sDesc.ViewDimension = (sampleCount > 1 || isMSAA) ?
-          D3D11_SRV_DIMENSION_TEXTURE2DMS : D3D11_SRV_DIMENSION_TEXTURE2D;
-        sDesc.Texture2D.MostDetailedMip = 0;
-        sDesc.Texture2D.MipLevels = mipLevels;
+    });
+
+    Vector<SPtr<Texture>> textures(numFiles);
+    for (uint32 i = 0; i < numFiles; ++i) {
+      if (!files[i].isValid()) {
+        continue;
       }
 
-      //for (uint32 i = 0; i < mipLevels; ++i)
-      uint32 i = 0;
-      {
-        throwIfFailed(m_pDevice->CreateShaderResourceView(pTexture->m_pTexture,
-                                                          &sDesc,
-                                                          &pTexture->m_ppSRV[i]));
+      auto pTexture = ge_shared_ptr_new<DXTexture>();
+      if (pTexture->_createFromDDS(m_pDevice, files[i])) {
+        pTexture->setPath(filePaths[i]);
+        pTexture->setDebugName(filePaths[i].toString());
+        textures[i] = pTexture;
       }
-    }
 
-    if (autogenMipmaps) {
-      generateMips(pTexture);
+      //The texture has its own copy, the pages can go
+      files[i].close();
     }
-
-    pTexture->m_desc = TranslateUtils::get(tDesc);
-    pTexture->m_bIsCubeMap = isCubeMap;
-
-    return pTexture;
+    return textures;
   }
 
   SPtr<VertexDeclaration>
@@ -745,8 +848,8 @@ namespace geEngineSDK {
 
     HRESULT hr = m_pDevice->CreateInputLayout(&dxDescArray[0],
                                               static_cast<uint32>(dxDescArray.size()),
-                                              vs->m_pBlob->GetBufferPointer(),
-                                              vs->m_pBlob->GetBufferSize(),
+                                              vs->getInputSignature(),
+                                              vs->getInputSignatureSize(),
                                               &inputLayout->m_inputLayout);
     if (FAILED(hr)) {
       GE_LOG(kError,
@@ -758,6 +861,7 @@ namespace geEngineSDK {
     //Should we set the vertex declaration here?
     inputLayout->m_vertexDeclaration = pDesc;
 
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kInputLayout);
     return inputLayout;
   }
 
@@ -772,49 +876,37 @@ namespace geEngineSDK {
       return nullptr;
     }
 
-    //Use the reflection API to get the input layout
-    ID3D11ShaderReflection* pReflector = nullptr;
+    //The inputs are reflected once, or when the shader was created if its
+    //bytecode was stripped afterwards
+    Vector<VertexElement> vertexElements;
     {//This scope is to unlock the Vertex Shader after reflection
       auto pDXVS = reinterpret_cast<DXShader*>(pVS.lock().get());
-      throwIfFailed(D3DReflect(pDXVS->m_pBlob->GetBufferPointer(),
-                               pDXVS->m_pBlob->GetBufferSize(),
-                               __uuidof(ID3D11ShaderReflection),
-                               reinterpret_cast<void**>(&pReflector)));
-
-    }
+      if (!pDXVS->_reflectInputs()) {
+        return nullptr;
+      }
 
-    D3D11_SHADER_DESC shaderDesc;
-    pReflector->GetDesc(&shaderDesc);
+      const auto& inputParameters = pDXVS->getInputParameters();
+      vertexElements.reserve(inputParameters.size());
 
-    Vector<D3D11_INPUT_ELEMENT_DESC> descArray;
-    descArray.reserve(shaderDesc.InputParameters);
-    
-    Vector<VertexElement> vertexElements;
-    vertexElements.reserve(shaderDesc.InputParameters);
+      //Loop through all the input parameters and create the vertex elements
+      uint32 offset = 0;
+      for (const auto& param : inputParameters) {
+        //We ignore the system value semantics, as they are not used in the vertex shader
+        if (StringUtil::startsWith(param.semanticName, "sv_")) {
+          continue;
+        }
 
-    //Loop through all the input parameters and create the input element descriptors
-    uint32 offset = 0;
-    for (uint32 i = 0; i < shaderDesc.InputParameters; ++i) {
-      D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
-      throwIfFailed(pReflector->GetInputParameterDesc(i, &paramDesc));
+        vertexElements.emplace_back(param.stream,
+                                    offset,
+                                    TranslateUtils::getInputType(param.componentType,
+                                      param.mask),
+                                    TranslateUtils::get(param.semanticName.c_str()),
+                                    param.semanticIndex);
 
-      //We ignore the system value semantics, as they are not used in the vertex shader
-      if (StringUtil::startsWith(String(paramDesc.SemanticName), "sv_")) {
-        continue;
+        offset += vertexElements.back().getSize();
       }
-
-      vertexElements.emplace_back(paramDesc.Stream,
-                                  offset,
-                                  TranslateUtils::getInputType(paramDesc.ComponentType,
-                                    paramDesc.Mask),
-                                  TranslateUtils::get(paramDesc.SemanticName),
-                                  paramDesc.SemanticIndex);
-
-      offset += vertexElements.back().getSize();
     }
 
-    safeRelease(pReflector);
-
     //Create the vertex declaration from the elements
     auto pVertexDecl = createVertexDeclaration(vertexElements);
     
@@ -833,7 +925,13 @@ namespace geEngineSDK {
                                ID3D11Buffer** outBuffer,
                                D3D11_BUFFER_DESC& outDesc) const {
     GE_ASSERT(m_pDevice && outBuffer && sizeInBytes > 0 && bindFlags != 0);
-    
+    TimelineScope timelineScope(m_timeline, "CreateBuffer", "Resource");
+    if (timelineScope.isActive()) {
+      timelineScope.setArgs(StringUtil::format("\"bytes\":{0},\"bindFlags\":{1}",
+                                               static_cast<uint64>(sizeInBytes),
+                                               bindFlags));
+    }
+
     ge_zero_out(outDesc);
     outDesc.Usage = static_cast<D3D11_USAGE>(usage);
     outDesc.ByteWidth = static_cast<UINT>(sizeInBytes);
@@ -850,6 +948,19 @@ namespace geEngineSDK {
     throwIfFailed(m_pDevice->CreateBuffer(&outDesc,
                                           pInitialData ? &InitData : nullptr,
                                           outBuffer));
+
+    GPU_MEMORY_CATEGORY::E memCategory = GPU_MEMORY_CATEGORY::kVertexBuffer;
+    if (bindFlags & D3D11_BIND_STREAM_OUTPUT) {
+      memCategory = GPU_MEMORY_CATEGORY::kStreamOutput;
+    }
+    else if (bindFlags & D3D11_BIND_INDEX_BUFFER) {
+      memCategory = GPU_MEMORY_CATEGORY::kIndexBuffer;
+    }
+    else if (bindFlags & D3D11_BIND_CONSTANT_BUFFER) {
+      memCategory = GPU_MEMORY_CATEGORY::kConstantBuffer;
+    }
+    DXMemoryTracker::onAllocated(*outBuffer, memCategory, outDesc.ByteWidth);
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kBuffer);
   }
 
   SPtr<VertexBuffer>
@@ -965,6 +1076,7 @@ namespace geEngineSDK {
     throwIfFailed(m_pDevice->CreateRasterizerState2(&desc, &pRS->m_pRasterizerState));
 #endif
 
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kState);
     return pRS;
   }
 
@@ -977,6 +1089,7 @@ namespace geEngineSDK {
     memcpy(&desc, &depthStencilDesc, sizeof(desc));
 
     throwIfFailed(m_pDevice->CreateDepthStencilState(&desc, &pDSS->m_pDepthStencilState));
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kState);
     return pDSS;
   }
 
@@ -1018,6 +1131,7 @@ namespace geEngineSDK {
     pBS->m_blendFactors = blendFactors;
     pBS->m_sampleMask = sampleMask;
 
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kState);
     return pBS;
   }
 
@@ -1031,6 +1145,7 @@ namespace geEngineSDK {
 
     throwIfFailed(m_pDevice->CreateSamplerState(&desc, &pSS->m_pSampler));
 
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kState);
     return pSS;
   }
 
@@ -1042,7 +1157,17 @@ namespace geEngineSDK {
                    const Vector<ShaderMacro>& pMacros,
                    const String szEntryPoint,
                    const String szShaderModel,
-                   ID3DBlob** pBlob) {
+                   ID3DBlob** pBlob,
+                   DXTimelineCapture& timeline) {
+    TimelineScope timelineScope(timeline, "CompileShader", "Shader");
+    if (timelineScope.isActive()) {
+      timelineScope.setArgs(
+        StringUtil::format("\"file\":\"{0}\",\"entry\":\"{1}\",\"model\":\"{2}\"",
+                           DXTimelineCapture::escape(fileName.toString()),
+                           DXTimelineCapture::escape(szEntryPoint),
+                           DXTimelineCapture::escape(szShaderModel)));
+    }
+
     HRESULT hr = S_OK;
     int32 dwShaderFlags = D3DCOMPILE_ENABLE_STRICTNESS ;
 #if USING(GE_DEBUG_MODE)
@@ -1095,20 +1220,86 @@ namespace geEngineSDK {
     return true;
   }
 
+  bool
+  DX11RenderAPI::openShaderArchive(const Path& filePath) {
+    TimelineScope timelineScope(m_timeline, "OpenShaderArchive", "Shader");
+    if (!m_shaderArchive.open(filePath)) {
+      return false;
+    }
+
+    g_debug().log(StringUtil::format("Shader archive {0}: {1} shaders",
+                                     filePath.toString(),
+                                     m_shaderArchive.getNumShaders()),
+                  LogVerbosity::kInfo);
+    return true;
+  }
+
+  void
+  DX11RenderAPI::closeShaderArchive() {
+    m_shaderArchive.close();
+  }
+
+  bool
+  DX11RenderAPI::compileShader(const Path& fileName,
+                               const Vector<ShaderMacro>& macros,
+                               const String& szEntryPoint,
+                               const String& szShaderModel,
+                               ID3DBlob** ppBlob) {
+    return _compileFromFile(fileName, macros, szEntryPoint, szShaderModel, ppBlob, m_timeline);
+  }
+
+  bool
+  DX11RenderAPI::_getBytecode(DXShader& shader,
+                              const Path& fileName,
+                              const Vector<ShaderMacro>& macros,
+                              const String& szEntryPoint,
+                              const String& szShaderModel,
+                              DXBC_PROGRAM_TYPE::E programType) {
+    if (m_shaderArchive.isOpen()) {
+      SIZE_T size = 0;
+      auto key = DXShaderArchive::makeKey(fileName, macros, szEntryPoint, szShaderModel);
+      const uint8* pBytecode = m_shaderArchive.find(key, size);
+      if (pBytecode && DXShader::getProgramType(pBytecode, size) == programType) {
+        //The device reads it from the mapping, nothing is copied. The shader
+        //keeps the mapping alive if the archive is closed or opened again
+        shader.m_pArchiveMapping = m_shaderArchive.getMapping();
+        shader.m_pArchiveBytecode = pBytecode;
+        shader.m_archiveBytecodeSize = size;
+        return true;
+      }
+
+      if (pBytecode) {
+        GE_LOG(kWarning,
+               RenderAPI,
+               "The archived {0} of {1} is for another stage, it will be compiled",
+               szEntryPoint,
+               fileName);
+      }
+    }
+
+    return _compileFromFile(fileName,
+                            macros,
+                            szEntryPoint,
+                            szShaderModel,
+                            &shader.m_pBlob,
+                            m_timeline);
+  }
+
   SPtr<VertexShader>
   DX11RenderAPI::createVertexShader(CREATE_SHADER_PARAMS) {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kVertex)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile VertexShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreateVertexShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreateVertexShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11VertexShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1120,6 +1311,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kVertex;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1128,15 +1325,16 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kPixel)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile PixelShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreatePixelShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreatePixelShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11PixelShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1148,6 +1346,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kPixel;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1156,15 +1360,16 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kGeometry)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile GeometryShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreateGeometryShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreateGeometryShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11GeometryShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1176,6 +1381,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kGeometry;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1203,7 +1414,8 @@ namespace geEngineSDK {
 
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kGeometry)) {
       GE_LOG(kError,
         RenderAPI,
         "Could not compile GeometryShader Shader from {1}", fileName);
@@ -1213,8 +1425,8 @@ namespace geEngineSDK {
     UINT stride = pDecl->getProperties().getComponentCountForOutputSlot(0) * sizeof(float);
 
     HRESULT hr = m_pDevice->CreateGeometryShaderWithStreamOutput(
-                              vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+                              vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               pDeclArray.data(),
                               static_cast<UINT>(pDeclArray.size()),
                               &stride,
@@ -1231,6 +1443,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kGeometry;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
 
   }
@@ -1240,15 +1458,16 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kHull)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile HullShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreateHullShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreateHullShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11HullShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1260,6 +1479,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kHull;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1268,15 +1493,16 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kDomain)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile DomainShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreateDomainShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreateDomainShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11DomainShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1288,6 +1514,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kDomain;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1296,15 +1528,16 @@ namespace geEngineSDK {
     GE_ASSERT(m_pDevice);
     auto vShader = ge_shared_ptr_new<DXShader>();
 
-    if (!_compileFromFile(fileName, pMacro, szEntryPoint, szShaderModel, &vShader->m_pBlob)) {
+    if (!_getBytecode(*vShader, fileName, pMacro, szEntryPoint, szShaderModel,
+                      DXBC_PROGRAM_TYPE::kCompute)) {
       GE_LOG(kError,
              RenderAPI,
              "Could not compile ComputeShader Shader from {1}", fileName);
       return nullptr;
     }
 
-    HRESULT hr = m_pDevice->CreateComputeShader(vShader->m_pBlob->GetBufferPointer(),
-                              vShader->m_pBlob->GetBufferSize(),
+    HRESULT hr = m_pDevice->CreateComputeShader(vShader->getBytecode(),
+                              vShader->getBytecodeSize(),
                               nullptr,
                               reinterpret_cast<ID3D11ComputeShader**>(&vShader->m_pShader));
     if (FAILED(hr)) {
@@ -1316,6 +1549,12 @@ namespace geEngineSDK {
       return nullptr;
     }
 
+    vShader->m_programType = DXBC_PROGRAM_TYPE::kCompute;
+    vShader->_compactBytecode();
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(vShader->m_pShader,
+                                 GPU_MEMORY_CATEGORY::kShader,
+                                 vShader->getMemoryUsage());
     return vShader;
   }
 
@@ -1337,25 +1576,83 @@ namespace geEngineSDK {
       return;
     }
 
+    TimelineScope timelineScope(m_timeline, "WriteToResource", "Upload");
+
     auto pTex = pResource.lock();
     auto pGraphRes =
       reinterpret_cast<ID3D11Resource*>(pTex->_getGraphicsResource());
     GE_ASSERT(pGraphRes);
 
+    _updateSubresource(pGraphRes,
+                       dstSubRes,
+                       pDstBox,
+                       pSrcData,
+                       srcRowPitch,
+                       srcDepthPitch,
+                       copyFlags);
+  }
+
+  void
+  DX11RenderAPI::writeToResources(const ResourceWrite* pWrites,
+                                  uint32 numWrites,
+                                  uint32 copyFlags) {
+    GE_ASSERT(m_pActiveContext);
+    GE_ASSERT(pWrites || 0 == numWrites);
+
+    TimelineScope timelineScope(m_timeline, "WriteToResources", "Upload");
+    if (timelineScope.isActive()) {
+      timelineScope.setArgs(StringUtil::format("\"writes\":{0}", numWrites));
+    }
+
+    GraphicsResource* pLastResource = nullptr;
+    ID3D11Resource* pGraphRes = nullptr;
+
+    for (uint32 i = 0; i < numWrites; ++i) {
+      const ResourceWrite& write = pWrites[i];
+      if (!write.pResource) {
+        continue;
+      }
+
+      if (write.pResource != pLastResource) {
+        pLastResource = write.pResource;
+        pGraphRes = reinterpret_cast<ID3D11Resource*>(pLastResource->_getGraphicsResource());
+        GE_ASSERT(pGraphRes);
+      }
+
+      _updateSubresource(pGraphRes,
+                         write.dstSubRes,
+                         write.bUseBox ? &write.dstBox : nullptr,
+                         write.pSrcData,
+                         write.srcRowPitch,
+                         write.srcDepthPitch,
+                         copyFlags);
+    }
+  }
+
+  void
+  DX11RenderAPI::_updateSubresource(ID3D11Resource* pGraphRes,
+                                    uint32 dstSubRes,
+                                    const GRAPHICS_BOX* pDstBox,
+                                    const void* pSrcData,
+                                    uint32 srcRowPitch,
+                                    uint32 srcDepthPitch,
+                                    uint32 copyFlags) {
+    //A null box writes the whole subresource
+    auto pBox = reinterpret_cast<const D3D11_BOX*>(pDstBox);
+    m_stats.onUpload(_getUpdateSize(pGraphRes, dstSubRes, pBox, srcRowPitch, srcDepthPitch));
+
 #if USING(DX_VERSION_11_0)
     GE_UNREFERENCED_PARAMETER(copyFlags);
     m_pActiveContext->UpdateSubresource(pGraphRes,
                                         dstSubRes,
-                                        pDstBox ? nullptr :
-                                        reinterpret_cast<const D3D11_BOX*>(pDstBox),
+                                        pBox,
                                         pSrcData,
                                         srcRowPitch,
                                         srcDepthPitch);
 #else
     m_pActiveContext->UpdateSubresource1(pGraphRes,
                                          dstSubRes,
-                                         pDstBox ? nullptr :
-                                         reinterpret_cast<const D3D11_BOX*>(pDstBox),
+                                         pBox,
                                          pSrcData,
                                          srcRowPitch,
                                          srcDepthPitch,
@@ -1363,6 +1660,66 @@ namespace geEngineSDK {
 #endif
   }
 
+  SIZE_T
+  DX11RenderAPI::_getUpdateSize(ID3D11Resource* pGraphRes,
+                                uint32 dstSubRes,
+                                const D3D11_BOX* pBox,
+                                uint32 srcRowPitch,
+                                uint32 srcDepthPitch) {
+    D3D11_RESOURCE_DIMENSION dimension;
+    pGraphRes->GetType(&dimension);
+
+    if (D3D11_RESOURCE_DIMENSION_BUFFER == dimension) {
+      if (pBox) {
+        return pBox->right - pBox->left;
+      }
+
+      D3D11_BUFFER_DESC bDesc;
+      static_cast<ID3D11Buffer*>(pGraphRes)->GetDesc(&bDesc);
+      return bDesc.ByteWidth;
+    }
+
+    if (D3D11_RESOURCE_DIMENSION_TEXTURE2D != dimension) {
+      return 0;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    static_cast<ID3D11Texture2D*>(pGraphRes)->GetDesc(&tDesc);
+
+    uint32 height = pBox ? pBox->bottom - pBox->top :
+                           Math::max(1U, tDesc.Height >> (dstSubRes % tDesc.MipLevels));
+    uint32 depth = pBox ? pBox->back - pBox->front : 1;
+    height = TranslateUtils::getNumRows(tDesc.Format, height);
+
+    return static_cast<SIZE_T>(srcRowPitch) * height +
+           static_cast<SIZE_T>(srcDepthPitch) * (depth > 0 ? depth - 1 : 0);
+  }
+
+  UploadToken
+  DX11RenderAPI::writeToResourceAsync(const WeakSPtr<GraphicsResource>& pResource,
+                                      uint32 dstSubRes,
+                                      const GRAPHICS_BOX* pDstBox,
+                                      const void* pSrcData,
+                                      uint32 srcRowPitch) {
+    if (pResource.expired()) {
+      return INVALID_UPLOAD_TOKEN;
+    }
+
+    auto pRes = pResource.lock();
+    auto pGraphRes =
+      reinterpret_cast<ID3D11Resource*>(pRes->_getGraphicsResource());
+    GE_ASSERT(pGraphRes);
+
+    SIZE_T pendingBytes = m_uploadScheduler.getPendingBytes();
+    UploadToken token = m_uploadScheduler.enqueue(pGraphRes,
+                                                  dstSubRes,
+                                                  reinterpret_cast<const D3D11_BOX*>(pDstBox),
+                                                  pSrcData,
+                                                  srcRowPitch);
+    m_stats.onUpload(m_uploadScheduler.getPendingBytes() - pendingBytes);
+    return token;
+  }
+
   MappedSubresource
   DX11RenderAPI::mapToRead(const WeakSPtr<GraphicsResource>& pResource,
                            uint32 subResource,
@@ -1381,7 +1738,10 @@ namespace geEngineSDK {
       reinterpret_cast<ID3D11Resource*>(pTex->_getGraphicsResource());
     GE_ASSERT(pGraphRes);
 
+    //Reading back stalls until the GPU is done with the resource
+    TimelineScope timelineScope(m_timeline, "MapToRead", "Readback");
     ge_zero_out(mappedSubresource);
+    m_stats.onMap();
     throwIfFailed(m_pActiveContext->Map(pGraphRes,
                           subResource,
                           D3D11_MAP_READ,
@@ -1394,6 +1754,22 @@ namespace geEngineSDK {
     return mappedSubresource;
   }
 
+  ReadbackTicket
+  DX11RenderAPI::readbackAsync(const WeakSPtr<GraphicsResource>& pResource,
+                               uint32 subResource,
+                               const DXReadbackQueue::ReadbackFn& pCallback) {
+    if (pResource.expired()) {
+      return INVALID_READBACK_TICKET;
+    }
+
+    auto pRes = pResource.lock();
+    auto pGraphRes =
+      reinterpret_cast<ID3D11Resource*>(pRes->_getGraphicsResource());
+    GE_ASSERT(pGraphRes);
+
+    return m_readbackQueue.request(pGraphRes, subResource, pCallback);
+  }
+
   void
   DX11RenderAPI::unmap(const WeakSPtr<GraphicsResource>& pResource,
                        uint32 subResource) {
@@ -1407,6 +1783,7 @@ namespace geEngineSDK {
       reinterpret_cast<ID3D11Resource*>(pTex->_getGraphicsResource());
     GE_ASSERT(pGraphRes);
 
+    m_stats.onUnmap();
     m_pActiveContext->Unmap(pGraphRes, subResource);
   }
 
@@ -1428,11 +1805,19 @@ namespace geEngineSDK {
     GE_ASSERT(pSrcDst && pResDst);
 
     //Copy the resource to the destination
+    TimelineScope timelineScope(m_timeline, "CopyResource");
+    m_stats.onCopy();
     m_pActiveContext->CopyResource(pResDst, pSrcDst);
   }
 
   void
   DX11RenderAPI::generateMips(const WeakSPtr<Texture>& pTexture) {
+    generateMips(pTexture, m_defaultMipDesc);
+  }
+
+  void
+  DX11RenderAPI::generateMips(const WeakSPtr<Texture>& pTexture,
+                              const MipGenerationDesc& mipDesc) {
     GE_ASSERT(m_pActiveContext);
 
     if (pTexture.expired()) {
@@ -1442,7 +1827,25 @@ namespace geEngineSDK {
     auto pObj = pTexture.lock();
     auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
 
-    m_pActiveContext->GenerateMips(pDXObj->m_ppSRV[0]);
+    TimelineScope timelineScope(m_timeline, "GenerateMips");
+    if (m_mipGenerator.generate(m_pActiveContext, pDXObj->m_pTexture, mipDesc)) {
+      return;
+    }
+
+    //Textures created outside createTexture may still use the fixed function
+    D3D11_TEXTURE2D_DESC tDesc;
+    pDXObj->m_pTexture->GetDesc(&tDesc);
+    if (tDesc.MiscFlags & D3D11_RESOURCE_MISC_GENERATE_MIPS) {
+      ID3D11ShaderResourceView* pSRV = pDXObj->_getSRV();
+      GE_ASSERT(pSRV);
+      m_pActiveContext->GenerateMips(pSRV);
+      return;
+    }
+
+    GE_LOG(kWarning,
+           RenderAPI,
+           "Can't generate the mips of a {0} texture",
+           TranslateUtils::toString(tDesc.Format));
   }
 
   void
@@ -1456,9 +1859,10 @@ namespace geEngineSDK {
 
     auto pObj = pRenderTarget.lock();
     auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
-    GE_ASSERT(!pDXObj->m_ppRTV.empty());
 
-    ID3D11RenderTargetView* pTarget = pDXObj->m_ppRTV[0];
+    ID3D11RenderTargetView* pTarget = pDXObj->_getRTV(0);
+    GE_ASSERT(pTarget);
+    m_stats.onClear();
     m_pActiveContext->ClearRenderTargetView(pTarget, reinterpret_cast<const FLOAT*>(&color));
   }
 
@@ -1475,9 +1879,11 @@ namespace geEngineSDK {
 
     auto pObj = pDepthStencilView.lock();
     auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
-    GE_ASSERT(pDXObj->m_pDSV);
 
-    m_pActiveContext->ClearDepthStencilView(pDXObj->m_pDSV, flags, depthVal, stencilVal);
+    ID3D11DepthStencilView* pDSV = pDXObj->_getDSV();
+    GE_ASSERT(pDSV);
+    m_stats.onClear();
+    m_pActiveContext->ClearDepthStencilView(pDSV, flags, depthVal, stencilVal);
   }
 
   void
@@ -1495,14 +1901,12 @@ namespace geEngineSDK {
     auto pObj = pTexture.lock();
     auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
 
-    ID3D11View* pView = nullptr;
-    if (!pDXObj->m_ppRTV.empty()) {
-      pView = pDXObj->m_ppRTV[0];
+    ID3D11View* pView = pDXObj->_getRTV(0);
+    if (!pView) {
+      pView = pDXObj->_getDSV();
     }
-    else if (pDXObj->m_pDSV) {
-      pView = pDXObj->m_pDSV;
-    }
-    else {
+
+    if (!pView) {
       GE_ASSERT(false && "Texture has no RTV or DSV to discard.");
       return;
     }
@@ -1515,22 +1919,61 @@ namespace geEngineSDK {
   DX11RenderAPI::present() {
     GE_ASSERT(m_pSwapChain && m_pActiveContext && m_pBackBufferTexture);
 
+    {
+      //Includes the wait for a free back buffer when the GPU is behind
+      TimelineScope timelineScope(m_timeline, "Present", "Frame");
 #if USING(DX_VERSION_11_0)
-    m_pSwapChain->Present(1, 0);
+      m_pSwapChain->Present(1, 0);
 #else
-    static DXGI_PRESENT_PARAMETERS presentParams = {};
-    m_pSwapChain->Present1(1, 0, &presentParams);
+      static DXGI_PRESENT_PARAMETERS presentParams = {};
+      m_pSwapChain->Present1(1, 0, &presentParams);
 #endif
+    }
+
+    //Uploads issued now are consumed by the next frame
+    {
+      TimelineScope timelineScope(m_timeline, "UploadScheduler", "Upload");
+      m_uploadScheduler.update();
+    }
+    {
+      TimelineScope timelineScope(m_timeline, "ReadbackQueue", "Readback");
+      m_readbackQueue.update();
+    }
+    m_gpuProfiler.newFrame();
+
+    if (m_timeline.isCapturing()) {
+      const RenderStats& stats = m_stats.getCurrentFrame();
+      m_timeline.addCounter("RenderStats",
+                            StringUtil::format("\"drawCalls\":{0},\"dispatches\":{1},"
+                                               "\"uploadKB\":{2}",
+                                               stats.numDrawCalls,
+                                               stats.numDispatches,
+                                               stats.uploadBytes / 1024));
+    }
+    m_stats.endFrame();
+    m_timeline.endFrame();
+    m_memoryTracker.update();
+    m_mipGenerator.endFrame();
   }
 
   void
   DX11RenderAPI::setImmediateContext() {
     m_pActiveContext = m_pImmediateDC;
+    m_bindCache.invalidate();
+  }
+
+  void
+  DX11RenderAPI::setActiveContext(D3DDeviceContext* pContext) {
+    m_pActiveContext = pContext ? pContext : m_pImmediateDC;
+
+    //The cache mirrors what is bound on the previous context
+    m_bindCache.invalidate();
   }
 
   void
   DX11RenderAPI::setTopology(PRIMITIVE_TOPOLOGY::E topologyType) {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onBind(RENDER_STAT_BIND::kTopology, m_bindCache.setTopology(topologyType));
     m_pActiveContext->IASetPrimitiveTopology(
       static_cast<D3D11_PRIMITIVE_TOPOLOGY>(topologyType));
   }
@@ -1548,6 +1991,8 @@ namespace geEngineSDK {
       dxViewports(D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
 
     memcpy(&dxViewports[0], viewports.data(), sizeof(D3D11_VIEWPORT) * numViewports);
+    m_stats.onBind(RENDER_STAT_BIND::kViewports,
+      m_bindCache.setViewports(reinterpret_cast<const float*>(&dxViewports[0]), numViewports));
     m_pActiveContext->RSSetViewports(numViewports, &dxViewports[0]);
   }
 
@@ -1561,6 +2006,7 @@ namespace geEngineSDK {
       pLayout = pObj->m_inputLayout;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kInputLayout, m_bindCache.setInputLayout(pLayout));
     m_pActiveContext->IASetInputLayout(pLayout);
   }
 
@@ -1574,6 +2020,7 @@ namespace geEngineSDK {
       pRS = pRSState->m_pRasterizerState;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kRasterizerState, m_bindCache.setRasterizerState(pRS));
     m_pActiveContext->RSSetState(pRS);
   }
 
@@ -1588,6 +2035,8 @@ namespace geEngineSDK {
       pDSS = pDSSState->m_pDepthStencilState;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kDepthStencilState,
+                   m_bindCache.setDepthStencilState(pDSS, stencilRef));
     m_pActiveContext->OMSetDepthStencilState(pDSS, stencilRef);
   }
 
@@ -1606,6 +2055,8 @@ namespace geEngineSDK {
       sampleMask = pBlend->m_sampleMask;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kBlendState,
+                   m_bindCache.setBlendState(pBS, &blendFactors[0], sampleMask));
     m_pActiveContext->OMSetBlendState(pBS, &blendFactors[0], sampleMask);
   }
 
@@ -1625,6 +2076,8 @@ namespace geEngineSDK {
       stride = pVB->m_pVertexDeclaration->getProperties().getVertexSize(0);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kVertexBuffer,
+                   m_bindCache.setVertexBuffer(startSlot, pBuffer, stride, offsetInBytes));
     m_pActiveContext->IASetVertexBuffers(startSlot, 1, &pBuffer, &stride, &offsetInBytes);
   }
 
@@ -1643,6 +2096,8 @@ namespace geEngineSDK {
       format = static_cast<DXGI_FORMAT>(pIB->m_indexFormat);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kIndexBuffer,
+                   m_bindCache.setIndexBuffer(pBuffer, format, offsetInBytes));
     m_pActiveContext->IASetIndexBuffer(pBuffer, format, offsetInBytes);
   }
 
@@ -1662,6 +2117,8 @@ namespace geEngineSDK {
       pShader = reinterpret_cast<typename Traits::ShaderInterface*>(pObj->m_pShader);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kShader,
+                   m_bindCache.setShader(static_cast<uint32>(Stage), pShader));
     (m_pActiveContext->*Traits::SetProgramFn)(pShader, nullptr, 0);
   }
 
@@ -1697,15 +2154,19 @@ namespace geEngineSDK {
 
   template<DX11RenderAPI::ShaderStage Stage>
   void DX11RenderAPI::_setShaderResource(const WeakSPtr<Texture>& pTexture,
-                                         const uint32 startSlot) {
+                                         const uint32 startSlot,
+                                         const uint32 mostDetailedMip,
+                                         const uint32 numMips) {
     GE_ASSERT(m_pActiveContext);
 
     ID3D11ShaderResourceView* pSRV = nullptr;
     if (!pTexture.expired()) {
       auto pTx = reinterpret_cast<DXTexture*>(pTexture.lock().get());
-      pSRV = pTx->m_ppSRV[0];
+      pSRV = pTx->_getSRV(mostDetailedMip, numMips);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kShaderResource,
+                   m_bindCache.setShaderResource(static_cast<uint32>(Stage), startSlot, pSRV));
     (m_pActiveContext->*ShaderTraits<Stage>::SetSRVFn)(startSlot, 1, &pSRV);
   }
 
@@ -1748,20 +2209,37 @@ namespace geEngineSDK {
     _setShaderResource<ShaderStage::Compute>(pTexture, startSlot);
   }
 
+  void
+  DX11RenderAPI::csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot,
+                                     const uint32 mostDetailedMip,
+                                     const uint32 numMips) {
+    _setShaderResource<ShaderStage::Compute>(pTexture, startSlot, mostDetailedMip, numMips);
+  }
+
   /*************************************************************************/
   // Set Unordered Access Views
   /*************************************************************************/
   void
   DX11RenderAPI::csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
                                           const uint32 startSlot) {
+    csSetUnorderedAccessView(pTexture, startSlot, 0);
+  }
+
+  void
+  DX11RenderAPI::csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                                          const uint32 startSlot,
+                                          const uint32 mipSlice) {
     GE_ASSERT(m_pActiveContext);
 
     ID3D11UnorderedAccessView* pUAV = nullptr;
     if (!pTexture.expired()) {
       auto pTx = reinterpret_cast<DXTexture*>(pTexture.lock().get());
-      pUAV = pTx->m_ppUAV[0];
+      pUAV = pTx->_getUAV(mipSlice);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kUnorderedAccess,
+                   m_bindCache.setUnorderedAccess(startSlot, pUAV));
     m_pActiveContext->CSSetUnorderedAccessViews(startSlot, 1, &pUAV, nullptr);
   }
 
@@ -1780,6 +2258,8 @@ namespace geEngineSDK {
       pDXBuffer = pCB->m_pBuffer;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kConstantBuffer,
+                   m_bindCache.setConstantBuffer(static_cast<uint32>(Stage), startSlot, pDXBuffer));
     (m_pActiveContext->*ShaderTraits<Stage>::SetCBuffFn)(startSlot, 1, &pDXBuffer);
   }
 
@@ -1834,6 +2314,8 @@ namespace geEngineSDK {
       pSS = pObj->m_pSampler;
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kSampler,
+                   m_bindCache.setSampler(static_cast<uint32>(Stage), startSlot, pSS));
     (m_pActiveContext->*ShaderTraits<Stage>::SetSamplerFn)(startSlot, 1, &pSS);
   }
 
@@ -1879,6 +2361,13 @@ namespace geEngineSDK {
   void
   DX11RenderAPI::setRenderTargets(const Vector<RenderTarget>& pTargets,
                                   const WeakSPtr<Texture>& pDepthStencilView) {
+    setRenderTargets(pTargets, pDepthStencilView, false);
+  }
+
+  void
+  DX11RenderAPI::setRenderTargets(const Vector<RenderTarget>& pTargets,
+                                  const WeakSPtr<Texture>& pDepthStencilView,
+                                  bool bReadOnlyDepth) {
     GE_ASSERT(m_pActiveContext);
 
     static Vector<ID3D11RenderTargetView*>
@@ -1896,8 +2385,8 @@ namespace geEngineSDK {
       auto pObj = target.pRenderTarget.lock();
       auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
 
-      GE_ASSERT(pDXObj->m_ppRTV.size() > SIZE_T(target.mipLevel));
-      ID3D11RenderTargetView* pRTV = pDXObj->m_ppRTV[target.mipLevel];
+      ID3D11RenderTargetView* pRTV = pDXObj->_getRTV(target.mipLevel);
+      GE_ASSERT(pRTV);
       pRTVs[i] = pRTV;
     }
 
@@ -1905,12 +2394,55 @@ namespace geEngineSDK {
     if (!pDepthStencilView.expired()) {
       auto pObj = pDepthStencilView.lock();
       auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
-      pDS = pDXObj->m_pDSV;
+      pDS = pDXObj->_getDSV(bReadOnlyDepth);
+      GE_ASSERT(pDS);
     }
 
+    m_stats.onBind(RENDER_STAT_BIND::kRenderTargets,
+      m_bindCache.setRenderTargets(reinterpret_cast<void* const*>(pRTVs.data()), numTargets, pDS));
+
+    //With the read-only view bound the runtime doesn't unbind the SRVs of the
+    //depth texture, so it can be sampled in the same draw without a copy
     m_pActiveContext->OMSetRenderTargets(numTargets, pRTVs.data(), pDS);
   }
 
+  void
+  DX11RenderAPI::setRenderTargetSlices(const Vector<RenderTargetSlice>& pTargets,
+                                       const WeakSPtr<Texture>& pDepthStencilView,
+                                       uint32 depthFirstSlice,
+                                       uint32 depthNumSlices,
+                                       bool bReadOnlyDepth) {
+    GE_ASSERT(m_pActiveContext);
+    GE_ASSERT(pTargets.size() <= D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT);
+
+    ID3D11RenderTargetView* pRTVs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+    uint32 numTargets = static_cast<uint32>(pTargets.size());
+
+    for (uint32 i = 0; i < numTargets; ++i) {
+      const RenderTargetSlice& target = pTargets[i];
+      if (target.pRenderTarget.expired()) {
+        continue;
+      }
+
+      auto pObj = target.pRenderTarget.lock();
+      auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
+
+      pRTVs[i] = pDXObj->_getRTV(target.mipLevel, target.firstSlice, target.numSlices);
+      GE_ASSERT(pRTVs[i]);
+    }
+
+    ID3D11DepthStencilView* pDS = nullptr;
+    if (!pDepthStencilView.expired()) {
+      auto pObj = pDepthStencilView.lock();
+      auto pDXObj = reinterpret_cast<DXTexture*>(pObj.get());
+      pDS = pDXObj->_getDSV(bReadOnlyDepth, depthFirstSlice, depthNumSlices);
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kRenderTargets,
+      m_bindCache.setRenderTargets(reinterpret_cast<void* const*>(pRTVs), numTargets, pDS));
+    m_pActiveContext->OMSetRenderTargets(numTargets, pRTVs, pDS);
+  }
+
   void
   DX11RenderAPI::setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) {
     GE_ASSERT(m_pActiveContext);
@@ -1986,6 +2518,9 @@ namespace geEngineSDK {
       return;
     }
 
+    //The restored state bypasses the bind cache
+    m_bindCache.invalidate();
+
     auto pOldState = reinterpret_cast<DXPipelineState*>(pState.lock().get());
 
     m_pActiveContext->RSSetScissorRects(pOldState->m_scissorRectsCount,
@@ -2028,6 +2563,7 @@ namespace geEngineSDK {
   void
   DX11RenderAPI::draw(uint32 vertexCount, uint32 startVertexLocation) {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onDraw();
     m_pActiveContext->Draw(vertexCount, startVertexLocation);
   }
 
@@ -2036,6 +2572,7 @@ namespace geEngineSDK {
                              uint32 startIndexLocation,
                              int32 baseVertexLocation) {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onDraw();
     m_pActiveContext->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
   }
 
@@ -2045,6 +2582,7 @@ namespace geEngineSDK {
                                uint32 startVertexLocation,
                                uint32 startInstanceLocation) {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onDraw();
     m_pActiveContext->DrawInstanced(vertexCountPerInstance,
                                     instanceCount,
                                     startVertexLocation,
@@ -2054,6 +2592,7 @@ namespace geEngineSDK {
   void
   DX11RenderAPI::drawAuto() {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onDraw();
     m_pActiveContext->DrawAuto();
   }
 
@@ -2062,6 +2601,7 @@ namespace geEngineSDK {
                           uint32 threadGroupCountY,
                           uint32 threadGroupCountZ) {
     GE_ASSERT(m_pActiveContext);
+    m_stats.onDispatch();
     m_pActiveContext->Dispatch(threadGroupCountX,
                                threadGroupCountY,
                                threadGroupCountZ);
@@ -2098,6 +2638,18 @@ namespace geEngineSDK {
     D3D11_TEXTURE2D_DESC desc;
     m_pBackBufferTexture->m_pTexture->GetDesc(&desc);
     m_pBackBufferTexture->_setDesc(desc);
+
+    //Only one buffer of the chain is visible, but all of them are allocated
+    DXGI_SWAP_CHAIN_DESC scDesc;
+    m_pSwapChain->GetDesc(&scDesc);
+    DXMemoryTracker::onAllocated(m_pBackBufferTexture->m_pTexture,
+                                 GPU_MEMORY_CATEGORY::kRenderTarget,
+                                 DXTexture::computeMemoryUsage(desc) * scDesc.BufferCount,
+                                 "BackBuffer");
+    m_pBackBufferTexture->_initViews(m_pDevice,
+                                     desc.Format,
+                                     desc.Format,
+                                     DXGI_FORMAT_UNKNOWN);
   }
 
   WeakSPtr<Texture>
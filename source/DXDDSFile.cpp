@@ -0,0 +1,357 @@
+/*****************************************************************************/
+/**
+ * @file    DXDDSFile.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   DDS texture files, read from a memory mapping.
+ *
+ * DDS texture files, read from a memory mapping.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXDDSFile.h"
+#include "DXTranslateUtils.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+
+namespace geEngineSDK {
+
+  namespace {
+    constexpr uint32
+    makeFourCC(char a, char b, char c, char d) {
+      return static_cast<uint32>(static_cast<uint8>(a)) |
+             static_cast<uint32>(static_cast<uint8>(b)) << 8 |
+             static_cast<uint32>(static_cast<uint8>(c)) << 16 |
+             static_cast<uint32>(static_cast<uint8>(d)) << 24;
+    }
+
+    const uint32 DDS_MAGIC = makeFourCC('D', 'D', 'S', ' ');
+
+    //DDS_PIXELFORMAT flags
+    const uint32 DDPF_ALPHA = 0x2;
+    const uint32 DDPF_FOURCC = 0x4;
+    const uint32 DDPF_RGB = 0x40;
+    const uint32 DDPF_LUMINANCE = 0x20000;
+
+    //DDS_HEADER caps2
+    const uint32 DDSCAPS2_CUBEMAP = 0x200;
+    const uint32 DDSCAPS2_CUBEMAP_ALLFACES = 0xFC00;
+    const uint32 DDSCAPS2_VOLUME = 0x200000;
+
+    //DDS_HEADER_DXT10
+    const uint32 DDS_DIMENSION_TEXTURE2D = 3;
+    const uint32 DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+
+    struct DDSPixelFormat
+    {
+      uint32 size;
+      uint32 flags;
+      uint32 fourCC;
+      uint32 rgbBitCount;
+      uint32 rBitMask;
+      uint32 gBitMask;
+      uint32 bBitMask;
+      uint32 aBitMask;
+    };
+
+    struct DDSHeader
+    {
+      uint32 size;
+      uint32 flags;
+      uint32 height;
+      uint32 width;
+      uint32 pitchOrLinearSize;
+      uint32 depth;
+      uint32 mipMapCount;
+      uint32 reserved1[11];
+      DDSPixelFormat pixelFormat;
+      uint32 caps;
+      uint32 caps2;
+      uint32 caps3;
+      uint32 caps4;
+      uint32 reserved2;
+    };
+
+    struct DDSHeaderDX10
+    {
+      uint32 dxgiFormat;
+      uint32 resourceDimension;
+      uint32 miscFlag;
+      uint32 arraySize;
+      uint32 miscFlags2;
+    };
+
+    static_assert(sizeof(DDSPixelFormat) == 32, "DDS_PIXELFORMAT is 32 bytes");
+    static_assert(sizeof(DDSHeader) == 124, "DDS_HEADER is 124 bytes");
+    static_assert(sizeof(DDSHeaderDX10) == 20, "DDS_HEADER_DXT10 is 20 bytes");
+
+    bool
+    hasMasks(const DDSPixelFormat& pf, uint32 r, uint32 g, uint32 b, uint32 a) {
+      return pf.rBitMask == r && pf.gBitMask == g && pf.bBitMask == b && pf.aBitMask == a;
+    }
+
+    /**
+     * @brief Format of a header without the DX10 extension.
+     */
+    DXGI_FORMAT
+    getLegacyFormat(const DDSPixelFormat& pf) {
+      if (pf.flags & DDPF_FOURCC) {
+        switch (pf.fourCC) {
+          case makeFourCC('D', 'X', 'T', '1'):
+            return DXGI_FORMAT_BC1_UNORM;
+          case makeFourCC('D', 'X', 'T', '2'):
+          case makeFourCC('D', 'X', 'T', '3'):
+            return DXGI_FORMAT_BC2_UNORM;
+          case makeFourCC('D', 'X', 'T', '4'):
+          case makeFourCC('D', 'X', 'T', '5'):
+            return DXGI_FORMAT_BC3_UNORM;
+          case makeFourCC('A', 'T', 'I', '1'):
+          case makeFourCC('B', 'C', '4', 'U'):
+            return DXGI_FORMAT_BC4_UNORM;
+          case makeFourCC('B', 'C', '4', 'S'):
+            return DXGI_FORMAT_BC4_SNORM;
+          case makeFourCC('A', 'T', 'I', '2'):
+          case makeFourCC('B', 'C', '5', 'U'):
+            return DXGI_FORMAT_BC5_UNORM;
+          case makeFourCC('B', 'C', '5', 'S'):
+            return DXGI_FORMAT_BC5_SNORM;
+          case makeFourCC('R', 'G', 'B', 'G'):
+            return DXGI_FORMAT_R8G8_B8G8_UNORM;
+          case makeFourCC('G', 'R', 'G', 'B'):
+            return DXGI_FORMAT_G8R8_G8B8_UNORM;
+          //D3DFORMAT values
+          case 36:
+            return DXGI_FORMAT_R16G16B16A16_UNORM;
+          case 110:
+            return DXGI_FORMAT_R16G16B16A16_SNORM;
+          case 111:
+            return DXGI_FORMAT_R16_FLOAT;
+          case 112:
+            return DXGI_FORMAT_R16G16_FLOAT;
+          case 113:
+            return DXGI_FORMAT_R16G16B16A16_FLOAT;
+          case 114:
+            return DXGI_FORMAT_R32_FLOAT;
+          case 115:
+            return DXGI_FORMAT_R32G32_FLOAT;
+          case 116:
+            return DXGI_FORMAT_R32G32B32A32_FLOAT;
+          default:
+            return DXGI_FORMAT_UNKNOWN;
+        }
+      }
+
+      if (pf.flags & DDPF_RGB) {
+        if (32 == pf.rgbBitCount) {
+          if (hasMasks(pf, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000)) {
+            return DXGI_FORMAT_R8G8B8A8_UNORM;
+          }
+          if (hasMasks(pf, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000)) {
+            return DXGI_FORMAT_B8G8R8A8_UNORM;
+          }
+          if (hasMasks(pf, 0x00FF0000, 0x0000FF00, 0x000000FF, 0)) {
+            return DXGI_FORMAT_B8G8R8X8_UNORM;
+          }
+          //Writers swap the red and blue masks of this one
+          if (hasMasks(pf, 0x3FF00000, 0x000FFC00, 0x000003FF, 0xC0000000) ||
+              hasMasks(pf, 0x000003FF, 0x000FFC00, 0x3FF00000, 0xC0000000)) {
+            return DXGI_FORMAT_R10G10B10A2_UNORM;
+          }
+          if (hasMasks(pf, 0x0000FFFF, 0xFFFF0000, 0, 0)) {
+            return DXGI_FORMAT_R16G16_UNORM;
+          }
+          if (hasMasks(pf, 0xFFFFFFFF, 0, 0, 0)) {
+            return DXGI_FORMAT_R32_FLOAT;
+          }
+        }
+        else if (16 == pf.rgbBitCount) {
+          if (hasMasks(pf, 0x7C00, 0x03E0, 0x001F, 0x8000)) {
+            return DXGI_FORMAT_B5G5R5A1_UNORM;
+          }
+          if (hasMasks(pf, 0xF800, 0x07E0, 0x001F, 0)) {
+            return DXGI_FORMAT_B5G6R5_UNORM;
+          }
+          if (hasMasks(pf, 0x0F00, 0x00F0, 0x000F, 0xF000)) {
+            return DXGI_FORMAT_B4G4R4A4_UNORM;
+          }
+        }
+        return DXGI_FORMAT_UNKNOWN;
+      }
+
+      if (pf.flags & DDPF_LUMINANCE) {
+        if (8 == pf.rgbBitCount && hasMasks(pf, 0xFF, 0, 0, 0)) {
+          return DXGI_FORMAT_R8_UNORM;
+        }
+        if (16 == pf.rgbBitCount && hasMasks(pf, 0xFFFF, 0, 0, 0)) {
+          return DXGI_FORMAT_R16_UNORM;
+        }
+        if (16 == pf.rgbBitCount && hasMasks(pf, 0x00FF, 0, 0, 0xFF00)) {
+          return DXGI_FORMAT_R8G8_UNORM;
+        }
+        return DXGI_FORMAT_UNKNOWN;
+      }
+
+      if ((pf.flags & DDPF_ALPHA) && 8 == pf.rgbBitCount) {
+        return DXGI_FORMAT_A8_UNORM;
+      }
+      return DXGI_FORMAT_UNKNOWN;
+    }
+  }
+
+  bool
+  DXDDSFile::open(const Path& filePath) {
+    close();
+    if (!m_file.open(filePath)) {
+      return false;
+    }
+
+    if (!parse(m_file.getData(), m_file.getSize(), filePath.toString())) {
+      m_file.close();
+      return false;
+    }
+    return true;
+  }
+
+  bool
+  DXDDSFile::parse(const uint8* pData, SIZE_T size, const String& name) {
+    m_subresources.clear();
+    m_bIsCubeMap = false;
+
+    SIZE_T offset = sizeof(uint32) + sizeof(DDSHeader);
+    uint32 magic = 0;
+    DDSHeader header;
+    if (size < offset) {
+      GE_LOG(kError, RenderAPI, "{0} isn't a DDS file", name);
+      return false;
+    }
+    memcpy(&magic, pData, sizeof(magic));
+    memcpy(&header, pData + sizeof(uint32), sizeof(header));
+    if (DDS_MAGIC != magic ||
+        sizeof(DDSHeader) != header.size ||
+        sizeof(DDSPixelFormat) != header.pixelFormat.size) {
+      GE_LOG(kError, RenderAPI, "{0} isn't a DDS file", name);
+      return false;
+    }
+
+    const uint32 width = header.width;
+    const uint32 height = header.height;
+    const uint32 mipLevels = Math::max(1U, header.mipMapCount);
+    uint32 arraySize = 1;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+    bool bVolume = 0 != (header.caps2 & DDSCAPS2_VOLUME);
+
+    if ((header.pixelFormat.flags & DDPF_FOURCC) &&
+        makeFourCC('D', 'X', '1', '0') == header.pixelFormat.fourCC) {
+      DDSHeaderDX10 headerDX10;
+      if (size < offset + sizeof(headerDX10)) {
+        GE_LOG(kError, RenderAPI, "{0} is truncated", name);
+        return false;
+      }
+      memcpy(&headerDX10, pData + offset, sizeof(headerDX10));
+      offset += sizeof(headerDX10);
+
+      format = static_cast<DXGI_FORMAT>(headerDX10.dxgiFormat);
+      arraySize = headerDX10.arraySize;
+      m_bIsCubeMap = 0 != (headerDX10.miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE);
+      bVolume = DDS_DIMENSION_TEXTURE2D != headerDX10.resourceDimension;
+    }
+    else {
+      format = getLegacyFormat(header.pixelFormat);
+      if (header.caps2 & DDSCAPS2_CUBEMAP) {
+        if ((header.caps2 & DDSCAPS2_CUBEMAP_ALLFACES) != DDSCAPS2_CUBEMAP_ALLFACES) {
+          GE_LOG(kError, RenderAPI, "{0} is a cube map without all its faces", name);
+          return false;
+        }
+        m_bIsCubeMap = true;
+      }
+    }
+
+    if (bVolume) {
+      GE_LOG(kError, RenderAPI, "{0} isn't a 2D texture", name);
+      return false;
+    }
+
+    const auto& formatInfo = TranslateUtils::getFormatInfo(format);
+    if (DXGI_FORMAT_UNKNOWN == format || formatInfo.format != format ||
+        0 != (formatInfo.flags & (TranslateUtils::FORMAT_FLAG::kPlanar |
+                                  TranslateUtils::FORMAT_FLAG::kVideo |
+                                  TranslateUtils::FORMAT_FLAG::kPalette))) {
+      GE_LOG(kError, RenderAPI, "{0} has a format that can't be loaded", name);
+      return false;
+    }
+
+    //Limits of D3D11, they also keep a corrupt header from overflowing. The
+    //array size is checked before it is multiplied by the faces of a cube
+    const uint32 numFaces = m_bIsCubeMap ? 6 : 1;
+    uint32 maxMips = 1;
+    while (maxMips < 32 && (Math::max(width, height) >> maxMips) > 0) {
+      ++maxMips;
+    }
+    if (0 == width || 0 == height ||
+        width > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION ||
+        height > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION ||
+        0 == arraySize ||
+        arraySize > D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION / numFaces ||
+        mipLevels > maxMips ||
+        (m_bIsCubeMap && width != height)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "{0} has an invalid size: {1}x{2}, {3} mips, {4} slices",
+             name,
+             width,
+             height,
+             mipLevels,
+             static_cast<uint64>(arraySize) * numFaces);
+      return false;
+    }
+    const uint32 numSlices = arraySize * numFaces;
+
+    m_subresources.reserve(static_cast<SIZE_T>(numSlices) * mipLevels);
+    for (uint32 slice = 0; slice < numSlices; ++slice) {
+      for (uint32 mip = 0; mip < mipLevels; ++mip) {
+        const uint32 mipWidth = Math::max(1U, width >> mip);
+        const uint32 mipHeight = Math::max(1U, height >> mip);
+        const SIZE_T surfaceSize = TranslateUtils::getSurfaceSize(format, mipWidth, mipHeight);
+        if (size - offset < surfaceSize) {
+          GE_LOG(kError, RenderAPI, "{0} is truncated", name);
+          m_subresources.clear();
+          return false;
+        }
+
+        D3D11_SUBRESOURCE_DATA subresource;
+        subresource.pSysMem = pData + offset;
+        subresource.SysMemPitch = static_cast<UINT>(TranslateUtils::getRowPitch(format, mipWidth));
+        subresource.SysMemSlicePitch = static_cast<UINT>(surfaceSize);
+        m_subresources.push_back(subresource);
+        offset += surfaceSize;
+      }
+    }
+
+    memset(&m_desc, 0, sizeof(m_desc));
+    m_desc.Width = width;
+    m_desc.Height = height;
+    m_desc.MipLevels = mipLevels;
+    m_desc.ArraySize = numSlices;
+    m_desc.Format = format;
+    m_desc.SampleDesc.Count = 1;
+    m_desc.Usage = D3D11_USAGE_IMMUTABLE;
+    m_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    m_desc.MiscFlags = m_bIsCubeMap ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+    return true;
+  }
+
+  void
+  DXDDSFile::close() {
+    m_subresources.clear();
+    m_file.close();
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,230 @@
+/*****************************************************************************/
+/**
+ * @file    DXDeviceCaps.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Format support, MSAA levels and feature options of the device.
+ *
+ * Format support, MSAA levels and feature options of the device.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXDeviceCaps.h"
+#include "DXTranslateUtils.h"
+
+#include <geDebug.h>
+#include <geFileSystem.h>
+#include <geDataStream.h>
+
+namespace geEngineSDK {
+
+  namespace {
+    struct DeviceCapsHeader
+    {
+      uint32 magic = 0;
+      uint32 version = 0;
+      DXAdapterIdentity identity;
+      uint32 numFormats = 0;
+      uint32 formatCapsSize = 0;    //sizeof(DXFormatCaps) of the writer
+      uint32 featureCapsSize = 0;   //sizeof(DXFeatureCaps) of the writer
+    };
+
+    bool
+    isSameAdapter(const DXAdapterIdentity& a, const DXAdapterIdentity& b) {
+      return a.vendorId == b.vendorId &&
+             a.deviceId == b.deviceId &&
+             a.subSysId == b.subSysId &&
+             a.revision == b.revision &&
+             a.driverVersion == b.driverVersion &&
+             a.featureLevel == b.featureLevel;
+    }
+
+    template<class T>
+    void
+    checkFeature(D3DDevice* pDevice, D3D11_FEATURE feature, T& data) {
+      if (FAILED(pDevice->CheckFeatureSupport(feature, &data, sizeof(T)))) {
+        memset(&data, 0, sizeof(T));
+      }
+    }
+  }
+
+  DXDeviceCaps::DXDeviceCaps() {
+    memset(&m_features, 0, sizeof(m_features));
+  }
+
+  void
+  DXDeviceCaps::probe(D3DDevice* pDevice, const DXAdapterIdentity& identity) {
+    GE_ASSERT(pDevice);
+
+    m_identity = identity;
+    for (auto& formatCaps : m_formats) {
+      formatCaps = DXFormatCaps();
+    }
+
+    for (uint32 i = 1; i < NUM_FORMATS; ++i) {
+      auto format = static_cast<DXGI_FORMAT>(i);
+      if (TranslateUtils::getFormatInfo(format).format != format) {
+        continue;   //Value DXGI doesn't define
+      }
+
+      DXFormatCaps& formatCaps = m_formats[i];
+      UINT support = 0;
+      if (FAILED(pDevice->CheckFormatSupport(format, &support)) || 0 == support) {
+        continue;
+      }
+      formatCaps.support = support;
+
+      D3D11_FEATURE_DATA_FORMAT_SUPPORT2 support2 = { format, 0 };
+      if (SUCCEEDED(pDevice->CheckFeatureSupport(D3D11_FEATURE_FORMAT_SUPPORT2,
+                                                 &support2,
+                                                 sizeof(support2)))) {
+        formatCaps.support2 = support2.OutFormatSupport2;
+      }
+
+      //Every sample count is probed, drivers may expose counts that aren't
+      //powers of two
+      for (uint32 count = 1; count <= D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT; ++count) {
+        UINT quality = 0;
+        HRESULT hr = E_FAIL;
+#if USING(DX_VERSION_11_0)
+        hr = pDevice->CheckMultisampleQualityLevels(format, count, &quality);
+#else
+        hr = pDevice->CheckMultisampleQualityLevels1(format, count, 0, &quality);
+#endif
+        if (SUCCEEDED(hr) && quality > 0) {
+          formatCaps.sampleCountMask |= 1U << (count - 1);
+          formatCaps.maxSampleCount = count;
+          formatCaps.maxSampleQuality = quality - 1;
+        }
+      }
+    }
+
+    memset(&m_features, 0, sizeof(m_features));
+    m_features.featureLevel = pDevice->GetFeatureLevel();
+    checkFeature(pDevice, D3D11_FEATURE_THREADING, m_features.threading);
+    checkFeature(pDevice, D3D11_FEATURE_DOUBLES, m_features.doubles);
+    checkFeature(pDevice, D3D11_FEATURE_D3D10_X_HARDWARE_OPTIONS, m_features.d3d10XOptions);
+    checkFeature(pDevice, D3D11_FEATURE_ARCHITECTURE_INFO, m_features.architecture);
+    checkFeature(pDevice, D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT, m_features.minPrecision);
+#if !USING(DX_VERSION_11_0)
+    checkFeature(pDevice, D3D11_FEATURE_D3D11_OPTIONS, m_features.options);
+#endif
+#if !USING(DX_VERSION_11_0) && !USING(DX_VERSION_11_1)
+    checkFeature(pDevice, D3D11_FEATURE_D3D11_OPTIONS1, m_features.options1);
+#endif
+#if USING(DX_VERSION_11_3) || USING(DX_VERSION_11_4)
+    checkFeature(pDevice, D3D11_FEATURE_D3D11_OPTIONS2, m_features.options2);
+    checkFeature(pDevice, D3D11_FEATURE_D3D11_OPTIONS3, m_features.options3);
+#endif
+
+    m_bValid = true;
+  }
+
+  bool
+  DXDeviceCaps::load(const Path& filePath, const DXAdapterIdentity& identity) {
+    if (!FileSystem::isFile(filePath)) {
+      return false;
+    }
+
+    auto stream = FileSystem::openFile(filePath);
+    if (!stream) {
+      return false;
+    }
+
+    DeviceCapsHeader header;
+    if (stream->read(&header, sizeof(header)) != sizeof(header) ||
+        header.magic != MAGIC ||
+        header.version != VERSION ||
+        header.numFormats != NUM_FORMATS ||
+        header.formatCapsSize != sizeof(DXFormatCaps) ||
+        header.featureCapsSize != sizeof(DXFeatureCaps)) {
+      GE_LOG(kWarning,
+             RenderAPI,
+             "{0} isn't a device capability table of this version",
+             filePath.toString());
+      return false;
+    }
+
+    //A new driver can change what the device supports
+    if (!isSameAdapter(header.identity, identity)) {
+      return false;
+    }
+
+    DXFormatCaps formats[NUM_FORMATS];
+    DXFeatureCaps features;
+    if (stream->read(formats, sizeof(formats)) != sizeof(formats) ||
+        stream->read(&features, sizeof(features)) != sizeof(features)) {
+      GE_LOG(kWarning,
+             RenderAPI,
+             "Device capability table {0} is truncated",
+             filePath.toString());
+      return false;
+    }
+
+    m_identity = identity;
+    memcpy(m_formats, formats, sizeof(formats));
+    m_features = features;
+    m_bValid = true;
+    return true;
+  }
+
+  bool
+  DXDeviceCaps::save(const Path& filePath) const {
+    if (!m_bValid) {
+      return false;
+    }
+
+    auto stream = FileSystem::createAndOpenFile(filePath);
+    if (!stream) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create the device capability table: {0}",
+             filePath.toString());
+      return false;
+    }
+
+    DeviceCapsHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.identity = m_identity;
+    header.numFormats = NUM_FORMATS;
+    header.formatCapsSize = sizeof(DXFormatCaps);
+    header.featureCapsSize = sizeof(DXFeatureCaps);
+    stream->write(&header, sizeof(header));
+    stream->write(m_formats, sizeof(m_formats));
+    stream->write(&m_features, sizeof(m_features));
+    stream->close();
+    return true;
+  }
+
+  DXAdapterIdentity
+  DXDeviceCaps::getAdapterIdentity(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL featureLevel) {
+    DXAdapterIdentity identity;
+    identity.featureLevel = static_cast<uint32>(featureLevel);
+    if (!pAdapter) {
+      return identity;
+    }
+
+    DXGI_ADAPTER_DESC aDesc;
+    if (SUCCEEDED(pAdapter->GetDesc(&aDesc))) {
+      identity.vendorId = aDesc.VendorId;
+      identity.deviceId = aDesc.DeviceId;
+      identity.subSysId = aDesc.SubSysId;
+      identity.revision = aDesc.Revision;
+    }
+
+    LARGE_INTEGER driverVersion;
+    if (SUCCEEDED(pAdapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion))) {
+      identity.driverVersion = static_cast<uint64>(driverVersion.QuadPart);
+    }
+    return identity;
+  }
+
+} // namespace geEngineSDK
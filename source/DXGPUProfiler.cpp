@@ -0,0 +1,374 @@
+/*****************************************************************************/
+/**
+ * @file    DXGPUProfiler.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Hierarchical GPU timing with timestamp queries.
+ *
+ * Hierarchical GPU timing with timestamp queries.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXGPUProfiler.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+
+namespace geEngineSDK {
+
+  void
+  DXGPUProfiler::init(D3DDevice* pDevice, D3DDeviceContext* pContext) {
+    GE_ASSERT(pDevice && pContext);
+    release();
+
+    m_pDevice = pDevice;
+    m_pContext = pContext;
+    m_pDevice->AddRef();
+    m_pContext->AddRef();
+
+    D3D11_QUERY_DESC qDesc;
+    qDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+    qDesc.MiscFlags = 0;
+
+    m_frames.resize(m_frameLatency + 1);
+    for (auto& frame : m_frames) {
+      throwIfFailed(m_pDevice->CreateQuery(&qDesc, &frame.pDisjoint));
+    }
+
+    m_frameNumber = 0;
+    _beginFrame();
+  }
+
+  void
+  DXGPUProfiler::release() {
+    for (auto& frame : m_frames) {
+      _recycle(frame);
+      safeRelease(frame.pDisjoint);
+    }
+    m_frames.clear();
+
+    for (auto& pQuery : m_freeTimestamps) {
+      safeRelease(pQuery);
+    }
+    m_freeTimestamps.clear();
+
+    for (auto& pQuery : m_freeStats) {
+      safeRelease(pQuery);
+    }
+    m_freeStats.clear();
+
+    m_bFrameOpen = false;
+    m_currentScope = NumLimit::MAX_UINT32;
+
+    safeRelease(m_pContext);
+    safeRelease(m_pDevice);
+  }
+
+  void
+  DXGPUProfiler::newFrame() {
+    if (m_frames.empty()) {
+      return;
+    }
+
+    if (m_bFrameOpen) {
+      //Close whatever the frame left open, including the frame scope
+      while (NumLimit::MAX_UINT32 != m_currentScope) {
+        endScope();
+      }
+
+      FrameQueries& frame = m_frames[m_frameNumber % m_frames.size()];
+      m_pContext->End(frame.pDisjoint);
+      frame.bPending = true;
+      m_bFrameOpen = false;
+    }
+
+    ++m_frameNumber;
+
+    //Resolve from the oldest to the newest so getLastFrame() ends up with
+    //the most recent data
+    auto numSlots = static_cast<uint64>(m_frames.size());
+    uint64 firstFrame = m_frameNumber > numSlots ? m_frameNumber - numSlots : 0;
+    for (uint64 number = firstFrame; number + m_frameLatency <= m_frameNumber; ++number) {
+      FrameQueries& frame = m_frames[number % numSlots];
+      if (!frame.bPending || frame.frameNumber != number) {
+        continue;
+      }
+
+      if (!_resolve(frame)) {
+        break;
+      }
+      _recycle(frame);
+    }
+
+    _beginFrame();
+  }
+
+  void
+  DXGPUProfiler::beginScope(const char* name, bool bPipelineStats) {
+    if (!m_bFrameOpen) {
+      return;
+    }
+
+    FrameQueries& frame = m_frames[m_frameNumber % m_frames.size()];
+
+    ScopeQueries scope;
+    scope.name = name;
+    scope.parent = m_currentScope;
+    scope.depth = NumLimit::MAX_UINT32 == m_currentScope ?
+                    0 : frame.scopes[m_currentScope].depth + 1;
+    scope.pBegin = _acquireQuery(D3D11_QUERY_TIMESTAMP, m_freeTimestamps);
+    scope.pEnd = _acquireQuery(D3D11_QUERY_TIMESTAMP, m_freeTimestamps);
+
+    m_pContext->End(scope.pBegin);
+
+    if (bPipelineStats && m_bPipelineStatsEnabled) {
+      scope.pStats = _acquireQuery(D3D11_QUERY_PIPELINE_STATISTICS, m_freeStats);
+      m_pContext->Begin(scope.pStats);
+    }
+
+    m_currentScope = static_cast<uint32>(frame.scopes.size());
+    frame.scopes.push_back(scope);
+  }
+
+  void
+  DXGPUProfiler::endScope() {
+    if (!m_bFrameOpen || NumLimit::MAX_UINT32 == m_currentScope) {
+      return;
+    }
+
+    FrameQueries& frame = m_frames[m_frameNumber % m_frames.size()];
+    ScopeQueries& scope = frame.scopes[m_currentScope];
+
+    if (scope.pStats) {
+      m_pContext->End(scope.pStats);
+    }
+    m_pContext->End(scope.pEnd);
+    m_currentScope = scope.parent;
+  }
+
+  void
+  DXGPUProfiler::_beginFrame() {
+    if (!m_bEnabled) {
+      return;
+    }
+
+    FrameQueries& frame = m_frames[m_frameNumber % m_frames.size()];
+
+    //The GPU is more frames behind than we keep slots for, try one last
+    //time and drop the results if they still aren't there
+    if (frame.bPending) {
+      _resolve(frame);
+      _recycle(frame);
+    }
+
+    frame.frameNumber = m_frameNumber;
+    m_pContext->Begin(frame.pDisjoint);
+    m_bFrameOpen = true;
+
+    beginScope("Frame", true);
+  }
+
+  bool
+  DXGPUProfiler::_resolve(FrameQueries& frame) {
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+    if (S_OK != m_pContext->GetData(frame.pDisjoint,
+                                    &disjoint,
+                                    sizeof(disjoint),
+                                    D3D11_ASYNC_GETDATA_DONOTFLUSH)) {
+      return false;
+    }
+
+    //The clock changed (e.g. power state switch), the timestamps are useless
+    if (disjoint.Disjoint) {
+      return true;
+    }
+
+    //Read every timestamp before touching the results so a frame that is
+    //only partially available isn't accounted twice
+    auto numScopes = static_cast<uint32>(frame.scopes.size());
+    m_timestamps.resize(numScopes * 2);
+    m_pipelineStats.resize(numScopes);
+    for (uint32 i = 0; i < numScopes; ++i) {
+      const ScopeQueries& scope = frame.scopes[i];
+      if (S_OK != m_pContext->GetData(scope.pBegin, &m_timestamps[i * 2], sizeof(UINT64),
+                                      D3D11_ASYNC_GETDATA_DONOTFLUSH) ||
+          S_OK != m_pContext->GetData(scope.pEnd, &m_timestamps[i * 2 + 1], sizeof(UINT64),
+                                      D3D11_ASYNC_GETDATA_DONOTFLUSH)) {
+        return false;
+      }
+
+      if (scope.pStats &&
+          S_OK != m_pContext->GetData(scope.pStats,
+                                      &m_pipelineStats[i],
+                                      sizeof(D3D11_QUERY_DATA_PIPELINE_STATISTICS),
+                                      D3D11_ASYNC_GETDATA_DONOTFLUSH)) {
+        return false;
+      }
+    }
+
+    m_lastFrame.resize(numScopes);
+    m_pathScratch.resize(numScopes);
+
+    double ticksToMs = 1000.0 / static_cast<double>(disjoint.Frequency);
+    for (uint32 i = 0; i < numScopes; ++i) {
+      const ScopeQueries& scope = frame.scopes[i];
+      UINT64 begin = m_timestamps[i * 2];
+      UINT64 end = m_timestamps[i * 2 + 1];
+
+      GPUScopeResult& result = m_lastFrame[i];
+      result.name = scope.name;
+      result.parent = scope.parent;
+      result.depth = scope.depth;
+      result.timeMs = end > begin ? static_cast<float>((end - begin) * ticksToMs) : 0.0f;
+      result.beginTick = begin;
+      result.endTick = end;
+      result.bHasPipelineStats = nullptr != scope.pStats;
+      if (result.bHasPipelineStats) {
+        const D3D11_QUERY_DATA_PIPELINE_STATISTICS& data = m_pipelineStats[i];
+        result.pipelineStats.iaVertices = data.IAVertices;
+        result.pipelineStats.iaPrimitives = data.IAPrimitives;
+        result.pipelineStats.vsInvocations = data.VSInvocations;
+        result.pipelineStats.psInvocations = data.PSInvocations;
+        result.pipelineStats.cInvocations = data.CInvocations;
+        result.pipelineStats.cPrimitives = data.CPrimitives;
+        result.pipelineStats.csInvocations = data.CSInvocations;
+      }
+      else {
+        result.pipelineStats = GPUPipelineStats();
+      }
+
+      String& path = m_pathScratch[i];
+      if (NumLimit::MAX_UINT32 == scope.parent) {
+        path = scope.name;
+      }
+      else {
+        path = m_pathScratch[scope.parent];
+        path += '/';
+        path += scope.name;
+      }
+
+      GPUScopeStats& stats = m_stats[path];
+      if (0 == stats.numSamples) {
+        stats.minMs = result.timeMs;
+        stats.maxMs = result.timeMs;
+      }
+      else {
+        stats.minMs = Math::min(stats.minMs, result.timeMs);
+        stats.maxMs = Math::max(stats.maxMs, result.timeMs);
+      }
+      ++stats.numSamples;
+      stats.totalMs += result.timeMs;
+      stats.avgMs = static_cast<float>(stats.totalMs / stats.numSamples);
+      stats.lastMs = result.timeMs;
+
+      if (result.bHasPipelineStats) {
+        stats.lastPipelineStats = result.pipelineStats;
+        stats.totalPipelineStats += result.pipelineStats;
+        ++stats.numPipelineSamples;
+      }
+    }
+
+    m_lastFrameNumber = frame.frameNumber;
+    m_lastFrameFrequency = disjoint.Frequency;
+
+    if (m_pFrameResolvedFn) {
+      m_pFrameResolvedFn(m_lastFrameNumber, m_lastFrame, m_lastFrameFrequency);
+    }
+    return true;
+  }
+
+  bool
+  DXGPUProfiler::calibrateClocks(GPUClockCalibration& calibration) {
+    if (!m_pDevice) {
+      return false;
+    }
+
+    D3D11_QUERY_DESC qDesc;
+    qDesc.MiscFlags = 0;
+
+    ID3D11Query* pEvent = nullptr;
+    qDesc.Query = D3D11_QUERY_EVENT;
+    throwIfFailed(m_pDevice->CreateQuery(&qDesc, &pEvent));
+
+    ID3D11Query* pTimestamp = _acquireQuery(D3D11_QUERY_TIMESTAMP, m_freeTimestamps);
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    auto timeout = static_cast<LONGLONG>(frequency.QuadPart);   //One second
+
+    auto waitFor = [&](ID3D11Query* pQuery, void* pData, UINT dataSize) {
+      LARGE_INTEGER start, now;
+      QueryPerformanceCounter(&start);
+      HRESULT hr;
+      do {
+        hr = m_pContext->GetData(pQuery, pData, dataSize, 0);
+        QueryPerformanceCounter(&now);
+      } while (S_FALSE == hr && now.QuadPart - start.QuadPart < timeout);
+      return S_OK == hr;
+    };
+
+    //With the GPU idle the timestamp is written as soon as it is submitted,
+    //so the counter read right after the flush is taken at the same moment
+    //up to the submission latency
+    BOOL bDone = FALSE;
+    m_pContext->End(pEvent);
+    bool bResult = waitFor(pEvent, &bDone, sizeof(bDone));
+
+    LARGE_INTEGER cpuTick;
+    if (bResult) {
+      m_pContext->End(pTimestamp);
+      m_pContext->Flush();
+      QueryPerformanceCounter(&cpuTick);
+
+      UINT64 gpuTick = 0;
+      bResult = waitFor(pTimestamp, &gpuTick, sizeof(gpuTick));
+      if (bResult) {
+        calibration.gpuTick = gpuTick;
+        calibration.cpuTick = static_cast<uint64>(cpuTick.QuadPart);
+        calibration.cpuFrequency = static_cast<uint64>(frequency.QuadPart);
+      }
+    }
+
+    m_freeTimestamps.push_back(pTimestamp);
+    safeRelease(pEvent);
+    return bResult;
+  }
+
+  void
+  DXGPUProfiler::_recycle(FrameQueries& frame) {
+    for (auto& scope : frame.scopes) {
+      m_freeTimestamps.push_back(scope.pBegin);
+      m_freeTimestamps.push_back(scope.pEnd);
+      if (scope.pStats) {
+        m_freeStats.push_back(scope.pStats);
+      }
+    }
+    frame.scopes.clear();
+    frame.bPending = false;
+  }
+
+  ID3D11Query*
+  DXGPUProfiler::_acquireQuery(D3D11_QUERY type, Vector<ID3D11Query*>& freeList) {
+    if (!freeList.empty()) {
+      ID3D11Query* pQuery = freeList.back();
+      freeList.pop_back();
+      return pQuery;
+    }
+
+    D3D11_QUERY_DESC qDesc;
+    qDesc.Query = type;
+    qDesc.MiscFlags = 0;
+
+    ID3D11Query* pQuery = nullptr;
+    throwIfFailed(m_pDevice->CreateQuery(&qDesc, &pQuery));
+    return pQuery;
+  }
+
+} // namespace geEngineSDK
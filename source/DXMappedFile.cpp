@@ -0,0 +1,101 @@
+/*****************************************************************************/
+/**
+ * @file    DXMappedFile.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Read only memory mapping of a file.
+ *
+ * Read only memory mapping of a file.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXMappedFile.h"
+
+#include <geDebug.h>
+
+namespace geEngineSDK {
+
+  DXMappedFile::DXMappedFile(DXMappedFile&& other) {
+    *this = std::move(other);
+  }
+
+  DXMappedFile&
+  DXMappedFile::operator=(DXMappedFile&& other) {
+    if (this != &other) {
+      close();
+      m_hFile = other.m_hFile;
+      m_hMapping = other.m_hMapping;
+      m_pData = other.m_pData;
+      m_size = other.m_size;
+
+      other.m_hFile = INVALID_HANDLE_VALUE;
+      other.m_hMapping = nullptr;
+      other.m_pData = nullptr;
+      other.m_size = 0;
+    }
+    return *this;
+  }
+
+  bool
+  DXMappedFile::open(const Path& filePath) {
+    close();
+
+    WString fileName = filePath.toPlatformString();
+    m_hFile = CreateFileW(fileName.c_str(),
+                          GENERIC_READ,
+                          FILE_SHARE_READ,
+                          nullptr,
+                          OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                          nullptr);
+    if (INVALID_HANDLE_VALUE == m_hFile) {
+      GE_LOG(kError, RenderAPI, "Failed to open {0}", filePath.toString());
+      return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_hFile, &fileSize) || 0 == fileSize.QuadPart) {
+      GE_LOG(kError, RenderAPI, "{0} is empty", filePath.toString());
+      close();
+      return false;
+    }
+
+    m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_hMapping) {
+      m_pData = static_cast<const uint8*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!m_pData) {
+      GE_LOG(kError, RenderAPI, "Failed to map {0}", filePath.toString());
+      close();
+      return false;
+    }
+
+    m_size = static_cast<SIZE_T>(fileSize.QuadPart);
+    return true;
+  }
+
+  void
+  DXMappedFile::close() {
+    if (m_pData) {
+      UnmapViewOfFile(m_pData);
+      m_pData = nullptr;
+    }
+    if (m_hMapping) {
+      CloseHandle(m_hMapping);
+      m_hMapping = nullptr;
+    }
+    if (INVALID_HANDLE_VALUE != m_hFile) {
+      CloseHandle(m_hFile);
+      m_hFile = INVALID_HANDLE_VALUE;
+    }
+    m_size = 0;
+  }
+
+} // namespace geEngineSDK
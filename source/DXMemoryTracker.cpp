@@ -0,0 +1,344 @@
+/*****************************************************************************/
+/**
+ * @file    DXMemoryTracker.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Video memory accounting of the resources created by the plugin.
+ *
+ * Video memory accounting of the resources created by the plugin.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXMemoryTracker.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <dxgi1_4.h>
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+namespace geEngineSDK {
+
+  namespace {
+    struct Allocation
+    {
+      GPU_MEMORY_CATEGORY::E category = GPU_MEMORY_CATEGORY::kTexture;
+      uint64 bytes = 0;
+      String name;
+    };
+
+    struct TrackerState
+    {
+      std::mutex mutex;
+      UnorderedMap<const void*, Allocation> allocations;
+      GPUMemoryCategoryStats categories[GPU_MEMORY_CATEGORY::kNumCategories];
+      UnorderedMap<String, uint64> bytesByName;
+      uint64 totalBytes = 0;
+    };
+
+    //Created on first use so resources released during static destruction
+    //still find it
+    TrackerState&
+    getState() {
+      static TrackerState* s_pState = new TrackerState();
+      return *s_pState;
+    }
+
+    String
+    nameKey(const Allocation& allocation) {
+      if (!allocation.name.empty()) {
+        return allocation.name;
+      }
+      return String("(") + DXMemoryTracker::getCategoryName(allocation.category) + ")";
+    }
+
+    void
+    removeName(TrackerState& state, const Allocation& allocation) {
+      auto it = state.bytesByName.find(nameKey(allocation));
+      if (it == state.bytesByName.end()) {
+        return;
+      }
+
+      it->second -= Math::min(it->second, allocation.bytes);
+      if (0 == it->second) {
+        state.bytesByName.erase(it);
+      }
+    }
+  }
+
+  void
+  DXMemoryTracker::onAllocated(const void* pResource,
+                               GPU_MEMORY_CATEGORY::E category,
+                               SIZE_T bytes,
+                               const String& name) {
+    if (!pResource) {
+      return;
+    }
+
+    TrackerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    //The same object reported twice replaces the previous entry
+    auto it = state.allocations.find(pResource);
+    if (it != state.allocations.end()) {
+      GPUMemoryCategoryStats& oldStats = state.categories[it->second.category];
+      oldStats.bytes -= it->second.bytes;
+      --oldStats.count;
+      state.totalBytes -= it->second.bytes;
+      removeName(state, it->second);
+    }
+
+    Allocation& allocation = state.allocations[pResource];
+    allocation.category = category;
+    allocation.bytes = static_cast<uint64>(bytes);
+    allocation.name = name;
+
+    GPUMemoryCategoryStats& stats = state.categories[category];
+    stats.bytes += allocation.bytes;
+    stats.peakBytes = Math::max(stats.peakBytes, stats.bytes);
+    ++stats.count;
+    state.totalBytes += allocation.bytes;
+    state.bytesByName[nameKey(allocation)] += allocation.bytes;
+  }
+
+  void
+  DXMemoryTracker::onReleased(const void* pResource) {
+    if (!pResource) {
+      return;
+    }
+
+    TrackerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.allocations.find(pResource);
+    if (it == state.allocations.end()) {
+      return;
+    }
+
+    GPUMemoryCategoryStats& stats = state.categories[it->second.category];
+    stats.bytes -= it->second.bytes;
+    --stats.count;
+    state.totalBytes -= it->second.bytes;
+    removeName(state, it->second);
+    state.allocations.erase(it);
+  }
+
+  void
+  DXMemoryTracker::onRenamed(const void* pResource, const String& name) {
+    if (!pResource) {
+      return;
+    }
+
+    TrackerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.allocations.find(pResource);
+    if (it == state.allocations.end() || it->second.name == name) {
+      return;
+    }
+
+    removeName(state, it->second);
+    it->second.name = name;
+    state.bytesByName[nameKey(it->second)] += it->second.bytes;
+  }
+
+  uint64
+  DXMemoryTracker::getTotalBytes() {
+    TrackerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.totalBytes;
+  }
+
+  GPUMemoryCategoryStats
+  DXMemoryTracker::getCategoryStats(GPU_MEMORY_CATEGORY::E category) {
+    TrackerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.categories[category];
+  }
+
+  Vector<std::pair<String, uint64>>
+  DXMemoryTracker::getBytesByName(uint32 maxNames) {
+    Vector<std::pair<String, uint64>> result;
+    {
+      TrackerState& state = getState();
+      std::lock_guard<std::mutex> lock(state.mutex);
+      result.assign(state.bytesByName.begin(), state.bytesByName.end());
+    }
+
+    std::sort(result.begin(), result.end(),
+              [](const std::pair<String, uint64>& a, const std::pair<String, uint64>& b) {
+                return a.second > b.second;
+              });
+    if (result.size() > maxNames) {
+      result.resize(maxNames);
+    }
+    return result;
+  }
+
+  const char*
+  DXMemoryTracker::getCategoryName(GPU_MEMORY_CATEGORY::E category) {
+    static const char* s_names[GPU_MEMORY_CATEGORY::kNumCategories] = {
+      "Texture",
+      "RenderTarget",
+      "DepthStencil",
+      "VertexBuffer",
+      "IndexBuffer",
+      "ConstantBuffer",
+      "StreamOutput",
+      "Shader",
+      "Staging"
+    };
+    return category < GPU_MEMORY_CATEGORY::kNumCategories ? s_names[category] : "Unknown";
+  }
+
+  String
+  DXMemoryTracker::getReport(uint32 maxNames) {
+    const double toMB = 1.0 / (1024.0 * 1024.0);
+
+    String report;
+    char line[256];
+    snprintf(line, sizeof(line), "Tracked video memory: %.2f MB\n", getTotalBytes() * toMB);
+    report += line;
+
+    for (uint32 i = 0; i < GPU_MEMORY_CATEGORY::kNumCategories; ++i) {
+      auto category = static_cast<GPU_MEMORY_CATEGORY::E>(i);
+      GPUMemoryCategoryStats stats = getCategoryStats(category);
+      if (0 == stats.count && 0 == stats.peakBytes) {
+        continue;
+      }
+
+      snprintf(line,
+               sizeof(line),
+               "  %-16s %6u objects %10.2f MB (peak %.2f MB)\n",
+               getCategoryName(category),
+               stats.count,
+               stats.bytes * toMB,
+               stats.peakBytes * toMB);
+      report += line;
+    }
+
+    auto names = getBytesByName(maxNames);
+    if (!names.empty()) {
+      report += "Largest:\n";
+      for (const auto& entry : names) {
+        snprintf(line,
+                 sizeof(line),
+                 "  %10.2f MB  %s\n",
+                 entry.second * toMB,
+                 entry.first.c_str());
+        report += line;
+      }
+    }
+
+    return report;
+  }
+
+  void
+  DXMemoryTracker::init(IDXGIAdapter* pAdapter, uint32 queryInterval, float warningRatio) {
+    release();
+
+    m_queryInterval = Math::max(1U, queryInterval);
+    m_warningRatio = warningRatio;
+    m_framesToQuery = 0;
+
+    if (!pAdapter ||
+        FAILED(pAdapter->QueryInterface(__uuidof(IDXGIAdapter3),
+                                        reinterpret_cast<void**>(&m_pAdapter)))) {
+      m_pAdapter = nullptr;
+      GE_LOG(kWarning,
+             RenderAPI,
+             "IDXGIAdapter3 is not available, the video memory budget is unknown");
+      return;
+    }
+
+    queryBudget();
+  }
+
+  void
+  DXMemoryTracker::release() {
+    if (m_pAdapter) {
+      m_pAdapter->Release();
+      m_pAdapter = nullptr;
+    }
+    m_budget = GPUMemoryBudget();
+    m_bOverBudget = false;
+  }
+
+  void
+  DXMemoryTracker::update() {
+    if (!m_pAdapter) {
+      return;
+    }
+
+    if (m_framesToQuery) {
+      --m_framesToQuery;
+      return;
+    }
+    m_framesToQuery = m_queryInterval - 1;
+
+    queryBudget();
+  }
+
+  const GPUMemoryBudget&
+  DXMemoryTracker::queryBudget() {
+    if (!m_pAdapter) {
+      return m_budget;
+    }
+
+    DXGI_QUERY_VIDEO_MEMORY_INFO local;
+    DXGI_QUERY_VIDEO_MEMORY_INFO nonLocal;
+    if (FAILED(m_pAdapter->QueryVideoMemoryInfo(0,
+                                                DXGI_MEMORY_SEGMENT_GROUP_LOCAL,
+                                                &local)) ||
+        FAILED(m_pAdapter->QueryVideoMemoryInfo(0,
+                                                DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL,
+                                                &nonLocal))) {
+      m_budget.bValid = false;
+      return m_budget;
+    }
+
+    uint64 previousBudget = m_budget.localBudget;
+
+    m_budget.bValid = true;
+    m_budget.localBudget = local.Budget;
+    m_budget.localUsage = local.CurrentUsage;
+    m_budget.nonLocalBudget = nonLocal.Budget;
+    m_budget.nonLocalUsage = nonLocal.CurrentUsage;
+    m_budget.trackedBytes = getTotalBytes();
+
+    //The budget moves with the other applications, so going over it is
+    //reported again every time it shrinks
+    bool bOver = m_budget.localBudget > 0 &&
+                 static_cast<double>(m_budget.localUsage) >
+                   static_cast<double>(m_budget.localBudget) * m_warningRatio;
+    bool bNotify = bOver && (!m_bOverBudget || m_budget.localBudget < previousBudget);
+    m_bOverBudget = bOver;
+
+    if (bNotify) {
+      const double toMB = 1.0 / (1024.0 * 1024.0);
+      GE_LOG(kWarning,
+             RenderAPI,
+             "Video memory usage {0} MB is over {1}% of the budget ({2} MB), "
+             "tracked resources use {3} MB",
+             static_cast<uint32>(m_budget.localUsage * toMB),
+             static_cast<uint32>(m_warningRatio * 100.0f),
+             static_cast<uint32>(m_budget.localBudget * toMB),
+             static_cast<uint32>(m_budget.trackedBytes * toMB));
+
+      if (m_pBudgetFn) {
+        m_pBudgetFn(m_budget);
+      }
+    }
+
+    return m_budget;
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,956 @@
+/*****************************************************************************/
+/**
+ * @file    DXMipGenerator.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Mip chain generation with compute shaders.
+ *
+ * Mip chain generation with compute shaders.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXMipGenerator.h"
+#include "DXDeviceCaps.h"
+#include "DXMemoryTracker.h"
+#include "DXTexture.h"
+#include "DXTranslateUtils.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <d3dcompiler.h>
+#include <algorithm>
+#include <cstring>
+
+namespace geEngineSDK {
+
+  namespace {
+    namespace MIP_SHADER_ENTRY {
+      enum E {
+        kDownsample = 0,
+        kFilter,
+        kCoverageTop,
+        kCoverageCount,
+        kNumEntries
+      };
+    }
+
+    const char* s_entryPoints[MIP_SHADER_ENTRY::kNumEntries] = {
+      "CSDownsample",
+      "CSFilter",
+      "CSCoverageTop",
+      "CSCoverageCount"
+    };
+
+    //Alpha scales tried by the coverage passes, must match NUM_SCALES
+    const uint32 NUM_COVERAGE_SCALES = 33;
+
+    //Frames a scratch texture survives without being used
+    const uint64 SCRATCH_FRAMES_TO_KEEP = 60;
+
+    const uint32 GROUP_SIZE = 8;
+
+    //Layout of the MipConstants cbuffer
+    struct MipConstants
+    {
+      uint32 srcSize[2];
+      uint32 dstSize[2];
+      float texelSize[2];
+      uint32 numMips;
+      float alphaReference;
+      uint32 coverageBase;
+      uint32 coverageStride;
+      uint32 mip0Texels;
+      float kaiserWidth;
+      float kaiserAlpha;
+      uint32 padding[3];
+    };
+    static_assert(sizeof(MipConstants) == 64, "MipConstants must match the cbuffer");
+
+    /**
+     * SRGB     Encode the results before storing them through the UNORM view.
+     * NPOT     Bit 0 if the source width is odd, bit 1 if the height is odd.
+     *          The box filter then takes two or four bilinear taps so no
+     *          source texel is skipped.
+     * FILTER   0 box, 1 Kaiser.
+     */
+    const char* s_mipShaderSource = R"HLSL(
+#ifndef SRGB
+# define SRGB 0
+#endif
+#ifndef NPOT
+# define NPOT 0
+#endif
+#ifndef FILTER
+# define FILTER 0
+#endif
+
+#define NUM_SCALES 33
+#define UNIT_SCALE 8
+#define MAX_TAPS 16
+
+Texture2DArray<float4> SrcMip : register(t0);
+RWTexture2DArray<float4> OutMip1 : register(u0);
+RWTexture2DArray<float4> OutMip2 : register(u1);
+RWTexture2DArray<float4> OutMip3 : register(u2);
+RWTexture2DArray<float4> OutMip4 : register(u3);
+RWByteAddressBuffer Coverage : register(u4);
+SamplerState BilinearClamp : register(s0);
+
+cbuffer MipConstants : register(b0)
+{
+  uint2 SrcSize;
+  uint2 DstSize;
+  float2 TexelSize;       //1 / DstSize
+  uint NumMips;           //Mips written by CSDownsample
+  float AlphaReference;
+  uint CoverageBase;      //First histogram bin of the destination mip
+  uint CoverageStride;    //Counters per slice, 0 without alpha coverage
+  uint Mip0Texels;
+  float KaiserWidth;
+  float KaiserAlpha;
+  uint3 Padding;
+};
+
+groupshared float gs_R[64];
+groupshared float gs_G[64];
+groupshared float gs_B[64];
+groupshared float gs_A[64];
+groupshared uint gs_Bins[NUM_SCALES];
+groupshared uint gs_Count;
+groupshared float gs_AlphaScale;
+
+float3
+toSRGB(float3 c) {
+  return c < 0.0031308 ? 12.92 * c : 1.055 * pow(abs(c), 1.0 / 2.4) - 0.055;
+}
+
+float4
+packColor(float4 c) {
+#if SRGB
+  return float4(toSRGB(c.rgb), c.a);
+#else
+  return c;
+#endif
+}
+
+void
+storeColor(uint index, float4 c) {
+  gs_R[index] = c.r;
+  gs_G[index] = c.g;
+  gs_B[index] = c.b;
+  gs_A[index] = c.a;
+}
+
+float4
+loadColor(uint index) {
+  return float4(gs_R[index], gs_G[index], gs_B[index], gs_A[index]);
+}
+
+float4
+sampleBox(uint3 dst) {
+#if NPOT == 0
+  float2 uv = TexelSize * (dst.xy + 0.5);
+  return SrcMip.SampleLevel(BilinearClamp, float3(uv, dst.z), 0);
+#elif NPOT == 1
+  float2 uv = TexelSize * (dst.xy + float2(0.25, 0.5));
+  float2 off = TexelSize * float2(0.5, 0.0);
+  return 0.5 * (SrcMip.SampleLevel(BilinearClamp, float3(uv, dst.z), 0) +
+                SrcMip.SampleLevel(BilinearClamp, float3(uv + off, dst.z), 0));
+#elif NPOT == 2
+  float2 uv = TexelSize * (dst.xy + float2(0.5, 0.25));
+  float2 off = TexelSize * float2(0.0, 0.5);
+  return 0.5 * (SrcMip.SampleLevel(BilinearClamp, float3(uv, dst.z), 0) +
+                SrcMip.SampleLevel(BilinearClamp, float3(uv + off, dst.z), 0));
+#else
+  float2 uv = TexelSize * (dst.xy + 0.25);
+  float2 off = TexelSize * 0.5;
+  return 0.25 * (SrcMip.SampleLevel(BilinearClamp, float3(uv, dst.z), 0) +
+                 SrcMip.SampleLevel(BilinearClamp, float3(uv + float2(off.x, 0.0), dst.z), 0) +
+                 SrcMip.SampleLevel(BilinearClamp, float3(uv + float2(0.0, off.y), dst.z), 0) +
+                 SrcMip.SampleLevel(BilinearClamp, float3(uv + off, dst.z), 0));
+#endif
+}
+
+float
+besselI0(float x) {
+  float sum = 1.0;
+  float term = 1.0;
+  float halfX = 0.5 * x;
+  [unroll]
+  for (uint k = 1; k < 16; ++k) {
+    float t = halfX / k;
+    term *= t * t;
+    sum += term;
+  }
+  return sum;
+}
+
+//Sinc at the destination frequency windowed over the filter radius, both
+//distances in source texels
+float
+kaiserWeight(float dist, float scale, float radius) {
+  float t = dist / radius;
+  if (abs(t) >= 1.0) {
+    return 0.0;
+  }
+
+  float window = besselI0(KaiserAlpha * sqrt(1.0 - t * t)) / besselI0(KaiserAlpha);
+  float x = 3.14159265 * dist / scale;
+  return (abs(x) < 1e-4 ? 1.0 : sin(x) / x) * window;
+}
+
+float4
+sampleKaiser(uint3 dst) {
+  float2 scale = float2(SrcSize) / float2(DstSize);
+  float2 radius = min(KaiserWidth * scale, MAX_TAPS * 0.5);
+  float2 center = (dst.xy + 0.5) * scale;
+  int2 first = int2(floor(center - radius + 0.5));
+
+  float4 sum = 0.0;
+  float weightSum = 0.0;
+  [loop]
+  for (int y = 0; y < MAX_TAPS; ++y) {
+    float wy = kaiserWeight(first.y + y + 0.5 - center.y, scale.y, radius.y);
+    if (wy == 0.0) {
+      continue;
+    }
+
+    int sy = clamp(first.y + y, 0, int(SrcSize.y) - 1);
+    [loop]
+    for (int x = 0; x < MAX_TAPS; ++x) {
+      float w = wy * kaiserWeight(first.x + x + 0.5 - center.x, scale.x, radius.x);
+      if (w == 0.0) {
+        continue;
+      }
+
+      int sx = clamp(first.x + x, 0, int(SrcSize.x) - 1);
+      sum += w * SrcMip.Load(int4(sx, sy, dst.z, 0));
+      weightSum += w;
+    }
+  }
+  return sum / weightSum;
+}
+
+float4
+sampleFilter(uint3 dst) {
+#if FILTER == 1
+  return sampleKaiser(dst);
+#else
+  return sampleBox(dst);
+#endif
+}
+
+float
+coverageScale(uint k) {
+  return exp2(lerp(-1.0, 3.0, k / float(NUM_SCALES - 1)));
+}
+
+//Scale whose coverage is the closest to the one of the top mip, ties keep
+//the scale closest to 1
+float
+pickCoverageScale(uint slice) {
+  uint base = slice * CoverageStride;
+  float target = Coverage.Load(base * 4) / float(Mip0Texels);
+  float dstTexels = float(DstSize.x * DstSize.y);
+
+  uint above = 0;
+  uint best = UNIT_SCALE;
+  float bestError = 2.0;
+  for (uint k = 0; k < NUM_SCALES; ++k) {
+    above += Coverage.Load((base + CoverageBase + k) * 4);
+    float error = abs(above / dstTexels - target);
+    if (error < bestError ||
+        (error == bestError && abs(int(k) - UNIT_SCALE) < abs(int(best) - UNIT_SCALE))) {
+      bestError = error;
+      best = k;
+    }
+  }
+  return coverageScale(best);
+}
+
+//Up to four mips, the last three reduced in groupshared memory. NumMips is
+//limited by the host so every 2x2 quad of the group is inside the mip.
+[numthreads(8, 8, 1)]
+void
+CSDownsample(uint GI : SV_GroupIndex, uint3 DTid : SV_DispatchThreadID) {
+  float4 src1 = sampleBox(DTid);
+  OutMip1[DTid] = packColor(src1);
+
+  if (NumMips == 1) {
+    return;
+  }
+
+  storeColor(GI, src1);
+  GroupMemoryBarrierWithGroupSync();
+
+  //X and Y even
+  if ((GI & 0x9) == 0) {
+    src1 = 0.25 * (src1 + loadColor(GI + 0x01) + loadColor(GI + 0x08) + loadColor(GI + 0x09));
+    OutMip2[uint3(DTid.xy / 2, DTid.z)] = packColor(src1);
+    storeColor(GI, src1);
+  }
+
+  if (NumMips == 2) {
+    return;
+  }
+
+  GroupMemoryBarrierWithGroupSync();
+
+  //X and Y multiples of four
+  if ((GI & 0x1B) == 0) {
+    src1 = 0.25 * (src1 + loadColor(GI + 0x02) + loadColor(GI + 0x10) + loadColor(GI + 0x12));
+    OutMip3[uint3(DTid.xy / 4, DTid.z)] = packColor(src1);
+    storeColor(GI, src1);
+  }
+
+  if (NumMips == 3) {
+    return;
+  }
+
+  GroupMemoryBarrierWithGroupSync();
+
+  //X and Y multiples of eight
+  if (GI == 0) {
+    src1 = 0.25 * (src1 + loadColor(0x04) + loadColor(0x20) + loadColor(0x24));
+    OutMip4[uint3(DTid.xy / 8, DTid.z)] = packColor(src1);
+  }
+}
+
+//One mip with the box or Kaiser filter and the alpha coverage scale
+[numthreads(8, 8, 1)]
+void
+CSFilter(uint GI : SV_GroupIndex, uint3 DTid : SV_DispatchThreadID) {
+  if (CoverageStride != 0) {
+    if (GI == 0) {
+      gs_AlphaScale = pickCoverageScale(DTid.z);
+    }
+    GroupMemoryBarrierWithGroupSync();
+  }
+
+  float4 color = sampleFilter(DTid);
+  if (CoverageStride != 0) {
+    color.a = saturate(color.a * gs_AlphaScale);
+  }
+  OutMip1[DTid] = packColor(color);
+}
+
+//Texels of the top mip over the reference, counter 0 of the slice
+[numthreads(8, 8, 1)]
+void
+CSCoverageTop(uint GI : SV_GroupIndex, uint3 DTid : SV_DispatchThreadID) {
+  if (GI == 0) {
+    gs_Count = 0;
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  if (all(DTid.xy < SrcSize) && SrcMip.Load(int4(DTid, 0)).a > AlphaReference) {
+    InterlockedAdd(gs_Count, 1);
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  if (GI == 0 && gs_Count != 0) {
+    Coverage.InterlockedAdd(DTid.z * CoverageStride * 4, gs_Count);
+  }
+}
+
+//Histogram of the first scale that lifts each filtered texel over the
+//reference, so the coverage of scale k is the sum of the bins up to k
+[numthreads(8, 8, 1)]
+void
+CSCoverageCount(uint GI : SV_GroupIndex, uint3 DTid : SV_DispatchThreadID) {
+  if (GI < NUM_SCALES) {
+    gs_Bins[GI] = 0;
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  if (all(DTid.xy < DstSize)) {
+    float alpha = sampleFilter(DTid).a;
+    uint k = 0;
+    [loop]
+    while (k < NUM_SCALES && alpha * coverageScale(k) <= AlphaReference) {
+      ++k;
+    }
+    if (k < NUM_SCALES) {
+      InterlockedAdd(gs_Bins[k], 1);
+    }
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  if (GI < NUM_SCALES && gs_Bins[GI] != 0) {
+    Coverage.InterlockedAdd((DTid.z * CoverageStride + CoverageBase + GI) * 4, gs_Bins[GI]);
+  }
+}
+)HLSL";
+
+    uint32
+    trailingZeros(uint32 value) {
+      if (0 == value) {
+        return 32;
+      }
+
+      uint32 count = 0;
+      while (0 == (value & 1)) {
+        value >>= 1;
+        ++count;
+      }
+      return count;
+    }
+
+    uint32
+    numGroups(uint32 size) {
+      return (size + GROUP_SIZE - 1) / GROUP_SIZE;
+    }
+
+    bool
+    isSameScratch(const D3D11_TEXTURE2D_DESC& a, const D3D11_TEXTURE2D_DESC& b) {
+      return a.Width == b.Width &&
+             a.Height == b.Height &&
+             a.MipLevels == b.MipLevels &&
+             a.ArraySize == b.ArraySize &&
+             a.Format == b.Format;
+    }
+  }
+
+  void
+  DXMipGenerator::init(D3DDevice* pDevice, const DXDeviceCaps* pDeviceCaps) {
+    GE_ASSERT(pDevice && pDeviceCaps);
+    release();
+
+    m_pDevice = pDevice;
+    m_pDevice->AddRef();
+    m_pDeviceCaps = pDeviceCaps;
+
+    D3D11_BUFFER_DESC bDesc;
+    ge_zero_out(bDesc);
+    bDesc.ByteWidth = sizeof(MipConstants);
+    bDesc.Usage = D3D11_USAGE_DYNAMIC;
+    bDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    bDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    throwIfFailed(m_pDevice->CreateBuffer(&bDesc, nullptr, &m_pConstants));
+
+    D3D11_SAMPLER_DESC sDesc;
+    ge_zero_out(sDesc);
+    sDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    sDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+    sDesc.MaxLOD = D3D11_FLOAT32_MAX;
+    throwIfFailed(m_pDevice->CreateSamplerState(&sDesc, &m_pBilinearClamp));
+  }
+
+  void
+  DXMipGenerator::release() {
+    for (auto& scratch : m_scratch) {
+      DXMemoryTracker::onReleased(scratch.target.pTexture);
+      _releaseTarget(scratch.target);
+    }
+    m_scratch.clear();
+
+    for (auto& shader : m_shaders) {
+      safeRelease(shader.second);
+    }
+    m_shaders.clear();
+
+    safeRelease(m_pCoverageUAV);
+    safeRelease(m_pCoverage);
+    m_coverageCounters = 0;
+
+    safeRelease(m_pBilinearClamp);
+    safeRelease(m_pConstants);
+    safeRelease(m_pDevice);
+    m_pDeviceCaps = nullptr;
+  }
+
+  bool
+  DXMipGenerator::isSupported(DXGI_FORMAT format) const {
+    DXGI_FORMAT srvFormat;
+    DXGI_FORMAT uavFormat;
+    return _getViewFormats(format, srvFormat, uavFormat);
+  }
+
+  bool
+  DXMipGenerator::generate(D3DDeviceContext* pContext,
+                           ID3D11Texture2D* pTexture,
+                           const MipGenerationDesc& desc) {
+    GE_ASSERT(pContext && pTexture);
+    if (!m_pDevice) {
+      return false;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    pTexture->GetDesc(&tDesc);
+    if (tDesc.MipLevels < 2 ||
+        tDesc.SampleDesc.Count > 1 ||
+        D3D11_USAGE_DEFAULT != tDesc.Usage) {
+      return false;
+    }
+
+    DXGI_FORMAT srvFormat;
+    DXGI_FORMAT uavFormat;
+    if (!_getViewFormats(tDesc.Format, srvFormat, uavFormat)) {
+      return false;
+    }
+    const bool bSRGB = srvFormat != uavFormat;
+
+    //Save the compute state the render API may have bound
+    ID3D11ComputeShader* pOldShader = nullptr;
+    ID3D11ShaderResourceView* pOldSRV = nullptr;
+    ID3D11UnorderedAccessView* pOldUAVs[5] = {};
+    ID3D11Buffer* pOldConstants = nullptr;
+    ID3D11SamplerState* pOldSampler = nullptr;
+    pContext->CSGetShader(&pOldShader, nullptr, nullptr);
+    pContext->CSGetShaderResources(0, 1, &pOldSRV);
+    pContext->CSGetUnorderedAccessViews(0, 5, pOldUAVs);
+    pContext->CSGetConstantBuffers(0, 1, &pOldConstants);
+    pContext->CSGetSamplers(0, 1, &pOldSampler);
+
+    ID3D11UnorderedAccessView* nullUAVs[5] = {};
+    pContext->CSSetUnorderedAccessViews(0, 5, nullUAVs, nullptr);
+    pContext->CSSetConstantBuffers(0, 1, &m_pConstants);
+    pContext->CSSetSamplers(0, 1, &m_pBilinearClamp);
+
+    bool bResult = false;
+    const bool bDirect = (tDesc.BindFlags & D3D11_BIND_UNORDERED_ACCESS) &&
+                         (tDesc.BindFlags & D3D11_BIND_SHADER_RESOURCE) &&
+                         !bSRGB;
+    if (bDirect) {
+      MipTarget target;
+      target.pTexture = pTexture;
+      target.pTexture->AddRef();
+      _createViews(target, tDesc, srvFormat, uavFormat);
+      bResult = _generateMips(pContext, target, tDesc, desc, bSRGB);
+      _releaseTarget(target);
+    }
+    else {
+      //sRGB textures can't be typed UAVs, they go through the UNORM alias of
+      //a typeless copy
+      ScratchTexture& scratch = _getScratch(tDesc, srvFormat, uavFormat);
+      ID3D11Texture2D* pScratch = scratch.target.pTexture;
+      for (uint32 slice = 0; slice < tDesc.ArraySize; ++slice) {
+        UINT subresource = D3D11CalcSubresource(0, slice, tDesc.MipLevels);
+        pContext->CopySubresourceRegion(pScratch, subresource, 0, 0, 0,
+                                        pTexture, subresource, nullptr);
+      }
+
+      bResult = _generateMips(pContext, scratch.target, tDesc, desc, bSRGB);
+
+      for (uint32 slice = 0; slice < tDesc.ArraySize; ++slice) {
+        for (uint32 mip = 1; mip < tDesc.MipLevels; ++mip) {
+          UINT subresource = D3D11CalcSubresource(mip, slice, tDesc.MipLevels);
+          pContext->CopySubresourceRegion(pTexture, subresource, 0, 0, 0,
+                                          pScratch, subresource, nullptr);
+        }
+      }
+    }
+
+    pContext->CSSetShader(pOldShader, nullptr, 0);
+    pContext->CSSetShaderResources(0, 1, &pOldSRV);
+    pContext->CSSetUnorderedAccessViews(0, 5, pOldUAVs, nullptr);
+    pContext->CSSetConstantBuffers(0, 1, &pOldConstants);
+    pContext->CSSetSamplers(0, 1, &pOldSampler);
+
+    safeRelease(pOldShader);
+    safeRelease(pOldSRV);
+    for (auto& pUAV : pOldUAVs) {
+      safeRelease(pUAV);
+    }
+    safeRelease(pOldConstants);
+    safeRelease(pOldSampler);
+
+    return bResult;
+  }
+
+  void
+  DXMipGenerator::endFrame() {
+    ++m_frameNumber;
+
+    auto itNewEnd = std::remove_if(m_scratch.begin(), m_scratch.end(),
+      [this](ScratchTexture& scratch) {
+        if (scratch.lastUsedFrame + SCRATCH_FRAMES_TO_KEEP >= m_frameNumber) {
+          return false;
+        }
+
+        DXMemoryTracker::onReleased(scratch.target.pTexture);
+        _releaseTarget(scratch.target);
+        return true;
+      });
+    m_scratch.erase(itNewEnd, m_scratch.end());
+  }
+
+  bool
+  DXMipGenerator::_getViewFormats(DXGI_FORMAT format,
+                                  DXGI_FORMAT& srvFormat,
+                                  DXGI_FORMAT& uavFormat) const {
+    using namespace TranslateUtils;
+    const uint32 unsupportedFlags = FORMAT_FLAG::kCompressed |
+                                    FORMAT_FLAG::kDepth |
+                                    FORMAT_FLAG::kStencil |
+                                    FORMAT_FLAG::kTypeless |
+                                    FORMAT_FLAG::kVideo |
+                                    FORMAT_FLAG::kPlanar |
+                                    FORMAT_FLAG::kPacked |
+                                    FORMAT_FLAG::kPalette;
+
+    const auto& info = getFormatInfo(format);
+    if (!m_pDeviceCaps ||
+        DXGI_FORMAT_UNKNOWN == info.format ||
+        0 != (info.flags & unsupportedFlags)) {
+      return false;
+    }
+
+    srvFormat = format;
+    uavFormat = info.hasFlag(FORMAT_FLAG::kSRGB) ? info.srgbFormat : format;
+
+    //Integer formats can't be filtered by the sampler
+    const DXFormatCaps& uavCaps = m_pDeviceCaps->getFormatCaps(uavFormat);
+    return m_pDeviceCaps->hasFormatSupport(srvFormat, D3D11_FORMAT_SUPPORT_SHADER_SAMPLE) &&
+           0 != (uavCaps.support & D3D11_FORMAT_SUPPORT_TYPED_UNORDERED_ACCESS_VIEW) &&
+           0 != (uavCaps.support2 & D3D11_FORMAT_SUPPORT2_UAV_TYPED_STORE);
+  }
+
+  void
+  DXMipGenerator::_createViews(MipTarget& target,
+                               const D3D11_TEXTURE2D_DESC& desc,
+                               DXGI_FORMAT srvFormat,
+                               DXGI_FORMAT uavFormat) {
+    target.srvs.resize(desc.MipLevels, nullptr);
+    target.uavs.resize(desc.MipLevels, nullptr);
+
+    //Cube maps are seen as arrays of faces
+    for (uint32 mip = 0; mip < desc.MipLevels; ++mip) {
+      if (mip + 1 < desc.MipLevels) {
+        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+        ge_zero_out(srvDesc);
+        srvDesc.Format = srvFormat;
+        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+        srvDesc.Texture2DArray.MostDetailedMip = mip;
+        srvDesc.Texture2DArray.MipLevels = 1;
+        srvDesc.Texture2DArray.FirstArraySlice = 0;
+        srvDesc.Texture2DArray.ArraySize = desc.ArraySize;
+        throwIfFailed(m_pDevice->CreateShaderResourceView(target.pTexture,
+                                                          &srvDesc,
+                                                          &target.srvs[mip]));
+      }
+
+      if (mip > 0) {
+        D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+        ge_zero_out(uavDesc);
+        uavDesc.Format = uavFormat;
+        uavDesc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2DARRAY;
+        uavDesc.Texture2DArray.MipSlice = mip;
+        uavDesc.Texture2DArray.FirstArraySlice = 0;
+        uavDesc.Texture2DArray.ArraySize = desc.ArraySize;
+        throwIfFailed(m_pDevice->CreateUnorderedAccessView(target.pTexture,
+                                                           &uavDesc,
+                                                           &target.uavs[mip]));
+      }
+    }
+  }
+
+  void
+  DXMipGenerator::_releaseTarget(MipTarget& target) {
+    for (auto& pSRV : target.srvs) {
+      safeRelease(pSRV);
+    }
+    for (auto& pUAV : target.uavs) {
+      safeRelease(pUAV);
+    }
+    target.srvs.clear();
+    target.uavs.clear();
+    safeRelease(target.pTexture);
+  }
+
+  DXMipGenerator::ScratchTexture&
+  DXMipGenerator::_getScratch(const D3D11_TEXTURE2D_DESC& desc,
+                              DXGI_FORMAT srvFormat,
+                              DXGI_FORMAT uavFormat) {
+    const auto& info = TranslateUtils::getFormatInfo(desc.Format);
+
+    D3D11_TEXTURE2D_DESC sDesc;
+    ge_zero_out(sDesc);
+    sDesc.Width = desc.Width;
+    sDesc.Height = desc.Height;
+    sDesc.MipLevels = desc.MipLevels;
+    sDesc.ArraySize = desc.ArraySize;
+    sDesc.Format = DXGI_FORMAT_UNKNOWN != info.typelessFormat ? info.typelessFormat
+                                                               : desc.Format;
+    sDesc.SampleDesc.Count = 1;
+    sDesc.Usage = D3D11_USAGE_DEFAULT;
+    sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_UNORDERED_ACCESS;
+
+    for (auto& scratch : m_scratch) {
+      if (isSameScratch(scratch.desc, sDesc) &&
+          scratch.srvFormat == srvFormat &&
+          scratch.uavFormat == uavFormat) {
+        scratch.lastUsedFrame = m_frameNumber;
+        return scratch;
+      }
+    }
+
+    m_scratch.emplace_back();
+    ScratchTexture& scratch = m_scratch.back();
+    scratch.desc = sDesc;
+    scratch.srvFormat = srvFormat;
+    scratch.uavFormat = uavFormat;
+    scratch.lastUsedFrame = m_frameNumber;
+    throwIfFailed(m_pDevice->CreateTexture2D(&sDesc, nullptr, &scratch.target.pTexture));
+    _createViews(scratch.target, sDesc, srvFormat, uavFormat);
+
+    DXMemoryTracker::onAllocated(scratch.target.pTexture,
+                                 GPU_MEMORY_CATEGORY::kTexture,
+                                 DXTexture::computeMemoryUsage(sDesc),
+                                 "MipGenerationScratch");
+    return scratch;
+  }
+
+  ID3D11ComputeShader*
+  DXMipGenerator::_getShader(uint32 entryPoint, uint32 filter, uint32 npot, bool bSRGB) {
+    GE_ASSERT(entryPoint < MIP_SHADER_ENTRY::kNumEntries);
+
+    uint32 key = entryPoint | (filter << 4) | (npot << 8) | ((bSRGB ? 1U : 0U) << 12);
+    auto it = m_shaders.find(key);
+    if (it != m_shaders.end()) {
+      return it->second;
+    }
+
+    char filterValue[2] = { static_cast<char>('0' + filter), '\0' };
+    char npotValue[2] = { static_cast<char>('0' + npot), '\0' };
+    D3D_SHADER_MACRO macros[] = {
+      { "FILTER", filterValue },
+      { "NPOT", npotValue },
+      { "SRGB", bSRGB ? "1" : "0" },
+      { nullptr, nullptr }
+    };
+
+    ID3DBlob* pCode = nullptr;
+    ID3DBlob* pErrorBlob = nullptr;
+    HRESULT hr = D3DCompile(s_mipShaderSource,
+                            strlen(s_mipShaderSource),
+                            "DXMipGenerator",
+                            macros,
+                            nullptr,
+                            s_entryPoints[entryPoint],
+                            "cs_5_0",
+                            D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_OPTIMIZATION_LEVEL3,
+                            0,
+                            &pCode,
+                            &pErrorBlob);
+
+    //A failed variant is remembered so it isn't compiled every call
+    ID3D11ComputeShader* pShader = nullptr;
+    if (FAILED(hr)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to compile the mip generation shader {0}: {1}",
+             s_entryPoints[entryPoint],
+             pErrorBlob ? reinterpret_cast<const char*>(pErrorBlob->GetBufferPointer()) : "");
+    }
+    else {
+      throwIfFailed(m_pDevice->CreateComputeShader(pCode->GetBufferPointer(),
+                                                   pCode->GetBufferSize(),
+                                                   nullptr,
+                                                   &pShader));
+    }
+
+    safeRelease(pCode);
+    safeRelease(pErrorBlob);
+
+    m_shaders[key] = pShader;
+    return pShader;
+  }
+
+  ID3D11UnorderedAccessView*
+  DXMipGenerator::_getCoverageUAV(uint32 numCounters) {
+    if (m_coverageCounters >= numCounters) {
+      return m_pCoverageUAV;
+    }
+
+    safeRelease(m_pCoverageUAV);
+    safeRelease(m_pCoverage);
+
+    //Grows to the next power of two so mip chains of similar sizes share it
+    m_coverageCounters = 64;
+    while (m_coverageCounters < numCounters) {
+      m_coverageCounters <<= 1;
+    }
+
+    D3D11_BUFFER_DESC bDesc;
+    ge_zero_out(bDesc);
+    bDesc.ByteWidth = m_coverageCounters * sizeof(uint32);
+    bDesc.Usage = D3D11_USAGE_DEFAULT;
+    bDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+    bDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    throwIfFailed(m_pDevice->CreateBuffer(&bDesc, nullptr, &m_pCoverage));
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+    ge_zero_out(uavDesc);
+    uavDesc.Format = DXGI_FORMAT_R32_TYPELESS;
+    uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+    uavDesc.Buffer.FirstElement = 0;
+    uavDesc.Buffer.NumElements = m_coverageCounters;
+    uavDesc.Buffer.Flags = D3D11_BUFFER_UAV_FLAG_RAW;
+    throwIfFailed(m_pDevice->CreateUnorderedAccessView(m_pCoverage, &uavDesc, &m_pCoverageUAV));
+
+    return m_pCoverageUAV;
+  }
+
+  void
+  DXMipGenerator::_setConstants(D3DDeviceContext* pContext, const void* pData, SIZE_T size) {
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    throwIfFailed(pContext->Map(m_pConstants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
+    memcpy(mapped.pData, pData, size);
+    pContext->Unmap(m_pConstants, 0);
+  }
+
+  bool
+  DXMipGenerator::_generateMips(D3DDeviceContext* pContext,
+                                const MipTarget& target,
+                                const D3D11_TEXTURE2D_DESC& texDesc,
+                                const MipGenerationDesc& desc,
+                                bool bSRGB) {
+    const uint32 numSlices = texDesc.ArraySize;
+    const bool bCoverage = desc.bPreserveAlphaCoverage;
+    const uint32 filter = static_cast<uint32>(desc.filter);
+
+    //The Kaiser filter and the coverage scale need the whole source mip, so
+    //they can't reduce several mips in groupshared memory
+    const bool bSingleMip = bCoverage || MIP_FILTER::kKaiser == desc.filter;
+
+    ID3D11UnorderedAccessView* nullUAVs[4] = {};
+    ID3D11ShaderResourceView* pNullSRV = nullptr;
+
+    MipConstants constants;
+    ge_zero_out(constants);
+    constants.alphaReference = desc.alphaReference;
+    constants.mip0Texels = texDesc.Width * texDesc.Height;
+    constants.kaiserWidth = Math::max(desc.kaiserWidth, 0.5f);
+    constants.kaiserAlpha = desc.kaiserAlpha;
+
+    uint32 coverageStride = 0;
+    if (bCoverage) {
+      //Counter 0 of every slice is the coverage of the top mip, followed by
+      //a histogram per destination mip
+      coverageStride = 1 + (texDesc.MipLevels - 1) * NUM_COVERAGE_SCALES;
+      ID3D11UnorderedAccessView* pCoverageUAV = _getCoverageUAV(coverageStride * numSlices);
+      const UINT zeros[4] = { 0, 0, 0, 0 };
+      pContext->ClearUnorderedAccessViewUint(pCoverageUAV, zeros);
+      pContext->CSSetUnorderedAccessViews(4, 1, &pCoverageUAV, nullptr);
+
+      ID3D11ComputeShader* pShader = _getShader(MIP_SHADER_ENTRY::kCoverageTop, 0, 0, false);
+      if (!pShader) {
+        return false;
+      }
+
+      constants.srcSize[0] = texDesc.Width;
+      constants.srcSize[1] = texDesc.Height;
+      constants.coverageStride = coverageStride;
+      _setConstants(pContext, &constants, sizeof(constants));
+
+      pContext->CSSetShader(pShader, nullptr, 0);
+      pContext->CSSetShaderResources(0, 1, &target.srvs[0]);
+      pContext->Dispatch(numGroups(texDesc.Width), numGroups(texDesc.Height), numSlices);
+    }
+
+    uint32 mip = 0;
+    while (mip + 1 < texDesc.MipLevels) {
+      uint32 srcWidth = Math::max(1U, texDesc.Width >> mip);
+      uint32 srcHeight = Math::max(1U, texDesc.Height >> mip);
+      uint32 dstWidth = srcWidth >> 1;
+      uint32 dstHeight = srcHeight >> 1;
+      uint32 npot = (srcWidth & 1) | ((srcHeight & 1) << 1);
+
+      //Each extra mip halves both sizes again, a 1 texel wide side stays 1
+      uint32 numMips = 1;
+      if (!bSingleMip) {
+        uint32 sizes = (1 == dstWidth ? dstHeight : dstWidth) |
+                       (1 == dstHeight ? dstWidth : dstHeight);
+        numMips += Math::min(3U, trailingZeros(sizes));
+      }
+      numMips = Math::min(numMips, texDesc.MipLevels - 1 - mip);
+
+      dstWidth = Math::max(1U, dstWidth);
+      dstHeight = Math::max(1U, dstHeight);
+
+      constants.srcSize[0] = srcWidth;
+      constants.srcSize[1] = srcHeight;
+      constants.dstSize[0] = dstWidth;
+      constants.dstSize[1] = dstHeight;
+      constants.texelSize[0] = 1.0f / dstWidth;
+      constants.texelSize[1] = 1.0f / dstHeight;
+      constants.numMips = numMips;
+
+      pContext->CSSetShaderResources(0, 1, &target.srvs[mip]);
+
+      if (bSingleMip) {
+        //The Kaiser filter reads texels directly, the odd sizes don't matter
+        uint32 variant = MIP_FILTER::kKaiser == desc.filter ? 0 : npot;
+
+        if (bCoverage) {
+          ID3D11ComputeShader* pShader = _getShader(MIP_SHADER_ENTRY::kCoverageCount,
+                                                    filter,
+                                                    variant,
+                                                    false);
+          if (!pShader) {
+            return false;
+          }
+
+          constants.coverageBase = 1 + mip * NUM_COVERAGE_SCALES;
+          constants.coverageStride = coverageStride;
+          _setConstants(pContext, &constants, sizeof(constants));
+          pContext->CSSetShader(pShader, nullptr, 0);
+          pContext->Dispatch(numGroups(dstWidth), numGroups(dstHeight), numSlices);
+        }
+        else {
+          _setConstants(pContext, &constants, sizeof(constants));
+        }
+
+        ID3D11ComputeShader* pShader = _getShader(MIP_SHADER_ENTRY::kFilter,
+                                                  filter,
+                                                  variant,
+                                                  bSRGB);
+        if (!pShader) {
+          return false;
+        }
+
+        pContext->CSSetShader(pShader, nullptr, 0);
+        pContext->CSSetUnorderedAccessViews(0, 1, &target.uavs[mip + 1], nullptr);
+        pContext->Dispatch(numGroups(dstWidth), numGroups(dstHeight), numSlices);
+      }
+      else {
+        ID3D11ComputeShader* pShader = _getShader(MIP_SHADER_ENTRY::kDownsample,
+                                                  0,
+                                                  npot,
+                                                  bSRGB);
+        if (!pShader) {
+          return false;
+        }
+
+        ID3D11UnorderedAccessView* pUAVs[4] = {};
+        for (uint32 i = 0; i < numMips; ++i) {
+          pUAVs[i] = target.uavs[mip + 1 + i];
+        }
+
+        _setConstants(pContext, &constants, sizeof(constants));
+        pContext->CSSetShader(pShader, nullptr, 0);
+        pContext->CSSetUnorderedAccessViews(0, 4, pUAVs, nullptr);
+        pContext->Dispatch(numGroups(dstWidth), numGroups(dstHeight), numSlices);
+      }
+
+      //The next source mip can't stay bound as a UAV
+      pContext->CSSetUnorderedAccessViews(0, 4, nullUAVs, nullptr);
+      mip += numMips;
+    }
+
+    pContext->CSSetShaderResources(0, 1, &pNullSRV);
+    return true;
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,361 @@
+/*****************************************************************************/
+/**
+ * @file    DXReadbackQueue.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Asynchronous GPU to CPU readbacks.
+ *
+ * Asynchronous GPU to CPU readbacks.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXReadbackQueue.h"
+#include "DXMemoryTracker.h"
+#include "DXTexture.h"
+#include "DXTranslateUtils.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <algorithm>
+
+namespace geEngineSDK {
+
+  void
+  DXReadbackQueue::init(D3DDevice* pDevice, D3DDeviceContext* pContext) {
+    GE_ASSERT(pDevice && pContext);
+    release();
+
+    m_pDevice = pDevice;
+    m_pContext = pContext;
+    m_pDevice->AddRef();
+    m_pContext->AddRef();
+  }
+
+  void
+  DXReadbackQueue::release() {
+    while (!m_requests.empty()) {
+      _retire(static_cast<uint32>(m_requests.size() - 1));
+    }
+
+    for (auto& staging : m_staging) {
+      DXMemoryTracker::onReleased(staging.pResource);
+      safeRelease(staging.pResource);
+    }
+    m_staging.clear();
+
+    for (auto& pQuery : m_freeQueries) {
+      safeRelease(pQuery);
+    }
+    m_freeQueries.clear();
+
+    safeRelease(m_pContext);
+    safeRelease(m_pDevice);
+  }
+
+  ReadbackTicket
+  DXReadbackQueue::request(ID3D11Resource* pResource,
+                           uint32 subResource,
+                           const ReadbackFn& pCallback) {
+    GE_ASSERT(m_pDevice && m_pContext);
+    if (!pResource) {
+      return INVALID_READBACK_TICKET;
+    }
+
+    Request req;
+    StagingKey key;
+    pResource->GetType(&key.dimension);
+
+    if (D3D11_RESOURCE_DIMENSION_TEXTURE2D == key.dimension) {
+      ID3D11Texture2D* pTexture = static_cast<ID3D11Texture2D*>(pResource);
+      D3D11_TEXTURE2D_DESC tDesc;
+      pTexture->GetDesc(&tDesc);
+
+      if (tDesc.SampleDesc.Count > 1) {
+        GE_LOG(kError, RenderAPI, "Can't read back a multisampled texture, resolve it first.");
+        return INVALID_READBACK_TICKET;
+      }
+
+      //Block compressed staging textures are whole blocks, even for the
+      //mips smaller than a block
+      const auto& formatInfo = TranslateUtils::getFormatInfo(tDesc.Format);
+      uint32 blockWidth = Math::max(1U, formatInfo.blockWidth);
+      uint32 blockHeight = Math::max(1U, formatInfo.blockHeight);
+
+      uint32 mipLevel = subResource % tDesc.MipLevels;
+      uint32 width = Math::max(1U, tDesc.Width >> mipLevel);
+      uint32 height = Math::max(1U, tDesc.Height >> mipLevel);
+      key.width = (width + blockWidth - 1) / blockWidth * blockWidth;
+      key.height = (height + blockHeight - 1) / blockHeight * blockHeight;
+      key.format = tDesc.Format;
+    }
+    else if (D3D11_RESOURCE_DIMENSION_BUFFER == key.dimension) {
+      ID3D11Buffer* pBuffer = static_cast<ID3D11Buffer*>(pResource);
+      D3D11_BUFFER_DESC bDesc;
+      pBuffer->GetDesc(&bDesc);
+
+      GE_ASSERT(0 == subResource);
+      key.width = bDesc.ByteWidth;
+      key.height = 1;
+    }
+    else {
+      GE_LOG(kError, RenderAPI, "Unsupported resource type for a readback.");
+      return INVALID_READBACK_TICKET;
+    }
+
+    req.pStaging = _acquireStaging(key);
+    req.pQuery = _acquireQuery();
+    req.ticket = m_nextTicket++;
+    req.pCallback = pCallback;
+    req.issueFrame = m_frameIndex;
+    req.info.width = key.width;
+    req.info.height = key.height;
+    req.info.format = key.format;
+
+    m_pContext->CopySubresourceRegion(req.pStaging,
+                                      0,
+                                      0, 0, 0,
+                                      pResource,
+                                      subResource,
+                                      nullptr);
+    m_pContext->End(req.pQuery);
+
+    m_requests.push_back(req);
+    return req.ticket;
+  }
+
+  void
+  DXReadbackQueue::update() {
+    ++m_frameIndex;
+
+    //Requests complete in submission order, stop at the first pending one
+    //that has a callback, the ones after it can't be done either
+    for (uint32 i = 0; i < m_requests.size();) {
+      if (!m_requests[i].pCallback) {
+        _poll(m_requests[i]);
+        ++i;
+        continue;
+      }
+
+      ReadbackData data;
+      if (!_map(m_requests[i], data)) {
+        break;
+      }
+
+      //Out of the queue before the callback, it may request or discard
+      //readbacks. Its staging stays mapped and in use until it returns
+      Request req = std::move(m_requests[i]);
+      m_requests.erase(m_requests.begin() + i);
+      req.pCallback(data);
+      _recycle(req);
+
+      //The callback may have discarded requests before this one
+      i = 0;
+    }
+
+    //Drop the staging resources that haven't been needed for a while
+    uint64 frameIndex = m_frameIndex;
+    uint32 framesToKeep = m_framesToKeepUnused;
+    auto itEnd = std::remove_if(m_staging.begin(), m_staging.end(),
+                   [frameIndex, framesToKeep](StagingResource& staging) {
+                     if (staging.bInUse ||
+                         frameIndex - staging.lastUsedFrame <= framesToKeep) {
+                       return false;
+                     }
+                     DXMemoryTracker::onReleased(staging.pResource);
+                     safeRelease(staging.pResource);
+                     return true;
+                   });
+    m_staging.erase(itEnd, m_staging.end());
+  }
+
+  READBACK_STATUS::E
+  DXReadbackQueue::getStatus(ReadbackTicket ticket) {
+    Request* pReq = _find(ticket);
+    if (!pReq) {
+      return READBACK_STATUS::kInvalid;
+    }
+
+    return _poll(*pReq) ? READBACK_STATUS::kReady : READBACK_STATUS::kPending;
+  }
+
+  bool
+  DXReadbackQueue::map(ReadbackTicket ticket, ReadbackData& outData) {
+    Request* pReq = _find(ticket);
+    if (!pReq) {
+      return false;
+    }
+
+    return _map(*pReq, outData);
+  }
+
+  void
+  DXReadbackQueue::discard(ReadbackTicket ticket) {
+    uint32 index = 0;
+    if (_find(ticket, &index)) {
+      _retire(index);
+    }
+  }
+
+  ID3D11Resource*
+  DXReadbackQueue::_acquireStaging(const StagingKey& key) {
+    for (auto& staging : m_staging) {
+      if (!staging.bInUse && staging.key == key) {
+        staging.bInUse = true;
+        staging.lastUsedFrame = m_frameIndex;
+        return staging.pResource;
+      }
+    }
+
+    StagingResource staging;
+    staging.key = key;
+    staging.lastUsedFrame = m_frameIndex;
+    staging.bInUse = true;
+
+    if (D3D11_RESOURCE_DIMENSION_TEXTURE2D == key.dimension) {
+      D3D11_TEXTURE2D_DESC tDesc;
+      ge_zero_out(tDesc);
+      tDesc.Width = key.width;
+      tDesc.Height = key.height;
+      tDesc.MipLevels = 1;
+      tDesc.ArraySize = 1;
+      tDesc.Format = key.format;
+      tDesc.SampleDesc.Count = 1;
+      tDesc.Usage = D3D11_USAGE_STAGING;
+      tDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+      ID3D11Texture2D* pTexture = nullptr;
+      throwIfFailed(m_pDevice->CreateTexture2D(&tDesc, nullptr, &pTexture));
+      DXMemoryTracker::onAllocated(pTexture,
+                                   GPU_MEMORY_CATEGORY::kStaging,
+                                   DXTexture::computeMemoryUsage(tDesc));
+      staging.pResource = pTexture;
+    }
+    else {
+      D3D11_BUFFER_DESC bDesc;
+      ge_zero_out(bDesc);
+      bDesc.ByteWidth = key.width;
+      bDesc.Usage = D3D11_USAGE_STAGING;
+      bDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+      ID3D11Buffer* pBuffer = nullptr;
+      throwIfFailed(m_pDevice->CreateBuffer(&bDesc, nullptr, &pBuffer));
+      DXMemoryTracker::onAllocated(pBuffer, GPU_MEMORY_CATEGORY::kStaging, bDesc.ByteWidth);
+      staging.pResource = pBuffer;
+    }
+
+    m_staging.push_back(staging);
+    return staging.pResource;
+  }
+
+  ID3D11Query*
+  DXReadbackQueue::_acquireQuery() {
+    if (!m_freeQueries.empty()) {
+      ID3D11Query* pQuery = m_freeQueries.back();
+      m_freeQueries.pop_back();
+      return pQuery;
+    }
+
+    D3D11_QUERY_DESC qDesc;
+    qDesc.Query = D3D11_QUERY_EVENT;
+    qDesc.MiscFlags = 0;
+
+    ID3D11Query* pQuery = nullptr;
+    throwIfFailed(m_pDevice->CreateQuery(&qDesc, &pQuery));
+    return pQuery;
+  }
+
+  bool
+  DXReadbackQueue::_poll(Request& request) {
+    if (request.bReady) {
+      return true;
+    }
+
+    if (m_frameIndex - request.issueFrame < m_frameLatency) {
+      return false;
+    }
+
+    //Don't flush, the copy was submitted frames ago
+    BOOL bDone = FALSE;
+    HRESULT hr = m_pContext->GetData(request.pQuery,
+                                     &bDone,
+                                     sizeof(bDone),
+                                     D3D11_ASYNC_GETDATA_DONOTFLUSH);
+    request.bReady = (S_OK == hr && bDone);
+    return request.bReady;
+  }
+
+  bool
+  DXReadbackQueue::_map(Request& request, ReadbackData& outData) {
+    if (!_poll(request)) {
+      return false;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (!request.bMapped) {
+      HRESULT hr = m_pContext->Map(request.pStaging,
+                                   0,
+                                   D3D11_MAP_READ,
+                                   D3D11_MAP_FLAG_DO_NOT_WAIT,
+                                   &mapped);
+      if (DXGI_ERROR_WAS_STILL_DRAWING == hr) {
+        return false;
+      }
+      throwIfFailed(hr);
+
+      request.bMapped = true;
+      request.info.pData = mapped.pData;
+      request.info.rowPitch = mapped.RowPitch;
+      request.info.depthPitch = mapped.DepthPitch;
+    }
+
+    outData = request.info;
+    return true;
+  }
+
+  void
+  DXReadbackQueue::_retire(uint32 requestIndex) {
+    _recycle(m_requests[requestIndex]);
+    m_requests.erase(m_requests.begin() + requestIndex);
+  }
+
+  void
+  DXReadbackQueue::_recycle(Request& req) {
+    if (req.bMapped) {
+      m_pContext->Unmap(req.pStaging, 0);
+    }
+
+    for (auto& staging : m_staging) {
+      if (staging.pResource == req.pStaging) {
+        staging.bInUse = false;
+        staging.lastUsedFrame = m_frameIndex;
+        break;
+      }
+    }
+
+    m_freeQueries.push_back(req.pQuery);
+    req.pQuery = nullptr;
+    req.pStaging = nullptr;
+    req.bMapped = false;
+  }
+
+  DXReadbackQueue::Request*
+  DXReadbackQueue::_find(ReadbackTicket ticket, uint32* pOutIndex) {
+    for (uint32 i = 0; i < m_requests.size(); ++i) {
+      if (m_requests[i].ticket == ticket) {
+        if (pOutIndex) {
+          *pOutIndex = i;
+        }
+        return &m_requests[i];
+      }
+    }
+    return nullptr;
+  }
+
+} // namespace geEngineSDK
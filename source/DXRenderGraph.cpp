@@ -0,0 +1,399 @@
+/*****************************************************************************/
+/**
+ * @file    DXRenderGraph.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Frame graph that schedules passes and transient render targets.
+ *
+ * Frame graph that schedules passes and transient render targets.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXRenderGraph.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <algorithm>
+
+namespace geEngineSDK {
+
+  /*************************************************************************/
+  // Pass Builder
+  /*************************************************************************/
+  RGTextureHandle
+  DXRenderGraph::PassBuilder::create(const String& name, const RGTextureDesc& desc) {
+    auto handle = static_cast<RGTextureHandle>(m_graph.m_resources.size());
+
+    m_graph.m_resources.emplace_back();
+    Resource& res = m_graph.m_resources.back();
+    res.name = name;
+    res.desc = desc;
+
+    //The creating pass is the producer, the physical texture is assigned on
+    //the first write even if the pass only writes it as a UAV
+    return write(handle);
+  }
+
+  RGTextureHandle
+  DXRenderGraph::PassBuilder::read(RGTextureHandle handle) {
+    GE_ASSERT(handle < m_graph.m_resources.size());
+    m_graph.m_passes[m_passIndex].reads.push_back(handle);
+    return handle;
+  }
+
+  RGTextureHandle
+  DXRenderGraph::PassBuilder::write(RGTextureHandle handle) {
+    GE_ASSERT(handle < m_graph.m_resources.size());
+    Pass& pass = m_graph.m_passes[m_passIndex];
+    Resource& res = m_graph.m_resources[handle];
+
+    //Writing something another pass already produced is a read-modify-write,
+    //the previous producer must survive the culling step
+    if (res.producer != NumLimit::MAX_UINT32 && res.producer != m_passIndex) {
+      pass.reads.push_back(handle);
+    }
+
+    res.producer = m_passIndex;
+
+    //create() already wrote it, writeRenderTarget(create(...)) is one write
+    if (std::find(pass.writes.begin(), pass.writes.end(), handle) == pass.writes.end()) {
+      pass.writes.push_back(handle);
+    }
+    return handle;
+  }
+
+  RGTextureHandle
+  DXRenderGraph::PassBuilder::writeRenderTarget(RGTextureHandle handle, uint32 mipLevel) {
+    write(handle);
+    m_graph.m_passes[m_passIndex].colorTargets.push_back({ handle, mipLevel });
+    return handle;
+  }
+
+  RGTextureHandle
+  DXRenderGraph::PassBuilder::writeDepthStencil(RGTextureHandle handle) {
+    write(handle);
+    m_graph.m_passes[m_passIndex].depthTarget = handle;
+    return handle;
+  }
+
+  void
+  DXRenderGraph::PassBuilder::setSideEffect() {
+    m_graph.m_passes[m_passIndex].bSideEffect = true;
+  }
+
+  const SPtr<Texture>&
+  DXRenderGraph::PassResources::getTexture(RGTextureHandle handle) const {
+    GE_ASSERT(handle < m_graph.m_resources.size());
+    return m_graph.m_resources[handle].pTexture;
+  }
+
+  /*************************************************************************/
+  // Graph construction
+  /*************************************************************************/
+  RGTextureHandle
+  DXRenderGraph::importTexture(const String& name, const SPtr<Texture>& pTexture) {
+    GE_ASSERT(pTexture);
+    auto handle = static_cast<RGTextureHandle>(m_resources.size());
+
+    m_resources.emplace_back();
+    Resource& res = m_resources.back();
+    res.name = name;
+    res.pTexture = pTexture;
+    res.bImported = true;
+
+    const auto& desc = pTexture->getDesc();
+    res.desc.width = desc.width;
+    res.desc.height = desc.height;
+    res.desc.format = desc.format;
+    res.desc.mipLevels = desc.mipLevels;
+
+    return handle;
+  }
+
+  void
+  DXRenderGraph::exportTexture(RGTextureHandle handle) {
+    GE_ASSERT(handle < m_resources.size());
+    m_resources[handle].bExported = true;
+  }
+
+  void
+  DXRenderGraph::addPass(const String& name,
+                         const SetupFn& setup,
+                         const ExecuteFn& execute) {
+    GE_ASSERT(!m_bCompiled && "Passes can't be added to a compiled graph.");
+
+    auto passIndex = static_cast<uint32>(m_passes.size());
+    m_passes.emplace_back();
+    m_passes.back().name = name;
+    m_passes.back().execute = execute;
+
+    PassBuilder builder(*this, passIndex);
+    setup(builder);
+  }
+
+  /*************************************************************************/
+  // Compilation
+  /*************************************************************************/
+  void
+  DXRenderGraph::compile() {
+    GE_ASSERT(!m_bCompiled);
+
+    _cullPasses();
+    _computeLifetimes();
+    _assignPhysicalTextures();
+
+    m_bCompiled = true;
+  }
+
+  void
+  DXRenderGraph::_cullPasses() {
+    for (auto& pass : m_passes) {
+      pass.refCount = static_cast<uint32>(pass.writes.size());
+      for (auto handle : pass.reads) {
+        ++m_resources[handle].refCount;
+      }
+    }
+
+    //Walk back from every resource nobody reads and release its producer
+    Vector<RGTextureHandle> unreferenced;
+    for (uint32 i = 0; i < m_resources.size(); ++i) {
+      const Resource& res = m_resources[i];
+      if (res.refCount == 0 && !res.bImported && !res.bExported) {
+        unreferenced.push_back(i);
+      }
+    }
+
+    while (!unreferenced.empty()) {
+      Resource& res = m_resources[unreferenced.back()];
+      unreferenced.pop_back();
+
+      if (res.producer == NumLimit::MAX_UINT32) {
+        continue;
+      }
+
+      Pass& producer = m_passes[res.producer];
+      if (producer.bCulled || producer.bSideEffect) {
+        continue;
+      }
+
+      GE_ASSERT(producer.refCount > 0);
+      if (--producer.refCount > 0) {
+        continue;
+      }
+
+      producer.bCulled = true;
+      for (auto handle : producer.reads) {
+        Resource& readRes = m_resources[handle];
+        GE_ASSERT(readRes.refCount > 0);
+        if (--readRes.refCount == 0 && !readRes.bImported && !readRes.bExported) {
+          unreferenced.push_back(handle);
+        }
+      }
+    }
+  }
+
+  void
+  DXRenderGraph::_computeLifetimes() {
+    auto passCount = static_cast<uint32>(m_passes.size());
+
+    for (uint32 i = 0; i < passCount; ++i) {
+      const Pass& pass = m_passes[i];
+      if (pass.bCulled) {
+        continue;
+      }
+
+      auto touch = [&](RGTextureHandle handle) {
+        Resource& res = m_resources[handle];
+        res.firstPass = Math::min(res.firstPass, i);
+        res.lastPass = Math::max(res.lastPass, i);
+      };
+
+      for (auto handle : pass.reads) {
+        touch(handle);
+      }
+      for (auto handle : pass.writes) {
+        touch(handle);
+      }
+    }
+
+    //Exported transients must survive until the caller fetches them
+    for (auto& res : m_resources) {
+      if (res.bExported && res.firstPass != NumLimit::MAX_UINT32) {
+        res.lastPass = passCount - 1;
+      }
+    }
+  }
+
+  void
+  DXRenderGraph::_assignPhysicalTextures() {
+    auto passCount = static_cast<uint32>(m_passes.size());
+    Vector<Vector<RGTextureHandle>> releaseAfter(passCount);
+
+    m_stats = Stats();
+    m_stats.numPasses = passCount;
+
+    for (uint32 i = 0; i < m_resources.size(); ++i) {
+      const Resource& res = m_resources[i];
+      if (!res.bImported && res.firstPass != NumLimit::MAX_UINT32) {
+        releaseAfter[res.lastPass].push_back(i);
+      }
+    }
+
+    for (uint32 i = 0; i < passCount; ++i) {
+      Pass& pass = m_passes[i];
+      if (pass.bCulled) {
+        ++m_stats.numCulledPasses;
+        continue;
+      }
+
+      //The first use of a transient is always its creating write
+      for (auto handle : pass.writes) {
+        Resource& res = m_resources[handle];
+        if (res.bImported || res.firstPass != i ||
+            res.physicalIndex != NumLimit::MAX_UINT32) {
+          continue;
+        }
+
+        res.physicalIndex = _acquirePhysical(res.desc);
+        res.pTexture = m_pool[res.physicalIndex].pTexture;
+        pass.toDiscard.push_back(handle);
+
+        ++m_stats.numTransients;
+        m_stats.transientBytes += res.pTexture->getMemoryUsage();
+      }
+
+      for (auto handle : releaseAfter[i]) {
+        const Resource& res = m_resources[handle];
+        if (res.physicalIndex != NumLimit::MAX_UINT32) {
+          m_pool[res.physicalIndex].bInUse = false;
+        }
+      }
+    }
+
+    for (auto& pooled : m_pool) {
+      if (pooled.lastUsedFrame == m_frameIndex) {
+        ++m_stats.numPhysicalTextures;
+        m_stats.physicalBytes += pooled.pTexture->getMemoryUsage();
+      }
+    }
+  }
+
+  uint32
+  DXRenderGraph::_acquirePhysical(const RGTextureDesc& desc) {
+    for (uint32 i = 0; i < m_pool.size(); ++i) {
+      PooledTexture& pooled = m_pool[i];
+      if (!pooled.bInUse && pooled.desc == desc) {
+        pooled.bInUse = true;
+        pooled.lastUsedFrame = m_frameIndex;
+        return i;
+      }
+    }
+
+    PooledTexture pooled;
+    pooled.desc = desc;
+    pooled.pTexture = m_renderAPI.createTexture(desc.width,
+                                                desc.height,
+                                                desc.format,
+                                                desc.bindFlags,
+                                                desc.mipLevels,
+                                                RESOURCE_USAGE::DEFAULT,
+                                                0,
+                                                desc.sampleCount,
+                                                desc.sampleCount > 1);
+    if (!pooled.pTexture) {
+      GE_EXCEPT(RenderingAPIException, "Failed to create a render graph transient.");
+    }
+
+    pooled.lastUsedFrame = m_frameIndex;
+    pooled.bInUse = true;
+    m_pool.push_back(pooled);
+
+    return static_cast<uint32>(m_pool.size() - 1);
+  }
+
+  /*************************************************************************/
+  // Execution
+  /*************************************************************************/
+  void
+  DXRenderGraph::execute() {
+    GE_ASSERT(m_bCompiled);
+
+    PassResources resources(*this);
+    Vector<RenderTarget> targets;
+
+    for (auto& pass : m_passes) {
+      if (pass.bCulled) {
+        continue;
+      }
+
+      //Contents of a physical texture reused from another transient are
+      //garbage, let the driver know so it doesn't preserve them
+      for (auto handle : pass.toDiscard) {
+        const Resource& res = m_resources[handle];
+        if (res.desc.bindFlags & (BIND_FLAG::RENDER_TARGET | BIND_FLAG::DEPTH_STENCIL)) {
+          m_renderAPI.discardView(res.pTexture);
+        }
+      }
+
+      if (!pass.colorTargets.empty() || pass.depthTarget != RG_INVALID_HANDLE) {
+        targets.clear();
+        for (auto& rtWrite : pass.colorTargets) {
+          RenderTarget target;
+          target.pRenderTarget = m_resources[rtWrite.handle].pTexture;
+          target.mipLevel = rtWrite.mipLevel;
+          targets.push_back(target);
+        }
+
+        WeakSPtr<Texture> pDepth;
+        if (pass.depthTarget != RG_INVALID_HANDLE) {
+          pDepth = m_resources[pass.depthTarget].pTexture;
+        }
+
+        m_renderAPI.setRenderTargets(targets, pDepth);
+      }
+
+      if (pass.execute) {
+        pass.execute(m_renderAPI, resources);
+      }
+    }
+  }
+
+  void
+  DXRenderGraph::reset() {
+    m_passes.clear();
+    m_resources.clear();
+    m_bCompiled = false;
+
+    for (auto& pooled : m_pool) {
+      pooled.bInUse = false;
+    }
+
+    //Drop the physical textures that haven't been needed for a while
+    uint64 frameIndex = m_frameIndex;
+    uint32 framesToKeep = m_framesToKeepUnused;
+    m_pool.erase(std::remove_if(m_pool.begin(), m_pool.end(),
+                   [frameIndex, framesToKeep](const PooledTexture& pooled) {
+                     return frameIndex - pooled.lastUsedFrame > framesToKeep;
+                   }),
+                 m_pool.end());
+
+    ++m_frameIndex;
+  }
+
+  void
+  DXRenderGraph::releasePool() {
+    for (auto& res : m_resources) {
+      res.pTexture = res.bImported ? res.pTexture : nullptr;
+      res.physicalIndex = NumLimit::MAX_UINT32;
+    }
+    m_pool.clear();
+  }
+
+} // namespace geEngineSDK
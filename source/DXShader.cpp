@@ -17,9 +17,43 @@
  */
 /*****************************************************************************/
 #include "DXShader.h"
+#include "DXMemoryTracker.h"
+#include "DXMappedFile.h"
+#include "geRenderStats.h"
+
+#include <geDebug.h>
+#include <d3dcompiler.h>
+#include <atomic>
 
 namespace geEngineSDK {
 
+  namespace {
+    std::atomic<D3DDevice*> s_pLoadDevice(nullptr);
+    std::atomic<SHADER_BYTECODE_MODE::E> s_bytecodeMode(SHADER_BYTECODE_MODE::kKeep);
+
+    constexpr uint32
+    makeFourCC(char a, char b, char c, char d) {
+      return static_cast<uint32>(static_cast<uint8>(a)) |
+             static_cast<uint32>(static_cast<uint8>(b)) << 8 |
+             static_cast<uint32>(static_cast<uint8>(c)) << 16 |
+             static_cast<uint32>(static_cast<uint8>(d)) << 24;
+    }
+
+    /**
+     * @brief Header of a DXBC container. The chunk offsets follow it.
+     */
+    struct DXBCHeader
+    {
+      uint32 fourCC;
+      uint8 checksum[16];
+      uint32 version;
+      uint32 totalSize;
+      uint32 chunkCount;
+    };
+
+    static_assert(sizeof(DXBCHeader) == 32, "The DXBC header is 32 bytes");
+  }
+
   DXShader::~DXShader() {
     release();
   }
@@ -27,11 +61,275 @@ namespace geEngineSDK {
   void
   DXShader::release() {
     safeRelease(m_pBlob);
+    if (m_pShader) {
+      RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kShader);
+      DXMemoryTracker::onReleased(m_pShader);
+    }
     safeRelease(m_pShader);
+    m_programType = DXBC_PROGRAM_TYPE::kUnknown;
+    m_pArchiveBytecode = nullptr;
+    m_archiveBytecodeSize = 0;
+    m_pArchiveMapping = nullptr;
+    safeRelease(m_pInputSignature);
+    m_inputParameters.clear();
+    m_bInputsReflected = false;
+  }
+
+  SIZE_T
+  DXShader::getMemoryUsage() const {
+    SIZE_T memoryUsage = m_pBlob ? m_pBlob->GetBufferSize() : 0;
+    if (m_pInputSignature) {
+      memoryUsage += m_pInputSignature->GetBufferSize();
+    }
+    memoryUsage += m_inputParameters.capacity() * sizeof(DXShaderInputParameter);
+    return memoryUsage;
+  }
+
+  bool
+  DXShader::load(const Path& filePath) {
+    D3DDevice* pDevice = s_pLoadDevice.load();
+    if (!pDevice) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Can't load {0} before the render API starts",
+             filePath.toString());
+      return false;
+    }
+
+    //The driver reads the bytecode straight from the mapping, which the
+    //shader keeps instead of a copy
+    auto pFile = ge_shared_ptr_new<DXMappedFile>();
+    if (!pFile->open(filePath) ||
+        !_createFromBytecode(pDevice,
+                             pFile,
+                             pFile->getData(),
+                             pFile->getSize(),
+                             filePath.toString())) {
+      return false;
+    }
+
+    setPath(filePath);
+    setDebugName(filePath.toString());
+    return true;
+  }
+
+  DXBC_PROGRAM_TYPE::E
+  DXShader::getProgramType(const void* pBytecode, SIZE_T size) {
+    const auto pData = static_cast<const uint8*>(pBytecode);
+    DXBCHeader header;
+    if (!pData || size < sizeof(header)) {
+      return DXBC_PROGRAM_TYPE::kUnknown;
+    }
+
+    memcpy(&header, pData, sizeof(header));
+    if (makeFourCC('D', 'X', 'B', 'C') != header.fourCC ||
+        header.totalSize < sizeof(header) ||
+        header.totalSize > size ||
+        header.chunkCount > (header.totalSize - sizeof(header)) / sizeof(uint32)) {
+      return DXBC_PROGRAM_TYPE::kUnknown;
+    }
+
+    for (uint32 i = 0; i < header.chunkCount; ++i) {
+      uint32 chunkOffset = 0;
+      memcpy(&chunkOffset, pData + sizeof(header) + i * sizeof(uint32), sizeof(uint32));
+
+      //Chunk fourCC, chunk size and the version token of the program
+      uint32 chunk[3];
+      if (chunkOffset > header.totalSize ||
+          header.totalSize - chunkOffset < sizeof(chunk)) {
+        return DXBC_PROGRAM_TYPE::kUnknown;
+      }
+
+      memcpy(chunk, pData + chunkOffset, sizeof(chunk));
+      if (makeFourCC('S', 'H', 'D', 'R') == chunk[0] ||
+          makeFourCC('S', 'H', 'E', 'X') == chunk[0]) {
+        const uint32 programType = chunk[2] >> 16;
+        return programType < DXBC_PROGRAM_TYPE::kUnknown ?
+                 static_cast<DXBC_PROGRAM_TYPE::E>(programType) :
+                 DXBC_PROGRAM_TYPE::kUnknown;
+      }
+    }
+
+    return DXBC_PROGRAM_TYPE::kUnknown;
+  }
+
+  bool
+  DXShader::_createFromBytecode(D3DDevice* pDevice,
+                                const SPtr<DXMappedFile>& pMapping,
+                                const void* pBytecode,
+                                SIZE_T size,
+                                const String& name) {
+    GE_ASSERT(pDevice);
+
+    const auto programType = getProgramType(pBytecode, size);
+    if (DXBC_PROGRAM_TYPE::kUnknown == programType) {
+      GE_LOG(kError, RenderAPI, "{0} isn't valid shader bytecode", name);
+      return false;
+    }
+
+    HRESULT hr = E_FAIL;
+    ID3D11DeviceChild* pShader = nullptr;
+    switch (programType) {
+      case DXBC_PROGRAM_TYPE::kPixel:
+        hr = pDevice->CreatePixelShader(pBytecode, size, nullptr,
+                                        reinterpret_cast<ID3D11PixelShader**>(&pShader));
+        break;
+      case DXBC_PROGRAM_TYPE::kVertex:
+        hr = pDevice->CreateVertexShader(pBytecode, size, nullptr,
+                                         reinterpret_cast<ID3D11VertexShader**>(&pShader));
+        break;
+      case DXBC_PROGRAM_TYPE::kGeometry:
+        hr = pDevice->CreateGeometryShader(pBytecode, size, nullptr,
+                                           reinterpret_cast<ID3D11GeometryShader**>(&pShader));
+        break;
+      case DXBC_PROGRAM_TYPE::kHull:
+        hr = pDevice->CreateHullShader(pBytecode, size, nullptr,
+                                       reinterpret_cast<ID3D11HullShader**>(&pShader));
+        break;
+      case DXBC_PROGRAM_TYPE::kDomain:
+        hr = pDevice->CreateDomainShader(pBytecode, size, nullptr,
+                                         reinterpret_cast<ID3D11DomainShader**>(&pShader));
+        break;
+      case DXBC_PROGRAM_TYPE::kCompute:
+        hr = pDevice->CreateComputeShader(pBytecode, size, nullptr,
+                                          reinterpret_cast<ID3D11ComputeShader**>(&pShader));
+        break;
+      default:
+        break;
+    }
+
+    if (FAILED(hr)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create a shader from {0} (HRESULT {1})",
+             name,
+             static_cast<uint32>(hr));
+      return false;
+    }
+
+    //Kept in place for the reflection of the input layouts
+    release();
+    m_pShader = pShader;
+    m_pArchiveMapping = pMapping;
+    m_pArchiveBytecode = pBytecode;
+    m_archiveBytecodeSize = size;
+    m_programType = programType;
+    _compactBytecode();
+
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kShader);
+    DXMemoryTracker::onAllocated(m_pShader, GPU_MEMORY_CATEGORY::kShader, getMemoryUsage());
+    return true;
+  }
+
+  void
+  DXShader::_setLoadDevice(D3DDevice* pDevice) {
+    s_pLoadDevice = pDevice;
+  }
+
+  bool
+  DXShader::_reflectInputs() {
+    if (m_bInputsReflected) {
+      return true;
+    }
+
+    ID3D11ShaderReflection* pReflector = nullptr;
+    if (!getBytecode() ||
+        FAILED(D3DReflect(getBytecode(),
+                          getBytecodeSize(),
+                          __uuidof(ID3D11ShaderReflection),
+                          reinterpret_cast<void**>(&pReflector)))) {
+      GE_LOG(kError, RenderAPI, "Failed to reflect the inputs of {0}", m_debugName);
+      return false;
+    }
+
+    D3D11_SHADER_DESC shaderDesc;
+    pReflector->GetDesc(&shaderDesc);
+
+    m_inputParameters.clear();
+    m_inputParameters.reserve(shaderDesc.InputParameters);
+    for (uint32 i = 0; i < shaderDesc.InputParameters; ++i) {
+      D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
+      if (FAILED(pReflector->GetInputParameterDesc(i, &paramDesc))) {
+        continue;
+      }
+
+      DXShaderInputParameter parameter;
+      parameter.semanticName = paramDesc.SemanticName;
+      parameter.semanticIndex = paramDesc.SemanticIndex;
+      parameter.stream = paramDesc.Stream;
+      parameter.componentType = paramDesc.ComponentType;
+      parameter.mask = paramDesc.Mask;
+      m_inputParameters.push_back(parameter);
+    }
+    m_inputParameters.shrink_to_fit();
+
+    safeRelease(pReflector);
+    m_bInputsReflected = true;
+    return true;
+  }
+
+  void
+  DXShader::_compactBytecode() {
+    const auto mode = s_bytecodeMode.load();
+    if (SHADER_BYTECODE_MODE::kKeep == mode || !getBytecode()) {
+      return;
+    }
+
+    //The input layouts only need the inputs, taken while they can be
+    if (DXBC_PROGRAM_TYPE::kVertex == m_programType) {
+      if (!_reflectInputs()) {
+        //Stripped or released it can't be reflected again, keep it
+        GE_LOG(kWarning,
+               RenderAPI,
+               "Failed to reflect the inputs of {0}, its bytecode is kept",
+               m_debugName);
+        return;
+      }
+
+      if (SHADER_BYTECODE_MODE::kRelease == mode && !m_pInputSignature &&
+          FAILED(D3DGetInputSignatureBlob(getBytecode(),
+                                          getBytecodeSize(),
+                                          &m_pInputSignature))) {
+        //Without it no input layout can be created, keep the bytecode
+        GE_LOG(kWarning,
+               RenderAPI,
+               "Failed to get the input signature of {0}, its bytecode is kept",
+               m_debugName);
+        return;
+      }
+    }
+
+    if (SHADER_BYTECODE_MODE::kRelease == mode) {
+      safeRelease(m_pBlob);
+      m_pArchiveBytecode = nullptr;
+      m_archiveBytecodeSize = 0;
+      m_pArchiveMapping = nullptr;
+      return;
+    }
+
+    //Mapped bytecode isn't ours, stripping it would be a copy
+    ID3DBlob* pStripped = nullptr;
+    if (m_pBlob &&
+        SUCCEEDED(D3DStripShader(m_pBlob->GetBufferPointer(),
+                                 m_pBlob->GetBufferSize(),
+                                 D3DCOMPILER_STRIP_REFLECTION_DATA |
+                                 D3DCOMPILER_STRIP_DEBUG_INFO |
+                                 D3DCOMPILER_STRIP_TEST_BLOBS |
+                                 D3DCOMPILER_STRIP_PRIVATE_DATA,
+                                 &pStripped))) {
+      safeRelease(m_pBlob);
+      m_pBlob = pStripped;
+    }
+  }
+
+  void
+  DXShader::_setBytecodeMode(SHADER_BYTECODE_MODE::E mode) {
+    s_bytecodeMode = mode;
   }
 
   void
   DXShader::setDebugName(const String& name) {
+    DXMemoryTracker::onRenamed(m_pShader, name);
 #if USING(GE_DEBUG_MODE)
     m_debugName = name;
     if (m_pShader) {
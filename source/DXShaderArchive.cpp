@@ -0,0 +1,321 @@
+/*****************************************************************************/
+/**
+ * @file    DXShaderArchive.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Single file archive of precompiled shaders.
+ *
+ * Single file archive of precompiled shaders.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXShaderArchive.h"
+
+#include <geDebug.h>
+#include <geFileSystem.h>
+#include <geDataStream.h>
+#include <geNumericLimits.h>
+#include <algorithm>
+
+namespace geEngineSDK {
+
+  namespace {
+    struct ShaderArchiveHeader
+    {
+      uint32 magic;
+      uint32 version;
+      uint32 numEntries;
+      uint32 alignment;
+    };
+
+    static_assert(sizeof(ShaderArchiveHeader) == 16, "The index must stay aligned");
+    static_assert(sizeof(ShaderArchiveEntry) == 16, "The index must stay aligned");
+
+    //FNV-1a, 64 bits so the keys of an archive don't collide in practice
+    const uint64 KEY_OFFSET_BASIS = 14695981039346656037ULL;
+    const uint64 KEY_PRIME = 1099511628211ULL;
+
+    uint64
+    hashBytes(uint64 hash, const char* pData, SIZE_T size) {
+      for (SIZE_T i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<uint8>(pData[i])) * KEY_PRIME;
+      }
+      //Separator, "ab" + "c" and "a" + "bc" are different keys
+      return (hash ^ 0xFF) * KEY_PRIME;
+    }
+
+    uint64
+    hashString(uint64 hash, const String& str) {
+      return hashBytes(hash, str.data(), str.size());
+    }
+
+    SIZE_T
+    alignOffset(SIZE_T offset) {
+      const SIZE_T alignment = DXShaderArchive::ALIGNMENT;
+      return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    bool
+    isSpace(char c) {
+      return ' ' == c || '\t' == c || '\r' == c;
+    }
+  }
+
+  bool
+  DXShaderArchive::open(const Path& filePath) {
+    close();
+
+    //Shared with the shaders created from it, they keep it mapped
+    auto pFile = ge_shared_ptr_new<DXMappedFile>();
+    if (!pFile->open(filePath)) {
+      return false;
+    }
+
+    const uint8* pData = pFile->getData();
+    const SIZE_T fileSize = pFile->getSize();
+
+    ShaderArchiveHeader header;
+    if (fileSize < sizeof(header)) {
+      GE_LOG(kError, RenderAPI, "{0} isn't a shader archive", filePath.toString());
+      return false;
+    }
+
+    memcpy(&header, pData, sizeof(header));
+    if (MAGIC != header.magic || VERSION != header.version) {
+      GE_LOG(kError,
+             RenderAPI,
+             "{0} isn't a shader archive of this version",
+             filePath.toString());
+      return false;
+    }
+
+    const SIZE_T maxEntries = (fileSize - sizeof(header)) / sizeof(ShaderArchiveEntry);
+    if (header.numEntries > maxEntries) {
+      GE_LOG(kError, RenderAPI, "Shader archive {0} is truncated", filePath.toString());
+      return false;
+    }
+
+    //The mapping starts on a page, the index is read in place
+    const auto pEntries = reinterpret_cast<const ShaderArchiveEntry*>(pData + sizeof(header));
+    const SIZE_T blobsOffset = sizeof(header) + header.numEntries * sizeof(ShaderArchiveEntry);
+    for (uint32 i = 0; i < header.numEntries; ++i) {
+      const ShaderArchiveEntry& entry = pEntries[i];
+      if ((i > 0 && entry.key <= pEntries[i - 1].key) ||
+          entry.offset < blobsOffset ||
+          0 != entry.offset % ALIGNMENT ||
+          0 == entry.size ||
+          entry.offset > fileSize ||
+          entry.size > fileSize - entry.offset) {
+        GE_LOG(kError,
+               RenderAPI,
+               "Shader archive {0} has an invalid entry at {1}",
+               filePath.toString(),
+               i);
+        return false;
+      }
+    }
+
+    m_pFile = pFile;
+    m_pEntries = pEntries;
+    m_numEntries = header.numEntries;
+    return true;
+  }
+
+  void
+  DXShaderArchive::close() {
+    m_pEntries = nullptr;
+    m_numEntries = 0;
+    m_pFile = nullptr;
+  }
+
+  const uint8*
+  DXShaderArchive::find(uint64 key, SIZE_T& size) const {
+    size = 0;
+    if (!m_pEntries) {
+      return nullptr;
+    }
+
+    const ShaderArchiveEntry* pEnd = m_pEntries + m_numEntries;
+    const ShaderArchiveEntry* pEntry =
+      std::lower_bound(m_pEntries, pEnd, key,
+                       [](const ShaderArchiveEntry& entry, uint64 value) {
+                         return entry.key < value;
+                       });
+    if (pEnd == pEntry || pEntry->key != key) {
+      return nullptr;
+    }
+
+    size = pEntry->size;
+    return m_pFile->getData() + pEntry->offset;
+  }
+
+  uint64
+  DXShaderArchive::makeKey(const Path& fileName,
+                           const Vector<ShaderMacro>& macros,
+                           const String& entryPoint,
+                           const String& shaderModel) {
+    String file = fileName.toString();
+    for (auto& c : file) {
+      if ('\\' == c) {
+        c = '/';
+      }
+      else if (c >= 'A' && c <= 'Z') {
+        c = static_cast<char>(c - 'A' + 'a');
+      }
+    }
+
+    uint64 key = hashString(KEY_OFFSET_BASIS, file);
+    key = hashString(key, entryPoint);
+    key = hashString(key, shaderModel);
+    for (const auto& macro : macros) {
+      key = hashString(key, macro.name);
+      key = hashString(key, macro.definition);
+    }
+    return key;
+  }
+
+  bool
+  DXShaderArchive::write(const Path& filePath,
+                         Vector<ShaderArchiveEntry> entries,
+                         const Vector<const void*>& blobs) {
+    GE_ASSERT(entries.size() == blobs.size());
+
+    //Sort an order instead of the entries, the blobs follow the entries
+    const auto numEntries = static_cast<uint32>(entries.size());
+    Vector<uint32> order(numEntries);
+    for (uint32 i = 0; i < numEntries; ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&entries](uint32 a, uint32 b) {
+      return entries[a].key < entries[b].key;
+    });
+
+    Vector<ShaderArchiveEntry> index(numEntries);
+    SIZE_T offset = sizeof(ShaderArchiveHeader) + numEntries * sizeof(ShaderArchiveEntry);
+    for (uint32 i = 0; i < numEntries; ++i) {
+      const ShaderArchiveEntry& entry = entries[order[i]];
+      if (i > 0 && entry.key == index[i - 1].key) {
+        GE_LOG(kError,
+               RenderAPI,
+               "Two shaders of {0} have the same key",
+               filePath.toString());
+        return false;
+      }
+
+      offset = alignOffset(offset);
+      if (offset + entry.size > NumLimit::MAX_UINT32) {
+        GE_LOG(kError, RenderAPI, "Shader archive {0} is too big", filePath.toString());
+        return false;
+      }
+
+      index[i].key = entry.key;
+      index[i].offset = static_cast<uint32>(offset);
+      index[i].size = entry.size;
+      offset += entry.size;
+    }
+
+    auto stream = FileSystem::createAndOpenFile(filePath);
+    if (!stream) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create the shader archive: {0}",
+             filePath.toString());
+      return false;
+    }
+
+    ShaderArchiveHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.numEntries = numEntries;
+    header.alignment = ALIGNMENT;
+    stream->write(&header, sizeof(header));
+    if (numEntries > 0) {
+      stream->write(index.data(), index.size() * sizeof(ShaderArchiveEntry));
+    }
+
+    const uint8 padding[ALIGNMENT] = {};
+    offset = sizeof(ShaderArchiveHeader) + numEntries * sizeof(ShaderArchiveEntry);
+    for (uint32 i = 0; i < numEntries; ++i) {
+      stream->write(padding, index[i].offset - offset);
+      stream->write(blobs[order[i]], index[i].size);
+      offset = index[i].offset + index[i].size;
+    }
+    stream->close();
+    return true;
+  }
+
+  bool
+  DXShaderArchive::readManifest(const Path& filePath, Vector<ShaderArchiveSource>& sources) {
+    auto stream = FileSystem::openFile(filePath);
+    if (!stream) {
+      GE_LOG(kError, RenderAPI, "Failed to open the manifest {0}", filePath.toString());
+      return false;
+    }
+
+    String text(stream->size(), '\0');
+    stream->read(&text[0], text.size());
+
+    uint32 lineNumber = 0;
+    SIZE_T lineStart = 0;
+    while (lineStart < text.size()) {
+      SIZE_T lineEnd = text.find('\n', lineStart);
+      if (String::npos == lineEnd) {
+        lineEnd = text.size();
+      }
+      ++lineNumber;
+
+      Vector<String> tokens;
+      SIZE_T pos = lineStart;
+      while (pos < lineEnd) {
+        while (pos < lineEnd && isSpace(text[pos])) {
+          ++pos;
+        }
+        SIZE_T tokenStart = pos;
+        while (pos < lineEnd && !isSpace(text[pos])) {
+          ++pos;
+        }
+        if (pos > tokenStart) {
+          tokens.push_back(text.substr(tokenStart, pos - tokenStart));
+        }
+      }
+      lineStart = lineEnd + 1;
+
+      if (tokens.empty() || '#' == tokens[0][0]) {
+        continue;
+      }
+
+      if (tokens.size() < 3) {
+        GE_LOG(kError,
+               RenderAPI,
+               "{0}({1}): expected <source file> <entry point> <shader model>",
+               filePath.toString(),
+               lineNumber);
+        return false;
+      }
+
+      ShaderArchiveSource source;
+      source.fileName = Path(tokens[0]);
+      source.entryPoint = tokens[1];
+      source.shaderModel = tokens[2];
+      for (SIZE_T i = 3; i < tokens.size(); ++i) {
+        const SIZE_T equalPos = tokens[i].find('=');
+        ShaderMacro macro;
+        macro.name = tokens[i].substr(0, equalPos);
+        if (String::npos != equalPos) {
+          macro.definition = tokens[i].substr(equalPos + 1);
+        }
+        source.macros.push_back(macro);
+      }
+      sources.push_back(source);
+    }
+    return true;
+  }
+
+} // namespace geEngineSDK
@@ -18,11 +18,21 @@
 /*****************************************************************************/
 #include "DXTexture.h"
 #include "DXTranslateUtils.h"
+#include "DXMemoryTracker.h"
+#include "DXDDSFile.h"
+#include "geRenderStats.h"
 
 #include <geVector3.h>
+#include <geMath.h>
+#include <geDebug.h>
+#include <atomic>
 
 namespace geEngineSDK {
 
+  namespace {
+    std::atomic<D3DDevice*> s_pLoadDevice(nullptr);
+  }
+
   DXTexture::~DXTexture() {
     release();
   }
@@ -35,11 +45,19 @@ namespace geEngineSDK {
       //Cast to DXTexture to access the specific members
       DXTexture& dxOther = static_cast<DXTexture&>(other);
       m_pTexture = dxOther.m_pTexture;
-      m_ppSRV = dxOther.m_ppSRV;
+      m_pDevice = dxOther.m_pDevice;
+      m_viewFormat = dxOther.m_viewFormat;
+      m_srvFormat = dxOther.m_srvFormat;
+      m_dsvFormat = dxOther.m_dsvFormat;
+      m_pSRV = dxOther.m_pSRV;
+      m_srvRanges = dxOther.m_srvRanges;
       m_pDSV = dxOther.m_pDSV;
       m_pRO_DSV = dxOther.m_pRO_DSV;
       m_ppUAV = dxOther.m_ppUAV;
       m_ppRTV = dxOther.m_ppRTV;
+      m_rtvRanges = dxOther.m_rtvRanges;
+      m_uavRanges = dxOther.m_uavRanges;
+      m_dsvRanges = dxOther.m_dsvRanges;
 
       m_bHaveAlpha = dxOther.m_bHaveAlpha;
       m_bIsCubeMap = dxOther.m_bIsCubeMap;
@@ -50,11 +68,13 @@ namespace geEngineSDK {
 
       // Add reference to the resources
       if (m_pTexture) { m_pTexture->AddRef(); }
+      if (m_pDevice) { m_pDevice->AddRef(); }
       if (m_pDSV) { m_pDSV->AddRef(); }
       if (m_pRO_DSV) { m_pRO_DSV->AddRef(); }
+      if (m_pSRV) { m_pSRV->AddRef(); }
 
-      for (auto& pSRV : m_ppSRV) {
-        if (pSRV) { pSRV->AddRef(); }
+      for (auto& srvPair : m_srvRanges) {
+        srvPair.second->AddRef();
       }
 
       for (auto& pUAV : m_ppUAV) {
@@ -63,35 +83,67 @@ namespace geEngineSDK {
       for (auto& pRTV : m_ppRTV) {
         if (pRTV) { pRTV->AddRef(); }
       }
+
+      for (auto& rtvPair : m_rtvRanges) {
+        rtvPair.second->AddRef();
+      }
+      for (auto& uavPair : m_uavRanges) {
+        uavPair.second->AddRef();
+      }
+      for (auto& dsvPair : m_dsvRanges) {
+        dsvPair.second->AddRef();
+      }
     }
   }
 
   void
   DXTexture::release() {
+    _releaseViews();
+    if (m_pTexture) {
+      RenderStatsCounter::onResourceReleased(RENDER_STAT_RESOURCE::kTexture);
+      DXMemoryTracker::onReleased(m_pTexture);
+    }
     safeRelease(m_pTexture);
+    safeRelease(m_pDevice);
+
+    m_desc.bindFlags = 0;
+  }
+
+  void
+  DXTexture::_releaseViews() {
     safeRelease(m_pDSV);
     safeRelease(m_pRO_DSV);
+    safeRelease(m_pSRV);
 
-    if (m_desc.bindFlags & D3D11_BIND_SHADER_RESOURCE) {
-      for (auto& pSRV : m_ppSRV) {
-        safeRelease(pSRV);
-      }
-      m_ppSRV.clear();
+    for (auto& srvPair : m_srvRanges) {
+      safeRelease(srvPair.second);
     }
-    if (m_desc.bindFlags & D3D11_BIND_RENDER_TARGET) {
-      for (auto& pRTV : m_ppRTV) {
-        safeRelease(pRTV);
-      }
-      m_ppRTV.clear();
+    m_srvRanges.clear();
+
+    for (auto& pRTV : m_ppRTV) {
+      safeRelease(pRTV);
     }
-    if (m_desc.bindFlags & D3D11_BIND_UNORDERED_ACCESS) {
-      for (auto& pUAV : m_ppUAV) {
-        safeRelease(pUAV);
-      }
-      m_ppUAV.clear();
+    m_ppRTV.clear();
+
+    for (auto& pUAV : m_ppUAV) {
+      safeRelease(pUAV);
     }
+    m_ppUAV.clear();
 
-    m_desc.bindFlags = 0;
+    for (auto& rtvPair : m_rtvRanges) {
+      safeRelease(rtvPair.second);
+    }
+    m_rtvRanges.clear();
+
+    for (auto& uavPair : m_uavRanges) {
+      safeRelease(uavPair.second);
+    }
+    m_uavRanges.clear();
+
+    for (auto& dsvPair : m_dsvRanges) {
+      safeRelease(dsvPair.second);
+    }
+    m_dsvRanges.clear();
   }
 
   Vector3
@@ -101,6 +153,7 @@ namespace geEngineSDK {
 
   void
   DXTexture::setDebugName(const String& name) {
+    DXMemoryTracker::onRenamed(m_pTexture, name);
 #if USING(GE_DEBUG_MODE)
     m_debugName = name;
     if (m_pTexture) {
@@ -113,20 +166,28 @@ namespace geEngineSDK {
 
   SIZE_T
   DXTexture::getMemoryUsage() const {
-    SIZE_T sizeInMemory = 0;
-    if (m_pTexture) {
-      const SIZE_T& width = m_desc.width;
-      const SIZE_T& height = m_desc.height;
-      const SIZE_T& mipLevels = m_desc.mipLevels;
-      const SIZE_T bpp =
-        TranslateUtils::getBitsPerPixel(static_cast<const DXGI_FORMAT>(m_desc.format));
+    if (!m_pTexture) {
+      return 0;
+    }
 
-      for (SIZE_T i = 0; i < mipLevels; ++i) {
-        sizeInMemory += (width >> i) * (height >> i) * (bpp >> 3);
-      }
+    D3D11_TEXTURE2D_DESC tDesc;
+    m_pTexture->GetDesc(&tDesc);
+    return computeMemoryUsage(tDesc);
+  }
+
+  SIZE_T
+  DXTexture::computeMemoryUsage(const D3D11_TEXTURE2D_DESC& desc) {
+    SIZE_T sliceSize = 0;
+    for (uint32 i = 0; i < desc.MipLevels; ++i) {
+      //Blocks hold more than a pixel, the small mips still take a whole one
+      sliceSize += TranslateUtils::getSurfaceSize(desc.Format,
+                                                  Math::max(1U, desc.Width >> i),
+                                                  Math::max(1U, desc.Height >> i));
     }
 
-    return sizeInMemory;
+    return sliceSize *
+           Math::max(1U, desc.ArraySize) *
+           Math::max(1U, desc.SampleDesc.Count);
   }
 
   void
@@ -134,9 +195,433 @@ namespace geEngineSDK {
     m_desc = TranslateUtils::get(desc);
   }
 
+  bool
+  DXTexture::load(const Path& filePath) {
+    D3DDevice* pDevice = m_pDevice ? m_pDevice : s_pLoadDevice.load();
+    if (!pDevice) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Can't load {0} before the render API starts",
+             filePath.toString());
+      return false;
+    }
+
+    DXDDSFile file;
+    if (!file.open(filePath) || !_createFromDDS(pDevice, file)) {
+      return false;
+    }
+
+    setPath(filePath);
+    setDebugName(filePath.toString());
+    return true;
+  }
+
+  bool
+  DXTexture::_createFromDDS(D3DDevice* pDevice, const DXDDSFile& file) {
+    GE_ASSERT(pDevice && file.isValid());
+
+    //The driver reads the subresources straight from the mapping
+    D3D11_TEXTURE2D_DESC tDesc = file.getDesc();
+    D3DTexture2D* pTexture = nullptr;
+    HRESULT hr = pDevice->CreateTexture2D(&tDesc, file.getSubresources().data(), &pTexture);
+    if (FAILED(hr)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create a {0}x{1} texture of format {2} (HRESULT {3})",
+             tDesc.Width,
+             tDesc.Height,
+             TranslateUtils::getFormatInfo(tDesc.Format).name,
+             static_cast<uint32>(hr));
+      return false;
+    }
+
+    //The device may be the one of the texture, keep it alive through release
+    pDevice->AddRef();
+    release();
+    m_pTexture = pTexture;
+    _initViews(pDevice, tDesc.Format, tDesc.Format, DXGI_FORMAT_UNKNOWN);
+    pDevice->Release();
+
+    m_pTexture->GetDesc(&tDesc);
+    m_desc = TranslateUtils::get(tDesc);
+    m_bIsCubeMap = file.isCubeMap();
+
+    DXMemoryTracker::onAllocated(m_pTexture,
+                                 GPU_MEMORY_CATEGORY::kTexture,
+                                 computeMemoryUsage(tDesc));
+    RenderStatsCounter::onResourceCreated(RENDER_STAT_RESOURCE::kTexture);
+    return true;
+  }
+
+  void
+  DXTexture::_setLoadDevice(D3DDevice* pDevice) {
+    s_pLoadDevice = pDevice;
+  }
+
   void*
   DXTexture::_getGraphicsResource() const {
     return m_pTexture;
   }
 
+  /*************************************************************************/
+  // Views
+  /*************************************************************************/
+  void
+  DXTexture::_initViews(D3DDevice* pDevice,
+                        DXGI_FORMAT viewFormat,
+                        DXGI_FORMAT srvFormat,
+                        DXGI_FORMAT dsvFormat) {
+    GE_ASSERT(pDevice);
+    safeRelease(m_pDevice);
+    m_pDevice = pDevice;
+    m_pDevice->AddRef();
+
+    m_viewFormat = viewFormat;
+    m_srvFormat = srvFormat;
+    m_dsvFormat = dsvFormat;
+  }
+
+  namespace {
+    FORCEINLINE uint64
+    viewRangeKey(uint32 firstMip, uint32 numMips, uint32 firstSlice, uint32 numSlices) {
+      return static_cast<uint64>(firstMip & 0xFF) |
+             static_cast<uint64>(numMips & 0xFF) << 8 |
+             static_cast<uint64>(firstSlice & 0xFFFF) << 16 |
+             static_cast<uint64>(numSlices & 0xFFFF) << 32;
+    }
+  }
+
+  D3DShaderResourceView*
+  DXTexture::_getSRV(uint32 mostDetailedMip,
+                     uint32 numMips,
+                     uint32 firstSlice,
+                     uint32 numSlices) {
+    const bool bDefaultRange = mostDetailedMip == 0 && numMips == ALL_MIPS &&
+                               firstSlice == 0 && numSlices == ALL_SLICES;
+    if (bDefaultRange && m_pSRV) {
+      return m_pSRV;
+    }
+
+    if (!m_pTexture || !m_pDevice) {
+      return nullptr;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    m_pTexture->GetDesc(&tDesc);
+    if (!(tDesc.BindFlags & D3D11_BIND_SHADER_RESOURCE) ||
+        mostDetailedMip >= tDesc.MipLevels || firstSlice >= tDesc.ArraySize) {
+      return nullptr;
+    }
+
+    numMips = Math::min(numMips, tDesc.MipLevels - mostDetailedMip);
+    numSlices = Math::min(numSlices, tDesc.ArraySize - firstSlice);
+
+    const bool bWholeResource = mostDetailedMip == 0 && numMips == tDesc.MipLevels &&
+                                firstSlice == 0 && numSlices == tDesc.ArraySize;
+    uint64 key = 0;
+    if (bWholeResource) {
+      if (m_pSRV) {
+        return m_pSRV;
+      }
+    }
+    else {
+      key = viewRangeKey(mostDetailedMip, numMips, firstSlice, numSlices);
+      auto it = m_srvRanges.find(key);
+      if (it != m_srvRanges.end()) {
+        return it->second;
+      }
+    }
+
+    const bool bMultisampled = tDesc.SampleDesc.Count > 1;
+    const bool bCubeMap = (tDesc.MiscFlags & D3D11_RESOURCE_MISC_TEXTURECUBE) != 0;
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC sDesc = CD3D11_SHADER_RESOURCE_VIEW_DESC();
+    sDesc.Format = m_srvFormat;
+
+    if (bCubeMap && bWholeResource) {
+      if (tDesc.ArraySize > 6) {
+        sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY;
+        sDesc.TextureCubeArray.MostDetailedMip = 0;
+        sDesc.TextureCubeArray.MipLevels = numMips;
+        sDesc.TextureCubeArray.First2DArrayFace = 0;
+        sDesc.TextureCubeArray.NumCubes = tDesc.ArraySize / 6;
+      }
+      else {
+        sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
+        sDesc.TextureCube.MostDetailedMip = 0;
+        sDesc.TextureCube.MipLevels = numMips;
+      }
+    }
+    else if (bMultisampled) {
+      if (tDesc.ArraySize > 1) {
+        sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DMSARRAY;
+        sDesc.Texture2DMSArray.FirstArraySlice = firstSlice;
+        sDesc.Texture2DMSArray.ArraySize = numSlices;
+      }
+      else {
+        sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DMS;
+      }
+    }
+    else if (tDesc.ArraySize > 1) {
+      sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+      sDesc.Texture2DArray.MostDetailedMip = mostDetailedMip;
+      sDesc.Texture2DArray.MipLevels = numMips;
+      sDesc.Texture2DArray.FirstArraySlice = firstSlice;
+      sDesc.Texture2DArray.ArraySize = numSlices;
+    }
+    else {
+      sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+      sDesc.Texture2D.MostDetailedMip = mostDetailedMip;
+      sDesc.Texture2D.MipLevels = numMips;
+    }
+
+    D3DShaderResourceView* pSRV = nullptr;
+    throwIfFailed(m_pDevice->CreateShaderResourceView(m_pTexture, &sDesc, &pSRV));
+
+    if (bWholeResource) {
+      m_pSRV = pSRV;
+    }
+    else {
+      m_srvRanges[key] = pSRV;
+    }
+
+    return pSRV;
+  }
+
+  D3DRenderTargetView*
+  DXTexture::_getRTV(uint32 mipSlice, uint32 firstSlice, uint32 numSlices) {
+    const bool bAllSlices = firstSlice == 0 && numSlices == ALL_SLICES;
+    if (bAllSlices && mipSlice < m_ppRTV.size() && m_ppRTV[mipSlice]) {
+      return m_ppRTV[mipSlice];
+    }
+
+    if (!m_pTexture || !m_pDevice) {
+      return nullptr;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    m_pTexture->GetDesc(&tDesc);
+    if (!(tDesc.BindFlags & D3D11_BIND_RENDER_TARGET) ||
+        mipSlice >= tDesc.MipLevels || firstSlice >= tDesc.ArraySize) {
+      return nullptr;
+    }
+
+    numSlices = Math::min(numSlices, tDesc.ArraySize - firstSlice);
+    const bool bWholeArray = firstSlice == 0 && numSlices == tDesc.ArraySize;
+    const uint64 key = viewRangeKey(mipSlice, 1, firstSlice, numSlices);
+
+    if (bWholeArray) {
+      if (mipSlice < m_ppRTV.size() && m_ppRTV[mipSlice]) {
+        return m_ppRTV[mipSlice];
+      }
+    }
+    else {
+      auto it = m_rtvRanges.find(key);
+      if (it != m_rtvRanges.end()) {
+        return it->second;
+      }
+    }
+
+#if !USING(DX_VERSION_11_3) && !USING(DX_VERSION_11_4)
+    D3D11_RENDER_TARGET_VIEW_DESC rDesc;
+#else
+    D3D11_RENDER_TARGET_VIEW_DESC1 rDesc;
+#endif
+    ge_zero_out(rDesc);
+    rDesc.Format = m_viewFormat;
+
+    //Cube maps are rendered as 2D arrays of faces
+    const bool bArray = tDesc.ArraySize > 1;
+    if (tDesc.SampleDesc.Count > 1) {
+      if (bArray) {
+        rDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DMSARRAY;
+        rDesc.Texture2DMSArray.FirstArraySlice = firstSlice;
+        rDesc.Texture2DMSArray.ArraySize = numSlices;
+      }
+      else {
+        rDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DMS;
+      }
+    }
+    else if (bArray) {
+      rDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DARRAY;
+      rDesc.Texture2DArray.MipSlice = mipSlice;
+      rDesc.Texture2DArray.FirstArraySlice = firstSlice;
+      rDesc.Texture2DArray.ArraySize = numSlices;
+    }
+    else {
+      rDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
+      rDesc.Texture2D.MipSlice = mipSlice;
+    }
+
+    D3DRenderTargetView* pRTV = nullptr;
+#if USING(DX_VERSION_11_3) || USING(DX_VERSION_11_4)
+    throwIfFailed(m_pDevice->CreateRenderTargetView1(m_pTexture, &rDesc, &pRTV));
+#else
+    throwIfFailed(m_pDevice->CreateRenderTargetView(m_pTexture, &rDesc, &pRTV));
+#endif
+
+    if (bWholeArray) {
+      if (m_ppRTV.size() < tDesc.MipLevels) {
+        m_ppRTV.resize(tDesc.MipLevels, nullptr);
+      }
+      m_ppRTV[mipSlice] = pRTV;
+    }
+    else {
+      m_rtvRanges[key] = pRTV;
+    }
+
+    return pRTV;
+  }
+
+  D3DUnorderedAccessView*
+  DXTexture::_getUAV(uint32 mipSlice, uint32 firstSlice, uint32 numSlices) {
+    const bool bAllSlices = firstSlice == 0 && numSlices == ALL_SLICES;
+    if (bAllSlices && mipSlice < m_ppUAV.size() && m_ppUAV[mipSlice]) {
+      return m_ppUAV[mipSlice];
+    }
+
+    if (!m_pTexture || !m_pDevice) {
+      return nullptr;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    m_pTexture->GetDesc(&tDesc);
+    if (!(tDesc.BindFlags & D3D11_BIND_UNORDERED_ACCESS) ||
+        mipSlice >= tDesc.MipLevels || firstSlice >= tDesc.ArraySize) {
+      return nullptr;
+    }
+
+    numSlices = Math::min(numSlices, tDesc.ArraySize - firstSlice);
+    const bool bWholeArray = firstSlice == 0 && numSlices == tDesc.ArraySize;
+    const uint64 key = viewRangeKey(mipSlice, 1, firstSlice, numSlices);
+
+    if (bWholeArray) {
+      if (mipSlice < m_ppUAV.size() && m_ppUAV[mipSlice]) {
+        return m_ppUAV[mipSlice];
+      }
+    }
+    else {
+      auto it = m_uavRanges.find(key);
+      if (it != m_uavRanges.end()) {
+        return it->second;
+      }
+    }
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+    ge_zero_out(uavDesc);
+    uavDesc.Format = m_viewFormat;
+
+    if (tDesc.ArraySize > 1) {
+      uavDesc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2DARRAY;
+      uavDesc.Texture2DArray.MipSlice = mipSlice;
+      uavDesc.Texture2DArray.FirstArraySlice = firstSlice;
+      uavDesc.Texture2DArray.ArraySize = numSlices;
+    }
+    else {
+      uavDesc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2D;
+      uavDesc.Texture2D.MipSlice = mipSlice;
+    }
+
+    D3DUnorderedAccessView* pUAV = nullptr;
+    throwIfFailed(m_pDevice->CreateUnorderedAccessView(m_pTexture, &uavDesc, &pUAV));
+
+    if (bWholeArray) {
+      if (m_ppUAV.size() < tDesc.MipLevels) {
+        m_ppUAV.resize(tDesc.MipLevels, nullptr);
+      }
+      m_ppUAV[mipSlice] = pUAV;
+    }
+    else {
+      m_uavRanges[key] = pUAV;
+    }
+
+    return pUAV;
+  }
+
+  D3DDepthStencilView*
+  DXTexture::_getDSV(bool bReadOnly, uint32 firstSlice, uint32 numSlices) {
+    const bool bAllSlices = firstSlice == 0 && numSlices == ALL_SLICES;
+    if (bAllSlices) {
+      D3DDepthStencilView* pDSV = bReadOnly ? m_pRO_DSV : m_pDSV;
+      if (pDSV) {
+        return pDSV;
+      }
+    }
+
+    if (!m_pTexture || !m_pDevice) {
+      return nullptr;
+    }
+
+    D3D11_TEXTURE2D_DESC tDesc;
+    m_pTexture->GetDesc(&tDesc);
+    if (!(tDesc.BindFlags & D3D11_BIND_DEPTH_STENCIL) || firstSlice >= tDesc.ArraySize) {
+      return nullptr;
+    }
+
+    numSlices = Math::min(numSlices, tDesc.ArraySize - firstSlice);
+    const bool bWholeArray = firstSlice == 0 && numSlices == tDesc.ArraySize;
+
+    //The read only flag goes in the otherwise unused mip count bits of the key
+    const uint64 key = viewRangeKey(0, bReadOnly ? 1 : 0, firstSlice, numSlices);
+
+    if (bWholeArray) {
+      D3DDepthStencilView* pDSV = bReadOnly ? m_pRO_DSV : m_pDSV;
+      if (pDSV) {
+        return pDSV;
+      }
+    }
+    else {
+      auto it = m_dsvRanges.find(key);
+      if (it != m_dsvRanges.end()) {
+        return it->second;
+      }
+    }
+
+    D3D11_DEPTH_STENCIL_VIEW_DESC descDSV;
+    ge_zero_out(descDSV);
+    descDSV.Format = m_dsvFormat;
+
+    const bool bArray = tDesc.ArraySize > 1;
+    if (tDesc.SampleDesc.Count > 1) {
+      if (bArray) {
+        descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DMSARRAY;
+        descDSV.Texture2DMSArray.FirstArraySlice = firstSlice;
+        descDSV.Texture2DMSArray.ArraySize = numSlices;
+      }
+      else {
+        descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DMS;
+      }
+    }
+    else if (bArray) {
+      descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+      descDSV.Texture2DArray.MipSlice = 0;
+      descDSV.Texture2DArray.FirstArraySlice = firstSlice;
+      descDSV.Texture2DArray.ArraySize = numSlices;
+    }
+    else {
+      descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+      descDSV.Texture2D.MipSlice = 0;
+    }
+
+    if (bReadOnly) {
+      descDSV.Flags |= D3D11_DSV_READ_ONLY_DEPTH;
+      if (DXGI_FORMAT_D24_UNORM_S8_UINT == m_dsvFormat ||
+          DXGI_FORMAT_D32_FLOAT_S8X24_UINT == m_dsvFormat) {
+        descDSV.Flags |= D3D11_DSV_READ_ONLY_STENCIL;
+      }
+    }
+
+    D3DDepthStencilView* pDSV = nullptr;
+    throwIfFailed(m_pDevice->CreateDepthStencilView(m_pTexture, &descDSV, &pDSV));
+
+    if (bWholeArray) {
+      (bReadOnly ? m_pRO_DSV : m_pDSV) = pDSV;
+    }
+    else {
+      m_dsvRanges[key] = pDSV;
+    }
+
+    return pDSV;
+  }
+
 }
@@ -0,0 +1,385 @@
+/*****************************************************************************/
+/**
+ * @file    DXTimelineCapture.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU and GPU timeline of a few frames in Chrome trace format.
+ *
+ * CPU and GPU timeline of a few frames in Chrome trace format.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXTimelineCapture.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <geFileSystem.h>
+#include <geDataStream.h>
+#include <cstdio>
+
+namespace geEngineSDK {
+
+  namespace {
+    //Process ids of the two tracks
+    const uint32 CPU_PID = 1;
+    const uint32 GPU_PID = 2;
+    const uint32 GPU_TID = 1;
+  }
+
+  void
+  DXTimelineCapture::init(DXGPUProfiler* pProfiler) {
+    m_pProfiler = pProfiler;
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    m_cpuFrequency = static_cast<uint64>(frequency.QuadPart);
+
+    if (m_pProfiler) {
+      m_pProfiler->setFrameResolvedCallback(
+        [this](uint64 frameNumber, const Vector<GPUScopeResult>& scopes, uint64 frequency) {
+          _onGPUFrameResolved(frameNumber, scopes, frequency);
+        });
+    }
+  }
+
+  void
+  DXTimelineCapture::release() {
+    if (m_bCapturing || m_bWaitingGPU) {
+      _finishCapture();
+    }
+    m_bArmed = false;
+
+    if (m_pProfiler) {
+      m_pProfiler->setFrameResolvedCallback(nullptr);
+      m_pProfiler = nullptr;
+    }
+  }
+
+  void
+  DXTimelineCapture::start(const Path& filePath, uint32 numFrames, uint32 framesToSkip) {
+    if (m_bCapturing || m_bWaitingGPU) {
+      GE_LOG(kWarning,
+             RenderAPI,
+             "A timeline capture is already running, {0} is ignored",
+             filePath.toString());
+      return;
+    }
+
+    m_filePath = filePath;
+    m_numFrames = Math::max(1U, numFrames);
+    m_framesToSkip = framesToSkip;
+    m_bArmed = true;
+  }
+
+  uint64
+  DXTimelineCapture::now() {
+    LARGE_INTEGER tick;
+    QueryPerformanceCounter(&tick);
+    return static_cast<uint64>(tick.QuadPart);
+  }
+
+  void
+  DXTimelineCapture::endFrame() {
+    if (m_bArmed) {
+      if (m_framesToSkip) {
+        --m_framesToSkip;
+        return;
+      }
+      _beginCapture();
+      return;
+    }
+
+    if (m_bCapturing) {
+      uint64 tick = now();
+      addScope("Frame",
+               "Frame",
+               m_frameBeginTick,
+               tick,
+               StringUtil::format("\"index\":{0}", m_frameIndex));
+      m_frameBeginTick = tick;
+      ++m_frameIndex;
+
+      if (0 == --m_framesLeft) {
+        m_bCapturing = false;
+        if (m_bCalibrated) {
+          m_bWaitingGPU = true;
+          m_waitFramesLeft = m_maxGPUWaitFrames;
+        }
+        else {
+          _finishCapture();
+        }
+      }
+      return;
+    }
+
+    if (m_bWaitingGPU) {
+      if (0 == m_waitFramesLeft) {
+        GE_LOG(kWarning,
+               RenderAPI,
+               "GPU scopes of the timeline capture didn't resolve in time, "
+               "the last frames have no GPU track");
+        _finishCapture();
+        return;
+      }
+      --m_waitFramesLeft;
+    }
+  }
+
+  void
+  DXTimelineCapture::addScope(const char* name,
+                              const char* category,
+                              uint64 beginTick,
+                              uint64 endTick,
+                              String args) {
+    if (!m_bCapturing) {
+      return;
+    }
+
+    TimelineEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = 'X';
+    event.pid = CPU_PID;
+    event.tid = static_cast<uint32>(GetCurrentThreadId());
+    event.beginTick = static_cast<int64>(beginTick);
+    event.durationTicks = static_cast<int64>(endTick - beginTick);
+    event.args = std::move(args);
+    m_events.push_back(std::move(event));
+  }
+
+  void
+  DXTimelineCapture::addInstant(const char* name, const char* category, String args) {
+    if (!m_bCapturing) {
+      return;
+    }
+
+    TimelineEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = 'i';
+    event.pid = CPU_PID;
+    event.tid = static_cast<uint32>(GetCurrentThreadId());
+    event.beginTick = static_cast<int64>(now());
+    event.args = std::move(args);
+    m_events.push_back(std::move(event));
+  }
+
+  void
+  DXTimelineCapture::addCounter(const char* name, String args) {
+    if (!m_bCapturing) {
+      return;
+    }
+
+    TimelineEvent event;
+    event.name = name;
+    event.category = "Counter";
+    event.phase = 'C';
+    event.pid = CPU_PID;
+    event.tid = static_cast<uint32>(GetCurrentThreadId());
+    event.beginTick = static_cast<int64>(now());
+    event.args = std::move(args);
+    m_events.push_back(std::move(event));
+  }
+
+  String
+  DXTimelineCapture::escape(const String& value) {
+    String result;
+    result.reserve(value.size());
+    for (char c : value) {
+      switch (c)
+      {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) >= 0x20) {
+          result += c;
+        }
+        break;
+      }
+    }
+    return result;
+  }
+
+  void
+  DXTimelineCapture::_onGPUFrameResolved(uint64 frameNumber,
+                                         const Vector<GPUScopeResult>& scopes,
+                                         uint64 frequency) {
+    if (!m_bCalibrated || !(m_bCapturing || m_bWaitingGPU) ||
+        frameNumber < m_firstGPUFrame || frameNumber > m_lastGPUFrame || 0 == frequency) {
+      return;
+    }
+
+    //The offset is taken in ticks before the conversion so the precision of
+    //the double doesn't depend on the uptime of the GPU
+    double cpuPerGPUTick = static_cast<double>(m_calibration.cpuFrequency) /
+                           static_cast<double>(frequency);
+    auto toCPUTick = [&](uint64 gpuTick) {
+      auto delta = static_cast<int64>(gpuTick - m_calibration.gpuTick);
+      return static_cast<int64>(m_calibration.cpuTick) +
+             static_cast<int64>(static_cast<double>(delta) * cpuPerGPUTick);
+    };
+
+    for (const auto& scope : scopes) {
+      TimelineEvent event;
+      event.name = scope.name;
+      event.category = "GPU";
+      event.phase = 'X';
+      event.pid = GPU_PID;
+      event.tid = GPU_TID;
+      event.beginTick = toCPUTick(scope.beginTick);
+      event.durationTicks = scope.endTick > scope.beginTick ?
+                              toCPUTick(scope.endTick) - event.beginTick : 0;
+      if (scope.bHasPipelineStats) {
+        const GPUPipelineStats& stats = scope.pipelineStats;
+        event.args = StringUtil::format("\"frame\":{0},\"iaPrimitives\":{1},"
+                                        "\"vsInvocations\":{2},\"psInvocations\":{3},"
+                                        "\"csInvocations\":{4}",
+                                        frameNumber,
+                                        stats.iaPrimitives,
+                                        stats.vsInvocations,
+                                        stats.psInvocations,
+                                        stats.csInvocations);
+      }
+      else {
+        event.args = StringUtil::format("\"frame\":{0}", frameNumber);
+      }
+      m_events.push_back(std::move(event));
+    }
+
+    if (m_bWaitingGPU && frameNumber >= m_lastGPUFrame) {
+      _finishCapture();
+    }
+  }
+
+  void
+  DXTimelineCapture::_beginCapture() {
+    m_bArmed = false;
+    m_events.clear();
+
+    //The calibration stalls until the GPU is idle, which is fine right
+    //before the first frame but would show up on every frame after it
+    m_bCalibrated = m_pProfiler &&
+                    m_pProfiler->isEnabled() &&
+                    m_pProfiler->calibrateClocks(m_calibration);
+    if (!m_bCalibrated) {
+      GE_LOG(kWarning,
+             RenderAPI,
+             "GPU clock calibration failed, the timeline capture has no GPU track");
+    }
+
+    m_startTick = now();
+    m_frameBeginTick = m_startTick;
+    m_frameIndex = 0;
+    m_framesLeft = m_numFrames;
+    m_firstGPUFrame = m_pProfiler ? m_pProfiler->getFrameNumber() : 0;
+    m_lastGPUFrame = m_firstGPUFrame + m_numFrames - 1;
+    m_bCapturing = true;
+  }
+
+  void
+  DXTimelineCapture::_finishCapture() {
+    m_bCapturing = false;
+    m_bWaitingGPU = false;
+
+    if (_write()) {
+      g_debug().log(StringUtil::format("Timeline of {0} frames saved to {1}",
+                                       m_frameIndex,
+                                       m_filePath.toString()),
+                    LogVerbosity::kInfo);
+    }
+    m_events.clear();
+  }
+
+  bool
+  DXTimelineCapture::_write() const {
+    auto stream = FileSystem::createAndOpenFile(m_filePath);
+    if (!stream) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create the timeline file: {0}",
+             m_filePath.toString());
+      return false;
+    }
+
+    String json;
+    json.reserve(256 + m_events.size() * 128);
+
+    char line[512];
+    snprintf(line,
+             sizeof(line),
+             "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"frames\":%llu,"
+             "\"gpuClockAligned\":%s},\"traceEvents\":[\n"
+             "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,"
+             "\"args\":{\"name\":\"CPU\"}},\n"
+             "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,"
+             "\"args\":{\"name\":\"GPU\"}},\n"
+             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,"
+             "\"args\":{\"name\":\"Immediate context\"}}",
+             static_cast<unsigned long long>(m_frameIndex),
+             m_bCalibrated ? "true" : "false",
+             CPU_PID,
+             GPU_PID,
+             GPU_PID,
+             GPU_TID);
+    json += line;
+
+    //Timestamps are microseconds since the start of the capture
+    double ticksToUs = 1000000.0 / static_cast<double>(m_cpuFrequency);
+    auto startTick = static_cast<int64>(m_startTick);
+    for (const auto& event : m_events) {
+      double ts = static_cast<double>(event.beginTick - startTick) * ticksToUs;
+      snprintf(line,
+               sizeof(line),
+               ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"pid\":%u,\"tid\":%u,"
+               "\"ts\":%.3f",
+               event.name ? event.name : "",
+               event.category ? event.category : "",
+               event.phase,
+               event.pid,
+               event.tid,
+               ts);
+      json += line;
+
+      if ('X' == event.phase) {
+        snprintf(line,
+                 sizeof(line),
+                 ",\"dur\":%.3f",
+                 static_cast<double>(event.durationTicks) * ticksToUs);
+        json += line;
+      }
+      else if ('i' == event.phase) {
+        json += ",\"s\":\"t\"";
+      }
+
+      if (!event.args.empty()) {
+        json += ",\"args\":{";
+        json += event.args;
+        json += '}';
+      }
+      json += '}';
+    }
+    json += "\n]}\n";
+
+    stream->write(json.data(), json.size());
+    stream->close();
+    return true;
+  }
+
+} // namespace geEngineSDK
@@ -3,644 +3,579 @@
 namespace geEngineSDK {
   namespace TranslateUtils {
 
+    namespace {
+#define FORMAT_ENTRY(name, bpp, blockW, blockH, blockBytes, channels, type, typeless, srgb, \
+                     flags)                                                                 \
+      { DXGI_FORMAT_##name, #name, bpp, blockW, blockH, blockBytes,                         \
+        channels, sizeof(channels) - 1, FORMAT_TYPE::type,                                  \
+        DXGI_FORMAT_##typeless, DXGI_FORMAT_##srgb, static_cast<uint32>(flags) }
+
+#define UNUSED_FORMAT(value)                                                                \
+      { static_cast<DXGI_FORMAT>(value), nullptr, 0, 0, 0, 0, "", 0, FORMAT_TYPE::kUnknown, \
+        DXGI_FORMAT_UNKNOWN, DXGI_FORMAT_UNKNOWN, 0 }
+
+      //Indexed by the value of the format, the gaps DXGI leaves are unused
+      //entries so the lookup is a bounds check and a load
+      constexpr FormatInfo s_formatTable[] = {
+        FORMAT_ENTRY(UNKNOWN, 0, 0, 0, 0, "", kUnknown, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32A32_TYPELESS, 128, 1, 1, 16, "RGBA", kTypeless, R32G32B32A32_TYPELESS,
+                     UNKNOWN, FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R32G32B32A32_FLOAT, 128, 1, 1, 16, "RGBA", kFloat, R32G32B32A32_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32A32_UINT, 128, 1, 1, 16, "RGBA", kUInt, R32G32B32A32_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32A32_SINT, 128, 1, 1, 16, "RGBA", kSInt, R32G32B32A32_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32_TYPELESS, 96, 1, 1, 12, "RGB", kTypeless, R32G32B32_TYPELESS,
+                     UNKNOWN, FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R32G32B32_FLOAT, 96, 1, 1, 12, "RGB", kFloat, R32G32B32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32_UINT, 96, 1, 1, 12, "RGB", kUInt, R32G32B32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32B32_SINT, 96, 1, 1, 12, "RGB", kSInt, R32G32B32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16B16A16_TYPELESS, 64, 1, 1, 8, "RGBA", kTypeless, R16G16B16A16_TYPELESS,
+                     UNKNOWN, FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R16G16B16A16_FLOAT, 64, 1, 1, 8, "RGBA", kFloat, R16G16B16A16_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16B16A16_UNORM, 64, 1, 1, 8, "RGBA", kUNorm, R16G16B16A16_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16B16A16_UINT, 64, 1, 1, 8, "RGBA", kUInt, R16G16B16A16_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(R16G16B16A16_SNORM, 64, 1, 1, 8, "RGBA", kSNorm, R16G16B16A16_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16B16A16_SINT, 64, 1, 1, 8, "RGBA", kSInt, R16G16B16A16_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(R32G32_TYPELESS, 64, 1, 1, 8, "RG", kTypeless, R32G32_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R32G32_FLOAT, 64, 1, 1, 8, "RG", kFloat, R32G32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32_UINT, 64, 1, 1, 8, "RG", kUInt, R32G32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G32_SINT, 64, 1, 1, 8, "RG", kSInt, R32G32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32G8X24_TYPELESS, 64, 1, 1, 8, "RG", kTypeless, R32G8X24_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(D32_FLOAT_S8X24_UINT, 64, 1, 1, 8, "DS", kDepthStencil, R32G8X24_TYPELESS,
+                     UNKNOWN, FORMAT_FLAG::kDepth | FORMAT_FLAG::kStencil),
+        FORMAT_ENTRY(R32_FLOAT_X8X24_TYPELESS, 64, 1, 1, 8, "R", kFloat, R32G8X24_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(X32_TYPELESS_G8X24_UINT, 64, 1, 1, 8, "G", kUInt, R32G8X24_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(R10G10B10A2_TYPELESS, 32, 1, 1, 4, "RGBA", kTypeless, R10G10B10A2_TYPELESS,
+                     UNKNOWN, FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R10G10B10A2_UNORM, 32, 1, 1, 4, "RGBA", kUNorm, R10G10B10A2_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(R10G10B10A2_UINT, 32, 1, 1, 4, "RGBA", kUInt, R10G10B10A2_TYPELESS, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(R11G11B10_FLOAT, 32, 1, 1, 4, "RGB", kFloat, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8B8A8_TYPELESS, 32, 1, 1, 4, "RGBA", kTypeless, R8G8B8A8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R8G8B8A8_UNORM, 32, 1, 1, 4, "RGBA", kUNorm, R8G8B8A8_TYPELESS,
+                     R8G8B8A8_UNORM_SRGB, 0),
+        FORMAT_ENTRY(R8G8B8A8_UNORM_SRGB, 32, 1, 1, 4, "RGBA", kUNorm, R8G8B8A8_TYPELESS,
+                     R8G8B8A8_UNORM, FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(R8G8B8A8_UINT, 32, 1, 1, 4, "RGBA", kUInt, R8G8B8A8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8B8A8_SNORM, 32, 1, 1, 4, "RGBA", kSNorm, R8G8B8A8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8B8A8_SINT, 32, 1, 1, 4, "RGBA", kSInt, R8G8B8A8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16_TYPELESS, 32, 1, 1, 4, "RG", kTypeless, R16G16_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R16G16_FLOAT, 32, 1, 1, 4, "RG", kFloat, R16G16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16_UNORM, 32, 1, 1, 4, "RG", kUNorm, R16G16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16_UINT, 32, 1, 1, 4, "RG", kUInt, R16G16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16_SNORM, 32, 1, 1, 4, "RG", kSNorm, R16G16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16G16_SINT, 32, 1, 1, 4, "RG", kSInt, R16G16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32_TYPELESS, 32, 1, 1, 4, "R", kTypeless, R32_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(D32_FLOAT, 32, 1, 1, 4, "D", kFloat, R32_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kDepth),
+        FORMAT_ENTRY(R32_FLOAT, 32, 1, 1, 4, "R", kFloat, R32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32_UINT, 32, 1, 1, 4, "R", kUInt, R32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R32_SINT, 32, 1, 1, 4, "R", kSInt, R32_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R24G8_TYPELESS, 32, 1, 1, 4, "RG", kTypeless, R24G8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(D24_UNORM_S8_UINT, 32, 1, 1, 4, "DS", kDepthStencil, R24G8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kDepth | FORMAT_FLAG::kStencil),
+        FORMAT_ENTRY(R24_UNORM_X8_TYPELESS, 32, 1, 1, 4, "R", kUNorm, R24G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(X24_TYPELESS_G8_UINT, 32, 1, 1, 4, "G", kUInt, R24G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8_TYPELESS, 16, 1, 1, 2, "RG", kTypeless, R8G8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R8G8_UNORM, 16, 1, 1, 2, "RG", kUNorm, R8G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8_UINT, 16, 1, 1, 2, "RG", kUInt, R8G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8_SNORM, 16, 1, 1, 2, "RG", kSNorm, R8G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8_SINT, 16, 1, 1, 2, "RG", kSInt, R8G8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16_TYPELESS, 16, 1, 1, 2, "R", kTypeless, R16_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R16_FLOAT, 16, 1, 1, 2, "R", kFloat, R16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(D16_UNORM, 16, 1, 1, 2, "D", kUNorm, R16_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kDepth),
+        FORMAT_ENTRY(R16_UNORM, 16, 1, 1, 2, "R", kUNorm, R16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16_UINT, 16, 1, 1, 2, "R", kUInt, R16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16_SNORM, 16, 1, 1, 2, "R", kSNorm, R16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R16_SINT, 16, 1, 1, 2, "R", kSInt, R16_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8_TYPELESS, 8, 1, 1, 1, "R", kTypeless, R8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(R8_UNORM, 8, 1, 1, 1, "R", kUNorm, R8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8_UINT, 8, 1, 1, 1, "R", kUInt, R8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8_SNORM, 8, 1, 1, 1, "R", kSNorm, R8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(R8_SINT, 8, 1, 1, 1, "R", kSInt, R8_TYPELESS, UNKNOWN, 0),
+        FORMAT_ENTRY(A8_UNORM, 8, 1, 1, 1, "A", kUNorm, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(R1_UNORM, 1, 8, 1, 1, "R", kUNorm, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(R9G9B9E5_SHAREDEXP, 32, 1, 1, 4, "RGB", kSharedExp, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(R8G8_B8G8_UNORM, 16, 2, 1, 4, "RGBG", kUNorm, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kPacked),
+        FORMAT_ENTRY(G8R8_G8B8_UNORM, 16, 2, 1, 4, "GRGB", kUNorm, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kPacked),
+        FORMAT_ENTRY(BC1_TYPELESS, 4, 4, 4, 8, "RGBA", kTypeless, BC1_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC1_UNORM, 4, 4, 4, 8, "RGBA", kUNorm, BC1_TYPELESS, BC1_UNORM_SRGB,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC1_UNORM_SRGB, 4, 4, 4, 8, "RGBA", kUNorm, BC1_TYPELESS, BC1_UNORM,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(BC2_TYPELESS, 8, 4, 4, 16, "RGBA", kTypeless, BC2_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC2_UNORM, 8, 4, 4, 16, "RGBA", kUNorm, BC2_TYPELESS, BC2_UNORM_SRGB,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC2_UNORM_SRGB, 8, 4, 4, 16, "RGBA", kUNorm, BC2_TYPELESS, BC2_UNORM,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(BC3_TYPELESS, 8, 4, 4, 16, "RGBA", kTypeless, BC3_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC3_UNORM, 8, 4, 4, 16, "RGBA", kUNorm, BC3_TYPELESS, BC3_UNORM_SRGB,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC3_UNORM_SRGB, 8, 4, 4, 16, "RGBA", kUNorm, BC3_TYPELESS, BC3_UNORM,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(BC4_TYPELESS, 4, 4, 4, 8, "R", kTypeless, BC4_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC4_UNORM, 4, 4, 4, 8, "R", kUNorm, BC4_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC4_SNORM, 4, 4, 4, 8, "R", kSNorm, BC4_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC5_TYPELESS, 8, 4, 4, 16, "RG", kTypeless, BC5_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC5_UNORM, 8, 4, 4, 16, "RG", kUNorm, BC5_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC5_SNORM, 8, 4, 4, 16, "RG", kSNorm, BC5_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(B5G6R5_UNORM, 16, 1, 1, 2, "BGR", kUNorm, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(B5G5R5A1_UNORM, 16, 1, 1, 2, "BGRA", kUNorm, UNKNOWN, UNKNOWN, 0),
+        FORMAT_ENTRY(B8G8R8A8_UNORM, 32, 1, 1, 4, "BGRA", kUNorm, B8G8R8A8_TYPELESS,
+                     B8G8R8A8_UNORM_SRGB, 0),
+        FORMAT_ENTRY(B8G8R8X8_UNORM, 32, 1, 1, 4, "BGRX", kUNorm, B8G8R8X8_TYPELESS,
+                     B8G8R8X8_UNORM_SRGB, 0),
+        FORMAT_ENTRY(R10G10B10_XR_BIAS_A2_UNORM, 32, 1, 1, 4, "RGBA", kUNorm, R10G10B10A2_TYPELESS,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(B8G8R8A8_TYPELESS, 32, 1, 1, 4, "BGRA", kTypeless, B8G8R8A8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(B8G8R8A8_UNORM_SRGB, 32, 1, 1, 4, "BGRA", kUNorm, B8G8R8A8_TYPELESS,
+                     B8G8R8A8_UNORM, FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(B8G8R8X8_TYPELESS, 32, 1, 1, 4, "BGRX", kTypeless, B8G8R8X8_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(B8G8R8X8_UNORM_SRGB, 32, 1, 1, 4, "BGRX", kUNorm, B8G8R8X8_TYPELESS,
+                     B8G8R8X8_UNORM, FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(BC6H_TYPELESS, 8, 4, 4, 16, "RGB", kTypeless, BC6H_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC6H_UF16, 8, 4, 4, 16, "RGB", kFloat, BC6H_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC6H_SF16, 8, 4, 4, 16, "RGB", kFloat, BC6H_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC7_TYPELESS, 8, 4, 4, 16, "RGBA", kTypeless, BC7_TYPELESS, UNKNOWN,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kTypeless),
+        FORMAT_ENTRY(BC7_UNORM, 8, 4, 4, 16, "RGBA", kUNorm, BC7_TYPELESS, BC7_UNORM_SRGB,
+                     FORMAT_FLAG::kCompressed),
+        FORMAT_ENTRY(BC7_UNORM_SRGB, 8, 4, 4, 16, "RGBA", kUNorm, BC7_TYPELESS, BC7_UNORM,
+                     FORMAT_FLAG::kCompressed | FORMAT_FLAG::kSRGB),
+        FORMAT_ENTRY(AYUV, 32, 1, 1, 4, "VUYA", kVideo, UNKNOWN, UNKNOWN, FORMAT_FLAG::kVideo),
+        FORMAT_ENTRY(Y410, 32, 1, 1, 4, "UYVA", kVideo, UNKNOWN, UNKNOWN, FORMAT_FLAG::kVideo),
+        FORMAT_ENTRY(Y416, 64, 1, 1, 8, "UYVA", kVideo, UNKNOWN, UNKNOWN, FORMAT_FLAG::kVideo),
+        FORMAT_ENTRY(NV12, 12, 2, 2, 6, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(P010, 24, 2, 2, 12, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(P016, 24, 2, 2, 12, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(420_OPAQUE, 12, 2, 2, 6, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(YUY2, 16, 2, 1, 4, "YUYV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPacked),
+        FORMAT_ENTRY(Y210, 32, 2, 1, 8, "YUYV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPacked),
+        FORMAT_ENTRY(Y216, 32, 2, 1, 8, "YUYV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPacked),
+        FORMAT_ENTRY(NV11, 12, 4, 1, 6, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(AI44, 8, 1, 1, 1, "AI", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPalette),
+        FORMAT_ENTRY(IA44, 8, 1, 1, 1, "IA", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPalette),
+        FORMAT_ENTRY(P8, 8, 1, 1, 1, "P", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPalette),
+        FORMAT_ENTRY(A8P8, 16, 1, 1, 2, "PA", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPalette),
+        FORMAT_ENTRY(B4G4R4A4_UNORM, 16, 1, 1, 2, "BGRA", kUNorm, UNKNOWN, UNKNOWN, 0),
+        UNUSED_FORMAT(116), UNUSED_FORMAT(117), UNUSED_FORMAT(118), UNUSED_FORMAT(119),
+        UNUSED_FORMAT(120), UNUSED_FORMAT(121), UNUSED_FORMAT(122), UNUSED_FORMAT(123),
+        UNUSED_FORMAT(124), UNUSED_FORMAT(125), UNUSED_FORMAT(126), UNUSED_FORMAT(127),
+        UNUSED_FORMAT(128), UNUSED_FORMAT(129),
+        FORMAT_ENTRY(P208, 16, 2, 1, 4, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(V208, 16, 1, 2, 4, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        FORMAT_ENTRY(V408, 24, 1, 1, 3, "YUV", kVideo, UNKNOWN, UNKNOWN,
+                     FORMAT_FLAG::kVideo | FORMAT_FLAG::kPlanar),
+        UNUSED_FORMAT(133), UNUSED_FORMAT(134), UNUSED_FORMAT(135), UNUSED_FORMAT(136),
+        UNUSED_FORMAT(137), UNUSED_FORMAT(138), UNUSED_FORMAT(139), UNUSED_FORMAT(140),
+        UNUSED_FORMAT(141), UNUSED_FORMAT(142), UNUSED_FORMAT(143), UNUSED_FORMAT(144),
+        UNUSED_FORMAT(145), UNUSED_FORMAT(146), UNUSED_FORMAT(147), UNUSED_FORMAT(148),
+        UNUSED_FORMAT(149), UNUSED_FORMAT(150), UNUSED_FORMAT(151), UNUSED_FORMAT(152),
+        UNUSED_FORMAT(153), UNUSED_FORMAT(154), UNUSED_FORMAT(155), UNUSED_FORMAT(156),
+        UNUSED_FORMAT(157), UNUSED_FORMAT(158), UNUSED_FORMAT(159), UNUSED_FORMAT(160),
+        UNUSED_FORMAT(161), UNUSED_FORMAT(162), UNUSED_FORMAT(163), UNUSED_FORMAT(164),
+        UNUSED_FORMAT(165), UNUSED_FORMAT(166), UNUSED_FORMAT(167), UNUSED_FORMAT(168),
+        UNUSED_FORMAT(169), UNUSED_FORMAT(170), UNUSED_FORMAT(171), UNUSED_FORMAT(172),
+        UNUSED_FORMAT(173), UNUSED_FORMAT(174), UNUSED_FORMAT(175), UNUSED_FORMAT(176),
+        UNUSED_FORMAT(177), UNUSED_FORMAT(178), UNUSED_FORMAT(179), UNUSED_FORMAT(180),
+        UNUSED_FORMAT(181), UNUSED_FORMAT(182), UNUSED_FORMAT(183), UNUSED_FORMAT(184),
+        UNUSED_FORMAT(185), UNUSED_FORMAT(186), UNUSED_FORMAT(187), UNUSED_FORMAT(188),
+        FORMAT_ENTRY(SAMPLER_FEEDBACK_MIN_MIP_OPAQUE, 32, 1, 1, 4, "", kOpaque, UNKNOWN, UNKNOWN,
+                     0),
+        FORMAT_ENTRY(SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE, 32, 1, 1, 4, "", kOpaque, UNKNOWN,
+                     UNKNOWN, 0),
+        FORMAT_ENTRY(A4B4G4R4_UNORM, 16, 1, 1, 2, "ABGR", kUNorm, UNKNOWN, UNKNOWN, 0)
+      };
+
+#undef UNUSED_FORMAT
+#undef FORMAT_ENTRY
+
+      constexpr uint32 NUM_FORMATS = sizeof(s_formatTable) / sizeof(s_formatTable[0]);
+
+      constexpr bool
+      isEntryConsistent(const FormatInfo& info) {
+        return (DXGI_FORMAT_UNKNOWN == info.typelessFormat ||
+                0 != (s_formatTable[info.typelessFormat].flags & FORMAT_FLAG::kTypeless)) &&
+               (DXGI_FORMAT_UNKNOWN == info.srgbFormat ||
+                s_formatTable[info.srgbFormat].srgbFormat == info.format) &&
+               (!info.name || info.bytesPerBlock * 8 ==
+                                info.bitsPerPixel * info.blockWidth * info.blockHeight);
+      }
+
+      constexpr bool
+      isTableValid(uint32 index = 0) {
+        return NUM_FORMATS == index ||
+               (static_cast<uint32>(s_formatTable[index].format) == index &&
+                isEntryConsistent(s_formatTable[index]) &&
+                isTableValid(index + 1));
+      }
+
+      static_assert(isTableValid(), "The format table is out of order or inconsistent");
+      static_assert(NUM_FORMATS == DXGI_FORMAT_A4B4G4R4_UNORM + 1,
+                    "The format table doesn't cover every DXGI_FORMAT");
+
+      //get(GRAPHICS_FORMAT::E) and get(D3D11_TEXTURE2D_DESC) rely on the
+      //engine formats having the values of their DXGI counterparts
+#define GE_MIRRORED_FORMAT(name)                                                 \
+      static_assert(static_cast<uint32>(GRAPHICS_FORMAT::k##name) ==             \
+                      static_cast<uint32>(DXGI_FORMAT_##name),                   \
+                    "GRAPHICS_FORMAT::k" #name " doesn't match its DXGI value")
+
+      GE_MIRRORED_FORMAT(R32G32B32A32_TYPELESS);
+      GE_MIRRORED_FORMAT(R32G32B32A32_FLOAT);
+      GE_MIRRORED_FORMAT(R32G32B32A32_UINT);
+      GE_MIRRORED_FORMAT(R32G32B32A32_SINT);
+      GE_MIRRORED_FORMAT(R32G32B32_TYPELESS);
+      GE_MIRRORED_FORMAT(R32G32B32_FLOAT);
+      GE_MIRRORED_FORMAT(R32G32B32_UINT);
+      GE_MIRRORED_FORMAT(R32G32B32_SINT);
+      GE_MIRRORED_FORMAT(R16G16B16A16_TYPELESS);
+      GE_MIRRORED_FORMAT(R16G16B16A16_FLOAT);
+      GE_MIRRORED_FORMAT(R16G16B16A16_UNORM);
+      GE_MIRRORED_FORMAT(R16G16B16A16_UINT);
+      GE_MIRRORED_FORMAT(R16G16B16A16_SNORM);
+      GE_MIRRORED_FORMAT(R16G16B16A16_SINT);
+      GE_MIRRORED_FORMAT(R32G32_TYPELESS);
+      GE_MIRRORED_FORMAT(R32G32_FLOAT);
+      GE_MIRRORED_FORMAT(R32G32_UINT);
+      GE_MIRRORED_FORMAT(R32G32_SINT);
+      GE_MIRRORED_FORMAT(R32G8X24_TYPELESS);
+      GE_MIRRORED_FORMAT(D32_FLOAT_S8X24_UINT);
+      GE_MIRRORED_FORMAT(R32_FLOAT_X8X24_TYPELESS);
+      GE_MIRRORED_FORMAT(X32_TYPELESS_G8X24_UINT);
+      GE_MIRRORED_FORMAT(R10G10B10A2_TYPELESS);
+      GE_MIRRORED_FORMAT(R10G10B10A2_UNORM);
+      GE_MIRRORED_FORMAT(R10G10B10A2_UINT);
+      GE_MIRRORED_FORMAT(R11G11B10_FLOAT);
+      GE_MIRRORED_FORMAT(R8G8B8A8_TYPELESS);
+      GE_MIRRORED_FORMAT(R8G8B8A8_UNORM);
+      GE_MIRRORED_FORMAT(R8G8B8A8_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(R8G8B8A8_UINT);
+      GE_MIRRORED_FORMAT(R8G8B8A8_SNORM);
+      GE_MIRRORED_FORMAT(R8G8B8A8_SINT);
+      GE_MIRRORED_FORMAT(R16G16_TYPELESS);
+      GE_MIRRORED_FORMAT(R16G16_FLOAT);
+      GE_MIRRORED_FORMAT(R16G16_UNORM);
+      GE_MIRRORED_FORMAT(R16G16_UINT);
+      GE_MIRRORED_FORMAT(R16G16_SNORM);
+      GE_MIRRORED_FORMAT(R16G16_SINT);
+      GE_MIRRORED_FORMAT(R32_TYPELESS);
+      GE_MIRRORED_FORMAT(D32_FLOAT);
+      GE_MIRRORED_FORMAT(R32_FLOAT);
+      GE_MIRRORED_FORMAT(R32_UINT);
+      GE_MIRRORED_FORMAT(R32_SINT);
+      GE_MIRRORED_FORMAT(R24G8_TYPELESS);
+      GE_MIRRORED_FORMAT(D24_UNORM_S8_UINT);
+      GE_MIRRORED_FORMAT(R24_UNORM_X8_TYPELESS);
+      GE_MIRRORED_FORMAT(X24_TYPELESS_G8_UINT);
+      GE_MIRRORED_FORMAT(R8G8_TYPELESS);
+      GE_MIRRORED_FORMAT(R8G8_UNORM);
+      GE_MIRRORED_FORMAT(R8G8_UINT);
+      GE_MIRRORED_FORMAT(R8G8_SNORM);
+      GE_MIRRORED_FORMAT(R8G8_SINT);
+      GE_MIRRORED_FORMAT(R16_TYPELESS);
+      GE_MIRRORED_FORMAT(R16_FLOAT);
+      GE_MIRRORED_FORMAT(D16_UNORM);
+      GE_MIRRORED_FORMAT(R16_UNORM);
+      GE_MIRRORED_FORMAT(R16_UINT);
+      GE_MIRRORED_FORMAT(R16_SNORM);
+      GE_MIRRORED_FORMAT(R16_SINT);
+      GE_MIRRORED_FORMAT(R8_TYPELESS);
+      GE_MIRRORED_FORMAT(R8_UNORM);
+      GE_MIRRORED_FORMAT(R8_UINT);
+      GE_MIRRORED_FORMAT(R8_SNORM);
+      GE_MIRRORED_FORMAT(R8_SINT);
+      GE_MIRRORED_FORMAT(A8_UNORM);
+      GE_MIRRORED_FORMAT(R1_UNORM);
+      GE_MIRRORED_FORMAT(R9G9B9E5_SHAREDEXP);
+      GE_MIRRORED_FORMAT(R8G8_B8G8_UNORM);
+      GE_MIRRORED_FORMAT(G8R8_G8B8_UNORM);
+      GE_MIRRORED_FORMAT(BC1_TYPELESS);
+      GE_MIRRORED_FORMAT(BC1_UNORM);
+      GE_MIRRORED_FORMAT(BC1_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(BC2_TYPELESS);
+      GE_MIRRORED_FORMAT(BC2_UNORM);
+      GE_MIRRORED_FORMAT(BC2_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(BC3_TYPELESS);
+      GE_MIRRORED_FORMAT(BC3_UNORM);
+      GE_MIRRORED_FORMAT(BC3_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(BC4_TYPELESS);
+      GE_MIRRORED_FORMAT(BC4_UNORM);
+      GE_MIRRORED_FORMAT(BC4_SNORM);
+      GE_MIRRORED_FORMAT(BC5_TYPELESS);
+      GE_MIRRORED_FORMAT(BC5_UNORM);
+      GE_MIRRORED_FORMAT(BC5_SNORM);
+      GE_MIRRORED_FORMAT(B5G6R5_UNORM);
+      GE_MIRRORED_FORMAT(B5G5R5A1_UNORM);
+      GE_MIRRORED_FORMAT(B8G8R8A8_UNORM);
+      GE_MIRRORED_FORMAT(B8G8R8X8_UNORM);
+      GE_MIRRORED_FORMAT(R10G10B10_XR_BIAS_A2_UNORM);
+      GE_MIRRORED_FORMAT(B8G8R8A8_TYPELESS);
+      GE_MIRRORED_FORMAT(B8G8R8A8_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(B8G8R8X8_TYPELESS);
+      GE_MIRRORED_FORMAT(B8G8R8X8_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(BC6H_TYPELESS);
+      GE_MIRRORED_FORMAT(BC6H_UF16);
+      GE_MIRRORED_FORMAT(BC6H_SF16);
+      GE_MIRRORED_FORMAT(BC7_TYPELESS);
+      GE_MIRRORED_FORMAT(BC7_UNORM);
+      GE_MIRRORED_FORMAT(BC7_UNORM_SRGB);
+      GE_MIRRORED_FORMAT(AYUV);
+      GE_MIRRORED_FORMAT(Y410);
+      GE_MIRRORED_FORMAT(Y416);
+      GE_MIRRORED_FORMAT(NV12);
+      GE_MIRRORED_FORMAT(P010);
+      GE_MIRRORED_FORMAT(P016);
+      GE_MIRRORED_FORMAT(420_OPAQUE);
+      GE_MIRRORED_FORMAT(YUY2);
+      GE_MIRRORED_FORMAT(Y210);
+      GE_MIRRORED_FORMAT(Y216);
+      GE_MIRRORED_FORMAT(NV11);
+      GE_MIRRORED_FORMAT(AI44);
+      GE_MIRRORED_FORMAT(IA44);
+      GE_MIRRORED_FORMAT(P8);
+      GE_MIRRORED_FORMAT(A8P8);
+      GE_MIRRORED_FORMAT(B4G4R4A4_UNORM);
+      GE_MIRRORED_FORMAT(P208);
+      GE_MIRRORED_FORMAT(V208);
+      GE_MIRRORED_FORMAT(V408);
+      GE_MIRRORED_FORMAT(SAMPLER_FEEDBACK_MIN_MIP_OPAQUE);
+      GE_MIRRORED_FORMAT(SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE);
+
+#undef GE_MIRRORED_FORMAT
+
+      //FNV-1a, also used at compile time to build the name index
+      constexpr uint32
+      hashName(const char* name, SIZE_T length) {
+        uint32 hash = 2166136261U;
+        for (SIZE_T i = 0; i < length; ++i) {
+          hash = (hash ^ static_cast<uint8>(name[i])) * 16777619U;
+        }
+        return hash;
+      }
+
+      constexpr SIZE_T
+      nameLength(const char* name) {
+        SIZE_T length = 0;
+        while (name[length]) {
+          ++length;
+        }
+        return length;
+      }
+
+      //Power of two, a bit more than half full with the DXGI names
+      constexpr uint32 FORMAT_NAME_SLOTS = 256;
+
+      struct FormatNameIndex
+      {
+        uint8 slots[FORMAT_NAME_SLOTS];   //Value of the format + 1, 0 is empty
+      };
+
+      static_assert(NUM_FORMATS < FORMAT_NAME_SLOTS,
+                    "The format name index is too small for the format table");
+
+      //Open addressing with linear probing, built by the compiler
+      constexpr FormatNameIndex
+      buildFormatNameIndex() {
+        FormatNameIndex index = {};
+        for (uint32 i = 0; i < NUM_FORMATS; ++i) {
+          const char* name = s_formatTable[i].name;
+          if (!name) {
+            continue;
+          }
+
+          uint32 slot = hashName(name, nameLength(name)) & (FORMAT_NAME_SLOTS - 1);
+          while (index.slots[slot]) {
+            slot = (slot + 1) & (FORMAT_NAME_SLOTS - 1);
+          }
+          index.slots[slot] = static_cast<uint8>(i + 1);
+        }
+        return index;
+      }
+
+      constexpr FormatNameIndex s_formatNameIndex = buildFormatNameIndex();
+
+      struct SemanticName
+      {
+        const char* name;
+        VERTEX_ELEMENT_SEMANTIC::E semantic;
+      };
+
+      //Upper case, the lookup folds the case of the name before hashing it
+      constexpr SemanticName s_semanticNames[] = {
+        { "BINORMAL", VERTEX_ELEMENT_SEMANTIC::BITANGENT },
+        { "BITANGENT", VERTEX_ELEMENT_SEMANTIC::BITANGENT },
+        { "BLENDINDICES", VERTEX_ELEMENT_SEMANTIC::BLENDINDICES },
+        { "BLENDWEIGHT", VERTEX_ELEMENT_SEMANTIC::BLENDWEIGHT },
+        { "COLOR", VERTEX_ELEMENT_SEMANTIC::COLOR },
+        { "NORMAL", VERTEX_ELEMENT_SEMANTIC::NORMAL },
+        { "POSITION", VERTEX_ELEMENT_SEMANTIC::POSITION },
+        { "POSITIONT", VERTEX_ELEMENT_SEMANTIC::POSITIONT },
+        { "PSIZE", VERTEX_ELEMENT_SEMANTIC::PSIZE },
+        { "TANGENT", VERTEX_ELEMENT_SEMANTIC::TANGENT },
+        { "TEXCOORD", VERTEX_ELEMENT_SEMANTIC::TEXCOORD }
+      };
+
+      constexpr uint32 NUM_SEMANTIC_NAMES = sizeof(s_semanticNames) / sizeof(s_semanticNames[0]);
+      constexpr uint32 SEMANTIC_NAME_SLOTS = 32;
+
+      struct SemanticNameIndex
+      {
+        uint8 slots[SEMANTIC_NAME_SLOTS];  //Entry of s_semanticNames + 1, 0 is empty
+      };
+
+      static_assert(NUM_SEMANTIC_NAMES < SEMANTIC_NAME_SLOTS,
+                    "The semantic name index is too small for the semantic names");
+
+      constexpr SemanticNameIndex
+      buildSemanticNameIndex() {
+        SemanticNameIndex index = {};
+        for (uint32 i = 0; i < NUM_SEMANTIC_NAMES; ++i) {
+          const char* name = s_semanticNames[i].name;
+          uint32 slot = hashName(name, nameLength(name)) & (SEMANTIC_NAME_SLOTS - 1);
+          while (index.slots[slot]) {
+            slot = (slot + 1) & (SEMANTIC_NAME_SLOTS - 1);
+          }
+          index.slots[slot] = static_cast<uint8>(i + 1);
+        }
+        return index;
+      }
+
+      constexpr SemanticNameIndex s_semanticNameIndex = buildSemanticNameIndex();
+
+      /**
+       * @brief True if the first length characters of name, in upper case,
+       *        are the upper case entry.
+       */
+      bool
+      isSemanticName(const char* name, SIZE_T length, const char* entry) {
+        for (SIZE_T i = 0; i < length; ++i, ++entry) {
+          char c = name[i];
+          if (c >= 'a' && c <= 'z') {
+            c = static_cast<char>(c - ('a' - 'A'));
+          }
+          if (c != *entry) {
+            return false;
+          }
+        }
+        return 0 == *entry;
+      }
+    }
+
+    const FormatInfo&
+    getFormatInfo(DXGI_FORMAT format) {
+      auto index = static_cast<uint32>(format);
+      if (index >= NUM_FORMATS || !s_formatTable[index].name) {
+        return s_formatTable[DXGI_FORMAT_UNKNOWN];
+      }
+      return s_formatTable[index];
+    }
+
+    SIZE_T
+    getRowPitch(DXGI_FORMAT format, uint32 width) {
+      const FormatInfo& info = getFormatInfo(format);
+      if (!info.blockWidth) {
+        return 0;
+      }
+      SIZE_T blocksWide = (static_cast<SIZE_T>(width) + info.blockWidth - 1) / info.blockWidth;
+      return blocksWide * info.bytesPerBlock;
+    }
+
+    uint32
+    getNumRows(DXGI_FORMAT format, uint32 height) {
+      const FormatInfo& info = getFormatInfo(format);
+      if (!info.blockHeight) {
+        return 0;
+      }
+      return (height + info.blockHeight - 1) / info.blockHeight;
+    }
+
+    SIZE_T
+    getSurfaceSize(DXGI_FORMAT format, uint32 width, uint32 height) {
+      return getRowPitch(format, width) * getNumRows(format, height);
+    }
+
     DXGI_FORMAT
     get(GRAPHICS_FORMAT::E inFormat) {
-      switch (inFormat) {
-      case GRAPHICS_FORMAT::kR32G32B32A32_TYPELESS:
-        return DXGI_FORMAT_R32G32B32A32_TYPELESS;
-      case GRAPHICS_FORMAT::kR32G32B32A32_FLOAT:
-        return DXGI_FORMAT_R32G32B32A32_FLOAT;
-      case GRAPHICS_FORMAT::kR32G32B32A32_UINT:
-        return DXGI_FORMAT_R32G32B32A32_UINT;
-      case GRAPHICS_FORMAT::kR32G32B32A32_SINT:
-        return DXGI_FORMAT_R32G32B32A32_SINT;
-      case GRAPHICS_FORMAT::kR32G32B32_TYPELESS:
-        return DXGI_FORMAT_R32G32B32_TYPELESS;
-      case GRAPHICS_FORMAT::kR32G32B32_FLOAT:
-        return DXGI_FORMAT_R32G32B32_FLOAT;
-      case GRAPHICS_FORMAT::kR32G32B32_UINT:
-        return DXGI_FORMAT_R32G32B32_UINT;
-      case GRAPHICS_FORMAT::kR32G32B32_SINT:
-        return DXGI_FORMAT_R32G32B32_SINT;
-      case GRAPHICS_FORMAT::kR16G16B16A16_TYPELESS:
-        return DXGI_FORMAT_R16G16B16A16_TYPELESS;
-      case GRAPHICS_FORMAT::kR16G16B16A16_FLOAT:
-        return DXGI_FORMAT_R16G16B16A16_FLOAT;
-      case GRAPHICS_FORMAT::kR16G16B16A16_UNORM:
-        return DXGI_FORMAT_R16G16B16A16_UNORM;
-      case GRAPHICS_FORMAT::kR16G16B16A16_UINT:
-        return DXGI_FORMAT_R16G16B16A16_UINT;
-      case GRAPHICS_FORMAT::kR16G16B16A16_SNORM:
-        return DXGI_FORMAT_R16G16B16A16_SNORM;
-      case GRAPHICS_FORMAT::kR16G16B16A16_SINT:
-        return DXGI_FORMAT_R16G16B16A16_SINT;
-      case GRAPHICS_FORMAT::kR32G32_TYPELESS:
-        return DXGI_FORMAT_R32G32_TYPELESS;
-      case GRAPHICS_FORMAT::kR32G32_FLOAT:
-        return DXGI_FORMAT_R32G32_FLOAT;
-      case GRAPHICS_FORMAT::kR32G32_UINT:
-        return DXGI_FORMAT_R32G32_UINT;
-      case GRAPHICS_FORMAT::kR32G32_SINT:
-        return DXGI_FORMAT_R32G32_SINT;
-      case GRAPHICS_FORMAT::kR32G8X24_TYPELESS:
-        return DXGI_FORMAT_R32G8X24_TYPELESS;
-      case GRAPHICS_FORMAT::kD32_FLOAT_S8X24_UINT:
-        return DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
-      case GRAPHICS_FORMAT::kR32_FLOAT_X8X24_TYPELESS:
-        return DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS;
-      case GRAPHICS_FORMAT::kX32_TYPELESS_G8X24_UINT:
-        return DXGI_FORMAT_X32_TYPELESS_G8X24_UINT;
-      case GRAPHICS_FORMAT::kR10G10B10A2_TYPELESS:
-        return DXGI_FORMAT_R10G10B10A2_TYPELESS;
-      case GRAPHICS_FORMAT::kR10G10B10A2_UNORM:
-        return DXGI_FORMAT_R10G10B10A2_UNORM;
-      case GRAPHICS_FORMAT::kR10G10B10A2_UINT:
-        return DXGI_FORMAT_R10G10B10A2_UINT;
-      case GRAPHICS_FORMAT::kR11G11B10_FLOAT:
-        return DXGI_FORMAT_R11G11B10_FLOAT;
-      case GRAPHICS_FORMAT::kR8G8B8A8_TYPELESS:
-        return DXGI_FORMAT_R8G8B8A8_TYPELESS;
-      case GRAPHICS_FORMAT::kR8G8B8A8_UNORM:
-        return DXGI_FORMAT_R8G8B8A8_UNORM;
-      case GRAPHICS_FORMAT::kR8G8B8A8_UNORM_SRGB:
-        return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kR8G8B8A8_UINT:
-        return DXGI_FORMAT_R8G8B8A8_UINT;
-      case GRAPHICS_FORMAT::kR8G8B8A8_SNORM:
-        return DXGI_FORMAT_R8G8B8A8_SNORM;
-      case GRAPHICS_FORMAT::kR8G8B8A8_SINT:
-        return DXGI_FORMAT_R8G8B8A8_SINT;
-      case GRAPHICS_FORMAT::kR16G16_TYPELESS:
-        return DXGI_FORMAT_R16G16_TYPELESS;
-      case GRAPHICS_FORMAT::kR16G16_FLOAT:
-        return DXGI_FORMAT_R16G16_FLOAT;
-      case GRAPHICS_FORMAT::kR16G16_UNORM:
-        return DXGI_FORMAT_R16G16_UNORM;
-      case GRAPHICS_FORMAT::kR16G16_UINT:
-        return DXGI_FORMAT_R16G16_UINT;
-      case GRAPHICS_FORMAT::kR16G16_SNORM:
-        return DXGI_FORMAT_R16G16_SNORM;
-      case GRAPHICS_FORMAT::kR16G16_SINT:
-        return DXGI_FORMAT_R16G16_SINT;
-      case GRAPHICS_FORMAT::kR32_TYPELESS:
-        return DXGI_FORMAT_R32_TYPELESS;
-      case GRAPHICS_FORMAT::kD32_FLOAT:
-        return DXGI_FORMAT_D32_FLOAT;
-      case GRAPHICS_FORMAT::kR32_FLOAT:
-        return DXGI_FORMAT_R32_FLOAT;
-      case GRAPHICS_FORMAT::kR32_UINT:
-        return DXGI_FORMAT_R32_UINT;
-      case GRAPHICS_FORMAT::kR32_SINT:
-        return DXGI_FORMAT_R32_SINT;
-      case GRAPHICS_FORMAT::kR24G8_TYPELESS:
-        return DXGI_FORMAT_R24G8_TYPELESS;
-      case GRAPHICS_FORMAT::kD24_UNORM_S8_UINT:
-        return DXGI_FORMAT_D24_UNORM_S8_UINT;
-      case GRAPHICS_FORMAT::kR24_UNORM_X8_TYPELESS:
-        return DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-      case GRAPHICS_FORMAT::kX24_TYPELESS_G8_UINT:
-        return DXGI_FORMAT_X24_TYPELESS_G8_UINT;
-      case GRAPHICS_FORMAT::kR8G8_TYPELESS:
-        return DXGI_FORMAT_R8G8_TYPELESS;
-      case GRAPHICS_FORMAT::kR8G8_UNORM:
-        return DXGI_FORMAT_R8G8_UNORM;
-      case GRAPHICS_FORMAT::kR8G8_UINT:
-        return DXGI_FORMAT_R8G8_UINT;
-      case GRAPHICS_FORMAT::kR8G8_SNORM:
-        return DXGI_FORMAT_R8G8_SNORM;
-      case GRAPHICS_FORMAT::kR8G8_SINT:
-        return DXGI_FORMAT_R8G8_SINT;
-      case GRAPHICS_FORMAT::kR16_TYPELESS:
-        return DXGI_FORMAT_R16_TYPELESS;
-      case GRAPHICS_FORMAT::kR16_FLOAT:
-        return DXGI_FORMAT_R16_FLOAT;
-      case GRAPHICS_FORMAT::kD16_UNORM:
-        return DXGI_FORMAT_D16_UNORM;
-      case GRAPHICS_FORMAT::kR16_UNORM:
-        return DXGI_FORMAT_R16_UNORM;
-      case GRAPHICS_FORMAT::kR16_UINT:
-        return DXGI_FORMAT_R16_UINT;
-      case GRAPHICS_FORMAT::kR16_SNORM:
-        return DXGI_FORMAT_R16_SNORM;
-      case GRAPHICS_FORMAT::kR16_SINT:
-        return DXGI_FORMAT_R16_SINT;
-      case GRAPHICS_FORMAT::kR8_TYPELESS:
-        return DXGI_FORMAT_R8_TYPELESS;
-      case GRAPHICS_FORMAT::kR8_UNORM:
-        return DXGI_FORMAT_R8_UNORM;
-      case GRAPHICS_FORMAT::kR8_UINT:
-        return DXGI_FORMAT_R8_UINT;
-      case GRAPHICS_FORMAT::kR8_SNORM:
-        return DXGI_FORMAT_R8_SNORM;
-      case GRAPHICS_FORMAT::kR8_SINT:
-        return DXGI_FORMAT_R8_SINT;
-      case GRAPHICS_FORMAT::kA8_UNORM:
-        return DXGI_FORMAT_A8_UNORM;
-      case GRAPHICS_FORMAT::kR1_UNORM:
-        return DXGI_FORMAT_R1_UNORM;
-      case GRAPHICS_FORMAT::kR9G9B9E5_SHAREDEXP:
-        return DXGI_FORMAT_R9G9B9E5_SHAREDEXP;
-      case GRAPHICS_FORMAT::kR8G8_B8G8_UNORM:
-        return DXGI_FORMAT_R8G8_B8G8_UNORM;
-      case GRAPHICS_FORMAT::kG8R8_G8B8_UNORM:
-        return DXGI_FORMAT_G8R8_G8B8_UNORM;
-      case GRAPHICS_FORMAT::kBC1_TYPELESS:
-        return DXGI_FORMAT_BC1_TYPELESS;
-      case GRAPHICS_FORMAT::kBC1_UNORM:
-        return DXGI_FORMAT_BC1_UNORM;
-      case GRAPHICS_FORMAT::kBC1_UNORM_SRGB:
-        return DXGI_FORMAT_BC1_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kBC2_TYPELESS:
-        return DXGI_FORMAT_BC2_TYPELESS;
-      case GRAPHICS_FORMAT::kBC2_UNORM:
-        return DXGI_FORMAT_BC2_UNORM;
-      case GRAPHICS_FORMAT::kBC2_UNORM_SRGB:
-        return DXGI_FORMAT_BC2_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kBC3_TYPELESS:
-        return DXGI_FORMAT_BC3_TYPELESS;
-      case GRAPHICS_FORMAT::kBC3_UNORM:
-        return DXGI_FORMAT_BC3_UNORM;
-      case GRAPHICS_FORMAT::kBC3_UNORM_SRGB:
-        return DXGI_FORMAT_BC3_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kBC4_TYPELESS:
-        return DXGI_FORMAT_BC4_TYPELESS;
-      case GRAPHICS_FORMAT::kBC4_UNORM:
-        return DXGI_FORMAT_BC4_UNORM;
-      case GRAPHICS_FORMAT::kBC4_SNORM:
-        return DXGI_FORMAT_BC4_SNORM;
-      case GRAPHICS_FORMAT::kBC5_TYPELESS:
-        return DXGI_FORMAT_BC5_TYPELESS;
-      case GRAPHICS_FORMAT::kBC5_UNORM:
-        return DXGI_FORMAT_BC5_UNORM;
-      case GRAPHICS_FORMAT::kBC5_SNORM:
-        return DXGI_FORMAT_BC5_SNORM;
-      case GRAPHICS_FORMAT::kB5G6R5_UNORM:
-        return DXGI_FORMAT_B5G6R5_UNORM;
-      case GRAPHICS_FORMAT::kB5G5R5A1_UNORM:
-        return DXGI_FORMAT_B5G5R5A1_UNORM;
-      case GRAPHICS_FORMAT::kB8G8R8A8_UNORM:
-        return DXGI_FORMAT_B8G8R8A8_UNORM;
-      case GRAPHICS_FORMAT::kB8G8R8X8_UNORM:
-        return DXGI_FORMAT_B8G8R8X8_UNORM;
-      case GRAPHICS_FORMAT::kR10G10B10_XR_BIAS_A2_UNORM:
-        return DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM;
-      case GRAPHICS_FORMAT::kB8G8R8A8_TYPELESS:
-        return DXGI_FORMAT_B8G8R8A8_TYPELESS;
-      case GRAPHICS_FORMAT::kB8G8R8A8_UNORM_SRGB:
-        return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kB8G8R8X8_TYPELESS:
-        return DXGI_FORMAT_B8G8R8X8_TYPELESS;
-      case GRAPHICS_FORMAT::kB8G8R8X8_UNORM_SRGB:
-        return DXGI_FORMAT_B8G8R8X8_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kBC6H_TYPELESS:
-        return DXGI_FORMAT_BC6H_TYPELESS;
-      case GRAPHICS_FORMAT::kBC6H_UF16:
-        return DXGI_FORMAT_BC6H_UF16;
-      case GRAPHICS_FORMAT::kBC6H_SF16:
-        return DXGI_FORMAT_BC6H_SF16;
-      case GRAPHICS_FORMAT::kBC7_TYPELESS:
-        return DXGI_FORMAT_BC7_TYPELESS;
-      case GRAPHICS_FORMAT::kBC7_UNORM:
-        return DXGI_FORMAT_BC7_UNORM;
-      case GRAPHICS_FORMAT::kBC7_UNORM_SRGB:
-        return DXGI_FORMAT_BC7_UNORM_SRGB;
-      case GRAPHICS_FORMAT::kAYUV:
-        return DXGI_FORMAT_AYUV;
-      case GRAPHICS_FORMAT::kY410:
-        return DXGI_FORMAT_Y410;
-      case GRAPHICS_FORMAT::kY416:
-        return DXGI_FORMAT_Y416;
-      case GRAPHICS_FORMAT::kNV12:
-        return DXGI_FORMAT_NV12;
-      case GRAPHICS_FORMAT::kP010:
-        return DXGI_FORMAT_P010;
-      case GRAPHICS_FORMAT::kP016:
-        return DXGI_FORMAT_P016;
-      case GRAPHICS_FORMAT::k420_OPAQUE:
-        return DXGI_FORMAT_420_OPAQUE;
-      case GRAPHICS_FORMAT::kYUY2:
-        return DXGI_FORMAT_YUY2;
-      case GRAPHICS_FORMAT::kY210:
-        return DXGI_FORMAT_Y210;
-      case GRAPHICS_FORMAT::kY216:
-        return DXGI_FORMAT_Y216;
-      case GRAPHICS_FORMAT::kNV11:
-        return DXGI_FORMAT_NV11;
-      case GRAPHICS_FORMAT::kAI44:
-        return DXGI_FORMAT_AI44;
-      case GRAPHICS_FORMAT::kIA44:
-        return DXGI_FORMAT_IA44;
-      case GRAPHICS_FORMAT::kP8:
-        return DXGI_FORMAT_P8;
-      case GRAPHICS_FORMAT::kA8P8:
-        return DXGI_FORMAT_A8P8;
-      case GRAPHICS_FORMAT::kB4G4R4A4_UNORM:
-        return DXGI_FORMAT_B4G4R4A4_UNORM;
-
-      case GRAPHICS_FORMAT::kP208:
-        return DXGI_FORMAT_P208;
-      case GRAPHICS_FORMAT::kV208:
-        return DXGI_FORMAT_V208;
-      case GRAPHICS_FORMAT::kV408:
-        return DXGI_FORMAT_V408;
-
-      case GRAPHICS_FORMAT::kSAMPLER_FEEDBACK_MIN_MIP_OPAQUE:
-        return DXGI_FORMAT_SAMPLER_FEEDBACK_MIN_MIP_OPAQUE;
-      case GRAPHICS_FORMAT::kSAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE:
-        return DXGI_FORMAT_SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE;
-      default:
-        return DXGI_FORMAT_UNKNOWN;
-      }
+      return getFormatInfo(static_cast<DXGI_FORMAT>(inFormat)).format;
     }
 
     String
     toString(const DXGI_FORMAT& format) {
-      switch (format) {
-      case DXGI_FORMAT_UNKNOWN:
-        return "UNKNOWN";
-      case DXGI_FORMAT_R32G32B32A32_TYPELESS:
-        return "R32G32B32A32_TYPELESS";
-      case DXGI_FORMAT_R32G32B32A32_FLOAT:
-        return "R32G32B32A32_FLOAT";
-      case DXGI_FORMAT_R32G32B32A32_UINT:
-        return "R32G32B32A32_UINT";
-      case DXGI_FORMAT_R32G32B32A32_SINT:
-        return "R32G32B32A32_SINT";
-      case DXGI_FORMAT_R32G32B32_TYPELESS:
-        return "R32G32B32_TYPELESS";
-      case DXGI_FORMAT_R32G32B32_FLOAT:
-        return "R32G32B32_FLOAT";
-      case DXGI_FORMAT_R32G32B32_UINT:
-        return "R32G32B32_UINT";
-      case DXGI_FORMAT_R32G32B32_SINT:
-        return "R32G32B32_SINT";
-      case DXGI_FORMAT_R16G16B16A16_TYPELESS:
-        return "R16G16B16A16_TYPELESS";
-      case DXGI_FORMAT_R16G16B16A16_FLOAT:
-        return "R16G16B16A16_FLOAT";
-      case DXGI_FORMAT_R16G16B16A16_UNORM:
-        return "R16G16B16A16_UNORM";
-      case DXGI_FORMAT_R16G16B16A16_UINT:
-        return "R16G16B16A16_UINT";
-      case DXGI_FORMAT_R16G16B16A16_SNORM:
-        return "R16G16B16A16_SNORM";
-      case DXGI_FORMAT_R16G16B16A16_SINT:
-        return "R16G16B16A16_SINT";
-      case DXGI_FORMAT_R32G32_TYPELESS:
-        return "R32G32_TYPELESS";
-      case DXGI_FORMAT_R32G32_FLOAT:
-        return "R32G32_FLOAT";
-      case DXGI_FORMAT_R32G32_UINT:
-        return "R32G32_UINT";
-      case DXGI_FORMAT_R32G32_SINT:
-        return "R32G32_SINT";
-      case DXGI_FORMAT_R32G8X24_TYPELESS:
-        return "R32G8X24_TYPELESS";
-      case DXGI_FORMAT_D32_FLOAT_S8X24_UINT:
-        return "D32_FLOAT_S8X24_UINT";
-      case DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS:
-        return "R32_FLOAT_X8X24_TYPELESS";
-      case DXGI_FORMAT_X32_TYPELESS_G8X24_UINT:
-        return "X32_TYPELESS_G8X24_UINT";
-      case DXGI_FORMAT_Y416:
-        return "Y416";
-      case DXGI_FORMAT_Y210:
-        return "Y210";
-      case DXGI_FORMAT_Y216:
-        return "Y216";
-      case DXGI_FORMAT_R10G10B10A2_TYPELESS:
-        return "R10G10B10A2_TYPELESS";
-      case DXGI_FORMAT_R10G10B10A2_UNORM:
-        return "R10G10B10A2_UNORM";
-      case DXGI_FORMAT_R10G10B10A2_UINT:
-        return "R10G10B10A2_UINT";
-      case DXGI_FORMAT_R11G11B10_FLOAT:
-        return "R11G11B10_FLOAT";
-      case DXGI_FORMAT_R8G8B8A8_TYPELESS:
-        return "R8G8B8A8_TYPELESS";
-      case DXGI_FORMAT_R8G8B8A8_UNORM:
-        return "R8G8B8A8_UNORM";
-      case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
-        return "R8G8B8A8_UNORM_SRGB";
-      case DXGI_FORMAT_R8G8B8A8_UINT:
-        return "R8G8B8A8_UINT";
-      case DXGI_FORMAT_R8G8B8A8_SNORM:
-        return "R8G8B8A8_SNORM";
-      case DXGI_FORMAT_R8G8B8A8_SINT:
-        return "R8G8B8A8_SINT";
-      case DXGI_FORMAT_R16G16_TYPELESS:
-        return "R16G16_TYPELESS";
-      case DXGI_FORMAT_R16G16_FLOAT:
-        return "R16G16_FLOAT";
-      case DXGI_FORMAT_R16G16_UNORM:
-        return "R16G16_UNORM";
-      case DXGI_FORMAT_R16G16_UINT:
-        return "R16G16_UINT";
-      case DXGI_FORMAT_R16G16_SNORM:
-        return "R16G16_SNORM";
-      case DXGI_FORMAT_R16G16_SINT:
-        return "R16G16_SINT";
-      case DXGI_FORMAT_R32_TYPELESS:
-        return "R32_TYPELESS";
-      case DXGI_FORMAT_D32_FLOAT:
-        return "D32_FLOAT";
-      case DXGI_FORMAT_R32_FLOAT:
-        return "R32_FLOAT";
-      case DXGI_FORMAT_R24G8_TYPELESS:
-        return "R24G8_TYPELESS";
-      case DXGI_FORMAT_D24_UNORM_S8_UINT:
-        return "D24_UNORM_S8_UINT";
-      case DXGI_FORMAT_R24_UNORM_X8_TYPELESS:
-        return "R24_UNORM_X8_TYPELESS";
-      case DXGI_FORMAT_X24_TYPELESS_G8_UINT:
-        return "X24_TYPELESS_G8_UINT";
-      case DXGI_FORMAT_R8G8_TYPELESS:
-        return "R8G8_TYPELESS";
-      case DXGI_FORMAT_R8G8_UNORM:
-        return "R8G8_UNORM";
-      case DXGI_FORMAT_R8G8_UINT:
-        return "R8G8_UINT";
-      case DXGI_FORMAT_R8G8_SNORM:
-        return "R8G8_SNORM";
-      case DXGI_FORMAT_R8G8_SINT:
-        return "R8G8_SINT";
-      case DXGI_FORMAT_R16_TYPELESS:
-        return "R16_TYPELESS";
-      case DXGI_FORMAT_R16_FLOAT:
-        return "R16_FLOAT";
-      case DXGI_FORMAT_D16_UNORM:
-        return "D16_UNORM";
-      case DXGI_FORMAT_R16_UNORM:
-        return "R16_UNORM";
-      case DXGI_FORMAT_R16_UINT:
-        return "R16_UINT";
-      case DXGI_FORMAT_R16_SNORM:
-        return "R16_SNORM";
-      case DXGI_FORMAT_R16_SINT:
-        return "R16_SINT";
-      case DXGI_FORMAT_R8_TYPELESS:
-        return "R8_TYPELESS";
-      case DXGI_FORMAT_R8_UNORM:
-        return "R8_UNORM";
-      case DXGI_FORMAT_R8_UINT:
-        return "R8_UINT";
-      case DXGI_FORMAT_R8_SNORM:
-        return "R8_SNORM";
-      case DXGI_FORMAT_R8_SINT:
-        return "R8_SINT";
-      case DXGI_FORMAT_A8_UNORM:
-        return "A8_UNORM";
-      case DXGI_FORMAT_R1_UNORM:
-        return "R1_UNORM";
-      case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
-        return "R9G9B9E5_SHAREDEXP";
-      case DXGI_FORMAT_R8G8_B8G8_UNORM:
-        return "R8G8_B8G8_UNORM";
-      case DXGI_FORMAT_G8R8_G8B8_UNORM:
-        return "G8R8_G8B8_UNORM";
-      case DXGI_FORMAT_BC1_TYPELESS:
-        return "BC1_TYPELESS";
-      case DXGI_FORMAT_BC1_UNORM:
-        return "BC1_UNORM";
-      case DXGI_FORMAT_BC1_UNORM_SRGB:
-        return "BC1_UNORM_SRGB";
-      case DXGI_FORMAT_BC2_TYPELESS:
-        return "BC2_TYPELESS";
-      case DXGI_FORMAT_BC2_UNORM:
-        return "BC2_UNORM";
-      case DXGI_FORMAT_BC2_UNORM_SRGB:
-        return "BC2_UNORM_SRGB";
-      case DXGI_FORMAT_BC3_TYPELESS:
-        return "BC3_TYPELESS";
-      case DXGI_FORMAT_BC3_UNORM:
-        return "BC3_UNORM";
-      case DXGI_FORMAT_BC3_UNORM_SRGB:
-        return "BC3_UNORM_SRGB";
-      case DXGI_FORMAT_BC4_TYPELESS:
-        return "BC4_TYPELESS";
-      case DXGI_FORMAT_BC4_UNORM:
-        return "BC4_UNORM";
-      case DXGI_FORMAT_BC4_SNORM:
-        return "BC4_SNORM";
-      case DXGI_FORMAT_BC5_TYPELESS:
-        return "BC5_TYPELESS";
-      case DXGI_FORMAT_BC5_UNORM:
-        return "BC5_UNORM";
-      case DXGI_FORMAT_BC5_SNORM:
-        return "BC5_SNORM";
-      case DXGI_FORMAT_B5G6R5_UNORM:
-        return "B5G6R5_UNORM";
-      case DXGI_FORMAT_B5G5R5A1_UNORM:
-        return "B5G5R5A1_UNORM";
-      case DXGI_FORMAT_B8G8R8A8_UNORM:
-        return "B8G8R8A8_UNORM";
-      case DXGI_FORMAT_B8G8R8X8_UNORM:
-        return "B8G8R8X8_UNORM";
-      case DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM:
-        return "R10G10B10_XR_BIAS_A2_UNORM";
-      case DXGI_FORMAT_B8G8R8A8_TYPELESS:
-        return "B8G8R8A8_TYPELESS";
-      case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
-        return "B8G8R8A8_UNORM_SRGB";
-      case DXGI_FORMAT_B8G8R8X8_TYPELESS:
-        return "B8G8R8X8_TYPELESS";
-      case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
-        return "B8G8R8X8_UNORM_SRGB";
-      case DXGI_FORMAT_BC6H_TYPELESS:
-        return "BC6H_TYPELESS";
-      case DXGI_FORMAT_BC6H_UF16:
-        return "BC6H_UF16";
-      case DXGI_FORMAT_BC6H_SF16:
-        return "BC6H_SF16";
-      case DXGI_FORMAT_BC7_TYPELESS:
-        return "BC7_TYPELESS";
-      case DXGI_FORMAT_BC7_UNORM:
-        return "BC7_UNORM";
-      case DXGI_FORMAT_BC7_UNORM_SRGB:
-        return "BC7_UNORM_SRGB";
-      case DXGI_FORMAT_AYUV:
-        return "AYUV";
-      case DXGI_FORMAT_Y410:
-        return "Y410";
-      case DXGI_FORMAT_NV12:
-        return "NV12";
-      case DXGI_FORMAT_P010:
-        return "P010";
-      case DXGI_FORMAT_P016:
-        return "P016";
-      case DXGI_FORMAT_420_OPAQUE:
-        return "420_OPAQUE";
-      case DXGI_FORMAT_YUY2:
-        return "YUY2";
-      case DXGI_FORMAT_NV11:
-        return "NV11";
-      case DXGI_FORMAT_AI44:
-        return "AI44";
-      case DXGI_FORMAT_IA44:
-        return "IA44";
-      case DXGI_FORMAT_P8:
-        return "P8";
-      case DXGI_FORMAT_A8P8:
-        return "A8P8";
-      case DXGI_FORMAT_B4G4R4A4_UNORM:
-        return "B4G4R4A4_UNORM";
-      case DXGI_FORMAT_P208:
-        return "P208";
-      case DXGI_FORMAT_V208:
-        return "V208";
-      case DXGI_FORMAT_V408:
-        return "V408";
-      case DXGI_FORMAT_FORCE_UINT:
+      if (DXGI_FORMAT_FORCE_UINT == format) {
         return "FORCE_UINT";
-      default:break;
       }
 
-      return "Unknown DXGI_FORMAT";
+      const FormatInfo& info = getFormatInfo(format);
+      if (DXGI_FORMAT_UNKNOWN == info.format && DXGI_FORMAT_UNKNOWN != format) {
+        return "Unknown DXGI_FORMAT";
+      }
+      return info.name;
     }
 
     DXGI_FORMAT
     fromString(const String& strFormat) {
-      if (strFormat == "UNKNOWN") return DXGI_FORMAT_UNKNOWN;
-
-      if (strFormat == "R32G32B32A32_TYPELESS") return DXGI_FORMAT_R32G32B32A32_TYPELESS;
-      if (strFormat == "R32G32B32A32_FLOAT") return DXGI_FORMAT_R32G32B32A32_FLOAT;
-      if (strFormat == "R32G32B32A32_UINT") return DXGI_FORMAT_R32G32B32A32_UINT;
-      if (strFormat == "R32G32B32A32_SINT") return DXGI_FORMAT_R32G32B32A32_SINT;
-
-      if (strFormat == "R32G32B32_TYPELESS") return DXGI_FORMAT_R32G32B32_TYPELESS;
-      if (strFormat == "R32G32B32_FLOAT") return DXGI_FORMAT_R32G32B32_FLOAT;
-      if (strFormat == "R32G32B32_UINT") return DXGI_FORMAT_R32G32B32_UINT;
-      if (strFormat == "R32G32B32_SINT") return DXGI_FORMAT_R32G32B32_SINT;
-
-      if (strFormat == "R16G16B16A16_TYPELESS") return DXGI_FORMAT_R16G16B16A16_TYPELESS;
-      if (strFormat == "R16G16B16A16_FLOAT") return DXGI_FORMAT_R16G16B16A16_FLOAT;
-      if (strFormat == "R16G16B16A16_UNORM") return DXGI_FORMAT_R16G16B16A16_UNORM;
-      if (strFormat == "R16G16B16A16_UINT") return DXGI_FORMAT_R16G16B16A16_UINT;
-      if (strFormat == "R16G16B16A16_SNORM") return DXGI_FORMAT_R16G16B16A16_SNORM;
-      if (strFormat == "R16G16B16A16_SINT") return DXGI_FORMAT_R16G16B16A16_SINT;
-
-      if (strFormat == "R32G32_TYPELESS") return DXGI_FORMAT_R32G32_TYPELESS;
-      if (strFormat == "R32G32_FLOAT") return DXGI_FORMAT_R32G32_FLOAT;
-      if (strFormat == "R32G32_UINT") return DXGI_FORMAT_R32G32_UINT;
-      if (strFormat == "R32G32_SINT") return DXGI_FORMAT_R32G32_SINT;
-      
-      if (strFormat == "R32G8X24_TYPELESS") return DXGI_FORMAT_R32G8X24_TYPELESS;
-      if (strFormat == "D32_FLOAT_S8X24_UINT") return DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
-      if (strFormat == "R32_FLOAT_X8X24_TYPELESS") return DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS;
-      if (strFormat == "X32_TYPELESS_G8X24_UINT") return DXGI_FORMAT_X32_TYPELESS_G8X24_UINT;
-
-      if (strFormat == "Y416") return DXGI_FORMAT_Y416;
-      if (strFormat == "Y210") return DXGI_FORMAT_Y210;
-      if (strFormat == "Y216") return DXGI_FORMAT_Y216;
-
-      if (strFormat == "R10G10B10A2_TYPELESS") return DXGI_FORMAT_R10G10B10A2_TYPELESS;
-      if (strFormat == "R10G10B10A2_UNORM") return DXGI_FORMAT_R10G10B10A2_UNORM;
-      if (strFormat == "R10G10B10A2_UINT") return DXGI_FORMAT_R10G10B10A2_UINT;
-      if (strFormat == "R11G11B10_FLOAT") return DXGI_FORMAT_R11G11B10_FLOAT;
-
-      if (strFormat == "R8G8B8A8_TYPELESS") return DXGI_FORMAT_R8G8B8A8_TYPELESS;
-      if (strFormat == "R8G8B8A8_UNORM") return DXGI_FORMAT_R8G8B8A8_UNORM;
-      if (strFormat == "R8G8B8A8_UNORM_SRGB") return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-      if (strFormat == "R8G8B8A8_UINT") return DXGI_FORMAT_R8G8B8A8_UINT;
-      if (strFormat == "R8G8B8A8_SNORM") return DXGI_FORMAT_R8G8B8A8_SNORM;
-      if (strFormat == "R8G8B8A8_SINT") return DXGI_FORMAT_R8G8B8A8_SINT;
-
-      if (strFormat == "R16G16_TYPELESS") return DXGI_FORMAT_R16G16_TYPELESS;
-      if (strFormat == "R16G16_FLOAT") return DXGI_FORMAT_R16G16_FLOAT;
-      if (strFormat == "R16G16_UNORM") return DXGI_FORMAT_R16G16_UNORM;
-      if (strFormat == "R16G16_UINT") return DXGI_FORMAT_R16G16_UINT;
-      if (strFormat == "R16G16_SNORM") return DXGI_FORMAT_R16G16_SNORM;
-      if (strFormat == "R16G16_SINT") return DXGI_FORMAT_R16G16_SINT;
-
-      if (strFormat == "R32_TYPELESS") return DXGI_FORMAT_R32_TYPELESS;
-      if (strFormat == "D32_FLOAT") return DXGI_FORMAT_D32_FLOAT;
-      if (strFormat == "R32_FLOAT") return DXGI_FORMAT_R32_FLOAT;
-
-      if (strFormat == "R24G8_TYPELESS") return DXGI_FORMAT_R24G8_TYPELESS;
-      if (strFormat == "D24_UNORM_S8_UINT") return DXGI_FORMAT_D24_UNORM_S8_UINT;
-      if (strFormat == "R24_UNORM_X8_TYPELESS") return DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-      if (strFormat == "X24_TYPELESS_G8_UINT") return DXGI_FORMAT_X24_TYPELESS_G8_UINT;
-
-      if (strFormat == "R8G8_TYPELESS") return DXGI_FORMAT_R8G8_TYPELESS;
-      if (strFormat == "R8G8_UNORM") return DXGI_FORMAT_R8G8_UNORM;
-      if (strFormat == "R8G8_UINT") return DXGI_FORMAT_R8G8_UINT;
-      if (strFormat == "R8G8_SNORM") return DXGI_FORMAT_R8G8_SNORM;
-      if (strFormat == "R8G8_SINT") return DXGI_FORMAT_R8G8_SINT;
-
-      if (strFormat == "R16_TYPELESS") return DXGI_FORMAT_R16_TYPELESS;
-      if (strFormat == "R16_FLOAT") return DXGI_FORMAT_R16_FLOAT;
-      if (strFormat == "D16_UNORM") return DXGI_FORMAT_D16_UNORM;
-      if (strFormat == "R16_UNORM") return DXGI_FORMAT_R16_UNORM;
-      if (strFormat == "R16_UINT") return DXGI_FORMAT_R16_UINT;
-      if (strFormat == "R16_SNORM") return DXGI_FORMAT_R16_SNORM;
-      if (strFormat == "R16_SINT") return DXGI_FORMAT_R16_SINT;
-
-      if (strFormat == "R8_TYPELESS") return DXGI_FORMAT_R8_TYPELESS;
-      if (strFormat == "R8_UNORM") return DXGI_FORMAT_R8_UNORM;
-      if (strFormat == "R8_UINT") return DXGI_FORMAT_R8_UINT;
-      if (strFormat == "R8_SNORM") return DXGI_FORMAT_R8_SNORM;
-      if (strFormat == "R8_SINT") return DXGI_FORMAT_R8_SINT;
-      if (strFormat == "A8_UNORM") return DXGI_FORMAT_A8_UNORM;
-      if (strFormat == "R1_UNORM") return DXGI_FORMAT_R1_UNORM;
-
-      if (strFormat == "R9G9B9E5_SHAREDEXP") return DXGI_FORMAT_R9G9B9E5_SHAREDEXP;
-      if (strFormat == "R8G8_B8G8_UNORM") return DXGI_FORMAT_R8G8_B8G8_UNORM;
-      if (strFormat == "G8R8_G8B8_UNORM") return DXGI_FORMAT_G8R8_G8B8_UNORM;
-
-      if (strFormat == "BC1_TYPELESS") return DXGI_FORMAT_BC1_TYPELESS;
-      if (strFormat == "BC1_UNORM") return DXGI_FORMAT_BC1_UNORM;
-      if (strFormat == "BC1_UNORM_SRGB") return DXGI_FORMAT_BC1_UNORM_SRGB;
-      if (strFormat == "BC2_TYPELESS") return DXGI_FORMAT_BC2_TYPELESS;
-      if (strFormat == "BC2_UNORM") return DXGI_FORMAT_BC2_UNORM;
-      if (strFormat == "BC2_UNORM_SRGB") return DXGI_FORMAT_BC2_UNORM_SRGB;
-      if (strFormat == "BC3_TYPELESS") return DXGI_FORMAT_BC3_TYPELESS;
-      if (strFormat == "BC3_UNORM") return DXGI_FORMAT_BC3_UNORM;
-      if (strFormat == "BC3_UNORM_SRGB") return DXGI_FORMAT_BC3_UNORM_SRGB;
-      if (strFormat == "BC4_TYPELESS") return DXGI_FORMAT_BC4_TYPELESS;
-      if (strFormat == "BC4_UNORM") return DXGI_FORMAT_BC4_UNORM;
-      if (strFormat == "BC4_SNORM") return DXGI_FORMAT_BC4_SNORM;
-      if (strFormat == "BC5_TYPELESS") return DXGI_FORMAT_BC5_TYPELESS;
-      if (strFormat == "BC5_UNORM") return DXGI_FORMAT_BC5_UNORM;
-      if (strFormat == "BC5_SNORM") return DXGI_FORMAT_BC5_SNORM;
-
-      if (strFormat == "B5G6R5_UNORM") return DXGI_FORMAT_B5G6R5_UNORM;
-      if (strFormat == "B5G5R5A1_UNORM") return DXGI_FORMAT_B5G5R5A1_UNORM;
-      if (strFormat == "B8G8R8A8_UNORM") return DXGI_FORMAT_B8G8R8A8_UNORM;
-      if (strFormat == "B8G8R8X8_UNORM") return DXGI_FORMAT_B8G8R8X8_UNORM;
-      if (strFormat == "R10G10B10_XR_BIAS_A2_UNORM")
-        return DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM;
-
-      if (strFormat == "B8G8R8A8_TYPELESS") return DXGI_FORMAT_B8G8R8A8_TYPELESS;
-      if (strFormat == "B8G8R8A8_UNORM_SRGB") return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
-      if (strFormat == "B8G8R8X8_TYPELESS") return DXGI_FORMAT_B8G8R8X8_TYPELESS;
-      if (strFormat == "B8G8R8X8_UNORM_SRGB") return DXGI_FORMAT_B8G8R8X8_UNORM_SRGB;
-
-      if (strFormat == "BC6H_TYPELESS") return DXGI_FORMAT_BC6H_TYPELESS;
-      if (strFormat == "BC6H_UF16") return DXGI_FORMAT_BC6H_UF16;
-      if (strFormat == "BC6H_SF16") return DXGI_FORMAT_BC6H_SF16;
-
-      if (strFormat == "BC7_TYPELESS") return DXGI_FORMAT_BC7_TYPELESS;
-      if (strFormat == "BC7_UNORM") return DXGI_FORMAT_BC7_UNORM;
-      if (strFormat == "BC7_UNORM_SRGB") return DXGI_FORMAT_BC7_UNORM_SRGB;
-
-      if (strFormat == "AYUV") return DXGI_FORMAT_AYUV;
-      if (strFormat == "Y410") return DXGI_FORMAT_Y410;
-      if (strFormat == "NV12") return DXGI_FORMAT_NV12;
-      if (strFormat == "P010") return DXGI_FORMAT_P010;
-      if (strFormat == "P016") return DXGI_FORMAT_P016;
-      if (strFormat == "420_OPAQUE") return DXGI_FORMAT_420_OPAQUE;
-      if (strFormat == "YUY2") return DXGI_FORMAT_YUY2;
-      if (strFormat == "NV11") return DXGI_FORMAT_NV11;
-      if (strFormat == "AI44") return DXGI_FORMAT_AI44;
-      if (strFormat == "IA44") return DXGI_FORMAT_IA44;
-      if (strFormat == "P8") return DXGI_FORMAT_P8;
-      if (strFormat == "A8P8") return DXGI_FORMAT_A8P8;
-      if (strFormat == "B4G4R4A4_UNORM") return DXGI_FORMAT_B4G4R4A4_UNORM;
-      if (strFormat == "P208") return DXGI_FORMAT_P208;
-      if (strFormat == "V208") return DXGI_FORMAT_V208;
-      if (strFormat == "V408") return DXGI_FORMAT_V408;
-      if (strFormat == "FORCE_UINT") return DXGI_FORMAT_FORCE_UINT;
+      uint32 slot = hashName(strFormat.data(), strFormat.size()) & (FORMAT_NAME_SLOTS - 1);
+      for (; s_formatNameIndex.slots[slot]; slot = (slot + 1) & (FORMAT_NAME_SLOTS - 1)) {
+        const FormatInfo& info = s_formatTable[s_formatNameIndex.slots[slot] - 1];
+        if (strFormat == info.name) {
+          return info.format;
+        }
+      }
 
+      if (strFormat == "FORCE_UINT") {
+        return DXGI_FORMAT_FORCE_UINT;
+      }
       return DXGI_FORMAT_UNKNOWN;
     }
 
@@ -653,152 +588,15 @@ namespace geEngineSDK {
 
     SIZE_T
     getBitsPerPixel(const DXGI_FORMAT& format) {
-      switch (format) {
-      case DXGI_FORMAT_R32G32B32A32_TYPELESS:
-      case DXGI_FORMAT_R32G32B32A32_FLOAT:
-      case DXGI_FORMAT_R32G32B32A32_UINT:
-      case DXGI_FORMAT_R32G32B32A32_SINT:
-        return 128;
-
-      case DXGI_FORMAT_R32G32B32_TYPELESS:
-      case DXGI_FORMAT_R32G32B32_FLOAT:
-      case DXGI_FORMAT_R32G32B32_UINT:
-      case DXGI_FORMAT_R32G32B32_SINT:
-        return 96;
-
-      case DXGI_FORMAT_R16G16B16A16_TYPELESS:
-      case DXGI_FORMAT_R16G16B16A16_FLOAT:
-      case DXGI_FORMAT_R16G16B16A16_UNORM:
-      case DXGI_FORMAT_R16G16B16A16_UINT:
-      case DXGI_FORMAT_R16G16B16A16_SNORM:
-      case DXGI_FORMAT_R16G16B16A16_SINT:
-      case DXGI_FORMAT_R32G32_TYPELESS:
-      case DXGI_FORMAT_R32G32_FLOAT:
-      case DXGI_FORMAT_R32G32_UINT:
-      case DXGI_FORMAT_R32G32_SINT:
-      case DXGI_FORMAT_R32G8X24_TYPELESS:
-      case DXGI_FORMAT_D32_FLOAT_S8X24_UINT:
-      case DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS:
-      case DXGI_FORMAT_X32_TYPELESS_G8X24_UINT:
-      case DXGI_FORMAT_Y416:
-      case DXGI_FORMAT_Y210:
-      case DXGI_FORMAT_Y216:
-        return 64;
-
-      case DXGI_FORMAT_R10G10B10A2_TYPELESS:
-      case DXGI_FORMAT_R10G10B10A2_UNORM:
-      case DXGI_FORMAT_R10G10B10A2_UINT:
-      case DXGI_FORMAT_R11G11B10_FLOAT:
-      case DXGI_FORMAT_R8G8B8A8_TYPELESS:
-      case DXGI_FORMAT_R8G8B8A8_UNORM:
-      case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
-      case DXGI_FORMAT_R8G8B8A8_UINT:
-      case DXGI_FORMAT_R8G8B8A8_SNORM:
-      case DXGI_FORMAT_R8G8B8A8_SINT:
-      case DXGI_FORMAT_R16G16_TYPELESS:
-      case DXGI_FORMAT_R16G16_FLOAT:
-      case DXGI_FORMAT_R16G16_UNORM:
-      case DXGI_FORMAT_R16G16_UINT:
-      case DXGI_FORMAT_R16G16_SNORM:
-      case DXGI_FORMAT_R16G16_SINT:
-      case DXGI_FORMAT_R32_TYPELESS:
-      case DXGI_FORMAT_D32_FLOAT:
-      case DXGI_FORMAT_R32_FLOAT:
-      case DXGI_FORMAT_R32_UINT:
-      case DXGI_FORMAT_R32_SINT:
-      case DXGI_FORMAT_R24G8_TYPELESS:
-      case DXGI_FORMAT_D24_UNORM_S8_UINT:
-      case DXGI_FORMAT_R24_UNORM_X8_TYPELESS:
-      case DXGI_FORMAT_X24_TYPELESS_G8_UINT:
-      case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
-      case DXGI_FORMAT_R8G8_B8G8_UNORM:
-      case DXGI_FORMAT_G8R8_G8B8_UNORM:
-      case DXGI_FORMAT_B8G8R8A8_UNORM:
-      case DXGI_FORMAT_B8G8R8X8_UNORM:
-      case DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM:
-      case DXGI_FORMAT_B8G8R8A8_TYPELESS:
-      case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
-      case DXGI_FORMAT_B8G8R8X8_TYPELESS:
-      case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
-      case DXGI_FORMAT_AYUV:
-      case DXGI_FORMAT_Y410:
-      case DXGI_FORMAT_YUY2:
-      case DXGI_FORMAT_NV12:
-      case DXGI_FORMAT_P010:
-      case DXGI_FORMAT_P016:
-      case DXGI_FORMAT_420_OPAQUE:
-      case DXGI_FORMAT_NV11:
-      case DXGI_FORMAT_FORCE_UINT:
-      case DXGI_FORMAT_SAMPLER_FEEDBACK_MIN_MIP_OPAQUE:
-      case DXGI_FORMAT_SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE:
+      if (DXGI_FORMAT_FORCE_UINT == format) {
         return 32;
-
-      case DXGI_FORMAT_R8G8_TYPELESS:
-      case DXGI_FORMAT_R8G8_UNORM:
-      case DXGI_FORMAT_R8G8_UINT:
-      case DXGI_FORMAT_R8G8_SNORM:
-      case DXGI_FORMAT_R8G8_SINT:
-      case DXGI_FORMAT_R16_TYPELESS:
-      case DXGI_FORMAT_R16_FLOAT:
-      case DXGI_FORMAT_D16_UNORM:
-      case DXGI_FORMAT_R16_UNORM:
-      case DXGI_FORMAT_R16_UINT:
-      case DXGI_FORMAT_R16_SNORM:
-      case DXGI_FORMAT_R16_SINT:
-      case DXGI_FORMAT_B5G6R5_UNORM:
-      case DXGI_FORMAT_B5G5R5A1_UNORM:
-      case DXGI_FORMAT_A8P8:
-      case DXGI_FORMAT_B4G4R4A4_UNORM:
-      case DXGI_FORMAT_A4B4G4R4_UNORM:
-      case DXGI_FORMAT_P208:
-      case DXGI_FORMAT_V208:
-      case DXGI_FORMAT_V408:
-        return 16;
-
-      case DXGI_FORMAT_R8_TYPELESS:
-      case DXGI_FORMAT_R8_UNORM:
-      case DXGI_FORMAT_R8_UINT:
-      case DXGI_FORMAT_R8_SNORM:
-      case DXGI_FORMAT_R8_SINT:
-      case DXGI_FORMAT_A8_UNORM:
-      case DXGI_FORMAT_AI44:
-      case DXGI_FORMAT_IA44:
-      case DXGI_FORMAT_P8:
-        return 8;
-
-      case DXGI_FORMAT_R1_UNORM:
-        return 1;
-
-      case DXGI_FORMAT_BC1_TYPELESS:
-      case DXGI_FORMAT_BC1_UNORM:
-      case DXGI_FORMAT_BC1_UNORM_SRGB:
-      case DXGI_FORMAT_BC4_TYPELESS:
-      case DXGI_FORMAT_BC4_UNORM:
-      case DXGI_FORMAT_BC4_SNORM:
-        return 4;
-
-      case DXGI_FORMAT_BC2_TYPELESS:
-      case DXGI_FORMAT_BC2_UNORM:
-      case DXGI_FORMAT_BC2_UNORM_SRGB:
-      case DXGI_FORMAT_BC3_TYPELESS:
-      case DXGI_FORMAT_BC3_UNORM:
-      case DXGI_FORMAT_BC3_UNORM_SRGB:
-      case DXGI_FORMAT_BC5_TYPELESS:
-      case DXGI_FORMAT_BC5_UNORM:
-      case DXGI_FORMAT_BC5_SNORM:
-      case DXGI_FORMAT_BC6H_TYPELESS:
-      case DXGI_FORMAT_BC6H_UF16:
-      case DXGI_FORMAT_BC6H_SF16:
-      case DXGI_FORMAT_BC7_TYPELESS:
-      case DXGI_FORMAT_BC7_UNORM:
-      case DXGI_FORMAT_BC7_UNORM_SRGB:
-        return 8;
-
-      case DXGI_FORMAT_UNKNOWN:
-        return 0;
       }
+      return getFormatInfo(format).bitsPerPixel;
+    }
 
-      return 0;
+    bool
+    isBlockCompressed(const DXGI_FORMAT& format) {
+      return getFormatInfo(format).hasFlag(FORMAT_FLAG::kCompressed);
     }
 
     DXGI_FORMAT
@@ -857,27 +655,37 @@ namespace geEngineSDK {
     }
 
     VERTEX_ELEMENT_SEMANTIC::E
-    get(const char* sem) {
-      if (strcmp(sem, "BLENDINDICES") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::BLENDINDICES;
-      if (strcmp(sem, "BLENDWEIGHT") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::BLENDWEIGHT;
-      if (strcmp(sem, "COLOR") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::COLOR;
-      if (strcmp(sem, "NORMAL") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::NORMAL;
-      if (strcmp(sem, "POSITION") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::POSITION;
-      if (strcmp(sem, "TEXCOORD") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::TEXCOORD;
-      if (strcmp(sem, "BINORMAL") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::BITANGENT;
-      if (strcmp(sem, "TANGENT") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::TANGENT;
-      if (strcmp(sem, "POSITIONT") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::POSITIONT;
-      if (strcmp(sem, "PSIZE") == 0)
-        return VERTEX_ELEMENT_SEMANTIC::PSIZE;
+    get(const char* sem, uint32* pSemanticIndex) {
+      //"TEXCOORD3" is TEXCOORD with index 3. Only the letters are hashed,
+      //a name with digits in the middle is rejected by the comparison
+      uint32 hash = 2166136261U;
+      SIZE_T nameEnd = 0;
+      uint32 index = 0;
+      for (SIZE_T i = 0; sem[i]; ++i) {
+        char c = sem[i];
+        if (c >= '0' && c <= '9') {
+          index = index * 10 + static_cast<uint32>(c - '0');
+          continue;
+        }
+
+        if (c >= 'a' && c <= 'z') {
+          c = static_cast<char>(c - ('a' - 'A'));
+        }
+        hash = (hash ^ static_cast<uint8>(c)) * 16777619U;
+        nameEnd = i + 1;
+        index = 0;
+      }
+      if (pSemanticIndex) {
+        *pSemanticIndex = index;
+      }
+
+      uint32 slot = hash & (SEMANTIC_NAME_SLOTS - 1);
+      for (; s_semanticNameIndex.slots[slot]; slot = (slot + 1) & (SEMANTIC_NAME_SLOTS - 1)) {
+        const SemanticName& entry = s_semanticNames[s_semanticNameIndex.slots[slot] - 1];
+        if (isSemanticName(sem, nameEnd, entry.name)) {
+          return entry.semantic;
+        }
+      }
 
       // Unsupported type
       return VERTEX_ELEMENT_SEMANTIC::POSITION;
@@ -0,0 +1,373 @@
+/*****************************************************************************/
+/**
+ * @file    DXUploadScheduler.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Spreads texture and buffer uploads over several frames.
+ *
+ * Spreads texture and buffer uploads over several frames.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "DXUploadScheduler.h"
+#include "DXMemoryTracker.h"
+#include "DXTexture.h"
+#include "DXTranslateUtils.h"
+
+#include <geDebug.h>
+#include <geMath.h>
+#include <algorithm>
+#include <limits>
+
+namespace geEngineSDK {
+
+  namespace {
+    //Limits the size of the staging textures so they can be recycled
+    constexpr uint32 MAX_CHUNK_ROWS = 256;
+
+    //Staging resources not used for this long are released
+    constexpr uint64 STAGING_FRAMES_TO_KEEP = 120;
+
+    uint32
+    nextPowerOfTwo(uint32 value) {
+      uint32 result = 1;
+      while (result < value) {
+        result <<= 1;
+      }
+      return result;
+    }
+  }
+
+  void
+  DXUploadScheduler::init(D3DDevice* pDevice, D3DDeviceContext* pContext) {
+    GE_ASSERT(pDevice && pContext);
+    GE_ASSERT(m_maxStagingSlots > 0);
+    release();
+
+    m_pDevice = pDevice;
+    m_pContext = pContext;
+    m_pDevice->AddRef();
+    m_pContext->AddRef();
+  }
+
+  void
+  DXUploadScheduler::release() {
+    for (auto& upload : m_uploads) {
+      safeRelease(upload.pDst);
+    }
+    m_uploads.clear();
+    m_pendingBytes = 0;
+
+    for (auto& slot : m_staging) {
+      DXMemoryTracker::onReleased(slot.pResource);
+      safeRelease(slot.pResource);
+    }
+    m_staging.clear();
+
+    safeRelease(m_pContext);
+    safeRelease(m_pDevice);
+  }
+
+  UploadToken
+  DXUploadScheduler::enqueue(ID3D11Resource* pDst,
+                             uint32 dstSubRes,
+                             const D3D11_BOX* pDstBox,
+                             const void* pSrcData,
+                             uint32 srcRowPitch) {
+    GE_ASSERT(m_pDevice && m_pContext);
+    if (!pDst || !pSrcData) {
+      return INVALID_UPLOAD_TOKEN;
+    }
+
+    Upload upload;
+    upload.dstSubRes = dstSubRes;
+    pDst->GetType(&upload.dimension);
+
+    if (D3D11_RESOURCE_DIMENSION_TEXTURE2D == upload.dimension) {
+      D3D11_TEXTURE2D_DESC tDesc;
+      static_cast<ID3D11Texture2D*>(pDst)->GetDesc(&tDesc);
+
+      uint32 mipLevel = dstSubRes % tDesc.MipLevels;
+      if (pDstBox) {
+        upload.box = *pDstBox;
+      }
+      else {
+        upload.box.left = 0;
+        upload.box.top = 0;
+        upload.box.front = 0;
+        upload.box.right = Math::max(1U, tDesc.Width >> mipLevel);
+        upload.box.bottom = Math::max(1U, tDesc.Height >> mipLevel);
+        upload.box.back = 1;
+      }
+
+      upload.format = tDesc.Format;
+      const auto& formatInfo = TranslateUtils::getFormatInfo(tDesc.Format);
+      upload.blockWidth = Math::max(1U, formatInfo.blockWidth);
+      upload.blockHeight = Math::max(1U, formatInfo.blockHeight);
+
+      uint32 width = upload.box.right - upload.box.left;
+      uint32 height = upload.box.bottom - upload.box.top;
+      upload.rowBytes = static_cast<uint32>(TranslateUtils::getRowPitch(tDesc.Format, width));
+      upload.numRows = TranslateUtils::getNumRows(tDesc.Format, height);
+      GE_ASSERT(srcRowPitch >= upload.rowBytes);
+
+      //Pack the rows so chunks can be copied without the caller's pitch
+      upload.data.resize(static_cast<SIZE_T>(upload.rowBytes) * upload.numRows);
+      auto pSrc = static_cast<const uint8*>(pSrcData);
+      for (uint32 row = 0; row < upload.numRows; ++row) {
+        memcpy(&upload.data[static_cast<SIZE_T>(row) * upload.rowBytes],
+               pSrc + static_cast<SIZE_T>(row) * srcRowPitch,
+               upload.rowBytes);
+      }
+    }
+    else if (D3D11_RESOURCE_DIMENSION_BUFFER == upload.dimension) {
+      D3D11_BUFFER_DESC bDesc;
+      static_cast<ID3D11Buffer*>(pDst)->GetDesc(&bDesc);
+
+      upload.box.left = pDstBox ? pDstBox->left : 0;
+      upload.box.right = pDstBox ? pDstBox->right : bDesc.ByteWidth;
+      upload.box.top = 0;
+      upload.box.bottom = 1;
+      upload.box.front = 0;
+      upload.box.back = 1;
+      GE_ASSERT(upload.box.right <= bDesc.ByteWidth);
+
+      upload.rowBytes = 1;
+      upload.numRows = 1;
+
+      auto pSrc = static_cast<const uint8*>(pSrcData);
+      upload.data.assign(pSrc, pSrc + (upload.box.right - upload.box.left));
+    }
+    else {
+      GE_LOG(kError, RenderAPI, "Unsupported resource type for a scheduled upload.");
+      return INVALID_UPLOAD_TOKEN;
+    }
+
+    upload.pDst = pDst;
+    upload.pDst->AddRef();
+    upload.token = m_nextToken++;
+    m_pendingBytes += upload.data.size();
+
+    m_uploads.push_back(std::move(upload));
+    return m_uploads.back().token;
+  }
+
+  void
+  DXUploadScheduler::update() {
+    ++m_frameIndex;
+    _issueUploads(m_bytesPerFrame);
+
+    uint64 frameIndex = m_frameIndex;
+    auto itEnd = std::remove_if(m_staging.begin(), m_staging.end(),
+                   [frameIndex](StagingSlot& slot) {
+                     if (frameIndex - slot.lastUsedFrame <= STAGING_FRAMES_TO_KEEP) {
+                       return false;
+                     }
+                     DXMemoryTracker::onReleased(slot.pResource);
+                     safeRelease(slot.pResource);
+                     return true;
+                   });
+    m_staging.erase(itEnd, m_staging.end());
+  }
+
+  void
+  DXUploadScheduler::flush() {
+    _issueUploads(std::numeric_limits<SIZE_T>::max());
+  }
+
+  void
+  DXUploadScheduler::_issueUploads(SIZE_T budget) {
+    SIZE_T issued = 0;
+    uint32 numDone = 0;
+    for (; numDone < m_uploads.size(); ++numDone) {
+      Upload& upload = m_uploads[numDone];
+
+      bool bDone = false;
+      while (!bDone) {
+        SIZE_T budgetLeft = budget > issued ? budget - issued : 0;
+        if (issued > 0 && budgetLeft < upload.rowBytes) {
+          break;
+        }
+
+        issued += _issueChunk(upload, Math::max(budgetLeft, SIZE_T(upload.rowBytes)));
+        bDone = upload.nextRow >= (D3D11_RESOURCE_DIMENSION_BUFFER == upload.dimension ?
+                                   upload.data.size() : upload.numRows);
+      }
+
+      if (!bDone) {
+        break;
+      }
+
+      m_lastCompletedToken = upload.token;
+      safeRelease(upload.pDst);
+    }
+
+    m_uploads.erase(m_uploads.begin(), m_uploads.begin() + numDone);
+    m_pendingBytes -= issued;
+    m_lastFrameBytes = issued;
+  }
+
+  SIZE_T
+  DXUploadScheduler::_issueChunk(Upload& upload, SIZE_T maxBytes) {
+    StagingKey key;
+    key.dimension = upload.dimension;
+    D3D11_BOX srcBox;
+    uint32 dstX = upload.box.left;
+    uint32 dstY = upload.box.top;
+    uint32 chunkRows = 0;
+    SIZE_T chunkBytes = 0;
+
+    if (D3D11_RESOURCE_DIMENSION_BUFFER == upload.dimension) {
+      chunkBytes = Math::min(upload.data.size() - upload.nextRow,
+                             Math::min(maxBytes, SIZE_T(m_bufferPageSize)));
+      key.width = m_bufferPageSize;
+      key.height = 1;
+
+      srcBox = { 0, 0, 0, static_cast<UINT>(chunkBytes), 1, 1 };
+      dstX += upload.nextRow;
+    }
+    else {
+      chunkRows = static_cast<uint32>(Math::min(SIZE_T(upload.numRows - upload.nextRow),
+                                                maxBytes / upload.rowBytes));
+      chunkRows = Math::max(1U, Math::min(chunkRows, MAX_CHUNK_ROWS));
+      chunkBytes = static_cast<SIZE_T>(chunkRows) * upload.rowBytes;
+
+      //Compressed copies must cover whole blocks, the runtime pads the
+      //dimensions of the small mips to the block size
+      uint32 bw = upload.blockWidth;
+      uint32 width = (upload.box.right - upload.box.left + bw - 1) / bw * bw;
+      uint32 height = chunkRows * upload.blockHeight;
+
+      key.width = nextPowerOfTwo(width);
+      key.height = nextPowerOfTwo(height);
+      key.format = upload.format;
+
+      srcBox = { 0, 0, 0, width, height, 1 };
+      dstY += upload.nextRow * upload.blockHeight;
+    }
+
+    ID3D11Resource* pStaging = _acquireStaging(key);
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    HRESULT hr = m_pContext->Map(pStaging, 0, D3D11_MAP_WRITE, D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+    if (DXGI_ERROR_WAS_STILL_DRAWING == hr) {
+      //The GPU is further behind than expected (or the pool is full), wait
+      //for it instead of allocating more staging memory
+      hr = m_pContext->Map(pStaging, 0, D3D11_MAP_WRITE, 0, &mapped);
+    }
+    throwIfFailed(hr);
+
+    auto pDst = static_cast<uint8*>(mapped.pData);
+    if (D3D11_RESOURCE_DIMENSION_BUFFER == upload.dimension) {
+      memcpy(pDst, &upload.data[upload.nextRow], chunkBytes);
+      upload.nextRow += static_cast<uint32>(chunkBytes);
+    }
+    else {
+      for (uint32 row = 0; row < chunkRows; ++row) {
+        SIZE_T srcOffset = static_cast<SIZE_T>(upload.nextRow + row) * upload.rowBytes;
+        memcpy(pDst + static_cast<SIZE_T>(row) * mapped.RowPitch,
+               &upload.data[srcOffset],
+               upload.rowBytes);
+      }
+      upload.nextRow += chunkRows;
+    }
+
+    m_pContext->Unmap(pStaging, 0);
+    m_pContext->CopySubresourceRegion(upload.pDst,
+                                      upload.dstSubRes,
+                                      dstX,
+                                      dstY,
+                                      upload.box.front,
+                                      pStaging,
+                                      0,
+                                      &srcBox);
+    return chunkBytes;
+  }
+
+  ID3D11Resource*
+  DXUploadScheduler::_acquireStaging(const StagingKey& key) {
+    //The pool is kept in use order, the slot found is moved to the back
+    auto touch = [this](Vector<StagingSlot>::iterator it) {
+      it->lastUsedFrame = m_frameIndex;
+      std::rotate(it, it + 1, m_staging.end());
+      return m_staging.back().pResource;
+    };
+
+    //A slot can be rewritten without waiting once the GPU is done with its
+    //last copy
+    auto itFree = std::find_if(m_staging.begin(), m_staging.end(),
+                    [this, &key](const StagingSlot& slot) {
+                      return slot.key == key &&
+                             slot.lastUsedFrame + m_frameLatency <= m_frameIndex;
+                    });
+    if (m_staging.end() != itFree) {
+      return touch(itFree);
+    }
+
+    if (m_staging.size() < m_maxStagingSlots) {
+      StagingSlot slot;
+      slot.key = key;
+      slot.lastUsedFrame = m_frameIndex;
+      slot.pResource = _createStaging(key);
+      m_staging.push_back(slot);
+      return slot.pResource;
+    }
+
+    //The pool is full, rewrite the oldest slot of this size (the map waits
+    //for the GPU if needed) or replace the oldest slot of any size
+    auto itOldest = std::find_if(m_staging.begin(), m_staging.end(),
+                      [&key](const StagingSlot& slot) {
+                        return slot.key == key;
+                      });
+    if (m_staging.end() == itOldest) {
+      itOldest = m_staging.begin();
+      DXMemoryTracker::onReleased(itOldest->pResource);
+      safeRelease(itOldest->pResource);
+      itOldest->key = key;
+      itOldest->pResource = _createStaging(key);
+    }
+    return touch(itOldest);
+  }
+
+  ID3D11Resource*
+  DXUploadScheduler::_createStaging(const StagingKey& key) {
+    if (D3D11_RESOURCE_DIMENSION_TEXTURE2D == key.dimension) {
+      D3D11_TEXTURE2D_DESC tDesc;
+      ge_zero_out(tDesc);
+      tDesc.Width = key.width;
+      tDesc.Height = key.height;
+      tDesc.MipLevels = 1;
+      tDesc.ArraySize = 1;
+      tDesc.Format = key.format;
+      tDesc.SampleDesc.Count = 1;
+      tDesc.Usage = D3D11_USAGE_STAGING;
+      tDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+      ID3D11Texture2D* pTexture = nullptr;
+      throwIfFailed(m_pDevice->CreateTexture2D(&tDesc, nullptr, &pTexture));
+      DXMemoryTracker::onAllocated(pTexture,
+                                   GPU_MEMORY_CATEGORY::kStaging,
+                                   DXTexture::computeMemoryUsage(tDesc));
+      return pTexture;
+    }
+    else {
+      D3D11_BUFFER_DESC bDesc;
+      ge_zero_out(bDesc);
+      bDesc.ByteWidth = key.width;
+      bDesc.Usage = D3D11_USAGE_STAGING;
+      bDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+      ID3D11Buffer* pBuffer = nullptr;
+      throwIfFailed(m_pDevice->CreateBuffer(&bDesc, nullptr, &pBuffer));
+      DXMemoryTracker::onAllocated(pBuffer, GPU_MEMORY_CATEGORY::kStaging, bDesc.ByteWidth);
+      return pBuffer;
+    }
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,1602 @@
+/*****************************************************************************/
+/**
+ * @file    geBlockCompression.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU encoder and decoder of the BC1, BC3, BC4, BC5 and BC7 formats.
+ *
+ * CPU encoder and decoder of the BC1, BC3, BC4, BC5 and BC7 formats.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geBlockCompression.h"
+
+#include <geMath.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define GE_BLOCK_COMPRESSION_SSE2 1
+# include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+# define GE_BLOCK_COMPRESSION_NEON 1
+# include <arm_neon.h>
+#endif
+
+namespace geEngineSDK {
+
+  namespace {
+    /*************************************************************************/
+    // Blocks
+    /*************************************************************************/
+    //Texels of a block by channel, the searches work on four texels at once
+    struct BlockSoA
+    {
+      float c[4][16];
+    };
+
+    void
+    loadBlock(const uint8* pixels, BlockSoA& block) {
+      for (uint32 i = 0; i < 16; ++i) {
+        for (uint32 c = 0; c < 4; ++c) {
+          block.c[c][i] = static_cast<float>(pixels[i * 4 + c]);
+        }
+      }
+    }
+
+    //Blocks past the edge repeat the last row and column of the image
+    void
+    gatherBlock(const TextureImage& src, uint32 blockX, uint32 blockY, uint8* pixels) {
+      for (uint32 y = 0; y < 4; ++y) {
+        const uint32 srcY = Math::min(blockY * 4 + y, src.height - 1);
+        const uint8* pRow = src.pData + static_cast<SIZE_T>(srcY) * src.rowPitch;
+        for (uint32 x = 0; x < 4; ++x) {
+          const uint32 srcX = Math::min(blockX * 4 + x, src.width - 1);
+          memcpy(pixels + (y * 4 + x) * 4, pRow + srcX * 4, 4);
+        }
+      }
+    }
+
+    void
+    scatterBlock(const uint8* pixels, uint32 blockX, uint32 blockY, const TextureImage& dst) {
+      for (uint32 y = 0; y < 4 && blockY * 4 + y < dst.height; ++y) {
+        uint8* pRow = dst.pData + static_cast<SIZE_T>(blockY * 4 + y) * dst.rowPitch;
+        for (uint32 x = 0; x < 4 && blockX * 4 + x < dst.width; ++x) {
+          memcpy(pRow + (blockX * 4 + x) * 4, pixels + (y * 4 + x) * 4, 4);
+        }
+      }
+    }
+
+    class BitWriter
+    {
+     public:
+      explicit BitWriter(uint8* pData) : m_pData(pData) {
+        memset(m_pData, 0, 16);
+      }
+
+      void
+      write(uint32 value, uint32 numBits) {
+        for (uint32 i = 0; i < numBits; ++i, ++m_position) {
+          if ((value >> i) & 1) {
+            m_pData[m_position >> 3] |= static_cast<uint8>(1 << (m_position & 7));
+          }
+        }
+      }
+
+     private:
+      uint8* m_pData;
+      uint32 m_position = 0;
+    };
+
+    class BitReader
+    {
+     public:
+      explicit BitReader(const uint8* pData) : m_pData(pData) {}
+
+      uint32
+      read(uint32 numBits) {
+        uint32 value = 0;
+        for (uint32 i = 0; i < numBits; ++i, ++m_position) {
+          value |= static_cast<uint32>((m_pData[m_position >> 3] >> (m_position & 7)) & 1) << i;
+        }
+        return value;
+      }
+
+     private:
+      const uint8* m_pData;
+      uint32 m_position = 0;
+    };
+
+    uint32
+    roundToInt(float value) {
+      return static_cast<uint32>(Math::clamp(std::floor(value + 0.5f), 0.0f, 255.0f));
+    }
+
+    /*************************************************************************/
+    // Palette search
+    /*************************************************************************/
+    using Palette = float[16][4];
+
+    float
+    sumErrors(const float* pErrors, uint16 mask) {
+      float error = 0.0f;
+      for (uint32 i = 0; i < 16; ++i) {
+        if ((mask >> i) & 1) {
+          error += pErrors[i];
+        }
+      }
+      return error;
+    }
+
+    void
+    findClosestScalar(const BlockSoA& block,
+                      uint32 firstChannel,
+                      uint32 numChannels,
+                      const Palette& palette,
+                      uint32 numEntries,
+                      uint8* pIndices,
+                      float* pErrors) {
+      for (uint32 i = 0; i < 16; ++i) {
+        float best = FLT_MAX;
+        uint32 bestIndex = 0;
+        for (uint32 e = 0; e < numEntries; ++e) {
+          float dist = 0.0f;
+          for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+            const float d = block.c[c][i] - palette[e][c];
+            dist += d * d;
+          }
+          if (dist < best) {
+            best = dist;
+            bestIndex = e;
+          }
+        }
+        pIndices[i] = static_cast<uint8>(bestIndex);
+        pErrors[i] = best;
+      }
+    }
+
+#if defined(GE_BLOCK_COMPRESSION_SSE2)
+    void
+    findClosestSSE2(const BlockSoA& block,
+                    uint32 firstChannel,
+                    uint32 numChannels,
+                    const Palette& palette,
+                    uint32 numEntries,
+                    uint8* pIndices,
+                    float* pErrors) {
+      for (uint32 i = 0; i < 16; i += 4) {
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i bestIndex = _mm_setzero_si128();
+        for (uint32 e = 0; e < numEntries; ++e) {
+          __m128 dist = _mm_setzero_ps();
+          for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+            __m128 d = _mm_sub_ps(_mm_loadu_ps(&block.c[c][i]), _mm_set1_ps(palette[e][c]));
+            dist = _mm_add_ps(dist, _mm_mul_ps(d, d));
+          }
+          __m128i closer = _mm_castps_si128(_mm_cmplt_ps(dist, best));
+          best = _mm_min_ps(dist, best);
+          bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(static_cast<int32>(e))),
+                                   _mm_andnot_si128(closer, bestIndex));
+        }
+        _mm_storeu_ps(pErrors + i, best);
+
+        int32 indices[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), bestIndex);
+        for (uint32 k = 0; k < 4; ++k) {
+          pIndices[i + k] = static_cast<uint8>(indices[k]);
+        }
+      }
+    }
+#elif defined(GE_BLOCK_COMPRESSION_NEON)
+    void
+    findClosestNEON(const BlockSoA& block,
+                    uint32 firstChannel,
+                    uint32 numChannels,
+                    const Palette& palette,
+                    uint32 numEntries,
+                    uint8* pIndices,
+                    float* pErrors) {
+      for (uint32 i = 0; i < 16; i += 4) {
+        float32x4_t best = vdupq_n_f32(FLT_MAX);
+        uint32x4_t bestIndex = vdupq_n_u32(0);
+        for (uint32 e = 0; e < numEntries; ++e) {
+          float32x4_t dist = vdupq_n_f32(0.0f);
+          for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+            float32x4_t d = vsubq_f32(vld1q_f32(&block.c[c][i]), vdupq_n_f32(palette[e][c]));
+            dist = vmlaq_f32(dist, d, d);
+          }
+          uint32x4_t closer = vcltq_f32(dist, best);
+          best = vminq_f32(dist, best);
+          bestIndex = vbslq_u32(closer, vdupq_n_u32(e), bestIndex);
+        }
+        vst1q_f32(pErrors + i, best);
+
+        uint32 indices[4];
+        vst1q_u32(indices, bestIndex);
+        for (uint32 k = 0; k < 4; ++k) {
+          pIndices[i + k] = static_cast<uint8>(indices[k]);
+        }
+      }
+    }
+#endif
+
+    /**
+     * @brief Closest palette entry of every texel of the block over the
+     *        channels [firstChannel, firstChannel + numChannels).
+     * @return Squared error of the texels in mask.
+     */
+    float
+    findClosest(const BlockSoA& block,
+                uint32 firstChannel,
+                uint32 numChannels,
+                const Palette& palette,
+                uint32 numEntries,
+                uint16 mask,
+                uint8* pIndices) {
+      float errors[16];
+      if (TextureKernels::isSIMDEnabled()) {
+#if defined(GE_BLOCK_COMPRESSION_SSE2)
+        findClosestSSE2(block, firstChannel, numChannels, palette, numEntries, pIndices, errors);
+        return sumErrors(errors, mask);
+#elif defined(GE_BLOCK_COMPRESSION_NEON)
+        findClosestNEON(block, firstChannel, numChannels, palette, numEntries, pIndices, errors);
+        return sumErrors(errors, mask);
+#endif
+      }
+      findClosestScalar(block, firstChannel, numChannels, palette, numEntries, pIndices, errors);
+      return sumErrors(errors, mask);
+    }
+
+    /*************************************************************************/
+    // Endpoint fitting
+    /*************************************************************************/
+    struct Moments
+    {
+      float count = 0.0f;
+      float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      float scatter[4][4];    //Sums of the products of the deviations
+    };
+
+    void
+    computeMoments(const BlockSoA& block,
+                   uint16 mask,
+                   uint32 firstChannel,
+                   uint32 numChannels,
+                   Moments& moments) {
+      memset(moments.scatter, 0, sizeof(moments.scatter));
+      for (uint32 i = 0; i < 16; ++i) {
+        if ((mask >> i) & 1) {
+          moments.count += 1.0f;
+          for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+            moments.mean[c] += block.c[c][i];
+          }
+        }
+      }
+      if (0.0f == moments.count) {
+        return;
+      }
+
+      for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+        moments.mean[c] /= moments.count;
+      }
+
+      for (uint32 i = 0; i < 16; ++i) {
+        if (!((mask >> i) & 1)) {
+          continue;
+        }
+        for (uint32 a = firstChannel; a < firstChannel + numChannels; ++a) {
+          const float da = block.c[a][i] - moments.mean[a];
+          for (uint32 b = a; b < firstChannel + numChannels; ++b) {
+            moments.scatter[a][b] += da * (block.c[b][i] - moments.mean[b]);
+          }
+        }
+      }
+      for (uint32 a = firstChannel; a < firstChannel + numChannels; ++a) {
+        for (uint32 b = firstChannel; b < a; ++b) {
+          moments.scatter[a][b] = moments.scatter[b][a];
+        }
+      }
+    }
+
+    /**
+     * @brief Unit eigenvector of the largest eigenvalue of the scatter
+     *        matrix, by power iteration.
+     * @return The eigenvalue, 0 if every texel is the same.
+     */
+    float
+    principalAxis(const Moments& moments,
+                  uint32 firstChannel,
+                  uint32 numChannels,
+                  float* pAxis) {
+      const uint32 lastChannel = firstChannel + numChannels;
+
+      //The column of the largest variance can't be orthogonal to the axis
+      uint32 start = firstChannel;
+      for (uint32 c = firstChannel; c < lastChannel; ++c) {
+        pAxis[c] = 0.0f;
+        if (moments.scatter[c][c] > moments.scatter[start][start]) {
+          start = c;
+        }
+      }
+      if (moments.scatter[start][start] <= 0.0f) {
+        return 0.0f;
+      }
+
+      for (uint32 c = firstChannel; c < lastChannel; ++c) {
+        pAxis[c] = moments.scatter[c][start];
+      }
+
+      float eigenvalue = 0.0f;
+      for (uint32 iteration = 0; iteration < 8; ++iteration) {
+        float next[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float length = 0.0f;
+        for (uint32 a = firstChannel; a < lastChannel; ++a) {
+          for (uint32 b = firstChannel; b < lastChannel; ++b) {
+            next[a] += moments.scatter[a][b] * pAxis[b];
+          }
+          length += next[a] * next[a];
+        }
+        if (length <= 1e-12f) {
+          break;
+        }
+
+        length = std::sqrt(length);
+        for (uint32 c = firstChannel; c < lastChannel; ++c) {
+          pAxis[c] = next[c] / length;
+        }
+      }
+
+      float length = 0.0f;
+      for (uint32 c = firstChannel; c < lastChannel; ++c) {
+        length += pAxis[c] * pAxis[c];
+      }
+      length = std::sqrt(length);
+      for (uint32 c = firstChannel; c < lastChannel; ++c) {
+        pAxis[c] /= length;
+      }
+
+      for (uint32 a = firstChannel; a < lastChannel; ++a) {
+        for (uint32 b = firstChannel; b < lastChannel; ++b) {
+          eigenvalue += pAxis[a] * moments.scatter[a][b] * pAxis[b];
+        }
+      }
+      return eigenvalue;
+    }
+
+    /**
+     * @brief Endpoints at the ends of the projection of the texels of mask
+     *        on their principal axis.
+     */
+    void
+    fitPrincipalAxis(const BlockSoA& block,
+                     uint16 mask,
+                     uint32 firstChannel,
+                     uint32 numChannels,
+                     float* pLow,
+                     float* pHigh) {
+      Moments moments;
+      computeMoments(block, mask, firstChannel, numChannels, moments);
+
+      float axis[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      principalAxis(moments, firstChannel, numChannels, axis);
+
+      float minDot = FLT_MAX;
+      float maxDot = -FLT_MAX;
+      for (uint32 i = 0; i < 16; ++i) {
+        if (!((mask >> i) & 1)) {
+          continue;
+        }
+        float dot = 0.0f;
+        for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+          dot += (block.c[c][i] - moments.mean[c]) * axis[c];
+        }
+        minDot = Math::min(minDot, dot);
+        maxDot = Math::max(maxDot, dot);
+      }
+      if (minDot > maxDot) {
+        minDot = maxDot = 0.0f;
+      }
+
+      for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+        pLow[c] = Math::clamp(moments.mean[c] + minDot * axis[c], 0.0f, 255.0f);
+        pHigh[c] = Math::clamp(moments.mean[c] + maxDot * axis[c], 0.0f, 255.0f);
+      }
+    }
+
+    //Sums of the texels and of their products, the moments of any subset
+    //of the block come from them without another pass over the texels
+    struct SubsetSums
+    {
+      float count = 0.0f;
+      float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      float products[4][4];
+    };
+
+    void
+    computeSums(const BlockSoA& block, uint16 mask, uint32 numChannels, SubsetSums& sums) {
+      memset(sums.products, 0, sizeof(sums.products));
+      for (uint32 i = 0; i < 16; ++i) {
+        if (!((mask >> i) & 1)) {
+          continue;
+        }
+        sums.count += 1.0f;
+        for (uint32 a = 0; a < numChannels; ++a) {
+          sums.sum[a] += block.c[a][i];
+          for (uint32 b = a; b < numChannels; ++b) {
+            sums.products[a][b] += block.c[a][i] * block.c[b][i];
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Squared distance of the texels to their principal axis, the
+     *        error a subset would have with unlimited indices.
+     */
+    float
+    estimateLineError(const SubsetSums& sums, uint32 numChannels) {
+      if (sums.count <= 1.0f) {
+        return 0.0f;
+      }
+
+      Moments moments;
+      moments.count = sums.count;
+      float trace = 0.0f;
+      for (uint32 a = 0; a < numChannels; ++a) {
+        moments.mean[a] = sums.sum[a] / sums.count;
+        for (uint32 b = a; b < numChannels; ++b) {
+          moments.scatter[a][b] = sums.products[a][b] - sums.sum[a] * moments.mean[b];
+          moments.scatter[b][a] = moments.scatter[a][b];
+        }
+        trace += moments.scatter[a][a];
+      }
+
+      float axis[4];
+      return trace - principalAxis(moments, 0, numChannels, axis);
+    }
+
+    /**
+     * @brief Endpoints with the least squared error for the indices of the
+     *        texels of mask.
+     * @param pWeights Position of every index between the endpoints, 0..1.
+     * @return False if every texel has the same weight.
+     */
+    bool
+    solveEndpoints(const BlockSoA& block,
+                   uint16 mask,
+                   uint32 firstChannel,
+                   uint32 numChannels,
+                   const uint8* pIndices,
+                   const float* pWeights,
+                   float* pLow,
+                   float* pHigh) {
+      float aa = 0.0f;
+      float ab = 0.0f;
+      float bb = 0.0f;
+      float rhsA[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      float rhsB[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      for (uint32 i = 0; i < 16; ++i) {
+        if (!((mask >> i) & 1)) {
+          continue;
+        }
+        const float b = pWeights[pIndices[i]];
+        const float a = 1.0f - b;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+          rhsA[c] += a * block.c[c][i];
+          rhsB[c] += b * block.c[c][i];
+        }
+      }
+
+      const float det = aa * bb - ab * ab;
+      if (std::fabs(det) < 1e-6f) {
+        return false;
+      }
+
+      const float invDet = 1.0f / det;
+      for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+        pLow[c] = Math::clamp((bb * rhsA[c] - ab * rhsB[c]) * invDet, 0.0f, 255.0f);
+        pHigh[c] = Math::clamp((aa * rhsB[c] - ab * rhsA[c]) * invDet, 0.0f, 255.0f);
+      }
+      return true;
+    }
+
+    /*************************************************************************/
+    // BC1
+    /*************************************************************************/
+    uint16
+    packRGB565(const float* pColor) {
+      const uint32 r = roundToInt(pColor[0] * (31.0f / 255.0f));
+      const uint32 g = roundToInt(pColor[1] * (63.0f / 255.0f));
+      const uint32 b = roundToInt(pColor[2] * (31.0f / 255.0f));
+      return static_cast<uint16>((r << 11) | (g << 5) | b);
+    }
+
+    void
+    unpackRGB565(uint16 color, uint8* pOut) {
+      const uint32 r = (color >> 11) & 31;
+      const uint32 g = (color >> 5) & 63;
+      const uint32 b = color & 31;
+      pOut[0] = static_cast<uint8>((r << 3) | (r >> 2));
+      pOut[1] = static_cast<uint8>((g << 2) | (g >> 4));
+      pOut[2] = static_cast<uint8>((b << 3) | (b >> 2));
+      pOut[3] = 255;
+    }
+
+    /**
+     * @param bFourColors BC2 and BC3 colors always use four colors, BC1 only
+     *        if c0 > c1.
+     */
+    void
+    getBC1Palette(uint16 c0, uint16 c1, bool bFourColors, uint8 (*pPalette)[4]) {
+      unpackRGB565(c0, pPalette[0]);
+      unpackRGB565(c1, pPalette[1]);
+      if (bFourColors || c0 > c1) {
+        for (uint32 c = 0; c < 3; ++c) {
+          const uint32 a = pPalette[0][c];
+          const uint32 b = pPalette[1][c];
+          pPalette[2][c] = static_cast<uint8>((2 * a + b + 1) / 3);
+          pPalette[3][c] = static_cast<uint8>((a + 2 * b + 1) / 3);
+        }
+        pPalette[2][3] = 255;
+        pPalette[3][3] = 255;
+      }
+      else {
+        for (uint32 c = 0; c < 3; ++c) {
+          pPalette[2][c] = static_cast<uint8>((pPalette[0][c] + pPalette[1][c] + 1) / 2);
+        }
+        pPalette[2][3] = 255;
+        memset(pPalette[3], 0, 4);
+      }
+    }
+
+    /**
+     * @brief Color half of BC1, BC2 and BC3.
+     * @param opaqueMask Texels the colors are fit to, the others (alpha
+     *        under 128 in BC1) get the transparent index.
+     * @param bThreeColors Writes c0 <= c1, for BC1 blocks with transparency.
+     */
+    void
+    encodeColorBlock(const BlockSoA& block,
+                     uint16 opaqueMask,
+                     bool bThreeColors,
+                     uint32 refinements,
+                     uint8* pOut) {
+      uint16 bestC0 = 0;
+      uint16 bestC1 = 0;
+      uint32 bestIndices = 0xFFFFFFFF;
+
+      if (0 != opaqueMask) {
+        //Positions of the indices between c0 and c1
+        const float fourWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+        const float threeWeights[4] = { 0.0f, 1.0f, 0.5f, 0.0f };
+        const float* pWeights = bThreeColors ? threeWeights : fourWeights;
+        const uint32 numEntries = bThreeColors ? 3 : 4;
+
+        float low[4];
+        float high[4];
+        fitPrincipalAxis(block, opaqueMask, 0, 3, low, high);
+
+        float bestError = FLT_MAX;
+        for (uint32 iteration = 0; iteration <= refinements; ++iteration) {
+          const uint16 a = packRGB565(high);
+          const uint16 b = packRGB565(low);
+          const uint16 c0 = bThreeColors ? Math::min(a, b) : Math::max(a, b);
+          const uint16 c1 = bThreeColors ? Math::max(a, b) : Math::min(a, b);
+
+          uint8 palette8[4][4];
+          getBC1Palette(c0, c1, !bThreeColors, palette8);
+          Palette palette;
+          for (uint32 e = 0; e < 4; ++e) {
+            for (uint32 c = 0; c < 4; ++c) {
+              palette[e][c] = static_cast<float>(palette8[e][c]);
+            }
+          }
+
+          uint8 indices[16];
+          const float error = findClosest(block, 0, 3, palette, numEntries, opaqueMask, indices);
+          if (error >= bestError) {
+            break;
+          }
+
+          bestError = error;
+          bestC0 = c0;
+          bestC1 = c1;
+          bestIndices = 0;
+          for (uint32 i = 0; i < 16; ++i) {
+            const uint32 index = ((opaqueMask >> i) & 1) ? indices[i] : 3;
+            bestIndices |= index << (i * 2);
+          }
+
+          if (0.0f == error ||
+              !solveEndpoints(block, opaqueMask, 0, 3, indices, pWeights, high, low)) {
+            break;
+          }
+        }
+      }
+
+      pOut[0] = static_cast<uint8>(bestC0 & 0xFF);
+      pOut[1] = static_cast<uint8>(bestC0 >> 8);
+      pOut[2] = static_cast<uint8>(bestC1 & 0xFF);
+      pOut[3] = static_cast<uint8>(bestC1 >> 8);
+      for (uint32 i = 0; i < 4; ++i) {
+        pOut[4 + i] = static_cast<uint8>(bestIndices >> (i * 8));
+      }
+    }
+
+    void
+    decodeColorBlock(const uint8* pBlock, bool bFourColors, uint8* pixels) {
+      const uint16 c0 = static_cast<uint16>(pBlock[0] | (pBlock[1] << 8));
+      const uint16 c1 = static_cast<uint16>(pBlock[2] | (pBlock[3] << 8));
+      uint8 palette[4][4];
+      getBC1Palette(c0, c1, bFourColors, palette);
+      for (uint32 i = 0; i < 16; ++i) {
+        const uint32 index = (pBlock[4 + i / 4] >> ((i % 4) * 2)) & 3;
+        memcpy(pixels + i * 4, palette[index], 4);
+      }
+    }
+
+    /*************************************************************************/
+    // BC4
+    /*************************************************************************/
+    /**
+     * @brief Eight interpolated values if a0 > a1, six plus 0 and 255
+     *        otherwise.
+     */
+    void
+    getBC4Palette(uint32 a0, uint32 a1, uint8* pPalette) {
+      pPalette[0] = static_cast<uint8>(a0);
+      pPalette[1] = static_cast<uint8>(a1);
+      if (a0 > a1) {
+        for (uint32 i = 2; i < 8; ++i) {
+          pPalette[i] = static_cast<uint8>(((8 - i) * a0 + (i - 1) * a1 + 3) / 7);
+        }
+      }
+      else {
+        for (uint32 i = 2; i < 6; ++i) {
+          pPalette[i] = static_cast<uint8>(((6 - i) * a0 + (i - 1) * a1 + 2) / 5);
+        }
+        pPalette[6] = 0;
+        pPalette[7] = 255;
+      }
+    }
+
+    float
+    evaluateBC4(const BlockSoA& block, uint32 channel, uint32 a0, uint32 a1, uint8* pIndices) {
+      uint8 palette8[8];
+      getBC4Palette(a0, a1, palette8);
+      Palette palette;
+      for (uint32 e = 0; e < 8; ++e) {
+        palette[e][channel] = static_cast<float>(palette8[e]);
+      }
+      return findClosest(block, channel, 1, palette, 8, 0xFFFF, pIndices);
+    }
+
+    void
+    encodeBC4(const BlockSoA& block, uint32 channel, uint8* pOut) {
+      const float* pValues = block.c[channel];
+      float minValue = 255.0f;
+      float maxValue = 0.0f;
+      float minInner = 255.0f;
+      float maxInner = 0.0f;
+      bool bHasExtremes = false;
+      for (uint32 i = 0; i < 16; ++i) {
+        minValue = Math::min(minValue, pValues[i]);
+        maxValue = Math::max(maxValue, pValues[i]);
+        if (0.0f == pValues[i] || 255.0f == pValues[i]) {
+          bHasExtremes = true;
+        }
+        else {
+          minInner = Math::min(minInner, pValues[i]);
+          maxInner = Math::max(maxInner, pValues[i]);
+        }
+      }
+
+      uint32 a0 = roundToInt(maxValue);
+      uint32 a1 = roundToInt(minValue);
+      uint8 indices[16];
+      float error = evaluateBC4(block, channel, a0, a1, indices);
+
+      //The six value mode spends no palette entries on 0 and 255
+      if (bHasExtremes && error > 0.0f) {
+        if (minInner > maxInner) {
+          minInner = maxInner = 0.0f;
+        }
+
+        const uint32 b0 = roundToInt(minInner);
+        const uint32 b1 = roundToInt(maxInner);
+        uint8 sixIndices[16];
+        const float sixError = evaluateBC4(block, channel, b0, b1, sixIndices);
+        if (sixError < error) {
+          a0 = b0;
+          a1 = b1;
+          memcpy(indices, sixIndices, sizeof(indices));
+        }
+      }
+
+      pOut[0] = static_cast<uint8>(a0);
+      pOut[1] = static_cast<uint8>(a1);
+      uint64 bits = 0;
+      for (uint32 i = 0; i < 16; ++i) {
+        bits |= static_cast<uint64>(indices[i]) << (i * 3);
+      }
+      for (uint32 i = 0; i < 6; ++i) {
+        pOut[2 + i] = static_cast<uint8>(bits >> (i * 8));
+      }
+    }
+
+    void
+    decodeBC4(const uint8* pBlock, uint32 channel, uint8* pixels) {
+      uint8 palette[8];
+      getBC4Palette(pBlock[0], pBlock[1], palette);
+      uint64 bits = 0;
+      for (uint32 i = 0; i < 6; ++i) {
+        bits |= static_cast<uint64>(pBlock[2 + i]) << (i * 8);
+      }
+      for (uint32 i = 0; i < 16; ++i) {
+        pixels[i * 4 + channel] = palette[(bits >> (i * 3)) & 7];
+      }
+    }
+
+    /*************************************************************************/
+    // BC7
+    /*************************************************************************/
+    namespace BC7_PBIT {
+      enum E {
+        kNone = 0,
+        kShared,      //One per subset
+        kEndpoint     //One per endpoint
+      };
+    }
+
+    struct BC7ModeInfo
+    {
+      uint32 numSubsets;
+      uint32 partitionBits;
+      uint32 rotationBits;
+      uint32 indexModeBits;
+      uint32 colorBits;
+      uint32 alphaBits;
+      BC7_PBIT::E pbits;
+      uint32 indexBits;
+      uint32 index2Bits;
+    };
+
+    const BC7ModeInfo BC7_MODES[8] = {
+      { 3, 4, 0, 0, 4, 0, BC7_PBIT::kEndpoint, 3, 0 },
+      { 2, 6, 0, 0, 6, 0, BC7_PBIT::kShared,   3, 0 },
+      { 3, 6, 0, 0, 5, 0, BC7_PBIT::kNone,     2, 0 },
+      { 2, 6, 0, 0, 7, 0, BC7_PBIT::kEndpoint, 2, 0 },
+      { 1, 0, 2, 1, 5, 6, BC7_PBIT::kNone,     2, 3 },
+      { 1, 0, 2, 0, 7, 8, BC7_PBIT::kNone,     2, 2 },
+      { 1, 0, 0, 0, 7, 7, BC7_PBIT::kEndpoint, 4, 0 },
+      { 2, 6, 0, 0, 5, 5, BC7_PBIT::kEndpoint, 2, 0 }
+    };
+
+    //Texels of the second subset of the two subset partitions
+    const uint16 BC7_PARTITIONS2[64] = {
+      0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+      0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+      0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+      0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+      0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+      0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+      0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+      0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+    };
+
+    //Anchor texel of the second subset, its index has an implicit zero MSB
+    const uint8 BC7_ANCHORS2[64] = {
+      15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15,
+      15,  2,  8,  2,  2,  8,  8, 15,
+       2,  8,  2,  2,  8,  8,  2,  2,
+      15, 15,  6,  8,  2,  8, 15, 15,
+       2,  8,  2,  2,  2, 15, 15,  6,
+       6,  2,  6,  8, 15, 15,  2,  2,
+      15, 15, 15, 15, 15,  2,  2, 15
+    };
+
+    const uint32 BC7_WEIGHTS2[4] = { 0, 21, 43, 64 };
+    const uint32 BC7_WEIGHTS3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+    const uint32 BC7_WEIGHTS4[16] = {
+      0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+    };
+
+    const uint32*
+    getBC7Weights(uint32 indexBits) {
+      return 2 == indexBits ? BC7_WEIGHTS2 : (3 == indexBits ? BC7_WEIGHTS3 : BC7_WEIGHTS4);
+    }
+
+    uint32
+    interpolateBC7(uint32 e0, uint32 e1, uint32 weight) {
+      return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+    }
+
+    uint32
+    expandBits(uint32 value, uint32 numBits) {
+      return ((value << (8 - numBits)) | (value >> (2 * numBits - 8))) & 0xFF;
+    }
+
+    struct BC7Format
+    {
+      uint32 colorBits;
+      uint32 alphaBits;     //0 if the mode has no alpha, decoded as 255
+      BC7_PBIT::E pbits;
+    };
+
+    struct BC7Subset
+    {
+      uint8 endpoints[2][4];    //Quantized, without the p-bits
+      uint8 pbits[2];
+    };
+
+    struct BC7Block
+    {
+      uint32 mode = 0;
+      uint32 partition = 0;
+      uint32 rotation = 0;
+      uint32 indexMode = 0;
+      BC7Subset subsets[2];
+      uint8 indices[16];        //Colors, and alpha but in modes 4 and 5
+      uint8 alphaIndices[16];
+      float error = FLT_MAX;
+    };
+
+    struct BC7Settings
+    {
+      uint32 refinements;
+      bool bExhaustive;       //Every p-bit combination, partition and rotation
+    };
+
+    /**
+     * @brief Nearest representable value of a channel.
+     * @param pbit -1 if the mode has no p-bit.
+     */
+    uint32
+    quantizeChannel(float value, uint32 numBits, int32 pbit, uint8& decoded) {
+      const uint32 totalBits = numBits + (pbit >= 0 ? 1 : 0);
+      const float scale = static_cast<float>((1 << totalBits) - 1) / 255.0f;
+      const int32 maxValue = (1 << numBits) - 1;
+      int32 guess = 0;
+      if (pbit >= 0) {
+        guess = static_cast<int32>(std::floor((value * scale - pbit) * 0.5f + 0.5f));
+      }
+      else {
+        guess = static_cast<int32>(std::floor(value * scale + 0.5f));
+      }
+
+      //The bit replication of the expansion isn't linear, the neighbors may
+      //be closer
+      uint32 best = 0;
+      float bestError = FLT_MAX;
+      for (int32 q = guess - 1; q <= guess + 1; ++q) {
+        if (q < 0 || q > maxValue) {
+          continue;
+        }
+        const uint32 bits = pbit >= 0 ? ((static_cast<uint32>(q) << 1) | pbit) :
+                                        static_cast<uint32>(q);
+        const uint32 expanded = expandBits(bits, totalBits);
+        const float error = std::fabs(static_cast<float>(expanded) - value);
+        if (error < bestError) {
+          bestError = error;
+          best = static_cast<uint32>(q);
+          decoded = static_cast<uint8>(expanded);
+        }
+      }
+      return best;
+    }
+
+    /**
+     * @return Squared error of the quantization.
+     */
+    float
+    quantizeEndpoint(const float* pValue,
+                     const BC7Format& format,
+                     uint32 firstChannel,
+                     uint32 numChannels,
+                     int32 pbit,
+                     uint8* pQuantized,
+                     uint8* pDecoded) {
+      float error = 0.0f;
+      for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+        const uint32 numBits = c < 3 ? format.colorBits : format.alphaBits;
+        if (0 == numBits) {
+          pQuantized[c] = 0;
+          pDecoded[c] = 255;
+        }
+        else {
+          pQuantized[c] = static_cast<uint8>(quantizeChannel(pValue[c],
+                                                             numBits,
+                                                             pbit,
+                                                             pDecoded[c]));
+        }
+        const float d = static_cast<float>(pDecoded[c]) - pValue[c];
+        error += d * d;
+      }
+      return error;
+    }
+
+    /**
+     * @brief Quantizes the endpoints, choosing the p-bits, and finds the
+     *        indices of the texels of mask.
+     * @return Squared error of the texels of mask.
+     */
+    float
+    evaluateSubset(const BlockSoA& block,
+                   uint16 mask,
+                   uint32 firstChannel,
+                   uint32 numChannels,
+                   const BC7Format& format,
+                   uint32 indexBits,
+                   bool bExhaustive,
+                   const float* pLow,
+                   const float* pHigh,
+                   BC7Subset& subset,
+                   uint8* pIndices) {
+      int32 pbitPairs[4][2] = { { -1, -1 } };
+      uint32 numPairs = 1;
+      if (BC7_PBIT::kShared == format.pbits) {
+        pbitPairs[0][0] = pbitPairs[0][1] = 0;
+        pbitPairs[1][0] = pbitPairs[1][1] = 1;
+        numPairs = 2;
+      }
+      else if (BC7_PBIT::kEndpoint == format.pbits) {
+        if (bExhaustive) {
+          for (uint32 i = 0; i < 4; ++i) {
+            pbitPairs[i][0] = static_cast<int32>(i & 1);
+            pbitPairs[i][1] = static_cast<int32>(i >> 1);
+          }
+          numPairs = 4;
+        }
+        else {
+          //The p-bit of each endpoint that quantizes it best
+          const float* endpoints[2] = { pLow, pHigh };
+          for (uint32 e = 0; e < 2; ++e) {
+            uint8 quantized[4];
+            uint8 decoded[4];
+            const float error0 = quantizeEndpoint(endpoints[e], format, firstChannel,
+                                                  numChannels, 0, quantized, decoded);
+            const float error1 = quantizeEndpoint(endpoints[e], format, firstChannel,
+                                                  numChannels, 1, quantized, decoded);
+            pbitPairs[0][e] = error1 < error0 ? 1 : 0;
+          }
+        }
+      }
+
+      const uint32* pWeights = getBC7Weights(indexBits);
+      const uint32 numEntries = 1U << indexBits;
+      float bestError = FLT_MAX;
+      for (uint32 pair = 0; pair < numPairs; ++pair) {
+        BC7Subset candidate;
+        uint8 decoded[2][4] = { { 255, 255, 255, 255 }, { 255, 255, 255, 255 } };
+        memset(candidate.endpoints, 0, sizeof(candidate.endpoints));
+        quantizeEndpoint(pLow, format, firstChannel, numChannels, pbitPairs[pair][0],
+                         candidate.endpoints[0], decoded[0]);
+        quantizeEndpoint(pHigh, format, firstChannel, numChannels, pbitPairs[pair][1],
+                         candidate.endpoints[1], decoded[1]);
+        candidate.pbits[0] = static_cast<uint8>(Math::max(0, pbitPairs[pair][0]));
+        candidate.pbits[1] = static_cast<uint8>(Math::max(0, pbitPairs[pair][1]));
+
+        Palette palette;
+        for (uint32 e = 0; e < numEntries; ++e) {
+          for (uint32 c = 0; c < 4; ++c) {
+            palette[e][c] = static_cast<float>(interpolateBC7(decoded[0][c],
+                                                              decoded[1][c],
+                                                              pWeights[e]));
+          }
+        }
+
+        uint8 indices[16];
+        const float error = findClosest(block, firstChannel, numChannels, palette,
+                                        numEntries, mask, indices);
+        if (error < bestError) {
+          bestError = error;
+          subset = candidate;
+          for (uint32 i = 0; i < 16; ++i) {
+            if ((mask >> i) & 1) {
+              pIndices[i] = indices[i];
+            }
+          }
+        }
+      }
+      return bestError;
+    }
+
+    /**
+     * @brief Fits the endpoints of the texels of mask and refines them by
+     *        least squares.
+     */
+    float
+    fitSubset(const BlockSoA& block,
+              uint16 mask,
+              uint32 firstChannel,
+              uint32 numChannels,
+              const BC7Format& format,
+              uint32 indexBits,
+              const BC7Settings& settings,
+              BC7Subset& subset,
+              uint8* pIndices) {
+      float low[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      float high[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      fitPrincipalAxis(block, mask, firstChannel, numChannels, low, high);
+      float bestError = evaluateSubset(block, mask, firstChannel, numChannels, format,
+                                       indexBits, settings.bExhaustive, low, high,
+                                       subset, pIndices);
+
+      const uint32* pWeights = getBC7Weights(indexBits);
+      float weights[16];
+      for (uint32 i = 0; i < (1U << indexBits); ++i) {
+        weights[i] = static_cast<float>(pWeights[i]) / 64.0f;
+      }
+
+      for (uint32 iteration = 0; iteration < settings.refinements && bestError > 0.0f;
+           ++iteration) {
+        if (!solveEndpoints(block, mask, firstChannel, numChannels, pIndices, weights,
+                            low, high)) {
+          break;
+        }
+
+        BC7Subset candidate;
+        uint8 indices[16];
+        const float error = evaluateSubset(block, mask, firstChannel, numChannels, format,
+                                           indexBits, settings.bExhaustive, low, high,
+                                           candidate, indices);
+        if (error >= bestError) {
+          break;
+        }
+
+        bestError = error;
+        subset = candidate;
+        for (uint32 i = 0; i < 16; ++i) {
+          if ((mask >> i) & 1) {
+            pIndices[i] = indices[i];
+          }
+        }
+      }
+      return bestError;
+    }
+
+    /**
+     * @brief The MSB of the index of the anchor texel isn't stored, so it
+     *        must be zero. Swaps the endpoints and inverts the indices if not.
+     */
+    void
+    fixAnchor(BC7Subset& subset,
+              uint32 firstChannel,
+              uint32 numChannels,
+              uint16 mask,
+              uint32 anchor,
+              uint32 indexBits,
+              uint8* pIndices) {
+      if (pIndices[anchor] < (1U << (indexBits - 1))) {
+        return;
+      }
+
+      for (uint32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+        std::swap(subset.endpoints[0][c], subset.endpoints[1][c]);
+      }
+      std::swap(subset.pbits[0], subset.pbits[1]);
+
+      const uint32 maxIndex = (1U << indexBits) - 1;
+      for (uint32 i = 0; i < 16; ++i) {
+        if ((mask >> i) & 1) {
+          pIndices[i] = static_cast<uint8>(maxIndex - pIndices[i]);
+        }
+      }
+    }
+
+    BC7Format
+    getBC7Format(uint32 mode) {
+      const BC7ModeInfo& info = BC7_MODES[mode];
+      BC7Format format;
+      format.colorBits = info.colorBits;
+      format.alphaBits = info.alphaBits;
+      format.pbits = info.pbits;
+      return format;
+    }
+
+    /**
+     * @brief Modes 1, 3, 6 and 7. Modes 1 and 3 are only for opaque blocks
+     *        and fit the colors alone.
+     */
+    void
+    tryBC7Mode(const BlockSoA& block,
+               uint32 mode,
+               uint32 partition,
+               const BC7Settings& settings,
+               BC7Block& best) {
+      const BC7ModeInfo& info = BC7_MODES[mode];
+      const BC7Format format = getBC7Format(mode);
+      const uint32 numChannels = 0 == info.alphaBits ? 3 : 4;
+      const uint16 mask1 = 2 == info.numSubsets ? BC7_PARTITIONS2[partition] : 0;
+      const uint16 mask0 = static_cast<uint16>(~mask1);
+
+      BC7Block candidate;
+      candidate.mode = mode;
+      candidate.partition = partition;
+      float error = fitSubset(block, mask0, 0, numChannels, format, info.indexBits, settings,
+                              candidate.subsets[0], candidate.indices);
+      if (error >= best.error) {
+        return;
+      }
+
+      if (2 == info.numSubsets) {
+        error += fitSubset(block, mask1, 0, numChannels, format, info.indexBits, settings,
+                           candidate.subsets[1], candidate.indices);
+        if (error >= best.error) {
+          return;
+        }
+        fixAnchor(candidate.subsets[1], 0, 4, mask1, BC7_ANCHORS2[partition],
+                  info.indexBits, candidate.indices);
+      }
+      fixAnchor(candidate.subsets[0], 0, 4, mask0, 0, info.indexBits, candidate.indices);
+
+      candidate.error = error;
+      best = candidate;
+    }
+
+    /**
+     * @brief Modes 4 and 5, colors and alpha with their own indices. The
+     *        rotation swaps alpha with a color channel, so that channel gets
+     *        the indices of its own.
+     */
+    void
+    tryBC7SeparateAlpha(const BlockSoA& block,
+                        uint32 mode,
+                        uint32 rotation,
+                        uint32 indexMode,
+                        const BC7Settings& settings,
+                        BC7Block& best) {
+      BlockSoA rotated = block;
+      if (0 != rotation) {
+        memcpy(rotated.c[rotation - 1], block.c[3], sizeof(block.c[3]));
+        memcpy(rotated.c[3], block.c[rotation - 1], sizeof(block.c[3]));
+      }
+
+      const BC7ModeInfo& info = BC7_MODES[mode];
+      const BC7Format format = getBC7Format(mode);
+      const uint32 colorIndexBits = 1 == indexMode ? info.index2Bits : info.indexBits;
+      const uint32 alphaIndexBits = 1 == indexMode ? info.indexBits : info.index2Bits;
+
+      BC7Block candidate;
+      candidate.mode = mode;
+      candidate.rotation = rotation;
+      candidate.indexMode = indexMode;
+      float error = fitSubset(rotated, 0xFFFF, 0, 3, format, colorIndexBits, settings,
+                              candidate.subsets[0], candidate.indices);
+      if (error >= best.error) {
+        return;
+      }
+
+      BC7Subset alpha;
+      error += fitSubset(rotated, 0xFFFF, 3, 1, format, alphaIndexBits, settings,
+                         alpha, candidate.alphaIndices);
+      if (error >= best.error) {
+        return;
+      }
+
+      fixAnchor(candidate.subsets[0], 0, 3, 0xFFFF, 0, colorIndexBits, candidate.indices);
+      fixAnchor(alpha, 3, 1, 0xFFFF, 0, alphaIndexBits, candidate.alphaIndices);
+      candidate.subsets[0].endpoints[0][3] = alpha.endpoints[0][3];
+      candidate.subsets[0].endpoints[1][3] = alpha.endpoints[1][3];
+
+      candidate.error = error;
+      best = candidate;
+    }
+
+    /**
+     * @brief The partitions with the least error if every subset had
+     *        unlimited indices, best first.
+     */
+    void
+    rankPartitions(const BlockSoA& block,
+                   uint32 numChannels,
+                   uint32 count,
+                   uint32* pPartitions) {
+      //Centered on the mean of the block, the scatter of a subset is the
+      //difference of two sums and loses less precision
+      BlockSoA centered;
+      for (uint32 c = 0; c < numChannels; ++c) {
+        float mean = 0.0f;
+        for (uint32 i = 0; i < 16; ++i) {
+          mean += block.c[c][i];
+        }
+        mean /= 16.0f;
+        for (uint32 i = 0; i < 16; ++i) {
+          centered.c[c][i] = block.c[c][i] - mean;
+        }
+      }
+
+      SubsetSums total;
+      computeSums(centered, 0xFFFF, numChannels, total);
+
+      float estimates[64];
+      uint32 order[64];
+      for (uint32 p = 0; p < 64; ++p) {
+        SubsetSums second;
+        computeSums(centered, BC7_PARTITIONS2[p], numChannels, second);
+
+        SubsetSums first;
+        first.count = total.count - second.count;
+        for (uint32 a = 0; a < numChannels; ++a) {
+          first.sum[a] = total.sum[a] - second.sum[a];
+          for (uint32 b = a; b < numChannels; ++b) {
+            first.products[a][b] = total.products[a][b] - second.products[a][b];
+          }
+        }
+
+        estimates[p] = estimateLineError(first, numChannels) +
+                       estimateLineError(second, numChannels);
+        order[p] = p;
+      }
+
+      std::partial_sort(order, order + count, order + 64, [&](uint32 a, uint32 b) {
+        return estimates[a] < estimates[b];
+      });
+      memcpy(pPartitions, order, count * sizeof(uint32));
+    }
+
+    void
+    packBC7(const BC7Block& block, uint8* pOut) {
+      const BC7ModeInfo& info = BC7_MODES[block.mode];
+      BitWriter writer(pOut);
+      writer.write(1U << block.mode, block.mode + 1);
+      writer.write(block.partition, info.partitionBits);
+      writer.write(block.rotation, info.rotationBits);
+      writer.write(block.indexMode, info.indexModeBits);
+
+      for (uint32 c = 0; c < 3; ++c) {
+        for (uint32 s = 0; s < info.numSubsets; ++s) {
+          writer.write(block.subsets[s].endpoints[0][c], info.colorBits);
+          writer.write(block.subsets[s].endpoints[1][c], info.colorBits);
+        }
+      }
+      if (0 != info.alphaBits) {
+        for (uint32 s = 0; s < info.numSubsets; ++s) {
+          writer.write(block.subsets[s].endpoints[0][3], info.alphaBits);
+          writer.write(block.subsets[s].endpoints[1][3], info.alphaBits);
+        }
+      }
+
+      for (uint32 s = 0; s < info.numSubsets; ++s) {
+        if (BC7_PBIT::kEndpoint == info.pbits) {
+          writer.write(block.subsets[s].pbits[0], 1);
+          writer.write(block.subsets[s].pbits[1], 1);
+        }
+        else if (BC7_PBIT::kShared == info.pbits) {
+          writer.write(block.subsets[s].pbits[0], 1);
+        }
+      }
+
+      //Mode 4 with index mode 1 stores the 2 bit alpha indices first
+      const bool bSwapIndices = 4 == block.mode && 1 == block.indexMode;
+      const uint8* pFirst = bSwapIndices ? block.alphaIndices : block.indices;
+      const uint8* pSecond = bSwapIndices ? block.indices : block.alphaIndices;
+      const uint32 anchor = 2 == info.numSubsets ? BC7_ANCHORS2[block.partition] : 0;
+      for (uint32 i = 0; i < 16; ++i) {
+        const bool bAnchor = 0 == i || anchor == i;
+        writer.write(pFirst[i], info.indexBits - (bAnchor ? 1 : 0));
+      }
+      if (0 != info.index2Bits) {
+        for (uint32 i = 0; i < 16; ++i) {
+          writer.write(pSecond[i], info.index2Bits - (0 == i ? 1 : 0));
+        }
+      }
+    }
+
+    void
+    encodeBC7(const BlockSoA& block, bool bOpaque, BC_QUALITY::E quality, uint8* pOut) {
+      BC7Settings settings;
+      settings.refinements = BC_QUALITY::kFast == quality ? 1 :
+                             (BC_QUALITY::kNormal == quality ? 2 : 3);
+      settings.bExhaustive = BC_QUALITY::kHigh == quality;
+
+      BC7Block best;
+      tryBC7Mode(block, 6, 0, settings, best);
+
+      if (BC_QUALITY::kFast != quality && best.error > 0.0f) {
+        const uint32 numPartitions = settings.bExhaustive ? 64 : 8;
+        uint32 partitions[64];
+        rankPartitions(block, bOpaque ? 3 : 4, numPartitions, partitions);
+        for (uint32 i = 0; i < numPartitions && best.error > 0.0f; ++i) {
+          if (bOpaque) {
+            tryBC7Mode(block, 1, partitions[i], settings, best);
+            tryBC7Mode(block, 3, partitions[i], settings, best);
+          }
+          else {
+            tryBC7Mode(block, 7, partitions[i], settings, best);
+          }
+        }
+
+        if (!bOpaque || settings.bExhaustive) {
+          const uint32 numRotations = settings.bExhaustive ? 4 : 1;
+          for (uint32 rotation = 0; rotation < numRotations && best.error > 0.0f; ++rotation) {
+            tryBC7SeparateAlpha(block, 5, rotation, 0, settings, best);
+            if (settings.bExhaustive) {
+              tryBC7SeparateAlpha(block, 4, rotation, 0, settings, best);
+              tryBC7SeparateAlpha(block, 4, rotation, 1, settings, best);
+            }
+          }
+        }
+      }
+
+      packBC7(best, pOut);
+    }
+
+    void
+    decodeBC7(const uint8* pBlock, uint8* pixels) {
+      uint32 mode = 0;
+      while (mode < 8 && !((pBlock[0] >> mode) & 1)) {
+        ++mode;
+      }
+      if (8 == mode || 3 == BC7_MODES[mode].numSubsets) {
+        memset(pixels, 0, 64);
+        return;
+      }
+
+      const BC7ModeInfo& info = BC7_MODES[mode];
+      BitReader reader(pBlock);
+      reader.read(mode + 1);
+      const uint32 partition = reader.read(info.partitionBits);
+      const uint32 rotation = reader.read(info.rotationBits);
+      const uint32 indexMode = reader.read(info.indexModeBits);
+
+      const uint32 numEndpoints = info.numSubsets * 2;
+      uint32 endpoints[4][4];
+      for (uint32 c = 0; c < 3; ++c) {
+        for (uint32 e = 0; e < numEndpoints; ++e) {
+          endpoints[e][c] = reader.read(info.colorBits);
+        }
+      }
+      for (uint32 e = 0; e < numEndpoints; ++e) {
+        endpoints[e][3] = reader.read(info.alphaBits);
+      }
+
+      uint32 pbits[4] = { 0, 0, 0, 0 };
+      if (BC7_PBIT::kEndpoint == info.pbits) {
+        for (uint32 e = 0; e < numEndpoints; ++e) {
+          pbits[e] = reader.read(1);
+        }
+      }
+      else if (BC7_PBIT::kShared == info.pbits) {
+        for (uint32 s = 0; s < info.numSubsets; ++s) {
+          pbits[s * 2] = pbits[s * 2 + 1] = reader.read(1);
+        }
+      }
+
+      const uint32 pbitBits = BC7_PBIT::kNone == info.pbits ? 0 : 1;
+      for (uint32 e = 0; e < numEndpoints; ++e) {
+        for (uint32 c = 0; c < 4; ++c) {
+          const uint32 numBits = c < 3 ? info.colorBits : info.alphaBits;
+          if (0 == numBits) {
+            endpoints[e][c] = 255;
+          }
+          else if (0 != pbitBits) {
+            endpoints[e][c] = expandBits((endpoints[e][c] << 1) | pbits[e], numBits + 1);
+          }
+          else {
+            endpoints[e][c] = expandBits(endpoints[e][c], numBits);
+          }
+        }
+      }
+
+      const uint32 anchor = 2 == info.numSubsets ? BC7_ANCHORS2[partition] : 0;
+      uint32 indices[16];
+      uint32 indices2[16];
+      for (uint32 i = 0; i < 16; ++i) {
+        const bool bAnchor = 0 == i || anchor == i;
+        indices[i] = reader.read(info.indexBits - (bAnchor ? 1 : 0));
+      }
+      for (uint32 i = 0; i < 16; ++i) {
+        indices2[i] = 0 != info.index2Bits ? reader.read(info.index2Bits - (0 == i ? 1 : 0)) : 0;
+      }
+
+      //Index mode 1 of mode 4 takes the colors from the second indices
+      const bool bSwapIndices = 1 == indexMode;
+      const uint32* pColorIndices = bSwapIndices ? indices2 : indices;
+      const uint32* pAlphaIndices = 0 == info.index2Bits ? indices :
+                                    (bSwapIndices ? indices : indices2);
+      const uint32 colorBits = bSwapIndices ? info.index2Bits : info.indexBits;
+      const uint32 alphaBits = 0 == info.index2Bits ? info.indexBits :
+                               (bSwapIndices ? info.indexBits : info.index2Bits);
+      const uint32* pColorWeights = getBC7Weights(colorBits);
+      const uint32* pAlphaWeights = getBC7Weights(alphaBits);
+
+      for (uint32 i = 0; i < 16; ++i) {
+        const uint32 subset = 2 == info.numSubsets ? (BC7_PARTITIONS2[partition] >> i) & 1 : 0;
+        const uint32* e0 = endpoints[subset * 2];
+        const uint32* e1 = endpoints[subset * 2 + 1];
+        uint8* pPixel = pixels + i * 4;
+        for (uint32 c = 0; c < 3; ++c) {
+          pPixel[c] = static_cast<uint8>(interpolateBC7(e0[c],
+                                                        e1[c],
+                                                        pColorWeights[pColorIndices[i]]));
+        }
+        pPixel[3] = static_cast<uint8>(interpolateBC7(e0[3],
+                                                      e1[3],
+                                                      pAlphaWeights[pAlphaIndices[i]]));
+        if (0 != rotation) {
+          std::swap(pPixel[rotation - 1], pPixel[3]);
+        }
+      }
+    }
+  }
+
+  namespace BlockCompression {
+    uint32
+    getBytesPerBlock(BC_FORMAT::E format) {
+      return BC_FORMAT::kBC1 == format || BC_FORMAT::kBC4 == format ? 8 : 16;
+    }
+
+    uint32
+    getRowPitch(BC_FORMAT::E format, uint32 width) {
+      return Math::max(1U, (width + 3) / 4) * getBytesPerBlock(format);
+    }
+
+    SIZE_T
+    getCompressedSize(BC_FORMAT::E format, uint32 width, uint32 height) {
+      return static_cast<SIZE_T>(getRowPitch(format, width)) * Math::max(1U, (height + 3) / 4);
+    }
+
+    void
+    compress(const TextureImage& src,
+             BC_FORMAT::E format,
+             BC_QUALITY::E quality,
+             uint8* pDst,
+             uint32 dstRowPitch) {
+      GE_ASSERT(src.pData && pDst && src.width > 0 && src.height > 0);
+
+      const uint32 blocksX = (src.width + 3) / 4;
+      const uint32 blocksY = (src.height + 3) / 4;
+      const uint32 bytesPerBlock = getBytesPerBlock(format);
+
+      //A row of BC7 blocks is a lot more work than one of the other formats
+      const uint32 rowsPerTask = BC_FORMAT::kBC7 == format ? 1 : 8;
+      TextureKernels::parallelFor(blocksY, rowsPerTask, [&](uint32 begin, uint32 end) {
+        uint8 pixels[64];
+        for (uint32 y = begin; y < end; ++y) {
+          uint8* pRow = pDst + static_cast<SIZE_T>(y) * dstRowPitch;
+          for (uint32 x = 0; x < blocksX; ++x) {
+            gatherBlock(src, x, y, pixels);
+            compressBlock(pixels, format, quality, pRow + x * bytesPerBlock);
+          }
+        }
+      });
+    }
+
+    void
+    compressMipChain(const TextureMipChain& chain,
+                     BC_FORMAT::E format,
+                     BC_QUALITY::E quality,
+                     Vector<uint8>& data,
+                     Vector<SIZE_T>& offsets) {
+      GE_ASSERT(TEXTURE_PIXEL_FORMAT::kRGBA32F != chain.format);
+
+      offsets.resize(chain.mips.size());
+      SIZE_T totalSize = 0;
+      for (SIZE_T i = 0; i < chain.mips.size(); ++i) {
+        offsets[i] = totalSize;
+        totalSize += getCompressedSize(format, chain.mips[i].width, chain.mips[i].height);
+      }
+
+      data.resize(totalSize);
+      for (SIZE_T i = 0; i < chain.mips.size(); ++i) {
+        const TextureImage& mip = chain.mips[i];
+        compress(mip, format, quality, data.data() + offsets[i], getRowPitch(format, mip.width));
+      }
+    }
+
+    void
+    decompress(const uint8* pSrc,
+               uint32 srcRowPitch,
+               BC_FORMAT::E format,
+               const TextureImage& dst) {
+      GE_ASSERT(pSrc && dst.pData);
+
+      const uint32 blocksX = (dst.width + 3) / 4;
+      const uint32 blocksY = (dst.height + 3) / 4;
+      const uint32 bytesPerBlock = getBytesPerBlock(format);
+      TextureKernels::parallelFor(blocksY, 8, [&](uint32 begin, uint32 end) {
+        uint8 pixels[64];
+        for (uint32 y = begin; y < end; ++y) {
+          const uint8* pRow = pSrc + static_cast<SIZE_T>(y) * srcRowPitch;
+          for (uint32 x = 0; x < blocksX; ++x) {
+            decompressBlock(pRow + x * bytesPerBlock, format, pixels);
+            scatterBlock(pixels, x, y, dst);
+          }
+        }
+      });
+    }
+
+    void
+    compressBlock(const uint8* pixels,
+                  BC_FORMAT::E format,
+                  BC_QUALITY::E quality,
+                  uint8* pBlock) {
+      BlockSoA block;
+      loadBlock(pixels, block);
+
+      uint16 opaqueMask = 0;
+      for (uint32 i = 0; i < 16; ++i) {
+        opaqueMask |= static_cast<uint16>((pixels[i * 4 + 3] >= 128 ? 1 : 0) << i);
+      }
+      const uint32 refinements = BC_QUALITY::kFast == quality ? 1 : 2;
+
+      switch (format) {
+        case BC_FORMAT::kBC1:
+          encodeColorBlock(block, opaqueMask, 0xFFFF != opaqueMask, refinements, pBlock);
+          break;
+        case BC_FORMAT::kBC3:
+          encodeBC4(block, 3, pBlock);
+          encodeColorBlock(block, 0xFFFF, false, refinements, pBlock + 8);
+          break;
+        case BC_FORMAT::kBC4:
+          encodeBC4(block, 0, pBlock);
+          break;
+        case BC_FORMAT::kBC5:
+          encodeBC4(block, 0, pBlock);
+          encodeBC4(block, 1, pBlock + 8);
+          break;
+        case BC_FORMAT::kBC7:
+        {
+          bool bOpaque = true;
+          for (uint32 i = 0; i < 16 && bOpaque; ++i) {
+            bOpaque = 255 == pixels[i * 4 + 3];
+          }
+          encodeBC7(block, bOpaque, quality, pBlock);
+          break;
+        }
+        default:
+          GE_ASSERT(false && "Unknown block format");
+          break;
+      }
+    }
+
+    void
+    decompressBlock(const uint8* pBlock, BC_FORMAT::E format, uint8* pixels) {
+      switch (format) {
+        case BC_FORMAT::kBC1:
+          decodeColorBlock(pBlock, false, pixels);
+          break;
+        case BC_FORMAT::kBC3:
+          decodeColorBlock(pBlock + 8, true, pixels);
+          decodeBC4(pBlock, 3, pixels);
+          break;
+        case BC_FORMAT::kBC4:
+          memset(pixels, 0, 64);
+          decodeBC4(pBlock, 0, pixels);
+          for (uint32 i = 0; i < 16; ++i) {
+            pixels[i * 4 + 3] = 255;
+          }
+          break;
+        case BC_FORMAT::kBC5:
+          memset(pixels, 0, 64);
+          decodeBC4(pBlock, 0, pixels);
+          decodeBC4(pBlock + 8, 1, pixels);
+          for (uint32 i = 0; i < 16; ++i) {
+            pixels[i * 4 + 3] = 255;
+          }
+          break;
+        case BC_FORMAT::kBC7:
+          decodeBC7(pBlock, pixels);
+          break;
+        default:
+          GE_ASSERT(false && "Unknown block format");
+          break;
+      }
+    }
+  }
+} // namespace geEngineSDK
@@ -18,12 +18,34 @@
 /*****************************************************************************/
 
 #include <gePrerequisitesCore.h>
+#include <geGameConfig.h>
 #include "DX11RenderAPI.h"
+#include "geNullRenderAPI.h"
+#include "geTraceRenderAPI.h"
 
 using namespace geEngineSDK;
 
 extern "C" GE_PLUGIN_EXPORT void InitPlugin()
 {
-    //Create the RenderAPI instance
+  //Create the RenderAPI instance
+  auto& config = GameConfig::instance();
+  bool bNullDevice = config.get<uint32>("RenderAPI", "NullDevice", 0) != 0;
+
+  //Captures wrap the backend that does the work
+  if (!config.get<String>("RenderAPI", "TraceCaptureFile", "").empty()) {
+    SPtr<RenderAPI> pBackend;
+    if (bNullDevice) {
+      pBackend = ge_shared_ptr_new<NullRenderAPI>();
+    }
+    else {
+      pBackend = ge_shared_ptr_new<DX11RenderAPI>();
+    }
+    RenderAPI::startUp<TraceRenderAPI>(pBackend);
+  }
+  else if (bNullDevice) {
+    RenderAPI::startUp<NullRenderAPI>();
+  }
+  else {
     RenderAPI::startUp<DX11RenderAPI>();
+  }
 }
@@ -0,0 +1,163 @@
+/*****************************************************************************/
+/**
+ * @file    geNullCommandStream.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   In-memory stream of the calls made to the null render API.
+ *
+ * In-memory stream of the calls made to the null render API.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geNullCommandStream.h"
+#include <cstring>
+#include <utility>
+
+namespace geEngineSDK {
+
+  uint32
+  NullCommandStream::record(const NullCommand& command, const void* pData, uint32 dataSize) {
+    auto index = static_cast<uint32>(m_commands.size());
+    m_commands.push_back(command);
+
+    NullCommand& stored = m_commands.back();
+    if (pData && dataSize) {
+      SIZE_T offset = (m_data.size() + DATA_ALIGNMENT - 1) & ~SIZE_T(DATA_ALIGNMENT - 1);
+      stored.dataOffset = static_cast<uint32>(offset);
+      stored.dataSize = dataSize;
+      m_data.resize(offset + dataSize);
+      memcpy(&m_data[stored.dataOffset], pData, dataSize);
+    }
+    else {
+      stored.dataOffset = 0;
+      stored.dataSize = 0;
+    }
+
+    return index;
+  }
+
+  void
+  NullCommandStream::addError(const String& message) {
+    ++m_numErrors;
+    if (m_errors.size() >= m_maxStoredErrors) {
+      return;
+    }
+
+    NullValidationError error;
+    error.commandIndex = m_commands.empty() ? 0 : static_cast<uint32>(m_commands.size() - 1);
+    error.message = message;
+    m_errors.push_back(error);
+  }
+
+  void
+  NullCommandStream::clear() {
+    m_commands.clear();
+    m_data.clear();
+    m_errors.clear();
+    m_numErrors = 0;
+  }
+
+  void
+  NullCommandStream::assign(Vector<NullCommand>&& commands, Vector<uint8>&& data) {
+    m_commands = std::move(commands);
+    m_data = std::move(data);
+    m_errors.clear();
+    m_numErrors = 0;
+  }
+
+  uint32
+  NullCommandStream::count(NULL_COMMAND::E type) const {
+    uint32 total = 0;
+    for (const auto& command : m_commands) {
+      total += command.type == type ? 1 : 0;
+    }
+    return total;
+  }
+
+  const char*
+  NullCommandStream::getName(NULL_COMMAND::E type) {
+    static const char* s_names[NULL_COMMAND::kNumCommands] = {
+      "CreateTexture",
+      "CreateVertexDeclaration",
+      "CreateStreamOutputDeclaration",
+      "CreateInputLayout",
+      "CreateInputLayoutFromShader",
+      "CreateVertexBuffer",
+      "CreateStreamOutputBuffer",
+      "CreateIndexBuffer",
+      "CreateConstantBuffer",
+      "CreateRasterizerState",
+      "CreateDepthStencilState",
+      "CreateBlendState",
+      "CreateSamplerState",
+      "CreateShader",
+      "ReleaseResource",
+      "BackBuffer",
+      "ResizeSwapChain",
+      "SetTopology",
+      "SetViewports",
+      "SetInputLayout",
+      "SetRasterizerState",
+      "SetDepthStencilState",
+      "SetBlendState",
+      "SetVertexBuffer",
+      "SetIndexBuffer",
+      "SetProgram",
+      "SetShaderResource",
+      "SetUnorderedAccess",
+      "SetConstantBuffer",
+      "SetSampler",
+      "SetRenderTargets",
+      "SetStreamOutput",
+      "SavePipelineState",
+      "RestorePipelineState",
+      "WriteResource",
+      "Map",
+      "Unmap",
+      "CopyResource",
+      "Resolve",
+      "GenerateMips",
+      "ClearRenderTarget",
+      "ClearDepthStencil",
+      "DiscardView",
+      "Draw",
+      "DrawIndexed",
+      "DrawInstanced",
+      "DrawAuto",
+      "Dispatch",
+      "Present"
+    };
+
+    return type < NULL_COMMAND::kNumCommands ? s_names[type] : "Unknown";
+  }
+
+  void
+  NullCommandStream::packStrings(const Vector<String>& strings, Vector<uint8>& outData) {
+    outData.clear();
+    for (const auto& str : strings) {
+      auto pStr = reinterpret_cast<const uint8*>(str.c_str());
+      outData.insert(outData.end(), pStr, pStr + str.size() + 1);
+    }
+  }
+
+  Vector<String>
+  NullCommandStream::unpackStrings(const void* pData, uint32 dataSize) {
+    Vector<String> strings;
+    auto pStr = reinterpret_cast<const char*>(pData);
+    auto pEnd = pStr + dataSize;
+    while (pStr < pEnd) {
+      SIZE_T length = strnlen(pStr, static_cast<SIZE_T>(pEnd - pStr));
+      strings.emplace_back(pStr, length);
+      pStr += length + 1;
+    }
+    return strings;
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,1659 @@
+/*****************************************************************************/
+/**
+ * @file    geNullRenderAPI.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Render API that records and validates calls without a GPU.
+ *
+ * Render API that records and validates calls without a GPU.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geNullRenderAPI.h"
+
+#include <geGameConfig.h>
+#include <geMath.h>
+#include <geDebug.h>
+#include <cstring>
+#include <utility>
+
+namespace geEngineSDK {
+
+  namespace {
+    //Same layout as GRAPHICS_BOX (and D3D11_BOX)
+    struct BoxCoords
+    {
+      uint32 left;
+      uint32 top;
+      uint32 front;
+      uint32 right;
+      uint32 bottom;
+      uint32 back;
+    };
+
+    //Errors beyond this many are stored but not logged
+    constexpr uint32 MAX_LOGGED_ERRORS = 32;
+
+    //Limit of every dimension of a dispatch
+    constexpr uint32 MAX_THREAD_GROUPS_PER_DIMENSION = 65535;
+
+    //Bytes per texel of the widest format, used to back mapped textures
+    constexpr uint32 MAX_BYTES_PER_TEXEL = 16;
+
+    uint32
+    floatAsUInt(float value) {
+      uint32 bits;
+      memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+  }
+
+  NullRenderAPI::~NullRenderAPI() {
+    m_pBackBufferTexture = nullptr;
+  }
+
+  bool
+  NullRenderAPI::initRenderAPI(void* scrHandle, bool bFullScreen) {
+    GE_UNREFERENCED_PARAMETER(scrHandle);
+    GE_UNREFERENCED_PARAMETER(bFullScreen);
+
+    auto& config = GameConfig::instance();
+    uint32 width = config.get<uint32>("RenderAPI", "NullBackBufferWidth", 1920);
+    uint32 height = config.get<uint32>("RenderAPI", "NullBackBufferHeight", 1080);
+    m_bValidation = config.get<uint32>("RenderAPI", "NullValidation", 1) != 0;
+    m_bRecording = config.get<uint32>("RenderAPI", "NullRecordCommands", 1) != 0;
+
+    _createBackBuffer(width, height);
+
+    GRAPHICS_VIEWPORT scDesc_Viewport;
+    scDesc_Viewport.x = 0.0f;
+    scDesc_Viewport.y = 0.0f;
+    scDesc_Viewport.width = float(width);
+    scDesc_Viewport.height = float(height);
+    scDesc_Viewport.zNear = 0.0f;
+    scDesc_Viewport.zFar = 1.0f;
+
+    setViewports({ scDesc_Viewport });
+
+    setRenderTargets({ {m_pBackBufferTexture, 0} }, WeakSPtr<Texture>());
+
+    return true;
+  }
+
+  bool
+  NullRenderAPI::resizeSwapChain(uint32 newWidth, uint32 newHeight) {
+    if (!m_pBackBufferTexture) {
+      return false;
+    }
+
+    //Same as a ClearState on a real device
+    m_state = NullBoundState();
+    m_bindCache.reset();
+    _record(NULL_COMMAND::kResizeSwapChain,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            newWidth,
+            newHeight);
+
+    _createBackBuffer(newWidth, newHeight);
+    return true;
+  }
+
+  bool
+  NullRenderAPI::isMSAAFormatSupported(const GRAPHICS_FORMAT::E format,
+                                       int32& samplesPerPixel,
+                                       int32& sampleQuality) const {
+    GE_UNREFERENCED_PARAMETER(format);
+
+    //Multisampled targets are accepted, but none is reported as supported
+    samplesPerPixel = 1;
+    sampleQuality = 0;
+    return false;
+  }
+
+  void
+  NullRenderAPI::msaaResolveRenderTarget(const WeakSPtr<Texture>& pSrc,
+                                         const WeakSPtr<Texture>& pDst) {
+    if (pDst.expired() || pSrc.expired()) {
+      return;
+    }
+
+    auto pSrcObj = static_cast<NullTexture*>(pSrc.lock().get());
+    auto pDstObj = static_cast<NullTexture*>(pDst.lock().get());
+
+    m_stats.onCopy();
+    _record(NULL_COMMAND::kResolve, _getId(pDstObj), _getId(pSrcObj));
+
+    if (m_bValidation) {
+      if (pSrcObj->m_sampleCount <= 1) {
+        _error("Resolve source isn't multisampled.");
+      }
+      if (pDstObj->m_sampleCount != 1) {
+        _error("Resolve destination is multisampled.");
+      }
+      if (pSrcObj->m_desc.width != pDstObj->m_desc.width ||
+          pSrcObj->m_desc.height != pDstObj->m_desc.height) {
+        _error("Resolve source and destination have different sizes.");
+      }
+    }
+  }
+
+  void
+  NullRenderAPI::reportLiveObjects() {
+    static const char* s_typeNames[RENDER_STAT_RESOURCE::kNumResourceTypes] = {
+      "Textures",
+      "Buffers",
+      "Shaders",
+      "States",
+      "Input layouts"
+    };
+
+    const RenderStats& stats = m_stats.getLastFrame();
+    for (uint32 i = 0; i < RENDER_STAT_RESOURCE::kNumResourceTypes; ++i) {
+      auto msg = StringUtil::format("Null device live {0}: {1}\n",
+                                    s_typeNames[i],
+                                    stats.alive[i]);
+      g_debug().log(msg, LogVerbosity::kInfo);
+    }
+  }
+
+  WeakSPtr<Texture>
+  NullRenderAPI::getBackBuffer() const {
+    return m_pBackBufferTexture;
+  }
+
+  WeakSPtr<RasterizerState>
+  NullRenderAPI::getCurrentRasterizerState() const {
+    return m_state.pRasterizerState;
+  }
+
+  WeakSPtr<DepthStencilState>
+  NullRenderAPI::getCurrentDepthStencilState() const {
+    return m_state.pDepthStencilState;
+  }
+
+  WeakSPtr<BlendState>
+  NullRenderAPI::getCurrentBlendState() const {
+    return m_state.pBlendState;
+  }
+
+  WeakSPtr<SamplerState>
+  NullRenderAPI::getCurrentSamplerState(uint32 samplerSlot) const {
+    if (samplerSlot >= NullBoundState::MAX_SAMPLERS) {
+      return WeakSPtr<SamplerState>();
+    }
+    return m_state.psSamplers[samplerSlot];
+  }
+
+  /*************************************************************************/
+  // Create methods
+  /*************************************************************************/
+  SPtr<Texture>
+  NullRenderAPI::createTexture(uint32 width,
+                               uint32 height,
+                               GRAPHICS_FORMAT::E format,
+                               uint32 bindFlags,
+                               uint32 mipLevels,
+                               RESOURCE_USAGE::E usage,
+                               uint32 cpuAccessFlags,
+                               uint32 sampleCount,
+                               bool isMSAA,
+                               bool isCubeMap,
+                               uint32 arraySize) {
+    if (0 == width || 0 == height) {
+      GE_LOG(kError,
+             RenderAPI,
+             "NullRenderAPI::createTexture called with an empty size.");
+      return nullptr;
+    }
+
+    NullTextureCreateInfo createInfo;
+    createInfo.mipLevels = mipLevels;
+    createInfo.usage = usage;
+    createInfo.cpuAccessFlags = cpuAccessFlags;
+    createInfo.sampleCount = sampleCount;
+    createInfo.bMSAA = isMSAA ? 1 : 0;
+    createInfo.bCubeMap = isCubeMap ? 1 : 0;
+    createInfo.arraySize = arraySize;
+
+    //Record the arguments as they were passed, not the adjusted ones
+    uint32 requestedBindFlags = bindFlags;
+
+    //Depth textures are always sampleable on the DX11 backend
+    if (bindFlags & BIND_FLAG::DEPTH_STENCIL) {
+      bindFlags |= BIND_FLAG::SHADER_RESOURCE;
+    }
+
+    if (0 == mipLevels) {
+      uint32 size = Math::max(width, height);
+      while (size > 1) {
+        size >>= 1;
+        ++mipLevels;
+      }
+      ++mipLevels;
+    }
+
+    auto pTexture = ge_shared_ptr_new<NullTexture>();
+    pTexture->m_desc.width = width;
+    pTexture->m_desc.height = height;
+    pTexture->m_desc.mipLevels = mipLevels;
+    pTexture->m_desc.format = format;
+    pTexture->m_desc.bindFlags = bindFlags;
+    pTexture->m_bIsCubeMap = isCubeMap;
+    pTexture->m_arraySize = Math::max(1U, arraySize) * (isCubeMap ? 6 : 1);
+    pTexture->m_sampleCount = Math::max(1U, sampleCount);
+    pTexture->m_bindFlags = bindFlags;
+    pTexture->m_usage = usage;
+
+    _registerObject(*pTexture, RENDER_STAT_RESOURCE::kTexture);
+    _record(NULL_COMMAND::kCreateTexture,
+            pTexture->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            width,
+            height,
+            static_cast<uint32>(format),
+            requestedBindFlags,
+            &createInfo,
+            sizeof(createInfo));
+
+    if (m_bValidation) {
+      if (isCubeMap && width != height) {
+        _error("Cube map faces must be square.");
+      }
+      if (pTexture->m_sampleCount > 1 && mipLevels > 1) {
+        _error("Multisampled textures can't have mip levels.");
+      }
+      if (usage == RESOURCE_USAGE::STAGING && bindFlags != 0) {
+        _error("Staging textures can't be bound to the pipeline.");
+      }
+    }
+
+    return pTexture;
+  }
+
+  SPtr<VertexDeclaration>
+  NullRenderAPI::createVertexDeclaration(const Vector<VertexElement>& elements) {
+    if (elements.empty()) {
+      GE_LOG(kError,
+             RenderAPI,
+             "NullRenderAPI::createVertexDeclaration called with no elements.");
+      return nullptr;
+    }
+    return ge_shared_ptr_new<VertexDeclaration>(elements);
+  }
+
+  SPtr<StreamOutputDeclaration>
+  NullRenderAPI::createStreamOutputDeclaration(const Vector<StreamOutputElement>& elements) {
+    if (elements.empty()) {
+      GE_LOG(kError,
+             RenderAPI,
+             "NullRenderAPI::createStreamOutputDeclaration called with no elements.");
+      return nullptr;
+    }
+    return ge_shared_ptr_new<StreamOutputDeclaration>(elements);
+  }
+
+  SPtr<InputLayout>
+  NullRenderAPI::createInputLayout(const WeakSPtr<VertexDeclaration>& descArray,
+                                   const WeakSPtr<VertexShader>& pVS) {
+    if (descArray.expired() || pVS.expired()) {
+      GE_LOG(kError,
+             RenderAPI,
+             "NullRenderAPI::createInputLayout called with Invalid Parameters");
+      return nullptr;
+    }
+
+    auto pShader = static_cast<NullShader*>(pVS.lock().get());
+
+    auto inputLayout = ge_shared_ptr_new<NullInputLayout>();
+    inputLayout->m_vertexDeclaration = descArray.lock();
+    _registerObject(*inputLayout, RENDER_STAT_RESOURCE::kInputLayout);
+    _record(NULL_COMMAND::kCreateInputLayout,
+            inputLayout->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0,
+            _getId(pShader));
+
+    if (m_bValidation && pShader->m_stage != NULL_SHADER_STAGE::kVertex) {
+      _error("Input layout created from a shader that isn't a vertex shader.");
+    }
+
+    return inputLayout;
+  }
+
+  SPtr<InputLayout>
+  NullRenderAPI::createInputLayoutFromShader(const WeakSPtr<VertexShader>& pVS) {
+    if (pVS.expired()) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Vertex Shader is expired.");
+      return nullptr;
+    }
+
+    //There is no bytecode to reflect, the layout has no declaration
+    auto pShader = static_cast<NullShader*>(pVS.lock().get());
+    auto inputLayout = ge_shared_ptr_new<NullInputLayout>();
+    _registerObject(*inputLayout, RENDER_STAT_RESOURCE::kInputLayout);
+    _record(NULL_COMMAND::kCreateInputLayoutFromShader,
+            inputLayout->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            _getId(pShader));
+    return inputLayout;
+  }
+
+  SPtr<VertexBuffer>
+  NullRenderAPI::createVertexBuffer(const SPtr<VertexDeclaration>& pDecl,
+                                    const SIZE_T sizeInBytes,
+                                    const void* pInitialData,
+                                    const uint32 usage) {
+    GE_UNREFERENCED_PARAMETER(pInitialData);
+    auto pVB = ge_shared_ptr_new<NullVertexBuffer>();
+    pVB->m_sizeInBytes = sizeInBytes;
+    pVB->m_usage = usage;
+    pVB->m_pVertexDeclaration = pDecl;
+
+    _registerObject(*pVB, RENDER_STAT_RESOURCE::kBuffer);
+    _record(NULL_COMMAND::kCreateVertexBuffer,
+            pVB->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            static_cast<uint32>(sizeInBytes),
+            usage);
+
+    if (m_bValidation && 0 == sizeInBytes) {
+      _error("Vertex buffer created with zero bytes.");
+    }
+
+    return pVB;
+  }
+
+  SPtr<StreamOutputBuffer>
+  NullRenderAPI::createStreamOutputBuffer(const SPtr<StreamOutputDeclaration>& pDecl,
+                                          const SIZE_T sizeInBytes,
+                                          const uint32 usage) {
+    auto pSOB = ge_shared_ptr_new<NullStreamOutputBuffer>();
+    pSOB->m_sizeInBytes = sizeInBytes;
+    pSOB->m_usage = usage;
+    pSOB->m_pStreamOutputDeclaration = pDecl;
+
+    _registerObject(*pSOB, RENDER_STAT_RESOURCE::kBuffer);
+    _record(NULL_COMMAND::kCreateStreamOutputBuffer,
+            pSOB->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            static_cast<uint32>(sizeInBytes),
+            usage);
+
+    if (m_bValidation && 0 == sizeInBytes) {
+      _error("Stream output buffer created with zero bytes.");
+    }
+
+    return pSOB;
+  }
+
+  SPtr<IndexBuffer>
+  NullRenderAPI::createIndexBuffer(const SIZE_T sizeInBytes,
+                                   const void* pInitialData,
+                                   const INDEX_BUFFER_FORMAT::E format,
+                                   const uint32 usage) {
+    GE_UNREFERENCED_PARAMETER(pInitialData);
+    auto pIB = ge_shared_ptr_new<NullIndexBuffer>();
+    pIB->m_sizeInBytes = sizeInBytes;
+    pIB->m_usage = usage;
+
+    if (format == INDEX_BUFFER_FORMAT::R32_UINT) {
+      pIB->m_indexFormat = GRAPHICS_FORMAT::kR32_UINT;
+      pIB->m_indexSize = sizeof(uint32);
+    }
+    else {
+      pIB->m_indexFormat = GRAPHICS_FORMAT::kR16_UINT;
+      pIB->m_indexSize = sizeof(uint16);
+    }
+
+    _registerObject(*pIB, RENDER_STAT_RESOURCE::kBuffer);
+    _record(NULL_COMMAND::kCreateIndexBuffer,
+            pIB->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            static_cast<uint32>(sizeInBytes),
+            usage,
+            static_cast<uint32>(format));
+
+    if (m_bValidation && (0 == sizeInBytes || 0 != sizeInBytes % pIB->m_indexSize)) {
+      _error("Index buffer size isn't a multiple of the index size.");
+    }
+
+    return pIB;
+  }
+
+  SPtr<ConstantBuffer>
+  NullRenderAPI::createConstantBuffer(const SIZE_T sizeInBytes,
+                                      const void* pInitialData,
+                                      const uint32 usage) {
+    GE_UNREFERENCED_PARAMETER(pInitialData);
+    auto pCB = ge_shared_ptr_new<NullConstantBuffer>();
+    pCB->m_sizeInBytes = sizeInBytes;
+    pCB->m_usage = usage;
+
+    _registerObject(*pCB, RENDER_STAT_RESOURCE::kBuffer);
+    _record(NULL_COMMAND::kCreateConstantBuffer,
+            pCB->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            static_cast<uint32>(sizeInBytes),
+            usage);
+
+    if (m_bValidation && (0 == sizeInBytes || 0 != sizeInBytes % 16)) {
+      _error("Constant buffer size must be a non zero multiple of 16 bytes.");
+    }
+
+    return pCB;
+  }
+
+  SPtr<RasterizerState>
+  NullRenderAPI::createRasterizerState(const RASTERIZER_DESC& rasterDesc) {
+    auto pRS = ge_shared_ptr_new<NullRasterizerState>();
+    _registerObject(*pRS, RENDER_STAT_RESOURCE::kState);
+    _record(NULL_COMMAND::kCreateRasterizerState,
+            pRS->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            &rasterDesc,
+            sizeof(RASTERIZER_DESC));
+    return pRS;
+  }
+
+  SPtr<DepthStencilState>
+  NullRenderAPI::createDepthStencilState(const DEPTH_STENCIL_DESC& depthStencilDesc) {
+    auto pDSS = ge_shared_ptr_new<NullDepthStencilState>();
+    _registerObject(*pDSS, RENDER_STAT_RESOURCE::kState);
+    _record(NULL_COMMAND::kCreateDepthStencilState,
+            pDSS->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            &depthStencilDesc,
+            sizeof(DEPTH_STENCIL_DESC));
+    return pDSS;
+  }
+
+  SPtr<BlendState>
+  NullRenderAPI::createBlendState(const BLEND_DESC& blendDesc,
+                                  const Vector4 blendFactors,
+                                  const uint32 sampleMask) {
+    auto pBS = ge_shared_ptr_new<NullBlendState>();
+    pBS->m_blendFactors = blendFactors;
+    pBS->m_sampleMask = sampleMask;
+    _registerObject(*pBS, RENDER_STAT_RESOURCE::kState);
+
+    NullBlendCreateInfo createInfo;
+    createInfo.desc = blendDesc;
+    createInfo.blendFactors = blendFactors;
+    _record(NULL_COMMAND::kCreateBlendState,
+            pBS->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            sampleMask,
+            0, 0, 0,
+            &createInfo,
+            sizeof(createInfo));
+    return pBS;
+  }
+
+  SPtr<SamplerState>
+  NullRenderAPI::createSamplerState(const SAMPLER_DESC& samplerDesc) {
+    auto pSS = ge_shared_ptr_new<NullSamplerState>();
+    _registerObject(*pSS, RENDER_STAT_RESOURCE::kState);
+    _record(NULL_COMMAND::kCreateSamplerState,
+            pSS->m_nullId,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            &samplerDesc,
+            sizeof(SAMPLER_DESC));
+    return pSS;
+  }
+
+  /*************************************************************************/
+  // Create Shaders
+  /*************************************************************************/
+  SPtr<NullShader>
+  NullRenderAPI::_createShader(NULL_SHADER_STAGE::E stage,
+                               const char* stagePrefix,
+                               CREATE_SHADER_PARAMS) {
+    auto pShader = ge_shared_ptr_new<NullShader>();
+    pShader->m_stage = stage;
+    pShader->m_debugName = szEntryPoint;
+    _registerObject(*pShader, RENDER_STAT_RESOURCE::kShader);
+
+    Vector<String> strings = { fileName.toString(), szEntryPoint, szShaderModel };
+    for (const auto& macro : pMacro) {
+      strings.push_back(macro.name);
+      strings.push_back(macro.definition);
+    }
+    NullCommandStream::packStrings(strings, m_scratchData);
+    _record(NULL_COMMAND::kCreateShader,
+            pShader->m_nullId,
+            0,
+            stage,
+            0, 0, 0, 0,
+            m_scratchData.data(),
+            static_cast<uint32>(m_scratchData.size()));
+
+    if (m_bValidation && !StringUtil::startsWith(szShaderModel, stagePrefix)) {
+      _error(StringUtil::format("Shader model {0} of '{1}' in {2} doesn't match its stage.",
+                                szShaderModel,
+                                szEntryPoint,
+                                fileName.toString()));
+    }
+
+    return pShader;
+  }
+
+  SPtr<VertexShader>
+  NullRenderAPI::createVertexShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kVertex, "vs_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<PixelShader>
+  NullRenderAPI::createPixelShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kPixel, "ps_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<GeometryShader>
+  NullRenderAPI::createGeometryShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kGeometry, "gs_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<GeometryShader>
+  NullRenderAPI::createGeometryShaderWithStreamOutput(CREATE_SHADER_PARAMS,
+                                    const SPtr<StreamOutputDeclaration>& pDecl) {
+    auto pShader = _createShader(NULL_SHADER_STAGE::kGeometry, "gs_",
+                                 fileName, pMacro, szEntryPoint, szShaderModel);
+    if (m_bValidation && !pDecl) {
+      _error("Geometry shader with stream output created without a declaration.");
+    }
+    return pShader;
+  }
+
+  SPtr<HullShader>
+  NullRenderAPI::createHullShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kHull, "hs_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<DomainShader>
+  NullRenderAPI::createDomainShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kDomain, "ds_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<ComputeShader>
+  NullRenderAPI::createComputeShader(CREATE_SHADER_PARAMS) {
+    return _createShader(NULL_SHADER_STAGE::kCompute, "cs_",
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  /*************************************************************************/
+  // Write Functions
+  /*************************************************************************/
+  void
+  NullRenderAPI::writeToResource(const WeakSPtr<GraphicsResource>& pResource,
+                                 uint32 dstSubRes,
+                                 const GRAPHICS_BOX* pDstBox,
+                                 const void* pSrcData,
+                                 uint32 srcRowPitch,
+                                 uint32 srcDepthPitch,
+                                 uint32 copyFlags) {
+    if (pResource.expired()) {
+      return;
+    }
+
+    auto pRes = pResource.lock();
+    NullObject* pObj = _getObject(pRes.get());
+    auto pBox = reinterpret_cast<const BoxCoords*>(pDstBox);
+
+    //Same accounting as the DX11 backend: rows times the source pitch
+    SIZE_T bytes = 0;
+    if (RENDER_STAT_RESOURCE::kBuffer == pObj->m_nullType) {
+      bytes = pBox ? pBox->right - pBox->left : pObj->m_sizeInBytes;
+    }
+    else {
+      auto pTexture = static_cast<NullTexture*>(pRes.get());
+      uint32 mip = dstSubRes % Math::max(1U, pTexture->m_desc.mipLevels);
+      uint32 rows = pBox ? pBox->bottom - pBox->top :
+                           Math::max(1U, pTexture->m_desc.height >> mip);
+      uint32 depth = pBox ? pBox->back - pBox->front : 1;
+      bytes = static_cast<SIZE_T>(srcRowPitch) * rows +
+              static_cast<SIZE_T>(srcDepthPitch) * (depth > 0 ? depth - 1 : 0);
+    }
+    m_stats.onUpload(bytes);
+
+    _record(NULL_COMMAND::kWriteResource,
+            _getId(pObj),
+            dstSubRes,
+            NULL_SHADER_STAGE::kNumStages,
+            srcRowPitch,
+            srcDepthPitch,
+            copyFlags,
+            pDstBox ? 1 : 0,
+            pDstBox,
+            pDstBox ? sizeof(GRAPHICS_BOX) : 0);
+
+    if (m_bValidation) {
+      if (!pSrcData) {
+        _error("writeToResource called without source data.");
+      }
+      if (pObj->m_usage == RESOURCE_USAGE::DYNAMIC) {
+        _error("Dynamic resources can't be written with writeToResource.");
+      }
+      if (pObj->m_numMapped) {
+        _error("Resource written while it is mapped.");
+      }
+      if (RENDER_STAT_RESOURCE::kBuffer == pObj->m_nullType &&
+          pBox && pBox->right > pObj->m_sizeInBytes) {
+        _error("Write outside of the buffer.");
+      }
+    }
+  }
+
+  MappedSubresource
+  NullRenderAPI::mapToRead(const WeakSPtr<GraphicsResource>& pResource,
+                           uint32 subResource,
+                           uint32 mapFlags) {
+    MappedSubresource mappedSubresource;
+    ge_zero_out(mappedSubresource);
+
+    if (pResource.expired()) {
+      return mappedSubresource;
+    }
+
+    auto pRes = pResource.lock();
+    NullObject* pObj = _getObject(pRes.get());
+
+    m_stats.onMap();
+    _record(NULL_COMMAND::kMap,
+            _getId(pObj),
+            subResource,
+            NULL_SHADER_STAGE::kNumStages,
+            mapFlags);
+
+    if (m_bValidation && pObj->m_usage != RESOURCE_USAGE::STAGING) {
+      _error("Only staging resources can be mapped for reading.");
+    }
+
+    //Rows as wide as the widest format, a pitch every format fits in (and
+    //the mips, like the padded pitches of a real driver)
+    SIZE_T rowPitch = pObj->m_sizeInBytes;
+    SIZE_T size = pObj->m_sizeInBytes;
+    if (RENDER_STAT_RESOURCE::kTexture == pObj->m_nullType) {
+      auto pTexture = static_cast<NullTexture*>(pRes.get());
+      rowPitch = static_cast<SIZE_T>(pTexture->m_desc.width) * MAX_BYTES_PER_TEXEL;
+      size = rowPitch * pTexture->m_desc.height;
+    }
+
+    if (pObj->m_cpuData.empty()) {
+      pObj->m_cpuData.resize(size);
+    }
+
+    ++pObj->m_numMapped;
+    ++m_numMappedResources;
+    mappedSubresource.pData = pObj->m_cpuData.data();
+    mappedSubresource.RowPitch = static_cast<uint32>(rowPitch);
+    mappedSubresource.DepthPitch = static_cast<uint32>(size);
+    return mappedSubresource;
+  }
+
+  void
+  NullRenderAPI::unmap(const WeakSPtr<GraphicsResource>& pResource,
+                       uint32 subResource) {
+    if (pResource.expired()) {
+      return;
+    }
+
+    auto pRes = pResource.lock();
+    NullObject* pObj = _getObject(pRes.get());
+
+    m_stats.onUnmap();
+    _record(NULL_COMMAND::kUnmap, _getId(pObj), subResource);
+
+    if (0 == pObj->m_numMapped) {
+      if (m_bValidation) {
+        _error("Unmap of a resource that isn't mapped.");
+      }
+      return;
+    }
+
+    --pObj->m_numMapped;
+    --m_numMappedResources;
+  }
+
+  void
+  NullRenderAPI::copyResource(const WeakSPtr<GraphicsResource>& pSrcObj,
+                              const WeakSPtr<GraphicsResource>& pDstObj) {
+    if (pSrcObj.expired() || pDstObj.expired()) {
+      return;
+    }
+
+    auto pSrcRes = pSrcObj.lock();
+    auto pDstRes = pDstObj.lock();
+    NullObject* pSrc = _getObject(pSrcRes.get());
+    NullObject* pDst = _getObject(pDstRes.get());
+
+    m_stats.onCopy();
+    _record(NULL_COMMAND::kCopyResource, _getId(pDst), _getId(pSrc));
+
+    if (!m_bValidation) {
+      return;
+    }
+
+    if (pSrc == pDst) {
+      _error("Resource copied onto itself.");
+    }
+    else if (pSrc->m_nullType != pDst->m_nullType) {
+      _error("Copy between a texture and a buffer.");
+    }
+    else if (RENDER_STAT_RESOURCE::kBuffer == pSrc->m_nullType) {
+      if (pSrc->m_sizeInBytes != pDst->m_sizeInBytes) {
+        _error("Copy between buffers of different sizes.");
+      }
+    }
+    else {
+      const auto& srcDesc = static_cast<NullTexture*>(pSrcRes.get())->m_desc;
+      const auto& dstDesc = static_cast<NullTexture*>(pDstRes.get())->m_desc;
+      if (srcDesc.width != dstDesc.width ||
+          srcDesc.height != dstDesc.height ||
+          srcDesc.mipLevels != dstDesc.mipLevels ||
+          srcDesc.format != dstDesc.format) {
+        _error("Copy between textures with different descriptions.");
+      }
+    }
+
+    if (pDst->m_numMapped) {
+      _error("Copy to a resource that is mapped.");
+    }
+  }
+
+  void
+  NullRenderAPI::generateMips(const WeakSPtr<Texture>& pTexture) {
+    if (pTexture.expired()) {
+      return;
+    }
+
+    auto pObj = pTexture.lock();
+    auto pNullObj = static_cast<NullTexture*>(pObj.get());
+    _record(NULL_COMMAND::kGenerateMips, _getId(pNullObj));
+
+    if (m_bValidation) {
+      if (pNullObj->m_desc.mipLevels <= 1) {
+        _error("generateMips on a texture without mip levels.");
+      }
+      if (!(pNullObj->m_bindFlags & BIND_FLAG::SHADER_RESOURCE)) {
+        _error("generateMips on a texture that can't be sampled.");
+      }
+    }
+  }
+
+  void
+  NullRenderAPI::clearRenderTarget(const WeakSPtr<Texture>& pRenderTarget,
+                                   const LinearColor& color) {
+    if (pRenderTarget.expired()) {
+      return;
+    }
+
+    auto pObj = pRenderTarget.lock();
+    auto pNullObj = static_cast<NullTexture*>(pObj.get());
+
+    m_stats.onClear();
+    _record(NULL_COMMAND::kClearRenderTarget,
+            _getId(pNullObj),
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            &color,
+            sizeof(LinearColor));
+
+    if (m_bValidation && !(pNullObj->m_bindFlags & BIND_FLAG::RENDER_TARGET)) {
+      _error("Clear of a texture that isn't a render target.");
+    }
+  }
+
+  void
+  NullRenderAPI::clearDepthStencil(const WeakSPtr<Texture>& pDepthStencilView,
+                                   uint32 flags,
+                                   float depthVal,
+                                   uint8 stencilVal) {
+    if (pDepthStencilView.expired()) {
+      return;
+    }
+
+    auto pObj = pDepthStencilView.lock();
+    auto pNullObj = static_cast<NullTexture*>(pObj.get());
+
+    m_stats.onClear();
+    _record(NULL_COMMAND::kClearDepthStencil,
+            _getId(pNullObj),
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            flags,
+            floatAsUInt(depthVal),
+            stencilVal);
+
+    if (m_bValidation && !(pNullObj->m_bindFlags & BIND_FLAG::DEPTH_STENCIL)) {
+      _error("Clear of a texture that isn't a depth stencil.");
+    }
+  }
+
+  void
+  NullRenderAPI::discardView(WeakSPtr<Texture> pTexture) {
+    if (pTexture.expired()) {
+      return;
+    }
+
+    auto pObj = pTexture.lock();
+    auto pNullObj = static_cast<NullTexture*>(pObj.get());
+    _record(NULL_COMMAND::kDiscardView, _getId(pNullObj));
+
+    if (m_bValidation &&
+        !(pNullObj->m_bindFlags & (BIND_FLAG::RENDER_TARGET | BIND_FLAG::DEPTH_STENCIL))) {
+      _error("Texture has no RTV or DSV to discard.");
+    }
+  }
+
+  void
+  NullRenderAPI::present() {
+    _record(NULL_COMMAND::kPresent);
+
+    if (m_bValidation && m_numMappedResources) {
+      _error(StringUtil::format("{0} subresources are still mapped at present.",
+                                m_numMappedResources));
+    }
+
+    m_stats.endFrame();
+
+    //Keep the allocations of the previous frame for the next one
+    std::swap(m_commands, m_lastFrameCommands);
+    m_commands.clear();
+    m_numLoggedErrors = 0;
+  }
+
+  /*************************************************************************/
+  // Set Objects
+  /*************************************************************************/
+  void
+  NullRenderAPI::setImmediateContext() {
+    //There is only one context
+  }
+
+  void
+  NullRenderAPI::setTopology(PRIMITIVE_TOPOLOGY::E topologyType) {
+    auto topology = static_cast<uint32>(topologyType);
+    m_stats.onBind(RENDER_STAT_BIND::kTopology, m_bindCache.setTopology(topology));
+    m_state.topology = topology;
+    _record(NULL_COMMAND::kSetTopology, 0, 0, NULL_SHADER_STAGE::kNumStages, topology);
+  }
+
+  void
+  NullRenderAPI::setViewports(const Vector<GRAPHICS_VIEWPORT>& viewports) {
+    auto numViewports = static_cast<uint32>(viewports.size());
+
+    m_stats.onBind(RENDER_STAT_BIND::kViewports,
+      m_bindCache.setViewports(reinterpret_cast<const float*>(viewports.data()), numViewports));
+    m_state.numViewports = numViewports;
+    _record(NULL_COMMAND::kSetViewports,
+            0,
+            numViewports,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            viewports.data(),
+            static_cast<uint32>(sizeof(GRAPHICS_VIEWPORT) * numViewports));
+
+    if (!m_bValidation) {
+      return;
+    }
+
+    if (0 == numViewports || numViewports > NullBoundState::MAX_VIEWPORTS) {
+      _error(StringUtil::format("Invalid number of viewports: {0}.", numViewports));
+    }
+
+    for (const auto& viewport : viewports) {
+      if (viewport.width <= 0.0f || viewport.height <= 0.0f) {
+        _error("Viewport with an empty size.");
+        break;
+      }
+    }
+  }
+
+  void
+  NullRenderAPI::setInputLayout(const WeakSPtr<InputLayout>& pInputLayout) {
+    NullInputLayout* pLayout = nullptr;
+    if (!pInputLayout.expired()) {
+      pLayout = static_cast<NullInputLayout*>(pInputLayout.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kInputLayout, m_bindCache.setInputLayout(pLayout));
+    m_state.inputLayout = _getId(pLayout);
+    _record(NULL_COMMAND::kSetInputLayout, m_state.inputLayout);
+  }
+
+  void
+  NullRenderAPI::setRasterizerState(const WeakSPtr<RasterizerState>& pRasterizerState) {
+    NullRasterizerState* pRS = nullptr;
+    if (!pRasterizerState.expired()) {
+      pRS = static_cast<NullRasterizerState*>(pRasterizerState.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kRasterizerState, m_bindCache.setRasterizerState(pRS));
+    m_state.rasterizerState = _getId(pRS);
+    m_state.pRasterizerState = pRasterizerState;
+    _record(NULL_COMMAND::kSetRasterizerState, m_state.rasterizerState);
+  }
+
+  void
+  NullRenderAPI::setDepthStencilState(const WeakSPtr<DepthStencilState>& pDepthStencilState,
+                                      uint32 stencilRef) {
+    NullDepthStencilState* pDSS = nullptr;
+    if (!pDepthStencilState.expired()) {
+      pDSS = static_cast<NullDepthStencilState*>(pDepthStencilState.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kDepthStencilState,
+                   m_bindCache.setDepthStencilState(pDSS, stencilRef));
+    m_state.depthStencilState = _getId(pDSS);
+    m_state.pDepthStencilState = pDepthStencilState;
+    _record(NULL_COMMAND::kSetDepthStencilState,
+            m_state.depthStencilState,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            stencilRef);
+  }
+
+  void
+  NullRenderAPI::setBlendState(const WeakSPtr<BlendState>& pBlendState) {
+    NullBlendState* pBS = nullptr;
+    Vector4 blendFactors(geEngineSDK::FORCE_INIT::kForceInitToZero);
+    uint32 sampleMask = NumLimit::MAX_UINT32;
+    if (!pBlendState.expired()) {
+      pBS = static_cast<NullBlendState*>(pBlendState.lock().get());
+      blendFactors = pBS->m_blendFactors;
+      sampleMask = pBS->m_sampleMask;
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kBlendState,
+                   m_bindCache.setBlendState(pBS, &blendFactors[0], sampleMask));
+    m_state.blendState = _getId(pBS);
+    m_state.pBlendState = pBlendState;
+    _record(NULL_COMMAND::kSetBlendState,
+            m_state.blendState,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            sampleMask);
+  }
+
+  void
+  NullRenderAPI::setVertexBuffer(const WeakSPtr<VertexBuffer>& pVertexBuffer,
+                                 uint32 startSlot,
+                                 uint32 offset) {
+    NullVertexBuffer* pVB = nullptr;
+    uint32 stride = 0;
+    if (!pVertexBuffer.expired()) {
+      pVB = static_cast<NullVertexBuffer*>(pVertexBuffer.lock().get());
+      if (pVB->m_pVertexDeclaration) {
+        stride = pVB->m_pVertexDeclaration->getProperties().getVertexSize(0);
+      }
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kVertexBuffer,
+                   m_bindCache.setVertexBuffer(startSlot, pVB, stride, offset));
+    _record(NULL_COMMAND::kSetVertexBuffer,
+            _getId(pVB),
+            startSlot,
+            NULL_SHADER_STAGE::kNumStages,
+            stride,
+            offset);
+
+    if (startSlot >= NullBoundState::MAX_VERTEX_BUFFERS) {
+      if (m_bValidation) {
+        _error(StringUtil::format("Vertex buffer slot {0} out of range.", startSlot));
+      }
+      return;
+    }
+    m_state.vertexBuffers[startSlot] = _getId(pVB);
+
+    if (m_bValidation && pVB && offset >= pVB->m_sizeInBytes) {
+      _error("Vertex buffer offset past the end of the buffer.");
+    }
+  }
+
+  void
+  NullRenderAPI::setIndexBuffer(const WeakSPtr<IndexBuffer>& pIndexBuffer,
+                                uint32 offset) {
+    NullIndexBuffer* pIB = nullptr;
+    if (!pIndexBuffer.expired()) {
+      pIB = static_cast<NullIndexBuffer*>(pIndexBuffer.lock().get());
+    }
+
+    m_state.indexBuffer = _getId(pIB);
+    m_state.indexBufferSize = pIB ? pIB->m_sizeInBytes : 0;
+    m_state.indexSize = pIB ? pIB->m_indexSize : 0;
+    m_state.indexOffset = offset;
+
+    m_stats.onBind(RENDER_STAT_BIND::kIndexBuffer,
+                   m_bindCache.setIndexBuffer(pIB, m_state.indexSize, offset));
+    _record(NULL_COMMAND::kSetIndexBuffer,
+            m_state.indexBuffer,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            offset);
+  }
+
+  /*************************************************************************/
+  // Set Shaders
+  /*************************************************************************/
+  void
+  NullRenderAPI::_setProgram(NULL_SHADER_STAGE::E stage, const WeakSPtr<Shader>& pInShader) {
+    NullShader* pShader = nullptr;
+    if (!pInShader.expired()) {
+      pShader = static_cast<NullShader*>(pInShader.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kShader, m_bindCache.setShader(stage, pShader));
+    m_state.shaders[stage] = _getId(pShader);
+    _record(NULL_COMMAND::kSetProgram, m_state.shaders[stage], 0, stage);
+
+    if (m_bValidation && pShader && pShader->m_stage != stage) {
+      _error(StringUtil::format("Shader '{0}' bound to the wrong stage.", pShader->getName()));
+    }
+  }
+
+  void
+  NullRenderAPI::vsSetProgram(const WeakSPtr<VertexShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kVertex, pInShader);
+  }
+
+  void
+  NullRenderAPI::psSetProgram(const WeakSPtr<PixelShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kPixel, pInShader);
+  }
+
+  void
+  NullRenderAPI::gsSetProgram(const WeakSPtr<GeometryShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kGeometry, pInShader);
+  }
+
+  void
+  NullRenderAPI::hsSetProgram(const WeakSPtr<HullShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kHull, pInShader);
+  }
+
+  void
+  NullRenderAPI::dsSetProgram(const WeakSPtr<DomainShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kDomain, pInShader);
+  }
+
+  void
+  NullRenderAPI::csSetProgram(const WeakSPtr<ComputeShader>& pInShader) {
+    _setProgram(NULL_SHADER_STAGE::kCompute, pInShader);
+  }
+
+  /*************************************************************************/
+  // Set Shaders Resources
+  /*************************************************************************/
+  void
+  NullRenderAPI::_setShaderResource(NULL_SHADER_STAGE::E stage,
+                                    const WeakSPtr<Texture>& pTexture,
+                                    uint32 startSlot) {
+    NullTexture* pTx = nullptr;
+    if (!pTexture.expired()) {
+      pTx = static_cast<NullTexture*>(pTexture.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kShaderResource,
+                   m_bindCache.setShaderResource(stage, startSlot, pTx));
+    _record(NULL_COMMAND::kSetShaderResource, _getId(pTx), startSlot, stage);
+
+    if (startSlot >= NullBoundState::MAX_SRVS) {
+      if (m_bValidation) {
+        _error(StringUtil::format("Shader resource slot {0} out of range.", startSlot));
+      }
+      return;
+    }
+    m_state.srvs[stage][startSlot] = _getId(pTx);
+
+    if (!m_bValidation || !pTx) {
+      return;
+    }
+
+    if (!(pTx->m_bindFlags & BIND_FLAG::SHADER_RESOURCE)) {
+      _error("Texture bound as shader resource without the shader resource flag.");
+    }
+    if (NULL_SHADER_STAGE::kCompute != stage && _isBoundAsTarget(pTx->m_nullId)) {
+      _error("Texture bound as shader resource while it is a bound render target.");
+    }
+  }
+
+  void
+  NullRenderAPI::vsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kVertex, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::psSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kPixel, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::gsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kGeometry, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::hsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kHull, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::dsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kDomain, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                     const uint32 startSlot) {
+    _setShaderResource(NULL_SHADER_STAGE::kCompute, pTexture, startSlot);
+  }
+
+  void
+  NullRenderAPI::csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                                          const uint32 startSlot) {
+    NullTexture* pTx = nullptr;
+    if (!pTexture.expired()) {
+      pTx = static_cast<NullTexture*>(pTexture.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kUnorderedAccess,
+                   m_bindCache.setUnorderedAccess(startSlot, pTx));
+    _record(NULL_COMMAND::kSetUnorderedAccess,
+            _getId(pTx),
+            startSlot,
+            NULL_SHADER_STAGE::kCompute);
+
+    if (startSlot >= NullBoundState::MAX_UAVS) {
+      if (m_bValidation) {
+        _error(StringUtil::format("Unordered access slot {0} out of range.", startSlot));
+      }
+      return;
+    }
+    m_state.uavs[startSlot] = _getId(pTx);
+
+    if (m_bValidation && pTx && !(pTx->m_bindFlags & BIND_FLAG::UNORDERED_ACCESS)) {
+      _error("Texture bound as unordered access without the unordered access flag.");
+    }
+  }
+
+  /*************************************************************************/
+  // Set Constant Buffers
+  /*************************************************************************/
+  void
+  NullRenderAPI::_setConstantBuffer(NULL_SHADER_STAGE::E stage,
+                                    const WeakSPtr<ConstantBuffer>& pBuffer,
+                                    uint32 startSlot) {
+    NullConstantBuffer* pCB = nullptr;
+    if (!pBuffer.expired()) {
+      pCB = static_cast<NullConstantBuffer*>(pBuffer.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kConstantBuffer,
+                   m_bindCache.setConstantBuffer(stage, startSlot, pCB));
+    _record(NULL_COMMAND::kSetConstantBuffer, _getId(pCB), startSlot, stage);
+
+    if (m_bValidation && startSlot >= NullBoundState::MAX_CONSTANT_BUFFERS) {
+      _error(StringUtil::format("Constant buffer slot {0} out of range.", startSlot));
+    }
+  }
+
+  void
+  NullRenderAPI::vsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kVertex, pBuffer, startSlot);
+  }
+
+  void
+  NullRenderAPI::psSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kPixel, pBuffer, startSlot);
+  }
+
+  void
+  NullRenderAPI::gsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kGeometry, pBuffer, startSlot);
+  }
+
+  void
+  NullRenderAPI::hsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kHull, pBuffer, startSlot);
+  }
+
+  void
+  NullRenderAPI::dsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kDomain, pBuffer, startSlot);
+  }
+
+  void
+  NullRenderAPI::csSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                     const uint32 startSlot) {
+    _setConstantBuffer(NULL_SHADER_STAGE::kCompute, pBuffer, startSlot);
+  }
+
+  /*************************************************************************/
+  // Set Samplers
+  /*************************************************************************/
+  void
+  NullRenderAPI::_setSampler(NULL_SHADER_STAGE::E stage,
+                             const WeakSPtr<SamplerState>& pSampler,
+                             uint32 startSlot) {
+    NullSamplerState* pSS = nullptr;
+    if (!pSampler.expired()) {
+      pSS = static_cast<NullSamplerState*>(pSampler.lock().get());
+    }
+
+    m_stats.onBind(RENDER_STAT_BIND::kSampler,
+                   m_bindCache.setSampler(stage, startSlot, pSS));
+    _record(NULL_COMMAND::kSetSampler, _getId(pSS), startSlot, stage);
+
+    if (startSlot >= NullBoundState::MAX_SAMPLERS) {
+      if (m_bValidation) {
+        _error(StringUtil::format("Sampler slot {0} out of range.", startSlot));
+      }
+      return;
+    }
+
+    if (NULL_SHADER_STAGE::kPixel == stage) {
+      m_state.psSamplers[startSlot] = pSampler;
+    }
+  }
+
+  void
+  NullRenderAPI::vsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kVertex, pSampler, startSlot);
+  }
+
+  void
+  NullRenderAPI::psSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kPixel, pSampler, startSlot);
+  }
+
+  void
+  NullRenderAPI::gsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kGeometry, pSampler, startSlot);
+  }
+
+  void
+  NullRenderAPI::hsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kHull, pSampler, startSlot);
+  }
+
+  void
+  NullRenderAPI::dsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kDomain, pSampler, startSlot);
+  }
+
+  void
+  NullRenderAPI::csSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                              const uint32 startSlot) {
+    _setSampler(NULL_SHADER_STAGE::kCompute, pSampler, startSlot);
+  }
+
+  /*************************************************************************/
+  // Set Render Targets
+  /*************************************************************************/
+  void
+  NullRenderAPI::setRenderTargets(const Vector<RenderTarget>& pTargets,
+                                  const WeakSPtr<Texture>& pDepthStencilView) {
+    auto numTargets = static_cast<uint32>(pTargets.size());
+    if (numTargets > NullBoundState::MAX_RENDER_TARGETS) {
+      if (m_bValidation) {
+        _record(NULL_COMMAND::kSetRenderTargets);
+        _error(StringUtil::format("{0} render targets bound, the limit is {1}.",
+                                  numTargets,
+                                  NullBoundState::MAX_RENDER_TARGETS));
+      }
+      numTargets = NullBoundState::MAX_RENDER_TARGETS;
+    }
+
+    const void* pObjects[NullBoundState::MAX_RENDER_TARGETS] = {};
+    NullTexture* pTextures[NullBoundState::MAX_RENDER_TARGETS] = {};
+    NullRenderTargetBinding bindings[NullBoundState::MAX_RENDER_TARGETS];
+    for (uint32 i = 0; i < numTargets; ++i) {
+      const RenderTarget& target = pTargets[i];
+      if (!target.pRenderTarget.expired()) {
+        pTextures[i] = static_cast<NullTexture*>(target.pRenderTarget.lock().get());
+      }
+      pObjects[i] = pTextures[i];
+      m_state.renderTargets[i] = _getId(pTextures[i]);
+      bindings[i].id = m_state.renderTargets[i];
+      bindings[i].mipLevel = target.mipLevel;
+    }
+    for (uint32 i = numTargets; i < NullBoundState::MAX_RENDER_TARGETS; ++i) {
+      m_state.renderTargets[i] = 0;
+    }
+
+    NullTexture* pDepth = nullptr;
+    if (!pDepthStencilView.expired()) {
+      pDepth = static_cast<NullTexture*>(pDepthStencilView.lock().get());
+    }
+
+    m_state.numRenderTargets = numTargets;
+    m_state.depthTarget = _getId(pDepth);
+
+    m_stats.onBind(RENDER_STAT_BIND::kRenderTargets,
+                   m_bindCache.setRenderTargets(pObjects, numTargets, pDepth));
+    _record(NULL_COMMAND::kSetRenderTargets,
+            m_state.depthTarget,
+            numTargets,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            bindings,
+            static_cast<uint32>(sizeof(NullRenderTargetBinding) * numTargets));
+
+    if (!m_bValidation) {
+      return;
+    }
+
+    //Every target must match the size and sample count of the first one
+    NullTexture* pReference = pDepth;
+    uint32 referenceMip = 0;
+    for (uint32 i = 0; i < numTargets; ++i) {
+      NullTexture* pTexture = pTextures[i];
+      if (!pTexture) {
+        continue;
+      }
+
+      if (!(pTexture->m_bindFlags & BIND_FLAG::RENDER_TARGET)) {
+        _error("Texture bound as render target without the render target flag.");
+      }
+      if (bindings[i].mipLevel >= pTexture->m_desc.mipLevels) {
+        _error(StringUtil::format("Render target mip {0} doesn't exist.",
+                                  bindings[i].mipLevel));
+      }
+
+      if (!pReference) {
+        pReference = pTexture;
+        referenceMip = bindings[i].mipLevel;
+      }
+      else if (pReference->m_sampleCount != pTexture->m_sampleCount ||
+               (pReference->m_desc.width >> referenceMip) !=
+                 (pTexture->m_desc.width >> bindings[i].mipLevel)) {
+        _error("Render targets with different sizes or sample counts.");
+      }
+    }
+
+    if (pDepth && !(pDepth->m_bindFlags & BIND_FLAG::DEPTH_STENCIL)) {
+      _error("Texture bound as depth stencil without the depth stencil flag.");
+    }
+
+    //A target that is still bound as shader resource would be unbound by D3D
+    for (uint32 stage = 0; stage < NULL_SHADER_STAGE::kCompute; ++stage) {
+      for (uint32 slot = 0; slot < NullBoundState::MAX_SRVS; ++slot) {
+        uint32 id = m_state.srvs[stage][slot];
+        if (id && _isBoundAsTarget(id)) {
+          _error("Render target is still bound as a shader resource.");
+          return;
+        }
+      }
+    }
+  }
+
+  void
+  NullRenderAPI::setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) {
+    NullStreamOutputBuffer* pSOB = nullptr;
+    if (!pBuffer.expired()) {
+      pSOB = static_cast<NullStreamOutputBuffer*>(pBuffer.lock().get());
+    }
+
+    m_state.streamOutput = _getId(pSOB);
+    _record(NULL_COMMAND::kSetStreamOutput, m_state.streamOutput);
+  }
+
+  /*************************************************************************/
+  // State Management Functions
+  /*************************************************************************/
+  SPtr<PipelineState>
+  NullRenderAPI::savePipelineState() const {
+    auto pBkState = ge_shared_ptr_new<NullPipelineState>();
+    pBkState->m_state = m_state;
+    return pBkState;
+  }
+
+  void
+  NullRenderAPI::restorePipelineState(const WeakSPtr<PipelineState>& pState) {
+    if (pState.expired()) {
+      return;
+    }
+
+    auto pOldState = static_cast<NullPipelineState*>(pState.lock().get());
+    m_state = pOldState->m_state;
+
+    //The restored state bypasses the bind cache
+    m_bindCache.invalidate();
+    _record(NULL_COMMAND::kRestorePipelineState);
+  }
+
+  /*************************************************************************/
+  // Draw Functions
+  /*************************************************************************/
+  void
+  NullRenderAPI::draw(uint32 vertexCount, uint32 startVertexLocation) {
+    m_stats.onDraw();
+    _record(NULL_COMMAND::kDraw,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            vertexCount,
+            startVertexLocation);
+    _validateDraw();
+  }
+
+  void
+  NullRenderAPI::drawIndexed(uint32 indexCount,
+                             uint32 startIndexLocation,
+                             int32 baseVertexLocation) {
+    m_stats.onDraw();
+    _record(NULL_COMMAND::kDrawIndexed,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            indexCount,
+            startIndexLocation,
+            static_cast<uint32>(baseVertexLocation));
+    _validateDraw();
+
+    if (!m_bValidation) {
+      return;
+    }
+
+    if (!m_state.indexBuffer) {
+      _error("Indexed draw without an index buffer.");
+      return;
+    }
+
+    SIZE_T lastByte = m_state.indexOffset +
+      (static_cast<SIZE_T>(startIndexLocation) + indexCount) * m_state.indexSize;
+    if (lastByte > m_state.indexBufferSize) {
+      _error(StringUtil::format("Indexed draw reads {0} bytes of a {1} bytes index buffer.",
+                                lastByte,
+                                m_state.indexBufferSize));
+    }
+  }
+
+  void
+  NullRenderAPI::drawInstanced(uint32 vertexCountPerInstance,
+                               uint32 instanceCount,
+                               uint32 startVertexLocation,
+                               uint32 startInstanceLocation) {
+    m_stats.onDraw();
+    _record(NULL_COMMAND::kDrawInstanced,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            vertexCountPerInstance,
+            instanceCount,
+            startVertexLocation,
+            startInstanceLocation);
+    _validateDraw();
+  }
+
+  void
+  NullRenderAPI::drawAuto() {
+    m_stats.onDraw();
+    _record(NULL_COMMAND::kDrawAuto);
+    _validateDraw();
+  }
+
+  void
+  NullRenderAPI::dispatch(uint32 threadGroupCountX,
+                          uint32 threadGroupCountY,
+                          uint32 threadGroupCountZ) {
+    m_stats.onDispatch();
+    _record(NULL_COMMAND::kDispatch,
+            0,
+            0,
+            NULL_SHADER_STAGE::kCompute,
+            threadGroupCountX,
+            threadGroupCountY,
+            threadGroupCountZ);
+
+    if (!m_bValidation) {
+      return;
+    }
+
+    if (!m_state.shaders[NULL_SHADER_STAGE::kCompute]) {
+      _error("Dispatch without a compute shader.");
+    }
+    if (threadGroupCountX > MAX_THREAD_GROUPS_PER_DIMENSION ||
+        threadGroupCountY > MAX_THREAD_GROUPS_PER_DIMENSION ||
+        threadGroupCountZ > MAX_THREAD_GROUPS_PER_DIMENSION) {
+      _error("Dispatch exceeds the thread group limit per dimension.");
+    }
+  }
+
+  /*************************************************************************/
+  // Helpers
+  /*************************************************************************/
+  void
+  NullRenderAPI::_createBackBuffer(uint32 width, uint32 height) {
+    auto pTexture = createTexture(width,
+                                  height,
+                                  GRAPHICS_FORMAT::kR8G8B8A8_UNORM,
+                                  BIND_FLAG::RENDER_TARGET);
+    m_pBackBufferTexture = std::static_pointer_cast<NullTexture>(pTexture);
+    _record(NULL_COMMAND::kBackBuffer, _getId(m_pBackBufferTexture.get()));
+  }
+
+  void
+  NullRenderAPI::_registerObject(NullObject& object, RENDER_STAT_RESOURCE::E type) {
+    object.m_nullId = m_nextObjectId++;
+    object.m_nullType = type;
+    RenderStatsCounter::onResourceCreated(type);
+  }
+
+  void
+  NullRenderAPI::_validateDraw() {
+    if (!m_bValidation) {
+      return;
+    }
+
+    if (!m_state.shaders[NULL_SHADER_STAGE::kVertex]) {
+      _error("Draw without a vertex shader.");
+    }
+    if (!m_state.topology) {
+      _error("Draw without a primitive topology.");
+    }
+    if (m_state.vertexBuffers[0] && !m_state.inputLayout) {
+      _error("Draw with vertex buffers but no input layout.");
+    }
+    if (0 == m_state.numViewports) {
+      _error("Draw without viewports.");
+    }
+  }
+
+  bool
+  NullRenderAPI::_isBoundAsTarget(uint32 textureId) const {
+    if (textureId == m_state.depthTarget) {
+      return true;
+    }
+
+    for (uint32 i = 0; i < m_state.numRenderTargets; ++i) {
+      if (m_state.renderTargets[i] == textureId) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void
+  NullRenderAPI::_record(NULL_COMMAND::E type,
+                         uint32 resourceId,
+                         uint32 slot,
+                         NULL_SHADER_STAGE::E stage,
+                         uint32 arg0,
+                         uint32 arg1,
+                         uint32 arg2,
+                         uint32 arg3,
+                         const void* pData,
+                         uint32 dataSize) {
+    if (!m_bRecording) {
+      return;
+    }
+
+    NullCommand command;
+    command.type = type;
+    command.stage = stage;
+    command.slot = slot;
+    command.resourceId = resourceId;
+    command.args[0] = arg0;
+    command.args[1] = arg1;
+    command.args[2] = arg2;
+    command.args[3] = arg3;
+    m_commands.record(command, pData, dataSize);
+  }
+
+  void
+  NullRenderAPI::_error(const String& message) {
+    m_commands.addError(message);
+
+    if (m_numLoggedErrors < MAX_LOGGED_ERRORS) {
+      ++m_numLoggedErrors;
+      GE_LOG(kWarning, RenderAPI, "Null device: {0}", message);
+    }
+  }
+
+} // namespace geEngineSDK
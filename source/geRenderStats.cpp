@@ -0,0 +1,149 @@
+/*****************************************************************************/
+/**
+ * @file    geRenderStats.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU side counters of the render API calls.
+ *
+ * CPU side counters of the render API calls.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geRenderStats.h"
+#include <cstring>
+
+namespace geEngineSDK {
+
+  std::atomic<uint64> RenderStatsCounter::s_created[RENDER_STAT_RESOURCE::kNumResourceTypes];
+  std::atomic<uint64> RenderStatsCounter::s_released[RENDER_STAT_RESOURCE::kNumResourceTypes];
+
+  void
+  RenderStatsCounter::endFrame() {
+    for (uint32 i = 0; i < RENDER_STAT_RESOURCE::kNumResourceTypes; ++i) {
+      uint64 created = s_created[i].load(std::memory_order_relaxed);
+      uint64 released = s_released[i].load(std::memory_order_relaxed);
+
+      m_current.created[i] = static_cast<uint32>(created - m_createdAtFrameStart[i]);
+      m_current.released[i] = static_cast<uint32>(released - m_releasedAtFrameStart[i]);
+      m_current.alive[i] = created > released ? created - released : 0;
+
+      m_createdAtFrameStart[i] = created;
+      m_releasedAtFrameStart[i] = released;
+    }
+
+    m_lastFrame = m_current;
+
+    uint64 frameIndex = m_current.frameIndex;
+    m_current = RenderStats();
+    m_current.frameIndex = frameIndex + 1;
+  }
+
+  void
+  RenderBindCache::reset() {
+    memset(this, 0, sizeof(RenderBindCache));
+    m_sampleMask = 0xffffffff;
+    m_topology = 0;
+  }
+
+  void
+  RenderBindCache::invalidate() {
+    //No real object lives at this address, so nothing compares equal to it
+    memset(this, 0xff, sizeof(RenderBindCache));
+  }
+
+  bool
+  RenderBindCache::setVertexBuffer(uint32 slot,
+                                   const void* pBuffer,
+                                   uint32 stride,
+                                   uint32 offset) {
+    if (slot >= MAX_VERTEX_BUFFERS) {
+      return false;
+    }
+
+    bool bRedundant = m_vertexBuffers[slot] == pBuffer &&
+                      m_vertexStrides[slot] == stride &&
+                      m_vertexOffsets[slot] == offset;
+    m_vertexBuffers[slot] = pBuffer;
+    m_vertexStrides[slot] = stride;
+    m_vertexOffsets[slot] = offset;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setIndexBuffer(const void* pBuffer, uint32 format, uint32 offset) {
+    bool bRedundant = m_indexBuffer == pBuffer &&
+                      m_indexFormat == format &&
+                      m_indexOffset == offset;
+    m_indexBuffer = pBuffer;
+    m_indexFormat = format;
+    m_indexOffset = offset;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setDepthStencilState(const void* pState, uint32 stencilRef) {
+    bool bRedundant = m_depthStencilState == pState && m_stencilRef == stencilRef;
+    m_depthStencilState = pState;
+    m_stencilRef = stencilRef;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setBlendState(const void* pState,
+                                 const float blendFactors[4],
+                                 uint32 sampleMask) {
+    bool bRedundant = m_blendState == pState &&
+                      m_sampleMask == sampleMask &&
+                      0 == memcmp(m_blendFactors, blendFactors, sizeof(m_blendFactors));
+    m_blendState = pState;
+    memcpy(m_blendFactors, blendFactors, sizeof(m_blendFactors));
+    m_sampleMask = sampleMask;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setTopology(uint32 topology) {
+    bool bRedundant = m_topology == topology;
+    m_topology = topology;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setRenderTargets(const void* const* ppTargets,
+                                    uint32 numTargets,
+                                    const void* pDepth) {
+    if (numTargets > MAX_RENDER_TARGETS) {
+      return false;
+    }
+
+    bool bRedundant = m_numRenderTargets == numTargets &&
+                      m_depthTarget == pDepth &&
+                      0 == memcmp(m_renderTargets, ppTargets, sizeof(void*) * numTargets);
+    memcpy(m_renderTargets, ppTargets, sizeof(void*) * numTargets);
+    m_numRenderTargets = numTargets;
+    m_depthTarget = pDepth;
+    return bRedundant;
+  }
+
+  bool
+  RenderBindCache::setViewports(const float* pViewports, uint32 numViewports) {
+    if (numViewports > MAX_VIEWPORTS) {
+      return false;
+    }
+
+    SIZE_T size = sizeof(float) * 6 * numViewports;
+    bool bRedundant = m_numViewports == numViewports &&
+                      0 == memcmp(m_viewports, pViewports, size);
+    memcpy(m_viewports, pViewports, size);
+    m_numViewports = numViewports;
+    return bRedundant;
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,926 @@
+/*****************************************************************************/
+/**
+ * @file    geRenderTrace.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Binary traces of the render API calls and their replay.
+ *
+ * Binary traces of the render API calls and their replay.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geRenderTrace.h"
+
+#include <geFileSystem.h>
+#include <geDataStream.h>
+#include <geDebug.h>
+#include <geMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+namespace geEngineSDK {
+
+  namespace {
+    //Same layout as GRAPHICS_BOX (and D3D11_BOX)
+    struct BoxCoords
+    {
+      uint32 left;
+      uint32 top;
+      uint32 front;
+      uint32 right;
+      uint32 bottom;
+      uint32 back;
+    };
+
+    bool
+    isBlockCompressed(uint32 format) {
+      return (format >= GRAPHICS_FORMAT::kBC1_TYPELESS &&
+              format <= GRAPHICS_FORMAT::kBC5_SNORM) ||
+             (format >= GRAPHICS_FORMAT::kBC6H_TYPELESS &&
+              format <= GRAPHICS_FORMAT::kBC7_UNORM_SRGB);
+    }
+
+    /**
+     * @brief Id of the object a command creates, 0 if it doesn't create one.
+     */
+    uint32
+    getCreatedId(const NullCommand& command) {
+      if (command.type <= NULL_COMMAND::kCreateShader ||
+          NULL_COMMAND::kBackBuffer == command.type ||
+          NULL_COMMAND::kSavePipelineState == command.type) {
+        return command.resourceId;
+      }
+      return 0;
+    }
+
+    uint32
+    getNumObjects(const NullCommandStream& frame, uint32 numObjects) {
+      for (const auto& command : frame.getCommands()) {
+        const uint32 id = getCreatedId(command);
+        if (id >= numObjects) {
+          numObjects = id + 1;
+        }
+      }
+      return numObjects;
+    }
+
+    /**
+     * @brief True if every object id a command references is below
+     *        numObjects. The replay reads the same ids.
+     */
+    bool
+    areIdsValid(const NullCommandStream& frame,
+                const NullCommand& command,
+                uint32 numObjects) {
+      const uint32* args = command.args;
+      bool bValid = command.resourceId < numObjects;
+
+      switch (command.type)
+      {
+      case NULL_COMMAND::kCreateInputLayout:
+        bValid &= args[0] < numObjects && args[1] < numObjects;
+        break;
+      case NULL_COMMAND::kCreateInputLayoutFromShader:
+        bValid &= args[0] < numObjects;
+        break;
+      case NULL_COMMAND::kCreateVertexBuffer:
+      case NULL_COMMAND::kCreateStreamOutputBuffer:
+        bValid &= args[2] < numObjects;
+        break;
+      case NULL_COMMAND::kCreateShader:
+        if (NULL_SHADER_STAGE::kGeometry == command.stage) {
+          bValid &= args[0] < numObjects;
+        }
+        break;
+      case NULL_COMMAND::kCopyResource:
+      case NULL_COMMAND::kResolve:
+        bValid &= command.slot < numObjects;
+        break;
+      case NULL_COMMAND::kSetRenderTargets:
+      {
+        auto pBindings = reinterpret_cast<const NullRenderTargetBinding*>(frame.getData(command));
+        const uint32 numTargets = command.dataSize / sizeof(NullRenderTargetBinding);
+        for (uint32 i = 0; i < numTargets; ++i) {
+          bValid &= pBindings[i].id < numObjects;
+        }
+        break;
+      }
+      default:
+        break;
+      }
+      return bValid;
+    }
+
+    uint32
+    getFullMipChain(uint32 width, uint32 height) {
+      uint32 mipLevels = 1;
+      uint32 size = Math::max(width, height);
+      while (size > 1) {
+        size >>= 1;
+        ++mipLevels;
+      }
+      return mipLevels;
+    }
+
+    /**
+     * @brief Copies the data of a command into a descriptor, false if the
+     *        size doesn't match (trace from a different build).
+     */
+    template<class T>
+    bool
+    readData(const NullCommandStream& frame, const NullCommand& command, T& outValue) {
+      if (command.dataSize != sizeof(T)) {
+        return false;
+      }
+      memcpy(&outValue, frame.getData(command), sizeof(T));
+      return true;
+    }
+
+    float
+    getPercentile(const Vector<float>& sortedTimes, float percentile) {
+      auto rank = static_cast<SIZE_T>(std::ceil(percentile / 100.0f * sortedTimes.size()));
+      rank = Math::max(rank, SIZE_T(1));
+      return sortedTimes[Math::min(rank, sortedTimes.size()) - 1];
+    }
+  }
+
+  /*************************************************************************/
+  // RenderTrace
+  /*************************************************************************/
+  void
+  RenderTrace::addFrame(const NullCommandStream& frame, bool bSetup) {
+    GE_ASSERT(!bSetup || m_numSetupFrames == m_frames.size());
+    m_frames.push_back(frame);
+    m_numSetupFrames += bSetup ? 1 : 0;
+    m_numObjects = getNumObjects(frame, m_numObjects);
+  }
+
+  void
+  RenderTrace::clear() {
+    m_frames.clear();
+    m_numSetupFrames = 0;
+    m_numObjects = 0;
+  }
+
+  bool
+  RenderTrace::save(const Path& filePath) const {
+    auto stream = FileSystem::createAndOpenFile(filePath);
+    if (!stream) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to create the render trace file: {0}",
+             filePath.toString());
+      return false;
+    }
+
+    RenderTraceHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.commandSize = sizeof(NullCommand);
+    header.numFrames = getNumFrames();
+    header.numSetupFrames = m_numSetupFrames;
+    stream->write(&header, sizeof(header));
+
+    for (const auto& frame : m_frames) {
+      RenderTraceFrameHeader frameHeader;
+      frameHeader.numCommands = frame.getNumCommands();
+      frameHeader.dataSize = static_cast<uint32>(frame.getDataSize());
+      stream->write(&frameHeader, sizeof(frameHeader));
+
+      if (frameHeader.numCommands) {
+        stream->write(frame.getCommands().data(),
+                      sizeof(NullCommand) * frameHeader.numCommands);
+      }
+      if (frameHeader.dataSize) {
+        stream->write(frame.getDataPool().data(), frameHeader.dataSize);
+      }
+    }
+
+    stream->close();
+    return true;
+  }
+
+  bool
+  RenderTrace::load(const Path& filePath) {
+    clear();
+
+    auto stream = FileSystem::openFile(filePath);
+    if (!stream) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Failed to open the render trace file: {0}",
+             filePath.toString());
+      return false;
+    }
+
+    RenderTraceHeader header;
+    if (stream->read(&header, sizeof(header)) != sizeof(header) ||
+        header.magic != MAGIC ||
+        header.version != VERSION ||
+        header.commandSize != sizeof(NullCommand) ||
+        header.numSetupFrames > header.numFrames) {
+      GE_LOG(kError,
+             RenderAPI,
+             "{0} isn't a render trace of this version",
+             filePath.toString());
+      return false;
+    }
+
+    //The counts of the file are checked against what is left of it before
+    //anything is allocated from them
+    SIZE_T bytesLeft = stream->size() - sizeof(header);
+    if (header.numFrames > bytesLeft / sizeof(RenderTraceFrameHeader)) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Render trace {0} is truncated",
+             filePath.toString());
+      return false;
+    }
+
+    m_frames.resize(header.numFrames);
+    for (auto& frame : m_frames) {
+      RenderTraceFrameHeader frameHeader;
+      if (stream->read(&frameHeader, sizeof(frameHeader)) != sizeof(frameHeader)) {
+        break;
+      }
+      bytesLeft -= sizeof(frameHeader);
+
+      if (frameHeader.numCommands > bytesLeft / sizeof(NullCommand)) {
+        break;
+      }
+      SIZE_T commandBytes = sizeof(NullCommand) * frameHeader.numCommands;
+      if (frameHeader.dataSize > bytesLeft - commandBytes) {
+        break;
+      }
+      bytesLeft -= commandBytes + frameHeader.dataSize;
+
+      Vector<NullCommand> commands(frameHeader.numCommands);
+      Vector<uint8> data(frameHeader.dataSize);
+      if ((commandBytes && stream->read(commands.data(), commandBytes) != commandBytes) ||
+          (frameHeader.dataSize &&
+           stream->read(data.data(), frameHeader.dataSize) != frameHeader.dataSize)) {
+        break;
+      }
+
+      //Don't trust offsets that point outside of the data pool
+      for (const auto& command : commands) {
+        if (command.type >= NULL_COMMAND::kNumCommands ||
+            static_cast<SIZE_T>(command.dataOffset) + command.dataSize > data.size()) {
+          GE_LOG(kError,
+                 RenderAPI,
+                 "Corrupted command in render trace {0}",
+                 filePath.toString());
+          clear();
+          return false;
+        }
+      }
+
+      frame.assign(std::move(commands), std::move(data));
+      --header.numFrames;
+    }
+
+    if (header.numFrames) {
+      GE_LOG(kError,
+             RenderAPI,
+             "Render trace {0} is truncated",
+             filePath.toString());
+      clear();
+      return false;
+    }
+
+    //The replay indexes its objects with the ids, they must be ones the
+    //trace creates. The ids are given in order, one per create command, so
+    //they can't go past the number of commands either
+    uint32 numObjects = 0;
+    SIZE_T numCommands = 0;
+    for (const auto& frame : m_frames) {
+      numObjects = getNumObjects(frame, numObjects);
+      numCommands += frame.getNumCommands();
+    }
+    for (const auto& frame : m_frames) {
+      for (const auto& command : frame.getCommands()) {
+        if (numObjects > numCommands + 1 ||
+            !areIdsValid(frame, command, numObjects)) {
+          GE_LOG(kError,
+                 RenderAPI,
+                 "Render trace {0} references an object it doesn't create",
+                 filePath.toString());
+          clear();
+          return false;
+        }
+      }
+    }
+
+    m_numSetupFrames = header.numSetupFrames;
+    m_numObjects = numObjects;
+    return true;
+  }
+
+  SIZE_T
+  RenderTrace::getWriteSize(const RenderTraceResourceInfo& info,
+                            uint32 dstSubRes,
+                            const GRAPHICS_BOX* pDstBox,
+                            uint32 srcRowPitch,
+                            uint32 srcDepthPitch) {
+    auto pBox = reinterpret_cast<const BoxCoords*>(pDstBox);
+    if (info.bBuffer) {
+      return pBox ? pBox->right - pBox->left : info.sizeInBytes;
+    }
+
+    uint32 mip = dstSubRes % Math::max(1U, info.mipLevels);
+    uint32 rows = pBox ? pBox->bottom - pBox->top : Math::max(1U, info.height >> mip);
+    uint32 depth = pBox ? pBox->back - pBox->front : 1;
+    if (isBlockCompressed(info.format)) {
+      rows = (rows + 3) / 4;
+    }
+
+    return static_cast<SIZE_T>(srcRowPitch) * rows +
+           static_cast<SIZE_T>(srcDepthPitch) * (depth > 0 ? depth - 1 : 0);
+  }
+
+  /*************************************************************************/
+  // RenderTraceReplayStats
+  /*************************************************************************/
+  void
+  RenderTraceReplayStats::computeSummary() {
+    if (frameTimesMs.empty()) {
+      return;
+    }
+
+    Vector<float> sortedTimes = frameTimesMs;
+    std::sort(sortedTimes.begin(), sortedTimes.end());
+
+    totalMs = 0.0f;
+    for (auto time : sortedTimes) {
+      totalMs += time;
+    }
+
+    meanMs = totalMs / sortedTimes.size();
+    minMs = sortedTimes.front();
+    maxMs = sortedTimes.back();
+    p50Ms = getPercentile(sortedTimes, 50.0f);
+    p90Ms = getPercentile(sortedTimes, 90.0f);
+    p95Ms = getPercentile(sortedTimes, 95.0f);
+    p99Ms = getPercentile(sortedTimes, 99.0f);
+  }
+
+  /*************************************************************************/
+  // RenderTraceReplayer
+  /*************************************************************************/
+  RenderTraceReplayStats
+  RenderTraceReplayer::replay(const RenderTrace& trace, uint32 numLoops) {
+    using Clock = std::chrono::steady_clock;
+
+    RenderTraceReplayStats stats;
+    const auto& frames = trace.getFrames();
+    const uint32 numSetupFrames = trace.getNumSetupFrames();
+    if (m_objects.size() < trace.getNumObjects()) {
+      m_objects.resize(trace.getNumObjects());
+    }
+
+    for (uint32 i = 0; i < numSetupFrames; ++i) {
+      for (const auto& command : frames[i].getCommands()) {
+        _execute(frames[i], command);
+      }
+    }
+
+    stats.frameTimesMs.reserve((frames.size() - numSetupFrames) * numLoops);
+    for (uint32 loop = 0; loop < numLoops; ++loop) {
+      for (SIZE_T i = numSetupFrames; i < frames.size(); ++i) {
+        const NullCommandStream& frame = frames[i];
+
+        auto start = Clock::now();
+        for (const auto& command : frame.getCommands()) {
+          _execute(frame, command);
+        }
+        auto end = Clock::now();
+
+        std::chrono::duration<float, std::milli> elapsed = end - start;
+        stats.frameTimesMs.push_back(elapsed.count());
+        stats.numCommands += frame.getNumCommands();
+      }
+    }
+
+    stats.computeSummary();
+    return stats;
+  }
+
+  void
+  RenderTraceReplayer::reset() {
+    m_objects.clear();
+    m_scratch.clear();
+  }
+
+  RenderTraceReplayer::ReplayObject&
+  RenderTraceReplayer::_getObject(uint32 id) {
+    if (id >= m_objects.size()) {
+      m_nullObject = ReplayObject();
+      return m_nullObject;
+    }
+    return m_objects[id];
+  }
+
+  SPtr<GraphicsResource>
+  RenderTraceReplayer::_getResource(uint32 id) {
+    switch (_getObject(id).createdBy)
+    {
+    case NULL_COMMAND::kCreateTexture:
+    case NULL_COMMAND::kBackBuffer:
+      return _get<Texture>(id);
+    case NULL_COMMAND::kCreateVertexBuffer:
+      return _get<VertexBuffer>(id);
+    case NULL_COMMAND::kCreateStreamOutputBuffer:
+      return _get<StreamOutputBuffer>(id);
+    case NULL_COMMAND::kCreateIndexBuffer:
+      return _get<IndexBuffer>(id);
+    case NULL_COMMAND::kCreateConstantBuffer:
+      return _get<ConstantBuffer>(id);
+    default:
+      return nullptr;
+    }
+  }
+
+  void
+  RenderTraceReplayer::_executeCreate(const NullCommandStream& frame,
+                                      const NullCommand& command) {
+    const uint32* args = command.args;
+    const void* pData = frame.getData(command);
+
+    ReplayObject object;
+    object.createdBy = command.type;
+
+    switch (command.type)
+    {
+    case NULL_COMMAND::kCreateTexture:
+    {
+      NullTextureCreateInfo createInfo;
+      readData(frame, command, createInfo);
+      object.pObject = m_renderAPI.createTexture(args[0],
+                                     args[1],
+                                     static_cast<GRAPHICS_FORMAT::E>(args[2]),
+                                     args[3],
+                                     createInfo.mipLevels,
+                                     static_cast<RESOURCE_USAGE::E>(createInfo.usage),
+                                     createInfo.cpuAccessFlags,
+                                     createInfo.sampleCount,
+                                     createInfo.bMSAA != 0,
+                                     createInfo.bCubeMap != 0,
+                                     createInfo.arraySize);
+      object.info.width = args[0];
+      object.info.height = args[1];
+      object.info.format = args[2];
+      object.info.mipLevels = createInfo.mipLevels ? createInfo.mipLevels :
+                                getFullMipChain(args[0], args[1]);
+      break;
+    }
+    case NULL_COMMAND::kCreateVertexDeclaration:
+    {
+      auto pElements = reinterpret_cast<const VertexElement*>(pData);
+      Vector<VertexElement> elements(pElements,
+                                     pElements + command.dataSize / sizeof(VertexElement));
+      object.pObject = m_renderAPI.createVertexDeclaration(elements);
+      break;
+    }
+    case NULL_COMMAND::kCreateStreamOutputDeclaration:
+    {
+      auto pElements = reinterpret_cast<const StreamOutputElement*>(pData);
+      Vector<StreamOutputElement> elements(pElements,
+                            pElements + command.dataSize / sizeof(StreamOutputElement));
+      object.pObject = m_renderAPI.createStreamOutputDeclaration(elements);
+      break;
+    }
+    case NULL_COMMAND::kCreateInputLayout:
+      object.pObject = m_renderAPI.createInputLayout(_get<VertexDeclaration>(args[0]),
+                                                     _get<VertexShader>(args[1]));
+      break;
+    case NULL_COMMAND::kCreateInputLayoutFromShader:
+      object.pObject = m_renderAPI.createInputLayoutFromShader(_get<VertexShader>(args[0]));
+      break;
+    case NULL_COMMAND::kCreateVertexBuffer:
+      object.pObject = m_renderAPI.createVertexBuffer(_get<VertexDeclaration>(args[2]),
+                                                      args[0],
+                                                      pData,
+                                                      args[1]);
+      object.info.bBuffer = true;
+      object.info.sizeInBytes = args[0];
+      break;
+    case NULL_COMMAND::kCreateStreamOutputBuffer:
+      object.pObject =
+        m_renderAPI.createStreamOutputBuffer(_get<StreamOutputDeclaration>(args[2]),
+                                             args[0],
+                                             args[1]);
+      object.info.bBuffer = true;
+      object.info.sizeInBytes = args[0];
+      break;
+    case NULL_COMMAND::kCreateIndexBuffer:
+      object.pObject = m_renderAPI.createIndexBuffer(args[0],
+                                        pData,
+                                        static_cast<INDEX_BUFFER_FORMAT::E>(args[2]),
+                                        args[1]);
+      object.info.bBuffer = true;
+      object.info.sizeInBytes = args[0];
+      break;
+    case NULL_COMMAND::kCreateConstantBuffer:
+      object.pObject = m_renderAPI.createConstantBuffer(args[0], pData, args[1]);
+      object.info.bBuffer = true;
+      object.info.sizeInBytes = args[0];
+      break;
+    case NULL_COMMAND::kCreateRasterizerState:
+    {
+      RASTERIZER_DESC desc;
+      if (readData(frame, command, desc)) {
+        object.pObject = m_renderAPI.createRasterizerState(desc);
+      }
+      break;
+    }
+    case NULL_COMMAND::kCreateDepthStencilState:
+    {
+      DEPTH_STENCIL_DESC desc;
+      if (readData(frame, command, desc)) {
+        object.pObject = m_renderAPI.createDepthStencilState(desc);
+      }
+      break;
+    }
+    case NULL_COMMAND::kCreateBlendState:
+    {
+      NullBlendCreateInfo createInfo;
+      if (readData(frame, command, createInfo)) {
+        object.pObject = m_renderAPI.createBlendState(createInfo.desc,
+                                                      createInfo.blendFactors,
+                                                      args[0]);
+      }
+      break;
+    }
+    case NULL_COMMAND::kCreateSamplerState:
+    {
+      SAMPLER_DESC desc;
+      if (readData(frame, command, desc)) {
+        object.pObject = m_renderAPI.createSamplerState(desc);
+      }
+      break;
+    }
+    case NULL_COMMAND::kCreateShader:
+    {
+      auto strings = NullCommandStream::unpackStrings(pData, command.dataSize);
+      if (strings.size() < 3) {
+        break;
+      }
+
+      Vector<ShaderMacro> macros;
+      for (SIZE_T i = 3; i + 1 < strings.size(); i += 2) {
+        ShaderMacro macro;
+        macro.name = strings[i];
+        macro.definition = strings[i + 1];
+        macros.push_back(macro);
+      }
+
+      Path fileName(strings[0]);
+      switch (command.stage)
+      {
+      case NULL_SHADER_STAGE::kVertex:
+        object.pObject = m_renderAPI.createVertexShader(fileName, macros,
+                                                        strings[1], strings[2]);
+        break;
+      case NULL_SHADER_STAGE::kPixel:
+        object.pObject = m_renderAPI.createPixelShader(fileName, macros,
+                                                       strings[1], strings[2]);
+        break;
+      case NULL_SHADER_STAGE::kGeometry:
+        if (args[0]) {
+          object.pObject = m_renderAPI.createGeometryShaderWithStreamOutput(fileName,
+                                      macros,
+                                      strings[1],
+                                      strings[2],
+                                      _get<StreamOutputDeclaration>(args[0]));
+        }
+        else {
+          object.pObject = m_renderAPI.createGeometryShader(fileName, macros,
+                                                            strings[1], strings[2]);
+        }
+        break;
+      case NULL_SHADER_STAGE::kHull:
+        object.pObject = m_renderAPI.createHullShader(fileName, macros,
+                                                      strings[1], strings[2]);
+        break;
+      case NULL_SHADER_STAGE::kDomain:
+        object.pObject = m_renderAPI.createDomainShader(fileName, macros,
+                                                        strings[1], strings[2]);
+        break;
+      case NULL_SHADER_STAGE::kCompute:
+        object.pObject = m_renderAPI.createComputeShader(fileName, macros,
+                                                         strings[1], strings[2]);
+        break;
+      default:
+        break;
+      }
+      break;
+    }
+    default:
+      break;
+    }
+
+    _getObject(command.resourceId) = std::move(object);
+  }
+
+  void
+  RenderTraceReplayer::_execute(const NullCommandStream& frame, const NullCommand& command) {
+    const uint32 id = command.resourceId;
+    const uint32 slot = command.slot;
+    const uint32* args = command.args;
+
+    switch (command.type)
+    {
+    case NULL_COMMAND::kReleaseResource:
+      _getObject(id) = ReplayObject();
+      break;
+    case NULL_COMMAND::kBackBuffer:
+    {
+      ReplayObject& object = _getObject(id);
+      SPtr<Texture> pBackBuffer = m_renderAPI.getBackBuffer().lock();
+      object.createdBy = NULL_COMMAND::kBackBuffer;
+      object.info = RenderTraceResourceInfo();
+      if (pBackBuffer) {
+        Vector3 dimensions = pBackBuffer->getDimensions();
+        object.info.width = static_cast<uint32>(dimensions.x);
+        object.info.height = static_cast<uint32>(dimensions.y);
+      }
+      object.pObject = pBackBuffer;
+      break;
+    }
+    case NULL_COMMAND::kResizeSwapChain:
+      m_renderAPI.resizeSwapChain(args[0], args[1]);
+      break;
+    case NULL_COMMAND::kSetTopology:
+      m_renderAPI.setTopology(static_cast<PRIMITIVE_TOPOLOGY::E>(args[0]));
+      break;
+    case NULL_COMMAND::kSetViewports:
+    {
+      Vector<GRAPHICS_VIEWPORT> viewports(command.dataSize / sizeof(GRAPHICS_VIEWPORT));
+      if (!viewports.empty()) {
+        memcpy(viewports.data(), frame.getData(command), command.dataSize);
+      }
+      m_renderAPI.setViewports(viewports);
+      break;
+    }
+    case NULL_COMMAND::kSetInputLayout:
+      m_renderAPI.setInputLayout(_get<InputLayout>(id));
+      break;
+    case NULL_COMMAND::kSetRasterizerState:
+      m_renderAPI.setRasterizerState(_get<RasterizerState>(id));
+      break;
+    case NULL_COMMAND::kSetDepthStencilState:
+      m_renderAPI.setDepthStencilState(_get<DepthStencilState>(id), args[0]);
+      break;
+    case NULL_COMMAND::kSetBlendState:
+      m_renderAPI.setBlendState(_get<BlendState>(id));
+      break;
+    case NULL_COMMAND::kSetVertexBuffer:
+      m_renderAPI.setVertexBuffer(_get<VertexBuffer>(id), slot, args[1]);
+      break;
+    case NULL_COMMAND::kSetIndexBuffer:
+      m_renderAPI.setIndexBuffer(_get<IndexBuffer>(id), args[0]);
+      break;
+    case NULL_COMMAND::kSetProgram:
+      switch (command.stage)
+      {
+      case NULL_SHADER_STAGE::kVertex:
+        m_renderAPI.vsSetProgram(_get<VertexShader>(id));
+        break;
+      case NULL_SHADER_STAGE::kPixel:
+        m_renderAPI.psSetProgram(_get<PixelShader>(id));
+        break;
+      case NULL_SHADER_STAGE::kGeometry:
+        m_renderAPI.gsSetProgram(_get<GeometryShader>(id));
+        break;
+      case NULL_SHADER_STAGE::kHull:
+        m_renderAPI.hsSetProgram(_get<HullShader>(id));
+        break;
+      case NULL_SHADER_STAGE::kDomain:
+        m_renderAPI.dsSetProgram(_get<DomainShader>(id));
+        break;
+      case NULL_SHADER_STAGE::kCompute:
+        m_renderAPI.csSetProgram(_get<ComputeShader>(id));
+        break;
+      default:
+        break;
+      }
+      break;
+    case NULL_COMMAND::kSetShaderResource:
+    {
+      SPtr<Texture> pTexture = _get<Texture>(id);
+      switch (command.stage)
+      {
+      case NULL_SHADER_STAGE::kVertex:
+        m_renderAPI.vsSetShaderResource(pTexture, slot);
+        break;
+      case NULL_SHADER_STAGE::kPixel:
+        m_renderAPI.psSetShaderResource(pTexture, slot);
+        break;
+      case NULL_SHADER_STAGE::kGeometry:
+        m_renderAPI.gsSetShaderResource(pTexture, slot);
+        break;
+      case NULL_SHADER_STAGE::kHull:
+        m_renderAPI.hsSetShaderResource(pTexture, slot);
+        break;
+      case NULL_SHADER_STAGE::kDomain:
+        m_renderAPI.dsSetShaderResource(pTexture, slot);
+        break;
+      case NULL_SHADER_STAGE::kCompute:
+        m_renderAPI.csSetShaderResource(pTexture, slot);
+        break;
+      default:
+        break;
+      }
+      break;
+    }
+    case NULL_COMMAND::kSetUnorderedAccess:
+      m_renderAPI.csSetUnorderedAccessView(_get<Texture>(id), slot);
+      break;
+    case NULL_COMMAND::kSetConstantBuffer:
+    {
+      SPtr<ConstantBuffer> pBuffer = _get<ConstantBuffer>(id);
+      switch (command.stage)
+      {
+      case NULL_SHADER_STAGE::kVertex:
+        m_renderAPI.vsSetConstantBuffer(pBuffer, slot);
+        break;
+      case NULL_SHADER_STAGE::kPixel:
+        m_renderAPI.psSetConstantBuffer(pBuffer, slot);
+        break;
+      case NULL_SHADER_STAGE::kGeometry:
+        m_renderAPI.gsSetConstantBuffer(pBuffer, slot);
+        break;
+      case NULL_SHADER_STAGE::kHull:
+        m_renderAPI.hsSetConstantBuffer(pBuffer, slot);
+        break;
+      case NULL_SHADER_STAGE::kDomain:
+        m_renderAPI.dsSetConstantBuffer(pBuffer, slot);
+        break;
+      case NULL_SHADER_STAGE::kCompute:
+        m_renderAPI.csSetConstantBuffer(pBuffer, slot);
+        break;
+      default:
+        break;
+      }
+      break;
+    }
+    case NULL_COMMAND::kSetSampler:
+    {
+      SPtr<SamplerState> pSampler = _get<SamplerState>(id);
+      switch (command.stage)
+      {
+      case NULL_SHADER_STAGE::kVertex:
+        m_renderAPI.vsSetSampler(pSampler, slot);
+        break;
+      case NULL_SHADER_STAGE::kPixel:
+        m_renderAPI.psSetSampler(pSampler, slot);
+        break;
+      case NULL_SHADER_STAGE::kGeometry:
+        m_renderAPI.gsSetSampler(pSampler, slot);
+        break;
+      case NULL_SHADER_STAGE::kHull:
+        m_renderAPI.hsSetSampler(pSampler, slot);
+        break;
+      case NULL_SHADER_STAGE::kDomain:
+        m_renderAPI.dsSetSampler(pSampler, slot);
+        break;
+      case NULL_SHADER_STAGE::kCompute:
+        m_renderAPI.csSetSampler(pSampler, slot);
+        break;
+      default:
+        break;
+      }
+      break;
+    }
+    case NULL_COMMAND::kSetRenderTargets:
+    {
+      auto pBindings = reinterpret_cast<const NullRenderTargetBinding*>(frame.getData(command));
+      uint32 numTargets = command.dataSize / sizeof(NullRenderTargetBinding);
+      Vector<RenderTarget> targets(numTargets);
+      for (uint32 i = 0; i < numTargets; ++i) {
+        targets[i].pRenderTarget = _get<Texture>(pBindings[i].id);
+        targets[i].mipLevel = pBindings[i].mipLevel;
+      }
+      m_renderAPI.setRenderTargets(targets, _get<Texture>(id));
+      break;
+    }
+    case NULL_COMMAND::kSetStreamOutput:
+      m_renderAPI.setStreamOutputTarget(_get<StreamOutputBuffer>(id));
+      break;
+    case NULL_COMMAND::kSavePipelineState:
+    {
+      ReplayObject& object = _getObject(id);
+      object.createdBy = NULL_COMMAND::kSavePipelineState;
+      object.pObject = m_renderAPI.savePipelineState();
+      break;
+    }
+    case NULL_COMMAND::kRestorePipelineState:
+      if (id) {
+        m_renderAPI.restorePipelineState(_get<PipelineState>(id));
+      }
+      break;
+    case NULL_COMMAND::kWriteResource:
+    {
+      auto pData = reinterpret_cast<const uint8*>(frame.getData(command));
+      const GRAPHICS_BOX* pBox = nullptr;
+      uint32 offset = 0;
+      if (args[3] && command.dataSize >= sizeof(GRAPHICS_BOX)) {
+        pBox = reinterpret_cast<const GRAPHICS_BOX*>(pData);
+        offset = sizeof(GRAPHICS_BOX);
+      }
+
+      //Null device streams don't store the bytes, any content will do. Data
+      //shorter than the write (a corrupt trace) isn't read either
+      const SIZE_T size = RenderTrace::getWriteSize(_getObject(id).info,
+                                                    slot,
+                                                    pBox,
+                                                    args[0],
+                                                    args[1]);
+      const void* pSrcData = pData + offset;
+      if (command.dataSize <= offset || command.dataSize - offset < size) {
+        if (m_scratch.size() < size) {
+          m_scratch.resize(size, 0);
+        }
+        pSrcData = m_scratch.data();
+      }
+
+      m_renderAPI.writeToResource(_getResource(id),
+                                  slot,
+                                  pBox,
+                                  pSrcData,
+                                  args[0],
+                                  args[1],
+                                  args[2]);
+      break;
+    }
+    case NULL_COMMAND::kMap:
+      m_renderAPI.mapToRead(_getResource(id), slot, args[0]);
+      break;
+    case NULL_COMMAND::kUnmap:
+      m_renderAPI.unmap(_getResource(id), slot);
+      break;
+    case NULL_COMMAND::kCopyResource:
+      m_renderAPI.copyResource(_getResource(slot), _getResource(id));
+      break;
+    case NULL_COMMAND::kResolve:
+      m_renderAPI.msaaResolveRenderTarget(_get<Texture>(slot), _get<Texture>(id));
+      break;
+    case NULL_COMMAND::kGenerateMips:
+      m_renderAPI.generateMips(_get<Texture>(id));
+      break;
+    case NULL_COMMAND::kClearRenderTarget:
+    {
+      LinearColor color = LinearColor::Black;
+      readData(frame, command, color);
+      m_renderAPI.clearRenderTarget(_get<Texture>(id), color);
+      break;
+    }
+    case NULL_COMMAND::kClearDepthStencil:
+    {
+      float depth;
+      memcpy(&depth, &args[1], sizeof(depth));
+      m_renderAPI.clearDepthStencil(_get<Texture>(id),
+                                    args[0],
+                                    depth,
+                                    static_cast<uint8>(args[2]));
+      break;
+    }
+    case NULL_COMMAND::kDiscardView:
+      m_renderAPI.discardView(_get<Texture>(id));
+      break;
+    case NULL_COMMAND::kDraw:
+      m_renderAPI.draw(args[0], args[1]);
+      break;
+    case NULL_COMMAND::kDrawIndexed:
+      m_renderAPI.drawIndexed(args[0], args[1], static_cast<int32>(args[2]));
+      break;
+    case NULL_COMMAND::kDrawInstanced:
+      m_renderAPI.drawInstanced(args[0], args[1], args[2], args[3]);
+      break;
+    case NULL_COMMAND::kDrawAuto:
+      m_renderAPI.drawAuto();
+      break;
+    case NULL_COMMAND::kDispatch:
+      m_renderAPI.dispatch(args[0], args[1], args[2]);
+      break;
+    case NULL_COMMAND::kPresent:
+      m_renderAPI.present();
+      break;
+    default:
+      if (command.type <= NULL_COMMAND::kCreateShader) {
+        _executeCreate(frame, command);
+      }
+      break;
+    }
+  }
+
+} // namespace geEngineSDK
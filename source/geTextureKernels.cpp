@@ -0,0 +1,1085 @@
+/*****************************************************************************/
+/**
+ * @file    geTextureKernels.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   CPU kernels to prepare texture data for upload.
+ *
+ * CPU kernels to prepare texture data for upload.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geTextureKernels.h"
+
+#include <geMath.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define GE_TEXTURE_KERNELS_SSE2 1
+# include <emmintrin.h>
+# include <immintrin.h>
+# if defined(_MSC_VER)
+#   include <intrin.h>
+# else
+#   include <cpuid.h>
+# endif
+//AVX2 and F16C are checked at run time, the functions that use them are
+//compiled for them regardless of the flags of the project
+# if defined(_MSC_VER) && !defined(__clang__)
+#   define GE_TARGET_AVX2
+# else
+#   define GE_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+# endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+# define GE_TEXTURE_KERNELS_NEON 1
+# include <arm_neon.h>
+#endif
+
+namespace geEngineSDK {
+
+  namespace {
+    //Kaiser window, same defaults as the GPU generator
+    const float KAISER_WIDTH = 3.0f;
+    const float KAISER_ALPHA = 4.0f;
+
+    //Pixels a worker processes at least in the conversion kernels
+    const uint32 PIXELS_PER_TASK = 16 * 1024;
+
+    std::atomic<bool> s_bSIMDEnabled(true);
+    std::atomic<uint32> s_numThreads(0);
+
+    /*************************************************************************/
+    // CPU features
+    /*************************************************************************/
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    void
+    cpuid(int32 info[4], int32 leaf, int32 subLeaf) {
+# if defined(_MSC_VER)
+      __cpuidex(info, leaf, subLeaf);
+# else
+      uint32 regs[4] = { 0, 0, 0, 0 };
+      __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+      memcpy(info, regs, sizeof(regs));
+# endif
+    }
+
+    uint64
+    readXCR0() {
+# if defined(_MSC_VER)
+      return _xgetbv(0);
+# else
+      uint32 eax = 0;
+      uint32 edx = 0;
+      __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      return (static_cast<uint64>(edx) << 32) | eax;
+# endif
+    }
+
+    bool
+    detectAVX2() {
+      int32 info[4];
+      cpuid(info, 0, 0);
+      if (info[0] < 7) {
+        return false;
+      }
+
+      //The OS must save the YMM registers too
+      cpuid(info, 1, 0);
+      const bool bOSXSave = 0 != (info[2] & (1 << 27));
+      const bool bAVX = 0 != (info[2] & (1 << 28));
+      const bool bF16C = 0 != (info[2] & (1 << 29));
+      if (!bOSXSave || !bAVX || !bF16C || (readXCR0() & 0x6) != 0x6) {
+        return false;
+      }
+
+      cpuid(info, 7, 0);
+      return 0 != (info[1] & (1 << 5));
+    }
+
+    bool
+    hasAVX2() {
+      static const bool s_bAVX2 = detectAVX2();
+      return s_bAVX2;
+    }
+#endif
+
+    bool
+    useSIMD() {
+      return s_bSIMDEnabled.load(std::memory_order_relaxed);
+    }
+
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    bool
+    useAVX2() {
+      return useSIMD() && hasAVX2();
+    }
+#endif
+
+    /*************************************************************************/
+    // Half precision
+    /*************************************************************************/
+    uint32
+    floatBits(float value) {
+      uint32 bits;
+      memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+
+    float
+    bitsFloat(uint32 bits) {
+      float value;
+      memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+
+    //Mantissa rounding with an integer bias for normal halves, and a float
+    //add for the subnormal ones so the FPU does the rounding
+    const uint32 HALF_MAX_BITS = (127 + 16) << 23;      //65536.0f
+    const uint32 HALF_MIN_NORMAL_BITS = 113 << 23;      //2^-14
+    const uint32 DENORM_MAGIC_BITS = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    void
+    floatToHalfScalar(const float* pSrc, uint16* pDst, SIZE_T count) {
+      for (SIZE_T i = 0; i < count; ++i) {
+        pDst[i] = TextureKernels::halfFromFloat(pSrc[i]);
+      }
+    }
+
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    __m128i
+    select(__m128i mask, __m128i a, __m128i b) {
+      return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    //The four halves in the low 16 bits of each lane
+    __m128i
+    halfFromFloatSSE2(__m128 value) {
+      __m128i bits = _mm_castps_si128(value);
+      __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int32>(0x80000000)));
+      __m128i absBits = _mm_xor_si128(bits, sign);
+
+      __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(1));
+      __m128i normal = _mm_add_epi32(absBits, _mm_set1_epi32(0xFFF - (112 << 23)));
+      normal = _mm_srli_epi32(_mm_add_epi32(normal, mantOdd), 13);
+
+      const __m128i denormMagic = _mm_set1_epi32(DENORM_MAGIC_BITS);
+      __m128 subnormalFloat = _mm_add_ps(_mm_castsi128_ps(absBits),
+                                         _mm_castsi128_ps(denormMagic));
+      __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(subnormalFloat), denormMagic);
+
+      __m128i isNaN = _mm_cmpgt_epi32(absBits, _mm_set1_epi32(0x7F800000));
+      __m128i infNaN = _mm_or_si128(_mm_set1_epi32(0x7C00),
+                                    _mm_and_si128(isNaN, _mm_set1_epi32(0x0200)));
+
+      __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(HALF_MIN_NORMAL_BITS), absBits);
+      __m128i isInfNaN = _mm_cmpgt_epi32(absBits, _mm_set1_epi32(HALF_MAX_BITS - 1));
+
+      __m128i result = select(isSubnormal, subnormal, normal);
+      result = select(isInfNaN, infNaN, result);
+      return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+    }
+
+    void
+    floatToHalfSSE2(const float* pSrc, uint16* pDst, SIZE_T count) {
+      //packs_epi32 saturates signed values, the halves are biased to fit
+      const __m128i bias = _mm_set1_epi32(0x8000);
+      const __m128i unbias = _mm_set1_epi16(static_cast<int16>(0x8000));
+
+      SIZE_T i = 0;
+      for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_sub_epi32(halfFromFloatSSE2(_mm_loadu_ps(pSrc + i)), bias);
+        __m128i hi = _mm_sub_epi32(halfFromFloatSSE2(_mm_loadu_ps(pSrc + i + 4)), bias);
+        __m128i packed = _mm_xor_si128(_mm_packs_epi32(lo, hi), unbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), packed);
+      }
+      floatToHalfScalar(pSrc + i, pDst + i, count - i);
+    }
+
+    GE_TARGET_AVX2 void
+    floatToHalfAVX2(const float* pSrc, uint16* pDst, SIZE_T count) {
+      SIZE_T i = 0;
+      for (; i + 8 <= count; i += 8) {
+        __m128i packed = _mm256_cvtps_ph(_mm256_loadu_ps(pSrc + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), packed);
+      }
+      floatToHalfScalar(pSrc + i, pDst + i, count - i);
+    }
+#elif defined(GE_TEXTURE_KERNELS_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    void
+    floatToHalfNEON(const float* pSrc, uint16* pDst, SIZE_T count) {
+      SIZE_T i = 0;
+      for (; i + 4 <= count; i += 4) {
+        vst1_u16(pDst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSrc + i))));
+      }
+      floatToHalfScalar(pSrc + i, pDst + i, count - i);
+    }
+#endif
+
+    /*************************************************************************/
+    // sRGB
+    /*************************************************************************/
+
+    //Linear values under 2^-13 encode to 0. From there to 1.0 the float bits
+    //are split in buckets of 4096 values, and no sRGB step is shorter than a
+    //bucket, so a bucket holds at most one rounding threshold.
+    const uint32 SRGB_MIN_BITS = 0x39000000;
+    const uint32 SRGB_BUCKET_SHIFT = 12;
+    const uint32 SRGB_NUM_BUCKETS = (0x3F800000 - SRGB_MIN_BITS) >> SRGB_BUCKET_SHIFT;
+
+    struct SRGBTables
+    {
+      float toLinear[256];
+      float thresholds[257];      //Lowest linear value that encodes to i
+      uint8 bucketBase[SRGB_NUM_BUCKETS];
+    };
+
+    uint8
+    encodeSRGBExact(float value) {
+      double linear = Math::clamp(static_cast<double>(value), 0.0, 1.0);
+      double encoded = linear <= 0.0031308 ? 12.92 * linear
+                                           : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+      return static_cast<uint8>(std::floor(encoded * 255.0 + 0.5));
+    }
+
+    SRGBTables*
+    buildSRGBTables() {
+      auto pTables = new SRGBTables();
+
+      for (uint32 i = 0; i < 256; ++i) {
+        double encoded = i / 255.0;
+        double linear = encoded <= 0.04045 ? encoded / 12.92
+                                           : std::pow((encoded + 0.055) / 1.055, 2.4);
+        pTables->toLinear[i] = static_cast<float>(linear);
+      }
+
+      //The encoding is monotonic, so each threshold is found with a binary
+      //search over the float bits
+      pTables->thresholds[0] = 0.0f;
+      for (uint32 code = 1; code < 256; ++code) {
+        uint32 low = 0;
+        uint32 high = 0x3F800000;
+        while (low < high) {
+          uint32 middle = low + (high - low) / 2;
+          if (encodeSRGBExact(bitsFloat(middle)) >= code) {
+            high = middle;
+          }
+          else {
+            low = middle + 1;
+          }
+        }
+        pTables->thresholds[code] = bitsFloat(low);
+      }
+      pTables->thresholds[256] = std::numeric_limits<float>::infinity();
+
+      for (uint32 i = 0; i < SRGB_NUM_BUCKETS; ++i) {
+        float first = bitsFloat(SRGB_MIN_BITS + (i << SRGB_BUCKET_SHIFT));
+        pTables->bucketBase[i] = encodeSRGBExact(first);
+      }
+
+      return pTables;
+    }
+
+    const SRGBTables&
+    getSRGBTables() {
+      static const SRGBTables* s_pTables = buildSRGBTables();
+      return *s_pTables;
+    }
+
+    uint8
+    encodeSRGB(const SRGBTables& tables, float value) {
+      //NaN fails the first test too
+      if (!(value >= bitsFloat(SRGB_MIN_BITS))) {
+        return 0;
+      }
+      if (value >= 1.0f) {
+        return 255;
+      }
+
+      uint32 base = tables.bucketBase[(floatBits(value) - SRGB_MIN_BITS) >> SRGB_BUCKET_SHIFT];
+      return static_cast<uint8>(base + (value >= tables.thresholds[base + 1] ? 1 : 0));
+    }
+
+    uint8
+    encodeUNorm(float value) {
+      //NaN fails the first test too
+      if (!(value > 0.0f)) {
+        return 0;
+      }
+      return static_cast<uint8>(Math::min(value, 1.0f) * 255.0f + 0.5f);
+    }
+
+    void
+    srgbToLinearRun(const uint8* pSrc, float* pDst, SIZE_T numPixels) {
+      const SRGBTables& tables = getSRGBTables();
+      const float toUNorm = 1.0f / 255.0f;
+      for (SIZE_T i = 0; i < numPixels; ++i) {
+        pDst[4 * i + 0] = tables.toLinear[pSrc[4 * i + 0]];
+        pDst[4 * i + 1] = tables.toLinear[pSrc[4 * i + 1]];
+        pDst[4 * i + 2] = tables.toLinear[pSrc[4 * i + 2]];
+        pDst[4 * i + 3] = pSrc[4 * i + 3] * toUNorm;
+      }
+    }
+
+    void
+    linearToSRGBRun(const float* pSrc, uint8* pDst, SIZE_T numPixels) {
+      const SRGBTables& tables = getSRGBTables();
+      for (SIZE_T i = 0; i < numPixels; ++i) {
+        pDst[4 * i + 0] = encodeSRGB(tables, pSrc[4 * i + 0]);
+        pDst[4 * i + 1] = encodeSRGB(tables, pSrc[4 * i + 1]);
+        pDst[4 * i + 2] = encodeSRGB(tables, pSrc[4 * i + 2]);
+        pDst[4 * i + 3] = encodeUNorm(pSrc[4 * i + 3]);
+      }
+    }
+
+    /*************************************************************************/
+    // Swizzle
+    /*************************************************************************/
+    void
+    swizzleScalar(const uint8* pSrc, uint8* pDst, SIZE_T numPixels) {
+      for (SIZE_T i = 0; i < numPixels; ++i) {
+        uint32 pixel;
+        memcpy(&pixel, pSrc + 4 * i, sizeof(pixel));
+        pixel = (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+        memcpy(pDst + 4 * i, &pixel, sizeof(pixel));
+      }
+    }
+
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    void
+    swizzleSSE2(const uint8* pSrc, uint8* pDst, SIZE_T numPixels) {
+      const __m128i keep = _mm_set1_epi32(static_cast<int32>(0xFF00FF00));
+      const __m128i low = _mm_set1_epi32(0xFF);
+
+      SIZE_T i = 0;
+      for (; i + 4 <= numPixels; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 4 * i));
+        __m128i red = _mm_slli_epi32(_mm_and_si128(pixels, low), 16);
+        __m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), low);
+        pixels = _mm_or_si128(_mm_and_si128(pixels, keep), _mm_or_si128(red, blue));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 4 * i), pixels);
+      }
+      swizzleScalar(pSrc + 4 * i, pDst + 4 * i, numPixels - i);
+    }
+
+    GE_TARGET_AVX2 void
+    swizzleAVX2(const uint8* pSrc, uint8* pDst, SIZE_T numPixels) {
+      const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7,
+                                               10, 9, 8, 11, 14, 13, 12, 15,
+                                               2, 1, 0, 3, 6, 5, 4, 7,
+                                               10, 9, 8, 11, 14, 13, 12, 15);
+      SIZE_T i = 0;
+      for (; i + 8 <= numPixels; i += 8) {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + 4 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 4 * i),
+                            _mm256_shuffle_epi8(pixels, shuffle));
+      }
+      swizzleScalar(pSrc + 4 * i, pDst + 4 * i, numPixels - i);
+    }
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+    void
+    swizzleNEON(const uint8* pSrc, uint8* pDst, SIZE_T numPixels) {
+      SIZE_T i = 0;
+      for (; i + 16 <= numPixels; i += 16) {
+        uint8x16x4_t pixels = vld4q_u8(pSrc + 4 * i);
+        uint8x16_t red = pixels.val[0];
+        pixels.val[0] = pixels.val[2];
+        pixels.val[2] = red;
+        vst4q_u8(pDst + 4 * i, pixels);
+      }
+      swizzleScalar(pSrc + 4 * i, pDst + 4 * i, numPixels - i);
+    }
+#endif
+
+    /*************************************************************************/
+    // 2x2 box filter of RGBA8, each output texel rounded to nearest
+    /*************************************************************************/
+    void
+    boxRowScalar(const uint8* pRow0, const uint8* pRow1, uint8* pOut, uint32 width) {
+      for (uint32 x = 0; x < width; ++x) {
+        const uint8* p0 = pRow0 + 8 * x;
+        const uint8* p1 = pRow1 + 8 * x;
+        for (uint32 c = 0; c < 4; ++c) {
+          pOut[4 * x + c] = static_cast<uint8>((p0[c] + p0[c + 4] + p1[c] + p1[c + 4] + 2) >> 2);
+        }
+      }
+    }
+
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    //Sums the 2x2 quads of four source pixels of two rows, two results
+    __m128i
+    boxQuadsSSE2(const uint8* pRow0, const uint8* pRow1) {
+      const __m128i zero = _mm_setzero_si128();
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow0));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1));
+      __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+      __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+      __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+      return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+    }
+
+    void
+    boxRowSSE2(const uint8* pRow0, const uint8* pRow1, uint8* pOut, uint32 width) {
+      uint32 x = 0;
+      for (; x + 4 <= width; x += 4) {
+        __m128i first = boxQuadsSSE2(pRow0 + 8 * x, pRow1 + 8 * x);
+        __m128i second = boxQuadsSSE2(pRow0 + 8 * x + 16, pRow1 + 8 * x + 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pOut + 4 * x),
+                         _mm_packus_epi16(first, second));
+      }
+      boxRowScalar(pRow0 + 8 * x, pRow1 + 8 * x, pOut + 4 * x, width - x);
+    }
+
+    GE_TARGET_AVX2 __m256i
+    boxQuadsAVX2(const uint8* pRow0, const uint8* pRow1) {
+      const __m256i zero = _mm256_setzero_si256();
+      __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow0));
+      __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow1));
+      __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+      __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+      __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi),
+                                     _mm256_unpackhi_epi64(lo, hi));
+      return _mm256_srli_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(2)), 2);
+    }
+
+    GE_TARGET_AVX2 void
+    boxRowAVX2(const uint8* pRow0, const uint8* pRow1, uint8* pOut, uint32 width) {
+      uint32 x = 0;
+      for (; x + 8 <= width; x += 8) {
+        //Each 128 bit lane holds two results of each half, packing
+        //interleaves them by lane
+        __m256i first = boxQuadsAVX2(pRow0 + 8 * x, pRow1 + 8 * x);
+        __m256i second = boxQuadsAVX2(pRow0 + 8 * x + 32, pRow1 + 8 * x + 32);
+        __m256i packed = _mm256_packus_epi16(first, second);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pOut + 4 * x),
+                            _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+      }
+      boxRowSSE2(pRow0 + 8 * x, pRow1 + 8 * x, pOut + 4 * x, width - x);
+    }
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+    void
+    boxRowNEON(const uint8* pRow0, const uint8* pRow1, uint8* pOut, uint32 width) {
+      uint32 x = 0;
+      for (; x + 2 <= width; x += 2) {
+        uint8x16_t a = vld1q_u8(pRow0 + 8 * x);
+        uint8x16_t b = vld1q_u8(pRow1 + 8 * x);
+        uint16x8_t lo = vaddl_u8(vget_low_u8(a), vget_low_u8(b));
+        uint16x8_t hi = vaddl_u8(vget_high_u8(a), vget_high_u8(b));
+        uint16x8_t sum = vaddq_u16(vcombine_u16(vget_low_u16(lo), vget_low_u16(hi)),
+                                   vcombine_u16(vget_high_u16(lo), vget_high_u16(hi)));
+        vst1_u8(pOut + 4 * x, vrshrn_n_u16(sum, 2));
+      }
+      boxRowScalar(pRow0 + 8 * x, pRow1 + 8 * x, pOut + 4 * x, width - x);
+    }
+#endif
+
+    using BoxRowFn = void(*)(const uint8*, const uint8*, uint8*, uint32);
+
+    BoxRowFn
+    getBoxRowFn() {
+      if (!useSIMD()) {
+        return boxRowScalar;
+      }
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+      return useAVX2() ? boxRowAVX2 : boxRowSSE2;
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+      return boxRowNEON;
+#else
+      return boxRowScalar;
+#endif
+    }
+
+    /*************************************************************************/
+    // Separable filtering of RGBA32F
+    /*************************************************************************/
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+    using Pixel = __m128;
+
+    Pixel
+    pixelZero() {
+      return _mm_setzero_ps();
+    }
+
+    Pixel
+    pixelLoad(const float* pSrc) {
+      return _mm_loadu_ps(pSrc);
+    }
+
+    void
+    pixelStore(float* pDst, Pixel value) {
+      _mm_storeu_ps(pDst, value);
+    }
+
+    Pixel
+    pixelMadd(Pixel acc, Pixel value, float weight) {
+      return _mm_add_ps(acc, _mm_mul_ps(value, _mm_set1_ps(weight)));
+    }
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+    using Pixel = float32x4_t;
+
+    Pixel
+    pixelZero() {
+      return vdupq_n_f32(0.0f);
+    }
+
+    Pixel
+    pixelLoad(const float* pSrc) {
+      return vld1q_f32(pSrc);
+    }
+
+    void
+    pixelStore(float* pDst, Pixel value) {
+      vst1q_f32(pDst, value);
+    }
+
+    Pixel
+    pixelMadd(Pixel acc, Pixel value, float weight) {
+      return vmlaq_n_f32(acc, value, weight);
+    }
+#else
+    struct Pixel
+    {
+      float v[4];
+    };
+
+    Pixel
+    pixelZero() {
+      return Pixel{ { 0.0f, 0.0f, 0.0f, 0.0f } };
+    }
+
+    Pixel
+    pixelLoad(const float* pSrc) {
+      Pixel pixel;
+      memcpy(pixel.v, pSrc, sizeof(pixel.v));
+      return pixel;
+    }
+
+    void
+    pixelStore(float* pDst, Pixel value) {
+      memcpy(pDst, value.v, sizeof(value.v));
+    }
+
+    Pixel
+    pixelMadd(Pixel acc, Pixel value, float weight) {
+      for (uint32 c = 0; c < 4; ++c) {
+        acc.v[c] += value.v[c] * weight;
+      }
+      return acc;
+    }
+#endif
+
+    struct FloatImage
+    {
+      Vector<float> pixels;
+      uint32 width = 0;
+      uint32 height = 0;
+
+      void
+      resize(uint32 newWidth, uint32 newHeight) {
+        width = newWidth;
+        height = newHeight;
+        pixels.resize(static_cast<SIZE_T>(width) * height * 4);
+      }
+
+      float*
+      row(uint32 y) {
+        return pixels.data() + static_cast<SIZE_T>(y) * width * 4;
+      }
+
+      const float*
+      row(uint32 y) const {
+        return pixels.data() + static_cast<SIZE_T>(y) * width * 4;
+      }
+    };
+
+    //Source texels and weights of every destination texel of an axis
+    struct FilterTaps
+    {
+      uint32 maxTaps = 0;
+      Vector<uint32> counts;
+      Vector<uint32> indices;     //maxTaps per destination texel
+      Vector<float> weights;
+    };
+
+    double
+    besselI0(double x) {
+      double sum = 1.0;
+      double term = 1.0;
+      double halfX = 0.5 * x;
+      for (uint32 k = 1; k < 25; ++k) {
+        double t = halfX / k;
+        term *= t * t;
+        sum += term;
+      }
+      return sum;
+    }
+
+    float
+    kaiserWeight(float dist, float scale, float radius) {
+      double t = dist / radius;
+      if (std::abs(t) >= 1.0) {
+        return 0.0f;
+      }
+
+      double window = besselI0(KAISER_ALPHA * std::sqrt(1.0 - t * t)) / besselI0(KAISER_ALPHA);
+      double x = Math::PI * dist / scale;
+      double sinc = std::abs(x) < 1e-6 ? 1.0 : std::sin(x) / x;
+      return static_cast<float>(sinc * window);
+    }
+
+    float
+    boxWeight(float texel, float center, float halfWidth) {
+      float overlap = Math::min(texel + 1.0f, center + halfWidth) -
+                      Math::max(texel, center - halfWidth);
+      return Math::max(overlap, 0.0f);
+    }
+
+    void
+    buildTaps(uint32 srcSize, uint32 dstSize, MIP_FILTER::E filter, FilterTaps& taps) {
+      const float scale = static_cast<float>(srcSize) / dstSize;
+      const float filterScale = Math::max(scale, 1.0f);
+      const bool bKaiser = MIP_FILTER::kKaiser == filter;
+      const float radius = bKaiser ? KAISER_WIDTH * filterScale : 0.5f * filterScale;
+
+      taps.maxTaps = static_cast<uint32>(std::ceil(2.0f * radius)) + 3;
+      taps.counts.assign(dstSize, 0);
+      taps.indices.assign(static_cast<SIZE_T>(dstSize) * taps.maxTaps, 0);
+      taps.weights.assign(static_cast<SIZE_T>(dstSize) * taps.maxTaps, 0.0f);
+
+      for (uint32 x = 0; x < dstSize; ++x) {
+        const float center = (x + 0.5f) * scale;
+        const int32 first = static_cast<int32>(std::floor(center - radius - 0.5f));
+        const int32 last = static_cast<int32>(std::ceil(center + radius - 0.5f));
+        const SIZE_T offset = static_cast<SIZE_T>(x) * taps.maxTaps;
+
+        uint32 count = 0;
+        float sum = 0.0f;
+        for (int32 s = first; s <= last && count < taps.maxTaps; ++s) {
+          float weight = bKaiser ? kaiserWeight(s + 0.5f - center, filterScale, radius)
+                                 : boxWeight(static_cast<float>(s), center, radius);
+          if (0.0f == weight) {
+            continue;
+          }
+
+          //Texels past the edges repeat the edge
+          int32 clamped = Math::clamp(s, 0, static_cast<int32>(srcSize) - 1);
+          taps.indices[offset + count] = static_cast<uint32>(clamped);
+          taps.weights[offset + count] = weight;
+          sum += weight;
+          ++count;
+        }
+
+        if (0.0f != sum) {
+          for (uint32 t = 0; t < count; ++t) {
+            taps.weights[offset + t] /= sum;
+          }
+        }
+        taps.counts[x] = count;
+      }
+    }
+
+    void
+    resample(const FloatImage& src,
+             FloatImage& dst,
+             uint32 dstWidth,
+             uint32 dstHeight,
+             MIP_FILTER::E filter) {
+      FilterTaps tapsX;
+      FilterTaps tapsY;
+      buildTaps(src.width, dstWidth, filter, tapsX);
+      buildTaps(src.height, dstHeight, filter, tapsY);
+
+      //Horizontal pass, every source row
+      FloatImage temp;
+      temp.resize(dstWidth, src.height);
+      TextureKernels::parallelFor(src.height, 16, [&](uint32 begin, uint32 end) {
+        for (uint32 y = begin; y < end; ++y) {
+          const float* pSrc = src.row(y);
+          float* pDst = temp.row(y);
+          for (uint32 x = 0; x < dstWidth; ++x) {
+            const SIZE_T offset = static_cast<SIZE_T>(x) * tapsX.maxTaps;
+            Pixel acc = pixelZero();
+            for (uint32 t = 0; t < tapsX.counts[x]; ++t) {
+              acc = pixelMadd(acc,
+                              pixelLoad(pSrc + 4 * tapsX.indices[offset + t]),
+                              tapsX.weights[offset + t]);
+            }
+            pixelStore(pDst + 4 * x, acc);
+          }
+        }
+      });
+
+      //Vertical pass, whole rows are accumulated to read memory in order
+      dst.resize(dstWidth, dstHeight);
+      TextureKernels::parallelFor(dstHeight, 8, [&](uint32 begin, uint32 end) {
+        for (uint32 y = begin; y < end; ++y) {
+          float* pDst = dst.row(y);
+          memset(pDst, 0, sizeof(float) * 4 * dstWidth);
+
+          const SIZE_T offset = static_cast<SIZE_T>(y) * tapsY.maxTaps;
+          for (uint32 t = 0; t < tapsY.counts[y]; ++t) {
+            const float* pSrc = temp.row(tapsY.indices[offset + t]);
+            const float weight = tapsY.weights[offset + t];
+            for (uint32 x = 0; x < dstWidth; ++x) {
+              pixelStore(pDst + 4 * x,
+                         pixelMadd(pixelLoad(pDst + 4 * x), pixelLoad(pSrc + 4 * x), weight));
+            }
+          }
+        }
+      });
+    }
+
+    void
+    decodeImage(const TextureImage& src, TEXTURE_PIXEL_FORMAT::E format, FloatImage& dst) {
+      dst.resize(src.width, src.height);
+      TextureKernels::parallelFor(src.height, 16, [&](uint32 begin, uint32 end) {
+        const float toUNorm = 1.0f / 255.0f;
+        for (uint32 y = begin; y < end; ++y) {
+          const uint8* pRow = src.pData + static_cast<SIZE_T>(y) * src.rowPitch;
+          float* pOut = dst.row(y);
+          switch (format) {
+          case TEXTURE_PIXEL_FORMAT::kRGBA32F:
+            memcpy(pOut, pRow, sizeof(float) * 4 * src.width);
+            break;
+          case TEXTURE_PIXEL_FORMAT::kRGBA8SRGB:
+            srgbToLinearRun(pRow, pOut, src.width);
+            break;
+          default:
+            for (uint32 i = 0; i < 4 * src.width; ++i) {
+              pOut[i] = pRow[i] * toUNorm;
+            }
+            break;
+          }
+        }
+      });
+    }
+
+    void
+    encodeImage(const FloatImage& src, TEXTURE_PIXEL_FORMAT::E format, const TextureImage& dst) {
+      TextureKernels::parallelFor(src.height, 16, [&](uint32 begin, uint32 end) {
+        for (uint32 y = begin; y < end; ++y) {
+          const float* pRow = src.row(y);
+          uint8* pOut = dst.pData + static_cast<SIZE_T>(y) * dst.rowPitch;
+          switch (format) {
+          case TEXTURE_PIXEL_FORMAT::kRGBA32F:
+            memcpy(pOut, pRow, sizeof(float) * 4 * src.width);
+            break;
+          case TEXTURE_PIXEL_FORMAT::kRGBA8SRGB:
+            linearToSRGBRun(pRow, pOut, src.width);
+            break;
+          default:
+            for (uint32 i = 0; i < 4 * src.width; ++i) {
+              pOut[i] = encodeUNorm(pRow[i]);
+            }
+            break;
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief Splits a run of items in blocks for the workers.
+     */
+    void
+    parallelRun(SIZE_T count, const std::function<void(SIZE_T, SIZE_T)>& fn) {
+      const SIZE_T numBlocks = (count + PIXELS_PER_TASK - 1) / PIXELS_PER_TASK;
+      TextureKernels::parallelFor(static_cast<uint32>(numBlocks),
+                                  4,
+                                  [&](uint32 begin, uint32 end) {
+        SIZE_T first = static_cast<SIZE_T>(begin) * PIXELS_PER_TASK;
+        SIZE_T last = Math::min(count, static_cast<SIZE_T>(end) * PIXELS_PER_TASK);
+        fn(first, last - first);
+      });
+    }
+  }
+
+  namespace TextureKernels {
+    const char*
+    getInstructionSet() {
+      if (!useSIMD()) {
+        return "Scalar";
+      }
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+      return hasAVX2() ? "AVX2" : "SSE2";
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+      return "NEON";
+#else
+      return "Scalar";
+#endif
+    }
+
+    void
+    setSIMDEnabled(bool bEnabled) {
+      s_bSIMDEnabled = bEnabled;
+    }
+
+    bool
+    isSIMDEnabled() {
+      return useSIMD();
+    }
+
+    void
+    setNumThreads(uint32 numThreads) {
+      s_numThreads = numThreads;
+    }
+
+    uint32
+    getNumThreads() {
+      uint32 numThreads = s_numThreads.load(std::memory_order_relaxed);
+      if (0 == numThreads) {
+        numThreads = std::thread::hardware_concurrency();
+      }
+      return Math::max(1U, numThreads);
+    }
+
+    void
+    parallelFor(uint32 count,
+                uint32 minPerTask,
+                const std::function<void(uint32, uint32)>& fn) {
+      if (0 == count) {
+        return;
+      }
+
+      const uint32 numTasks = Math::min(getNumThreads(), count / Math::max(1U, minPerTask));
+      if (numTasks <= 1) {
+        fn(0, count);
+        return;
+      }
+
+      //More ranges than workers so a slow range doesn't leave them waiting
+      const uint32 numRanges = Math::min(count, numTasks * 4);
+      std::atomic<uint32> nextRange(0);
+      auto worker = [&]() {
+        for (uint32 range = nextRange++; range < numRanges; range = nextRange++) {
+          uint32 begin = static_cast<uint32>(static_cast<uint64>(count) * range / numRanges);
+          uint32 end = static_cast<uint32>(static_cast<uint64>(count) * (range + 1) / numRanges);
+          fn(begin, end);
+        }
+      };
+
+      Vector<std::thread> threads;
+      threads.reserve(numTasks - 1);
+      for (uint32 i = 1; i < numTasks; ++i) {
+        threads.emplace_back(worker);
+      }
+      worker();
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+
+    uint32
+    getBytesPerPixel(TEXTURE_PIXEL_FORMAT::E format) {
+      return TEXTURE_PIXEL_FORMAT::kRGBA32F == format ? 16 : 4;
+    }
+
+    uint32
+    getNumMips(uint32 width, uint32 height) {
+      uint32 numMips = 1;
+      uint32 size = Math::max(width, height);
+      while (size > 1) {
+        size >>= 1;
+        ++numMips;
+      }
+      return numMips;
+    }
+
+    void
+    downsample(const TextureImage& src,
+               const TextureImage& dst,
+               TEXTURE_PIXEL_FORMAT::E format,
+               MIP_FILTER::E filter) {
+      GE_ASSERT(src.pData && dst.pData);
+      GE_ASSERT(src.width && src.height && dst.width && dst.height);
+
+      //Exact halves of RGBA8 are averaged in integers, 16 bytes at a time
+      if (MIP_FILTER::kBox == filter &&
+          TEXTURE_PIXEL_FORMAT::kRGBA8 == format &&
+          src.width == dst.width * 2 &&
+          src.height == dst.height * 2) {
+        BoxRowFn pBoxRow = getBoxRowFn();
+        parallelFor(dst.height, 16, [&](uint32 begin, uint32 end) {
+          for (uint32 y = begin; y < end; ++y) {
+            const uint8* pRow0 = src.pData + static_cast<SIZE_T>(2 * y) * src.rowPitch;
+            pBoxRow(pRow0,
+                    pRow0 + src.rowPitch,
+                    dst.pData + static_cast<SIZE_T>(y) * dst.rowPitch,
+                    dst.width);
+          }
+        });
+        return;
+      }
+
+      FloatImage source;
+      FloatImage filtered;
+      decodeImage(src, format, source);
+      resample(source, filtered, dst.width, dst.height, filter);
+      encodeImage(filtered, format, dst);
+    }
+
+    void
+    generateMipChain(const TextureImage& top,
+                     TEXTURE_PIXEL_FORMAT::E format,
+                     MIP_FILTER::E filter,
+                     uint32 numMips,
+                     TextureMipChain& chain) {
+      GE_ASSERT(top.pData && top.width && top.height);
+
+      const uint32 bytesPerPixel = getBytesPerPixel(format);
+      const uint32 maxMips = getNumMips(top.width, top.height);
+      numMips = 0 == numMips ? maxMips : Math::min(numMips, maxMips);
+
+      SIZE_T totalSize = 0;
+      chain.format = format;
+      chain.mips.resize(numMips);
+      for (uint32 i = 0; i < numMips; ++i) {
+        TextureImage& mip = chain.mips[i];
+        mip.width = Math::max(1U, top.width >> i);
+        mip.height = Math::max(1U, top.height >> i);
+        mip.rowPitch = mip.width * bytesPerPixel;
+        totalSize += static_cast<SIZE_T>(mip.rowPitch) * mip.height;
+      }
+
+      chain.data.resize(totalSize);
+      SIZE_T offset = 0;
+      for (auto& mip : chain.mips) {
+        mip.pData = chain.data.data() + offset;
+        offset += static_cast<SIZE_T>(mip.rowPitch) * mip.height;
+      }
+
+      const TextureImage& mip0 = chain.mips[0];
+      for (uint32 y = 0; y < top.height; ++y) {
+        memcpy(mip0.pData + static_cast<SIZE_T>(y) * mip0.rowPitch,
+               top.pData + static_cast<SIZE_T>(y) * top.rowPitch,
+               mip0.rowPitch);
+      }
+
+      //The box filter of linear RGBA8 is exact in integers
+      if (MIP_FILTER::kBox == filter && TEXTURE_PIXEL_FORMAT::kRGBA8 == format) {
+        for (uint32 i = 1; i < numMips; ++i) {
+          downsample(chain.mips[i - 1], chain.mips[i], format, filter);
+        }
+        return;
+      }
+
+      //The rest is filtered in linear float so the rounding of a mip
+      //doesn't carry to the next ones
+      FloatImage current;
+      FloatImage next;
+      decodeImage(top, format, current);
+      for (uint32 i = 1; i < numMips; ++i) {
+        resample(current, next, chain.mips[i].width, chain.mips[i].height, filter);
+        encodeImage(next, format, chain.mips[i]);
+        std::swap(current, next);
+      }
+    }
+
+    void
+    swizzleRGBA8ToBGRA8(const uint8* pSrc, uint8* pDst, SIZE_T numPixels) {
+      GE_ASSERT((pSrc && pDst) || 0 == numPixels);
+
+      auto pSwizzle = swizzleScalar;
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+      if (useSIMD()) {
+        pSwizzle = useAVX2() ? swizzleAVX2 : swizzleSSE2;
+      }
+#elif defined(GE_TEXTURE_KERNELS_NEON)
+      if (useSIMD()) {
+        pSwizzle = swizzleNEON;
+      }
+#endif
+
+      parallelRun(numPixels, [&](SIZE_T first, SIZE_T count) {
+        pSwizzle(pSrc + 4 * first, pDst + 4 * first, count);
+      });
+    }
+
+    void
+    convertFloatToHalf(const float* pSrc, uint16* pDst, SIZE_T count) {
+      GE_ASSERT((pSrc && pDst) || 0 == count);
+
+      auto pConvert = floatToHalfScalar;
+#if defined(GE_TEXTURE_KERNELS_SSE2)
+      if (useSIMD()) {
+        pConvert = useAVX2() ? floatToHalfAVX2 : floatToHalfSSE2;
+      }
+#elif defined(GE_TEXTURE_KERNELS_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+      if (useSIMD()) {
+        pConvert = floatToHalfNEON;
+      }
+#endif
+
+      parallelRun(count, [&](SIZE_T first, SIZE_T runCount) {
+        pConvert(pSrc + first, pDst + first, runCount);
+      });
+    }
+
+    void
+    convertSRGBToLinear(const uint8* pSrc, float* pDst, SIZE_T numPixels) {
+      GE_ASSERT((pSrc && pDst) || 0 == numPixels);
+      parallelRun(numPixels, [&](SIZE_T first, SIZE_T count) {
+        srgbToLinearRun(pSrc + 4 * first, pDst + 4 * first, count);
+      });
+    }
+
+    void
+    convertLinearToSRGB(const float* pSrc, uint8* pDst, SIZE_T numPixels) {
+      GE_ASSERT((pSrc && pDst) || 0 == numPixels);
+      parallelRun(numPixels, [&](SIZE_T first, SIZE_T count) {
+        linearToSRGBRun(pSrc + 4 * first, pDst + 4 * first, count);
+      });
+    }
+
+    float
+    floatFromHalf(uint16 value) {
+      const uint32 sign = static_cast<uint32>(value & 0x8000) << 16;
+      const uint32 exponent = (value >> 10) & 0x1F;
+      const uint32 mantissa = value & 0x3FF;
+
+      if (0 == exponent) {
+        //Zero or subnormal, mantissa * 2^-24
+        float magnitude = mantissa * (1.0f / 16777216.0f);
+        return bitsFloat(floatBits(magnitude) | sign);
+      }
+      if (0x1F == exponent) {
+        return bitsFloat(sign | 0x7F800000 | (mantissa << 13));
+      }
+      return bitsFloat(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+    }
+
+    uint16
+    halfFromFloat(float value) {
+      uint32 bits = floatBits(value);
+      const uint32 sign = bits & 0x80000000;
+      bits ^= sign;
+
+      uint32 result;
+      if (bits >= HALF_MAX_BITS) {
+        result = bits > 0x7F800000 ? 0x7E00 : 0x7C00;
+      }
+      else if (bits < HALF_MIN_NORMAL_BITS) {
+        result = floatBits(bitsFloat(bits) + bitsFloat(DENORM_MAGIC_BITS)) - DENORM_MAGIC_BITS;
+      }
+      else {
+        const uint32 mantOdd = (bits >> 13) & 1;
+        bits -= (127 - 15) << 23;
+        bits += 0xFFF + mantOdd;
+        result = bits >> 13;
+      }
+      return static_cast<uint16>(result | (sign >> 16));
+    }
+  }
+
+} // namespace geEngineSDK
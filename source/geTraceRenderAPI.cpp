@@ -0,0 +1,1334 @@
+/*****************************************************************************/
+/**
+ * @file    geTraceRenderAPI.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Render API that captures the calls made to another one.
+ *
+ * Render API that captures the calls made to another one.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include "geTraceRenderAPI.h"
+
+#include <geGameConfig.h>
+#include <geMath.h>
+#include <geDebug.h>
+#include <geVector3.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace geEngineSDK {
+
+  namespace {
+    uint32
+    floatAsUInt(float value) {
+      uint32 bits;
+      memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+
+    /**
+     * @brief Key of the last bind of a slot. The slot only distinguishes the
+     *        binds that have more than one (for the rest it has another
+     *        meaning, like the number of viewports).
+     */
+    uint64
+    getBindKey(NULL_COMMAND::E type, NULL_SHADER_STAGE::E stage, uint32 slot) {
+      switch (type)
+      {
+      case NULL_COMMAND::kSetVertexBuffer:
+      case NULL_COMMAND::kSetShaderResource:
+      case NULL_COMMAND::kSetUnorderedAccess:
+      case NULL_COMMAND::kSetConstantBuffer:
+      case NULL_COMMAND::kSetSampler:
+        break;
+      default:
+        slot = 0;
+        break;
+      }
+      return (static_cast<uint64>(type) << 40) |
+             (static_cast<uint64>(stage) << 32) |
+             slot;
+    }
+  }
+
+  TraceRenderAPI::TraceRenderAPI(SPtr<RenderAPI> pBackend)
+    : m_pBackend(std::move(pBackend)) {
+    GE_ASSERT(m_pBackend);
+  }
+
+  TraceRenderAPI::~TraceRenderAPI() {
+    if (m_bCapturing) {
+      _finishCapture();
+    }
+  }
+
+  bool
+  TraceRenderAPI::initRenderAPI(void* scrHandle, bool bFullScreen) {
+    if (!m_pBackend->initRenderAPI(scrHandle, bFullScreen)) {
+      return false;
+    }
+
+    auto& config = GameConfig::instance();
+    String fileName = config.get<String>("RenderAPI", "TraceCaptureFile", "");
+    if (!fileName.empty()) {
+      m_captureFile = Path(fileName);
+      m_captureStartFrame = config.get<uint32>("RenderAPI", "TraceCaptureFirstFrame", 0);
+      m_numFramesToCapture = config.get<uint32>("RenderAPI", "TraceCaptureNumFrames", 1);
+
+      if (m_frameIndex == m_captureStartFrame) {
+        _beginCapture();
+      }
+    }
+
+    return true;
+  }
+
+  bool
+  TraceRenderAPI::resizeSwapChain(uint32 newWidth, uint32 newHeight) {
+    _record(NULL_COMMAND::kResizeSwapChain,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            newWidth,
+            newHeight);
+    return m_pBackend->resizeSwapChain(newWidth, newHeight);
+  }
+
+  bool
+  TraceRenderAPI::isMSAAFormatSupported(const GRAPHICS_FORMAT::E format,
+                                        int32& samplesPerPixel,
+                                        int32& sampleQuality) const {
+    return m_pBackend->isMSAAFormatSupported(format, samplesPerPixel, sampleQuality);
+  }
+
+  void
+  TraceRenderAPI::msaaResolveRenderTarget(const WeakSPtr<Texture>& pSrc,
+                                          const WeakSPtr<Texture>& pDst) {
+    _record(NULL_COMMAND::kResolve, _getId(pDst), _getId(pSrc));
+    m_pBackend->msaaResolveRenderTarget(pSrc, pDst);
+  }
+
+  void
+  TraceRenderAPI::reportLiveObjects() {
+    m_pBackend->reportLiveObjects();
+  }
+
+  /*************************************************************************/
+  // Get methods
+  /*************************************************************************/
+  WeakSPtr<Texture>
+  TraceRenderAPI::getBackBuffer() const {
+    _registerBackBuffer();
+    return m_pBackend->getBackBuffer();
+  }
+
+  WeakSPtr<RasterizerState>
+  TraceRenderAPI::getCurrentRasterizerState() const {
+    return m_pBackend->getCurrentRasterizerState();
+  }
+
+  WeakSPtr<DepthStencilState>
+  TraceRenderAPI::getCurrentDepthStencilState() const {
+    return m_pBackend->getCurrentDepthStencilState();
+  }
+
+  WeakSPtr<BlendState>
+  TraceRenderAPI::getCurrentBlendState() const {
+    return m_pBackend->getCurrentBlendState();
+  }
+
+  WeakSPtr<SamplerState>
+  TraceRenderAPI::getCurrentSamplerState(uint32 samplerSlot) const {
+    return m_pBackend->getCurrentSamplerState(samplerSlot);
+  }
+
+  /*************************************************************************/
+  // Create methods
+  /*************************************************************************/
+  SPtr<Texture>
+  TraceRenderAPI::createTexture(uint32 width,
+                                uint32 height,
+                                GRAPHICS_FORMAT::E format,
+                                uint32 bindFlags,
+                                uint32 mipLevels,
+                                RESOURCE_USAGE::E usage,
+                                uint32 cpuAccessFlags,
+                                uint32 sampleCount,
+                                bool isMSAA,
+                                bool isCubeMap,
+                                uint32 arraySize) {
+    auto pTexture = m_pBackend->createTexture(width,
+                                              height,
+                                              format,
+                                              bindFlags,
+                                              mipLevels,
+                                              usage,
+                                              cpuAccessFlags,
+                                              sampleCount,
+                                              isMSAA,
+                                              isCubeMap,
+                                              arraySize);
+
+    NullTextureCreateInfo createInfo;
+    createInfo.mipLevels = mipLevels;
+    createInfo.usage = usage;
+    createInfo.cpuAccessFlags = cpuAccessFlags;
+    createInfo.sampleCount = sampleCount;
+    createInfo.bMSAA = isMSAA ? 1 : 0;
+    createInfo.bCubeMap = isCubeMap ? 1 : 0;
+    createInfo.arraySize = arraySize;
+
+    uint32 id = _registerObject(pTexture,
+                                NULL_COMMAND::kCreateTexture,
+                                NULL_SHADER_STAGE::kNumStages,
+                                width,
+                                height,
+                                static_cast<uint32>(format),
+                                bindFlags,
+                                &createInfo,
+                                sizeof(createInfo));
+    if (id) {
+      if (0 == mipLevels) {
+        uint32 size = Math::max(width, height);
+        while (size > 1) {
+          size >>= 1;
+          ++mipLevels;
+        }
+        ++mipLevels;
+      }
+
+      RenderTraceResourceInfo& info = m_objects[id].info;
+      info.width = width;
+      info.height = height;
+      info.mipLevels = mipLevels;
+      info.format = static_cast<uint32>(format);
+    }
+
+    return pTexture;
+  }
+
+  SPtr<VertexDeclaration>
+  TraceRenderAPI::createVertexDeclaration(const Vector<VertexElement>& elements) {
+    auto pDecl = m_pBackend->createVertexDeclaration(elements);
+
+    //The elements are plain data, the replay reads them back as they are
+    _registerObject(pDecl,
+                    NULL_COMMAND::kCreateVertexDeclaration,
+                    NULL_SHADER_STAGE::kNumStages,
+                    0, 0, 0, 0,
+                    elements.data(),
+                    sizeof(VertexElement) * elements.size());
+    return pDecl;
+  }
+
+  SPtr<StreamOutputDeclaration>
+  TraceRenderAPI::createStreamOutputDeclaration(const Vector<StreamOutputElement>& elements) {
+    auto pDecl = m_pBackend->createStreamOutputDeclaration(elements);
+    _registerObject(pDecl,
+                    NULL_COMMAND::kCreateStreamOutputDeclaration,
+                    NULL_SHADER_STAGE::kNumStages,
+                    0, 0, 0, 0,
+                    elements.data(),
+                    sizeof(StreamOutputElement) * elements.size());
+    return pDecl;
+  }
+
+  SPtr<InputLayout>
+  TraceRenderAPI::createInputLayout(const WeakSPtr<VertexDeclaration>& descArray,
+                                    const WeakSPtr<VertexShader>& pVS) {
+    auto pLayout = m_pBackend->createInputLayout(descArray, pVS);
+    _registerObject(pLayout,
+                    NULL_COMMAND::kCreateInputLayout,
+                    NULL_SHADER_STAGE::kNumStages,
+                    _getId(descArray),
+                    _getId(pVS),
+                    0, 0,
+                    nullptr,
+                    0);
+    return pLayout;
+  }
+
+  SPtr<InputLayout>
+  TraceRenderAPI::createInputLayoutFromShader(const WeakSPtr<VertexShader>& pVS) {
+    auto pLayout = m_pBackend->createInputLayoutFromShader(pVS);
+    _registerObject(pLayout,
+                    NULL_COMMAND::kCreateInputLayoutFromShader,
+                    NULL_SHADER_STAGE::kNumStages,
+                    _getId(pVS),
+                    0, 0, 0,
+                    nullptr,
+                    0);
+    return pLayout;
+  }
+
+  SPtr<VertexBuffer>
+  TraceRenderAPI::createVertexBuffer(const SPtr<VertexDeclaration>& pDecl,
+                                     const SIZE_T sizeInBytes,
+                                     const void* pInitialData,
+                                     const uint32 usage) {
+    auto pVB = m_pBackend->createVertexBuffer(pDecl, sizeInBytes, pInitialData, usage);
+    uint32 id = _registerObject(pVB,
+                                NULL_COMMAND::kCreateVertexBuffer,
+                                NULL_SHADER_STAGE::kNumStages,
+                                static_cast<uint32>(sizeInBytes),
+                                usage,
+                                _getId(pDecl),
+                                0,
+                                pInitialData,
+                                pInitialData ? sizeInBytes : 0);
+    if (id) {
+      m_objects[id].info.bBuffer = true;
+      m_objects[id].info.sizeInBytes = sizeInBytes;
+    }
+    return pVB;
+  }
+
+  SPtr<StreamOutputBuffer>
+  TraceRenderAPI::createStreamOutputBuffer(const SPtr<StreamOutputDeclaration>& pDecl,
+                                           const SIZE_T sizeInBytes,
+                                           const uint32 usage) {
+    auto pSOB = m_pBackend->createStreamOutputBuffer(pDecl, sizeInBytes, usage);
+    uint32 id = _registerObject(pSOB,
+                                NULL_COMMAND::kCreateStreamOutputBuffer,
+                                NULL_SHADER_STAGE::kNumStages,
+                                static_cast<uint32>(sizeInBytes),
+                                usage,
+                                _getId(pDecl),
+                                0,
+                                nullptr,
+                                0);
+    if (id) {
+      m_objects[id].info.bBuffer = true;
+      m_objects[id].info.sizeInBytes = sizeInBytes;
+    }
+    return pSOB;
+  }
+
+  SPtr<IndexBuffer>
+  TraceRenderAPI::createIndexBuffer(const SIZE_T sizeInBytes,
+                                    const void* pInitialData,
+                                    const INDEX_BUFFER_FORMAT::E format,
+                                    const uint32 usage) {
+    auto pIB = m_pBackend->createIndexBuffer(sizeInBytes, pInitialData, format, usage);
+    uint32 id = _registerObject(pIB,
+                                NULL_COMMAND::kCreateIndexBuffer,
+                                NULL_SHADER_STAGE::kNumStages,
+                                static_cast<uint32>(sizeInBytes),
+                                usage,
+                                static_cast<uint32>(format),
+                                0,
+                                pInitialData,
+                                pInitialData ? sizeInBytes : 0);
+    if (id) {
+      m_objects[id].info.bBuffer = true;
+      m_objects[id].info.sizeInBytes = sizeInBytes;
+    }
+    return pIB;
+  }
+
+  SPtr<ConstantBuffer>
+  TraceRenderAPI::createConstantBuffer(const SIZE_T sizeInBytes,
+                                       const void* pInitialData,
+                                       const uint32 usage) {
+    auto pCB = m_pBackend->createConstantBuffer(sizeInBytes, pInitialData, usage);
+    uint32 id = _registerObject(pCB,
+                                NULL_COMMAND::kCreateConstantBuffer,
+                                NULL_SHADER_STAGE::kNumStages,
+                                static_cast<uint32>(sizeInBytes),
+                                usage,
+                                0, 0,
+                                pInitialData,
+                                pInitialData ? sizeInBytes : 0);
+    if (id) {
+      m_objects[id].info.bBuffer = true;
+      m_objects[id].info.sizeInBytes = sizeInBytes;
+    }
+    return pCB;
+  }
+
+  SPtr<RasterizerState>
+  TraceRenderAPI::createRasterizerState(const RASTERIZER_DESC& rasterDesc) {
+    auto pRS = m_pBackend->createRasterizerState(rasterDesc);
+    _registerObject(pRS,
+                    NULL_COMMAND::kCreateRasterizerState,
+                    NULL_SHADER_STAGE::kNumStages,
+                    0, 0, 0, 0,
+                    &rasterDesc,
+                    sizeof(RASTERIZER_DESC));
+    return pRS;
+  }
+
+  SPtr<DepthStencilState>
+  TraceRenderAPI::createDepthStencilState(const DEPTH_STENCIL_DESC& depthStencilDesc) {
+    auto pDSS = m_pBackend->createDepthStencilState(depthStencilDesc);
+    _registerObject(pDSS,
+                    NULL_COMMAND::kCreateDepthStencilState,
+                    NULL_SHADER_STAGE::kNumStages,
+                    0, 0, 0, 0,
+                    &depthStencilDesc,
+                    sizeof(DEPTH_STENCIL_DESC));
+    return pDSS;
+  }
+
+  SPtr<BlendState>
+  TraceRenderAPI::createBlendState(const BLEND_DESC& blendDesc,
+                                   const Vector4 blendFactors,
+                                   const uint32 sampleMask) {
+    auto pBS = m_pBackend->createBlendState(blendDesc, blendFactors, sampleMask);
+
+    NullBlendCreateInfo createInfo;
+    createInfo.desc = blendDesc;
+    createInfo.blendFactors = blendFactors;
+    _registerObject(pBS,
+                    NULL_COMMAND::kCreateBlendState,
+                    NULL_SHADER_STAGE::kNumStages,
+                    sampleMask,
+                    0, 0, 0,
+                    &createInfo,
+                    sizeof(createInfo));
+    return pBS;
+  }
+
+  SPtr<SamplerState>
+  TraceRenderAPI::createSamplerState(const SAMPLER_DESC& samplerDesc) {
+    auto pSS = m_pBackend->createSamplerState(samplerDesc);
+    _registerObject(pSS,
+                    NULL_COMMAND::kCreateSamplerState,
+                    NULL_SHADER_STAGE::kNumStages,
+                    0, 0, 0, 0,
+                    &samplerDesc,
+                    sizeof(SAMPLER_DESC));
+    return pSS;
+  }
+
+  /*************************************************************************/
+  // Create Shaders
+  /*************************************************************************/
+  template<class T>
+  SPtr<T>
+  TraceRenderAPI::_createShader(SPtr<T> pShader,
+                                NULL_SHADER_STAGE::E stage,
+                                uint32 soDeclarationId,
+                                CREATE_SHADER_PARAMS) {
+    Vector<String> strings = { fileName.toString(), szEntryPoint, szShaderModel };
+    for (const auto& macro : pMacro) {
+      strings.push_back(macro.name);
+      strings.push_back(macro.definition);
+    }
+    NullCommandStream::packStrings(strings, m_scratchData);
+
+    _registerObject(pShader,
+                    NULL_COMMAND::kCreateShader,
+                    stage,
+                    soDeclarationId,
+                    0, 0, 0,
+                    m_scratchData.data(),
+                    m_scratchData.size());
+    return pShader;
+  }
+
+  SPtr<VertexShader>
+  TraceRenderAPI::createVertexShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createVertexShader(fileName,
+                                                        pMacro,
+                                                        szEntryPoint,
+                                                        szShaderModel),
+                         NULL_SHADER_STAGE::kVertex, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<PixelShader>
+  TraceRenderAPI::createPixelShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createPixelShader(fileName,
+                                                       pMacro,
+                                                       szEntryPoint,
+                                                       szShaderModel),
+                         NULL_SHADER_STAGE::kPixel, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<GeometryShader>
+  TraceRenderAPI::createGeometryShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createGeometryShader(fileName,
+                                                          pMacro,
+                                                          szEntryPoint,
+                                                          szShaderModel),
+                         NULL_SHADER_STAGE::kGeometry, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<GeometryShader>
+  TraceRenderAPI::createGeometryShaderWithStreamOutput(CREATE_SHADER_PARAMS,
+                                     const SPtr<StreamOutputDeclaration>& pDecl) {
+    return _createShader(m_pBackend->createGeometryShaderWithStreamOutput(fileName,
+                                                                          pMacro,
+                                                                          szEntryPoint,
+                                                                          szShaderModel,
+                                                                          pDecl),
+                         NULL_SHADER_STAGE::kGeometry, _getId(pDecl),
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<HullShader>
+  TraceRenderAPI::createHullShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createHullShader(fileName,
+                                                      pMacro,
+                                                      szEntryPoint,
+                                                      szShaderModel),
+                         NULL_SHADER_STAGE::kHull, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<DomainShader>
+  TraceRenderAPI::createDomainShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createDomainShader(fileName,
+                                                        pMacro,
+                                                        szEntryPoint,
+                                                        szShaderModel),
+                         NULL_SHADER_STAGE::kDomain, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  SPtr<ComputeShader>
+  TraceRenderAPI::createComputeShader(CREATE_SHADER_PARAMS) {
+    return _createShader(m_pBackend->createComputeShader(fileName,
+                                                         pMacro,
+                                                         szEntryPoint,
+                                                         szShaderModel),
+                         NULL_SHADER_STAGE::kCompute, 0,
+                         fileName, pMacro, szEntryPoint, szShaderModel);
+  }
+
+  /*************************************************************************/
+  // Write Functions
+  /*************************************************************************/
+  void
+  TraceRenderAPI::writeToResource(const WeakSPtr<GraphicsResource>& pResource,
+                                  uint32 dstSubRes,
+                                  const GRAPHICS_BOX* pDstBox,
+                                  const void* pSrcData,
+                                  uint32 srcRowPitch,
+                                  uint32 srcDepthPitch,
+                                  uint32 copyFlags) {
+    if (m_bCapturing && pSrcData) {
+      uint32 id = _getId(pResource);
+      auto it = m_objects.find(id);
+      if (it != m_objects.end()) {
+        //The data of the command is the box (if any) followed by the bytes
+        SIZE_T boxSize = pDstBox ? sizeof(GRAPHICS_BOX) : 0;
+        SIZE_T size = RenderTrace::getWriteSize(it->second.info,
+                                                dstSubRes,
+                                                pDstBox,
+                                                srcRowPitch,
+                                                srcDepthPitch);
+        m_scratchData.resize(boxSize + size);
+        if (pDstBox) {
+          memcpy(m_scratchData.data(), pDstBox, boxSize);
+        }
+        if (size) {
+          memcpy(m_scratchData.data() + boxSize, pSrcData, size);
+        }
+
+        _record(NULL_COMMAND::kWriteResource,
+                id,
+                dstSubRes,
+                NULL_SHADER_STAGE::kNumStages,
+                srcRowPitch,
+                srcDepthPitch,
+                copyFlags,
+                pDstBox ? 1 : 0,
+                m_scratchData.data(),
+                static_cast<uint32>(m_scratchData.size()));
+      }
+    }
+
+    m_pBackend->writeToResource(pResource,
+                                dstSubRes,
+                                pDstBox,
+                                pSrcData,
+                                srcRowPitch,
+                                srcDepthPitch,
+                                copyFlags);
+  }
+
+  MappedSubresource
+  TraceRenderAPI::mapToRead(const WeakSPtr<GraphicsResource>& pTexture,
+                            uint32 subResource,
+                            uint32 mapFlags) {
+    _record(NULL_COMMAND::kMap,
+            _getId(pTexture),
+            subResource,
+            NULL_SHADER_STAGE::kNumStages,
+            mapFlags);
+    return m_pBackend->mapToRead(pTexture, subResource, mapFlags);
+  }
+
+  void
+  TraceRenderAPI::unmap(const WeakSPtr<GraphicsResource>& pTexture,
+                        uint32 subResource) {
+    _record(NULL_COMMAND::kUnmap, _getId(pTexture), subResource);
+    m_pBackend->unmap(pTexture, subResource);
+  }
+
+  void
+  TraceRenderAPI::copyResource(const WeakSPtr<GraphicsResource>& pSrcObj,
+                               const WeakSPtr<GraphicsResource>& pDstObj) {
+    _record(NULL_COMMAND::kCopyResource, _getId(pDstObj), _getId(pSrcObj));
+    m_pBackend->copyResource(pSrcObj, pDstObj);
+  }
+
+  void
+  TraceRenderAPI::generateMips(const WeakSPtr<Texture>& pTexture) {
+    _record(NULL_COMMAND::kGenerateMips, _getId(pTexture));
+    m_pBackend->generateMips(pTexture);
+  }
+
+  void
+  TraceRenderAPI::clearRenderTarget(const WeakSPtr<Texture>& pRenderTarget,
+                                    const LinearColor& color) {
+    _record(NULL_COMMAND::kClearRenderTarget,
+            _getId(pRenderTarget),
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            0, 0, 0, 0,
+            &color,
+            sizeof(LinearColor));
+    m_pBackend->clearRenderTarget(pRenderTarget, color);
+  }
+
+  void
+  TraceRenderAPI::clearDepthStencil(const WeakSPtr<Texture>& pDepthStencilView,
+                                    uint32 flags,
+                                    float depthVal,
+                                    uint8 stencilVal) {
+    _record(NULL_COMMAND::kClearDepthStencil,
+            _getId(pDepthStencilView),
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            flags,
+            floatAsUInt(depthVal),
+            stencilVal);
+    m_pBackend->clearDepthStencil(pDepthStencilView, flags, depthVal, stencilVal);
+  }
+
+  void
+  TraceRenderAPI::discardView(WeakSPtr<Texture> pTexture) {
+    _record(NULL_COMMAND::kDiscardView, _getId(pTexture));
+    m_pBackend->discardView(pTexture);
+  }
+
+  void
+  TraceRenderAPI::present() {
+    _collectReleasedObjects();
+    _record(NULL_COMMAND::kPresent);
+    m_pBackend->present();
+
+    if (m_bCapturing) {
+      m_trace.addFrame(m_commands);
+      m_commands.clear();
+
+      uint32 numCaptured = m_trace.getNumFrames() - m_trace.getNumSetupFrames();
+      if (numCaptured >= m_numFramesToCapture) {
+        _finishCapture();
+      }
+    }
+
+    ++m_frameIndex;
+    if (!m_bCapturing && m_frameIndex == m_captureStartFrame) {
+      _beginCapture();
+    }
+  }
+
+  /*************************************************************************/
+  // Set Objects
+  /*************************************************************************/
+  void
+  TraceRenderAPI::setImmediateContext() {
+    m_pBackend->setImmediateContext();
+  }
+
+  void
+  TraceRenderAPI::setTopology(PRIMITIVE_TOPOLOGY::E topologyType) {
+    _recordBind(NULL_COMMAND::kSetTopology,
+                0,
+                0,
+                NULL_SHADER_STAGE::kNumStages,
+                static_cast<uint32>(topologyType));
+    m_pBackend->setTopology(topologyType);
+  }
+
+  void
+  TraceRenderAPI::setViewports(const Vector<GRAPHICS_VIEWPORT>& viewports) {
+    auto numViewports = static_cast<uint32>(viewports.size());
+    _recordBind(NULL_COMMAND::kSetViewports,
+                0,
+                numViewports,
+                NULL_SHADER_STAGE::kNumStages,
+                0, 0,
+                viewports.data(),
+                static_cast<uint32>(sizeof(GRAPHICS_VIEWPORT) * numViewports));
+    m_pBackend->setViewports(viewports);
+  }
+
+  void
+  TraceRenderAPI::setInputLayout(const WeakSPtr<InputLayout>& pInputLayout) {
+    _recordBind(NULL_COMMAND::kSetInputLayout, _getId(pInputLayout));
+    m_pBackend->setInputLayout(pInputLayout);
+  }
+
+  void
+  TraceRenderAPI::setRasterizerState(const WeakSPtr<RasterizerState>& pRasterizerState) {
+    _recordBind(NULL_COMMAND::kSetRasterizerState, _getId(pRasterizerState));
+    m_pBackend->setRasterizerState(pRasterizerState);
+  }
+
+  void
+  TraceRenderAPI::setDepthStencilState(const WeakSPtr<DepthStencilState>& pDepthStencilState,
+                                       uint32 stencilRef) {
+    _recordBind(NULL_COMMAND::kSetDepthStencilState,
+                _getId(pDepthStencilState),
+                0,
+                NULL_SHADER_STAGE::kNumStages,
+                stencilRef);
+    m_pBackend->setDepthStencilState(pDepthStencilState, stencilRef);
+  }
+
+  void
+  TraceRenderAPI::setBlendState(const WeakSPtr<BlendState>& pBlendState) {
+    _recordBind(NULL_COMMAND::kSetBlendState, _getId(pBlendState));
+    m_pBackend->setBlendState(pBlendState);
+  }
+
+  void
+  TraceRenderAPI::setVertexBuffer(const WeakSPtr<VertexBuffer>& pVertexBuffer,
+                                  uint32 startSlot,
+                                  uint32 offset) {
+    //The stride comes from the declaration of the buffer on replay
+    _recordBind(NULL_COMMAND::kSetVertexBuffer,
+                _getId(pVertexBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kNumStages,
+                0,
+                offset);
+    m_pBackend->setVertexBuffer(pVertexBuffer, startSlot, offset);
+  }
+
+  void
+  TraceRenderAPI::setIndexBuffer(const WeakSPtr<IndexBuffer>& pIndexBuffer,
+                                 uint32 offset) {
+    _recordBind(NULL_COMMAND::kSetIndexBuffer,
+                _getId(pIndexBuffer),
+                0,
+                NULL_SHADER_STAGE::kNumStages,
+                offset);
+    m_pBackend->setIndexBuffer(pIndexBuffer, offset);
+  }
+
+  /*************************************************************************/
+  // Set Shaders
+  /*************************************************************************/
+  void
+  TraceRenderAPI::vsSetProgram(const WeakSPtr<VertexShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kVertex);
+    m_pBackend->vsSetProgram(pInShader);
+  }
+
+  void
+  TraceRenderAPI::psSetProgram(const WeakSPtr<PixelShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kPixel);
+    m_pBackend->psSetProgram(pInShader);
+  }
+
+  void
+  TraceRenderAPI::gsSetProgram(const WeakSPtr<GeometryShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kGeometry);
+    m_pBackend->gsSetProgram(pInShader);
+  }
+
+  void
+  TraceRenderAPI::hsSetProgram(const WeakSPtr<HullShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kHull);
+    m_pBackend->hsSetProgram(pInShader);
+  }
+
+  void
+  TraceRenderAPI::dsSetProgram(const WeakSPtr<DomainShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kDomain);
+    m_pBackend->dsSetProgram(pInShader);
+  }
+
+  void
+  TraceRenderAPI::csSetProgram(const WeakSPtr<ComputeShader>& pInShader) {
+    _recordBind(NULL_COMMAND::kSetProgram, _getId(pInShader), 0, NULL_SHADER_STAGE::kCompute);
+    m_pBackend->csSetProgram(pInShader);
+  }
+
+  /*************************************************************************/
+  // Set Shader Resources
+  /*************************************************************************/
+  void
+  TraceRenderAPI::vsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kVertex);
+    m_pBackend->vsSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::psSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kPixel);
+    m_pBackend->psSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::gsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kGeometry);
+    m_pBackend->gsSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::hsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kHull);
+    m_pBackend->hsSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::dsSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kDomain);
+    m_pBackend->dsSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::csSetShaderResource(const WeakSPtr<Texture>& pTexture,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetShaderResource,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kCompute);
+    m_pBackend->csSetShaderResource(pTexture, startSlot);
+  }
+
+  void
+  TraceRenderAPI::csSetUnorderedAccessView(const WeakSPtr<Texture>& pTexture,
+                                           const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetUnorderedAccess,
+                _getId(pTexture),
+                startSlot,
+                NULL_SHADER_STAGE::kCompute);
+    m_pBackend->csSetUnorderedAccessView(pTexture, startSlot);
+  }
+
+  /*************************************************************************/
+  // Set Constant Buffers
+  /*************************************************************************/
+  void
+  TraceRenderAPI::vsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kVertex);
+    m_pBackend->vsSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  void
+  TraceRenderAPI::psSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kPixel);
+    m_pBackend->psSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  void
+  TraceRenderAPI::gsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kGeometry);
+    m_pBackend->gsSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  void
+  TraceRenderAPI::hsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kHull);
+    m_pBackend->hsSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  void
+  TraceRenderAPI::dsSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kDomain);
+    m_pBackend->dsSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  void
+  TraceRenderAPI::csSetConstantBuffer(const WeakSPtr<ConstantBuffer>& pBuffer,
+                                      const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetConstantBuffer,
+                _getId(pBuffer),
+                startSlot,
+                NULL_SHADER_STAGE::kCompute);
+    m_pBackend->csSetConstantBuffer(pBuffer, startSlot);
+  }
+
+  /*************************************************************************/
+  // Set Samplers
+  /*************************************************************************/
+  void
+  TraceRenderAPI::vsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kVertex);
+    m_pBackend->vsSetSampler(pSampler, startSlot);
+  }
+
+  void
+  TraceRenderAPI::psSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kPixel);
+    m_pBackend->psSetSampler(pSampler, startSlot);
+  }
+
+  void
+  TraceRenderAPI::gsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kGeometry);
+    m_pBackend->gsSetSampler(pSampler, startSlot);
+  }
+
+  void
+  TraceRenderAPI::hsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kHull);
+    m_pBackend->hsSetSampler(pSampler, startSlot);
+  }
+
+  void
+  TraceRenderAPI::dsSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kDomain);
+    m_pBackend->dsSetSampler(pSampler, startSlot);
+  }
+
+  void
+  TraceRenderAPI::csSetSampler(const WeakSPtr<SamplerState>& pSampler,
+                               const uint32 startSlot) {
+    _recordBind(NULL_COMMAND::kSetSampler,
+                _getId(pSampler),
+                startSlot,
+                NULL_SHADER_STAGE::kCompute);
+    m_pBackend->csSetSampler(pSampler, startSlot);
+  }
+
+  /*************************************************************************/
+  // Set Render Targets
+  /*************************************************************************/
+  void
+  TraceRenderAPI::setRenderTargets(const Vector<RenderTarget>& pTargets,
+                                   const WeakSPtr<Texture>& pDepthStencilView) {
+    Vector<NullRenderTargetBinding> bindings(pTargets.size());
+    for (SIZE_T i = 0; i < pTargets.size(); ++i) {
+      bindings[i].id = _getId(pTargets[i].pRenderTarget);
+      bindings[i].mipLevel = pTargets[i].mipLevel;
+    }
+
+    auto numTargets = static_cast<uint32>(bindings.size());
+    _recordBind(NULL_COMMAND::kSetRenderTargets,
+                _getId(pDepthStencilView),
+                numTargets,
+                NULL_SHADER_STAGE::kNumStages,
+                0, 0,
+                bindings.data(),
+                static_cast<uint32>(sizeof(NullRenderTargetBinding) * numTargets));
+    m_pBackend->setRenderTargets(pTargets, pDepthStencilView);
+  }
+
+  void
+  TraceRenderAPI::setStreamOutputTarget(const WeakSPtr<StreamOutputBuffer>& pBuffer) {
+    _recordBind(NULL_COMMAND::kSetStreamOutput, _getId(pBuffer));
+    m_pBackend->setStreamOutputTarget(pBuffer);
+  }
+
+  /*************************************************************************/
+  // State Management Functions
+  /*************************************************************************/
+  SPtr<PipelineState>
+  TraceRenderAPI::savePipelineState() const {
+    auto pState = m_pBackend->savePipelineState();
+
+    //Saved states can't be recreated by a setup frame, only their binds
+    uint32 id = _registerObject(pState,
+                                NULL_COMMAND::kSavePipelineState,
+                                NULL_SHADER_STAGE::kNumStages,
+                                0, 0, 0, 0,
+                                nullptr,
+                                0);
+    if (id) {
+      m_savedBinds[id] = m_binds;
+    }
+    return pState;
+  }
+
+  void
+  TraceRenderAPI::restorePipelineState(const WeakSPtr<PipelineState>& pState) {
+    uint32 id = _getId(pState);
+    auto it = m_savedBinds.find(id);
+    if (it != m_savedBinds.end()) {
+      m_binds = it->second;
+      for (auto& bind : m_binds) {
+        bind.second.sequence = m_bindSequence++;
+      }
+    }
+
+    _record(NULL_COMMAND::kRestorePipelineState, id);
+    m_pBackend->restorePipelineState(pState);
+  }
+
+  /*************************************************************************/
+  // Draw Functions
+  /*************************************************************************/
+  void
+  TraceRenderAPI::draw(uint32 vertexCount, uint32 startVertexLocation) {
+    _record(NULL_COMMAND::kDraw,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            vertexCount,
+            startVertexLocation);
+    m_pBackend->draw(vertexCount, startVertexLocation);
+  }
+
+  void
+  TraceRenderAPI::drawIndexed(uint32 indexCount,
+                              uint32 startIndexLocation,
+                              int32 baseVertexLocation) {
+    _record(NULL_COMMAND::kDrawIndexed,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            indexCount,
+            startIndexLocation,
+            static_cast<uint32>(baseVertexLocation));
+    m_pBackend->drawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+  }
+
+  void
+  TraceRenderAPI::drawInstanced(uint32 vertexCountPerInstance,
+                                uint32 instanceCount,
+                                uint32 startVertexLocation,
+                                uint32 startInstanceLocation) {
+    _record(NULL_COMMAND::kDrawInstanced,
+            0,
+            0,
+            NULL_SHADER_STAGE::kNumStages,
+            vertexCountPerInstance,
+            instanceCount,
+            startVertexLocation,
+            startInstanceLocation);
+    m_pBackend->drawInstanced(vertexCountPerInstance,
+                              instanceCount,
+                              startVertexLocation,
+                              startInstanceLocation);
+  }
+
+  void
+  TraceRenderAPI::drawAuto() {
+    _record(NULL_COMMAND::kDrawAuto);
+    m_pBackend->drawAuto();
+  }
+
+  void
+  TraceRenderAPI::dispatch(uint32 threadGroupCountX,
+                           uint32 threadGroupCountY,
+                           uint32 threadGroupCountZ) {
+    _record(NULL_COMMAND::kDispatch,
+            0,
+            0,
+            NULL_SHADER_STAGE::kCompute,
+            threadGroupCountX,
+            threadGroupCountY,
+            threadGroupCountZ);
+    m_pBackend->dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+  }
+
+  /*************************************************************************/
+  // Trace specific
+  /*************************************************************************/
+  void
+  TraceRenderAPI::startCapture(const Path& filePath, uint32 numFrames) {
+    if (m_bCapturing) {
+      GE_LOG(kWarning, RenderAPI, "A render trace capture is already running.");
+      return;
+    }
+
+    m_captureFile = filePath;
+    m_numFramesToCapture = Math::max(1U, numFrames);
+    m_captureStartFrame = m_frameIndex + 1;
+  }
+
+  uint32
+  TraceRenderAPI::_getId(const void* pKey) const {
+    auto it = m_ids.find(pKey);
+    return it != m_ids.end() ? it->second : 0;
+  }
+
+  uint32
+  TraceRenderAPI::_registerObject(const void* pKey,
+                                  WeakSPtr<void> pObject,
+                                  NULL_COMMAND::E type,
+                                  NULL_SHADER_STAGE::E stage,
+                                  uint32 arg0,
+                                  uint32 arg1,
+                                  uint32 arg2,
+                                  uint32 arg3,
+                                  const void* pData,
+                                  SIZE_T dataSize) const {
+    uint32 id = m_nextId++;
+
+    //A new object can take the address of a released one
+    m_ids[pKey] = id;
+
+    TraceObject& object = m_objects[id];
+    object.pKey = pKey;
+    object.pObject = std::move(pObject);
+    object.createCommand.type = type;
+    object.createCommand.stage = stage;
+    object.createCommand.resourceId = id;
+    object.createCommand.args[0] = arg0;
+    object.createCommand.args[1] = arg1;
+    object.createCommand.args[2] = arg2;
+    object.createCommand.args[3] = arg3;
+    if (dataSize) {
+      auto pBytes = reinterpret_cast<const uint8*>(pData);
+      object.createData.assign(pBytes, pBytes + dataSize);
+    }
+
+    _record(type,
+            id,
+            0,
+            stage,
+            arg0, arg1, arg2, arg3,
+            pData,
+            static_cast<uint32>(dataSize));
+    return id;
+  }
+
+  uint32
+  TraceRenderAPI::_registerBackBuffer() const {
+    SPtr<Texture> pBackBuffer = m_pBackend->getBackBuffer().lock();
+    if (!pBackBuffer) {
+      return 0;
+    }
+
+    uint32 id = _getId(pBackBuffer);
+    auto it = m_objects.find(id);
+    if (it != m_objects.end() && !it->second.pObject.expired()) {
+      return id;
+    }
+
+    id = _registerObject(pBackBuffer,
+                         NULL_COMMAND::kBackBuffer,
+                         NULL_SHADER_STAGE::kNumStages,
+                         0, 0, 0, 0,
+                         nullptr,
+                         0);
+
+    Vector3 dimensions = pBackBuffer->getDimensions();
+    RenderTraceResourceInfo& info = m_objects[id].info;
+    info.width = static_cast<uint32>(dimensions.x);
+    info.height = static_cast<uint32>(dimensions.y);
+    return id;
+  }
+
+  void
+  TraceRenderAPI::_record(NULL_COMMAND::E type,
+                          uint32 resourceId,
+                          uint32 slot,
+                          NULL_SHADER_STAGE::E stage,
+                          uint32 arg0,
+                          uint32 arg1,
+                          uint32 arg2,
+                          uint32 arg3,
+                          const void* pData,
+                          uint32 dataSize) const {
+    if (!m_bCapturing) {
+      return;
+    }
+
+    NullCommand command;
+    command.type = type;
+    command.stage = stage;
+    command.slot = slot;
+    command.resourceId = resourceId;
+    command.args[0] = arg0;
+    command.args[1] = arg1;
+    command.args[2] = arg2;
+    command.args[3] = arg3;
+    m_commands.record(command, pData, dataSize);
+  }
+
+  void
+  TraceRenderAPI::_recordBind(NULL_COMMAND::E type,
+                              uint32 resourceId,
+                              uint32 slot,
+                              NULL_SHADER_STAGE::E stage,
+                              uint32 arg0,
+                              uint32 arg1,
+                              const void* pData,
+                              uint32 dataSize) {
+    _record(type, resourceId, slot, stage, arg0, arg1, 0, 0, pData, dataSize);
+
+    TraceBind& bind = m_binds[getBindKey(type, stage, slot)];
+    bind.sequence = m_bindSequence++;
+    bind.command.type = type;
+    bind.command.stage = stage;
+    bind.command.slot = slot;
+    bind.command.resourceId = resourceId;
+    bind.command.args[0] = arg0;
+    bind.command.args[1] = arg1;
+    if (dataSize) {
+      auto pBytes = reinterpret_cast<const uint8*>(pData);
+      bind.data.assign(pBytes, pBytes + dataSize);
+    }
+    else {
+      bind.data.clear();
+    }
+  }
+
+  void
+  TraceRenderAPI::_beginCapture() {
+    _collectReleasedObjects();
+
+    m_trace.clear();
+    m_commands.clear();
+    m_bCapturing = true;
+
+    //Ids grow with creation, so dependencies are created first
+    Vector<uint32> ids;
+    ids.reserve(m_objects.size());
+    for (const auto& object : m_objects) {
+      if (object.second.createCommand.type != NULL_COMMAND::kSavePipelineState) {
+        ids.push_back(object.first);
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    for (auto id : ids) {
+      const TraceObject& object = m_objects[id];
+      m_commands.record(object.createCommand,
+                        object.createData.empty() ? nullptr : object.createData.data(),
+                        static_cast<uint32>(object.createData.size()));
+    }
+
+    Vector<const TraceBind*> binds;
+    binds.reserve(m_binds.size());
+    for (const auto& bind : m_binds) {
+      binds.push_back(&bind.second);
+    }
+    std::sort(binds.begin(), binds.end(),
+              [](const TraceBind* pA, const TraceBind* pB) {
+                return pA->sequence < pB->sequence;
+              });
+
+    for (auto pBind : binds) {
+      m_commands.record(pBind->command,
+                        pBind->data.empty() ? nullptr : pBind->data.data(),
+                        static_cast<uint32>(pBind->data.size()));
+    }
+
+    m_trace.addFrame(m_commands, true);
+    m_commands.clear();
+  }
+
+  void
+  TraceRenderAPI::_collectReleasedObjects() {
+    for (auto it = m_objects.begin(); it != m_objects.end();) {
+      if (!it->second.pObject.expired()) {
+        ++it;
+        continue;
+      }
+
+      _record(NULL_COMMAND::kReleaseResource, it->first);
+
+      auto idIt = m_ids.find(it->second.pKey);
+      if (idIt != m_ids.end() && idIt->second == it->first) {
+        m_ids.erase(idIt);
+      }
+      m_savedBinds.erase(it->first);
+      it = m_objects.erase(it);
+    }
+  }
+
+  void
+  TraceRenderAPI::_finishCapture() {
+    m_bCapturing = false;
+    m_captureStartFrame = NumLimit::MAX_UINT64;
+
+    //An interrupted frame is kept, it replays as a partial frame
+    if (m_commands.getNumCommands()) {
+      m_trace.addFrame(m_commands);
+      m_commands.clear();
+    }
+
+    if (m_trace.save(m_captureFile)) {
+      g_debug().log(StringUtil::format("Render trace of {0} frames saved to {1}",
+                                       m_trace.getNumFrames() - m_trace.getNumSetupFrames(),
+                                       m_captureFile.toString()),
+                    LogVerbosity::kInfo);
+    }
+    m_trace.clear();
+  }
+
+} // namespace geEngineSDK
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""
+@file    compareReference.py
+@author  Samuel Prince (samuel.prince.quezada@gmail.com)
+@date    2026/10/18
+@brief   Checks the block decoder against the one of Pillow.
+
+Usage: compareReference.py <directory>
+
+The directory is the one written by geBlockCompressionTest --dump. The
+blocks of every case are wrapped in a DDS header and decoded by Pillow, and
+the result is compared with the pixels our decoder wrote. The decoders
+round the interpolated colors differently, so a difference of 1 is allowed.
+The exit code is 1 if any case differs more.
+
+@bug     No known bugs.
+"""
+
+import glob
+import io
+import os
+import struct
+import sys
+
+from PIL import Image
+
+IMAGE_WIDTH = 128
+IMAGE_HEIGHT = 100
+MAX_DIFF = 1
+
+#DXGI format and channels compared of each format
+FORMATS = {
+  'bc1': (71, 4),
+  'bc3': (77, 4),
+  'bc4': (80, 1),
+  'bc5': (83, 2),
+  'bc7': (98, 4),
+}
+
+
+def makeDDS(dxgiFormat, blocks):
+  """DDS file with a DX10 header of a 2D texture with one mip."""
+  header = struct.pack('<4s7I44s',
+                       b'DDS ',
+                       124,
+                       0x81007,   #CAPS, HEIGHT, WIDTH, PIXELFORMAT, LINEARSIZE
+                       IMAGE_HEIGHT,
+                       IMAGE_WIDTH,
+                       len(blocks),
+                       0,
+                       1,
+                       b'\0' * 44)
+  pixelFormat = struct.pack('<2I4s5I', 32, 4, b'DX10', 0, 0, 0, 0, 0)
+  caps = struct.pack('<5I', 0x1000, 0, 0, 0, 0)
+  dx10 = struct.pack('<5I', dxgiFormat, 3, 0, 1, 0)
+  return header + pixelFormat + caps + dx10 + blocks
+
+
+def compare(blocksPath):
+  name = os.path.basename(blocksPath).split('_')[0]
+  dxgiFormat, numChannels = FORMATS[name]
+
+  with open(blocksPath, 'rb') as blocksFile:
+    blocks = blocksFile.read()
+  with open(blocksPath[:-4] + '.dec', 'rb') as decodedFile:
+    decoded = decodedFile.read()
+
+  image = Image.open(io.BytesIO(makeDDS(dxgiFormat, blocks))).convert('RGBA')
+  reference = image.tobytes()
+
+  maxDiff = 0
+  numDiffs = 0
+  for i in range(0, IMAGE_WIDTH * IMAGE_HEIGHT * 4, 4):
+    for c in range(numChannels):
+      diff = abs(reference[i + c] - decoded[i + c])
+      maxDiff = max(maxDiff, diff)
+      numDiffs += diff > MAX_DIFF
+
+  bPassed = maxDiff <= MAX_DIFF
+  print('%s %s: max difference %d, %d values over %d' %
+        ('ok  ' if bPassed else 'FAIL',
+         os.path.basename(blocksPath),
+         maxDiff,
+         numDiffs,
+         MAX_DIFF))
+  return bPassed
+
+
+def main():
+  if len(sys.argv) != 2:
+    print('Usage: compareReference.py <directory>')
+    return 1
+
+  blocksPaths = sorted(glob.glob(os.path.join(sys.argv[1], '*.bin')))
+  if not blocksPaths:
+    print('No blocks in %s, run geBlockCompressionTest --dump first' % sys.argv[1])
+    return 1
+
+  results = [compare(path) for path in blocksPaths]
+  return 0 if all(results) else 1
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,353 @@
+/*****************************************************************************/
+/**
+ * @file    geBlockCompressionTest.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Round trip checks of the block compression encoders.
+ *
+ * Usage: geBlockCompressionTest [--dump directory]
+ *
+ * Compresses a synthetic image (gradients, noise, hard edges and alpha
+ * patterns) to every format and quality, decodes it again and checks:
+ *
+ * - The PSNR of the channels the format stores is over a minimum.
+ * - The blocks are the same with SIMD on and off, and with one thread or
+ *   several.
+ * - Images that aren't a multiple of the block size round trip too.
+ *
+ * The exit code is 1 if any check fails. The encoder and decoder don't use
+ * Direct3D, so this also builds on Linux:
+ *
+ *   g++ -std=c++14 -O2 -msse2 -pthread -I../../include -I<geUtilities>/include
+ *       geBlockCompressionTest.cpp ../../source/geBlockCompression.cpp
+ *       ../../source/geTextureKernels.cpp -o geBlockCompressionTest
+ *
+ * The decoder is checked against a reference with --dump, which writes the
+ * source image and the blocks and decoded pixels of every case; then
+ * compareReference.py (Pillow) decodes the blocks on its own and compares.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include "geBlockCompression.h"
+
+using namespace geEngineSDK;
+
+namespace {
+  const uint32 IMAGE_WIDTH = 128;
+  const uint32 IMAGE_HEIGHT = 100;
+
+  const char* FORMAT_NAMES[BC_FORMAT::kNumFormats] = {
+    "bc1", "bc3", "bc4", "bc5", "bc7"
+  };
+
+  //Minimum PSNR (dB) of each format and quality on the test image. The
+  //noise region keeps them low, a broken mode drops them far below
+  const double MIN_PSNR[BC_FORMAT::kNumFormats][3] = {
+    { 19.0, 19.0, 19.0 },   //BC1
+    { 21.0, 21.0, 21.0 },   //BC3
+    { 34.0, 34.0, 34.0 },   //BC4
+    { 34.0, 34.0, 34.0 },   //BC5
+    { 21.5, 25.5, 26.5 }    //BC7
+  };
+
+  /**
+   * @brief Eight regions of 32x50 texels with different content.
+   */
+  void
+  fillTestImage(Vector<uint8>& pixels, uint32 width, uint32 height) {
+    pixels.resize(static_cast<SIZE_T>(width) * height * 4);
+    std::mt19937 rng(7);
+    for (uint32 y = 0; y < height; ++y) {
+      for (uint32 x = 0; x < width; ++x) {
+        uint8* p = &pixels[(static_cast<SIZE_T>(y) * width + x) * 4];
+        switch ((x / 32) % 4 + 4 * ((y / 50) % 2)) {
+          case 0:   //Smooth gradients
+            p[0] = static_cast<uint8>(x * 4);
+            p[1] = static_cast<uint8>(y * 2);
+            p[2] = 128;
+            p[3] = 255;
+            break;
+          case 1:   //Noise
+            p[0] = static_cast<uint8>(rng());
+            p[1] = static_cast<uint8>(rng());
+            p[2] = static_cast<uint8>(rng());
+            p[3] = 255;
+            break;
+          case 2:   //Checkers and an alpha ramp
+            p[0] = 200;
+            p[1] = ((x ^ y) & 8) ? 30 : 220;
+            p[2] = 60;
+            p[3] = static_cast<uint8>(x * 8);
+            break;
+          case 3:   //Waves and punched alpha
+            p[0] = static_cast<uint8>(128 + 60 * std::sin(x * 0.3));
+            p[1] = static_cast<uint8>(128 + 60 * std::cos(y * 0.2));
+            p[2] = p[0] / 2;
+            p[3] = ((x + y) & 4) ? 0 : 255;
+            break;
+          case 4:   //Gray
+            p[0] = p[1] = p[2] = static_cast<uint8>(x * y);
+            p[3] = 255;
+            break;
+          case 5:   //Noisy alpha
+            p[0] = 255;
+            p[1] = 0;
+            p[2] = static_cast<uint8>(y * 5);
+            p[3] = static_cast<uint8>(rng());
+            break;
+          case 6:   //Hard edges every texel
+            p[0] = (x & 1) ? 255 : 0;
+            p[1] = static_cast<uint8>(y * 2);
+            p[2] = static_cast<uint8>(x * 3);
+            p[3] = 200;
+            break;
+          default:  //Alpha edge
+            p[0] = static_cast<uint8>(10 + y);
+            p[1] = static_cast<uint8>(250 - y);
+            p[2] = static_cast<uint8>((x * y) % 256);
+            p[3] = x < 112 ? 255 : 0;
+            break;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief PSNR of the channels the format keeps. BC1 skips the texels it
+   *        makes transparent.
+   */
+  double
+  computePSNR(const Vector<uint8>& src, const Vector<uint8>& decoded, BC_FORMAT::E format) {
+    uint32 numChannels = 4;
+    if (BC_FORMAT::kBC1 == format) {
+      numChannels = 3;
+    }
+    else if (BC_FORMAT::kBC4 == format) {
+      numChannels = 1;
+    }
+    else if (BC_FORMAT::kBC5 == format) {
+      numChannels = 2;
+    }
+
+    double squaredError = 0.0;
+    SIZE_T numValues = 0;
+    for (SIZE_T i = 0; i < src.size(); i += 4) {
+      if (BC_FORMAT::kBC1 == format && src[i + 3] < 128) {
+        continue;
+      }
+      for (uint32 c = 0; c < numChannels; ++c) {
+        double diff = static_cast<double>(src[i + c]) - decoded[i + c];
+        squaredError += diff * diff;
+      }
+      numValues += numChannels;
+    }
+
+    if (0.0 == squaredError) {
+      return 99.0;
+    }
+    return 10.0 * std::log10(255.0 * 255.0 * numValues / squaredError);
+  }
+
+  void
+  compressImage(Vector<uint8>& pixels,
+                uint32 width,
+                uint32 height,
+                BC_FORMAT::E format,
+                BC_QUALITY::E quality,
+                Vector<uint8>& blocks) {
+    TextureImage image;
+    image.pData = pixels.data();
+    image.width = width;
+    image.height = height;
+    image.rowPitch = width * 4;
+
+    blocks.assign(BlockCompression::getCompressedSize(format, width, height), 0);
+    BlockCompression::compress(image,
+                               format,
+                               quality,
+                               blocks.data(),
+                               BlockCompression::getRowPitch(format, width));
+  }
+
+  void
+  decompressImage(const Vector<uint8>& blocks,
+                  uint32 width,
+                  uint32 height,
+                  BC_FORMAT::E format,
+                  Vector<uint8>& pixels) {
+    pixels.assign(static_cast<SIZE_T>(width) * height * 4, 0);
+
+    TextureImage image;
+    image.pData = pixels.data();
+    image.width = width;
+    image.height = height;
+    image.rowPitch = width * 4;
+    BlockCompression::decompress(blocks.data(),
+                                 BlockCompression::getRowPitch(format, width),
+                                 format,
+                                 image);
+  }
+
+  bool
+  writeFile(const String& path, const Vector<uint8>& data) {
+    FILE* pFile = fopen(path.c_str(), "wb");
+    if (!pFile) {
+      printf("Failed to write %s\n", path.c_str());
+      return false;
+    }
+    fwrite(data.data(), 1, data.size(), pFile);
+    fclose(pFile);
+    return true;
+  }
+
+  /**
+   * @brief Checks a format and quality on the test image.
+   * @param pDumpDir Where the blocks and the decoded pixels are written,
+   *        nullptr to skip.
+   */
+  bool
+  testFormat(Vector<uint8>& pixels,
+             BC_FORMAT::E format,
+             BC_QUALITY::E quality,
+             const char* pDumpDir) {
+    const uint32 numThreads = TextureKernels::getNumThreads();
+
+    Vector<uint8> blocks;
+    compressImage(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, format, quality, blocks);
+
+    Vector<uint8> scalarBlocks;
+    TextureKernels::setSIMDEnabled(false);
+    compressImage(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, format, quality, scalarBlocks);
+    TextureKernels::setSIMDEnabled(true);
+
+    Vector<uint8> serialBlocks;
+    TextureKernels::setNumThreads(1);
+    compressImage(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, format, quality, serialBlocks);
+    TextureKernels::setNumThreads(numThreads);
+
+    Vector<uint8> decoded;
+    decompressImage(blocks, IMAGE_WIDTH, IMAGE_HEIGHT, format, decoded);
+    const double psnr = computePSNR(pixels, decoded, format);
+
+    bool bPassed = true;
+    if (psnr < MIN_PSNR[format][quality]) {
+      printf("FAIL %s q%u: PSNR %.2f under %.2f\n",
+             FORMAT_NAMES[format],
+             quality,
+             psnr,
+             MIN_PSNR[format][quality]);
+      bPassed = false;
+    }
+    if (blocks != scalarBlocks) {
+      printf("FAIL %s q%u: the SIMD and scalar blocks differ\n", FORMAT_NAMES[format], quality);
+      bPassed = false;
+    }
+    if (blocks != serialBlocks) {
+      printf("FAIL %s q%u: the blocks depend on the number of threads\n",
+             FORMAT_NAMES[format],
+             quality);
+      bPassed = false;
+    }
+    if (bPassed) {
+      printf("ok   %s q%u: PSNR %.2f\n", FORMAT_NAMES[format], quality, psnr);
+    }
+
+    if (pDumpDir) {
+      char name[32];
+      snprintf(name, sizeof(name), "/%s_q%u", FORMAT_NAMES[format], quality);
+      bPassed &= writeFile(String(pDumpDir) + name + ".bin", blocks);
+      bPassed &= writeFile(String(pDumpDir) + name + ".dec", decoded);
+    }
+    return bPassed;
+  }
+
+  /**
+   * @brief The edge blocks of images that aren't a multiple of 4 repeat the
+   *        last row and column, and only the image is written back.
+   */
+  bool
+  testPartialBlocks() {
+    const uint32 sizes[][2] = { { 1, 1 }, { 5, 3 }, { 17, 33 }, { 2, 9 } };
+
+    bool bPassed = true;
+    for (const auto& size : sizes) {
+      Vector<uint8> pixels;
+      fillTestImage(pixels, size[0], size[1]);
+
+      for (uint32 f = 0; f < BC_FORMAT::kNumFormats; ++f) {
+        const auto format = static_cast<BC_FORMAT::E>(f);
+        Vector<uint8> blocks;
+        compressImage(pixels, size[0], size[1], format, BC_QUALITY::kNormal, blocks);
+
+        //A guard past the end catches writes outside of the image
+        const SIZE_T imageSize = pixels.size();
+        Vector<uint8> decoded(imageSize + 1, 0xCD);
+        TextureImage image;
+        image.pData = decoded.data();
+        image.width = size[0];
+        image.height = size[1];
+        image.rowPitch = size[0] * 4;
+        BlockCompression::decompress(blocks.data(),
+                                     BlockCompression::getRowPitch(format, size[0]),
+                                     format,
+                                     image);
+        if (0xCD != decoded[imageSize]) {
+          printf("FAIL %s %ux%u: wrote past the image\n", FORMAT_NAMES[f], size[0], size[1]);
+          bPassed = false;
+        }
+      }
+    }
+
+    if (bPassed) {
+      printf("ok   partial blocks\n");
+    }
+    return bPassed;
+  }
+}
+
+int
+main(int argc, char** argv) {
+  const char* pDumpDir = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (0 == strcmp(argv[i], "--dump") && i + 1 < argc) {
+      pDumpDir = argv[++i];
+    }
+    else {
+      printf("Usage: geBlockCompressionTest [--dump directory]\n");
+      return 1;
+    }
+  }
+
+  Vector<uint8> pixels;
+  fillTestImage(pixels, IMAGE_WIDTH, IMAGE_HEIGHT);
+  if (pDumpDir && !writeFile(String(pDumpDir) + "/src.raw", pixels)) {
+    return 1;
+  }
+
+  bool bPassed = true;
+  for (uint32 f = 0; f < BC_FORMAT::kNumFormats; ++f) {
+    for (uint32 q = BC_QUALITY::kFast; q <= BC_QUALITY::kHigh; ++q) {
+      bPassed &= testFormat(pixels,
+                            static_cast<BC_FORMAT::E>(f),
+                            static_cast<BC_QUALITY::E>(q),
+                            pDumpDir);
+    }
+  }
+  bPassed &= testPartialBlocks();
+
+  printf(bPassed ? "All checks passed\n" : "Some checks failed\n");
+  return bPassed ? 0 : 1;
+}
@@ -0,0 +1,607 @@
+/*****************************************************************************/
+/**
+ * @file    geRenderBench.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Microbenchmarks of the per draw calls of the DX11 render API.
+ *
+ * Usage: geRenderBench [--out file.json] [--samples N] [--batch N]
+ *                      [--immediate] [--baseline file.json] [--tolerance %]
+ *                      [--shaders manifest --archive file]
+ *
+ * Measures the CPU cost (ns per call) of the bind, draw and pipeline state
+ * calls of DX11RenderAPI. By default the calls go to a deferred context, a
+ * stand-in for the immediate one that records the commands without sending
+ * them to the driver; the recorded commands are dropped between samples.
+ * Every bind is measured twice: alternating two objects (the call reaches
+ * the context) and repeating the same one (the bind cache skips it). The
+ * format and semantic name lookups are measured next to a linear search.
+ *
+ * With --shaders the startup cost of the shaders of a manifest is measured
+ * twice (ns per shader): compiling them, and creating them from the archive
+ * geShaderPacker wrote from the same manifest, opening it included.
+ *
+ * The results are written as JSON. With --baseline the medians are compared
+ * against a previous result and the exit code is 2 if any benchmark is
+ * slower than the tolerance allows.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geGameConfig.h>
+#include <geMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "DX11RenderAPI.h"
+#include "DXTranslateUtils.h"
+#include "DXShaderArchive.h"
+
+using namespace geEngineSDK;
+
+namespace {
+  struct BenchResult
+  {
+    String name;
+    uint64 calls = 0;
+    double medianNs = 0.0;
+    double minNs = 0.0;
+    double maxNs = 0.0;
+  };
+
+  struct BenchOptions
+  {
+    const char* outPath = nullptr;
+    const char* baselinePath = nullptr;
+    const char* shaderManifestPath = nullptr;
+    const char* shaderArchivePath = nullptr;
+    uint32 numSamples = 31;
+    uint32 batchSize = 2048;
+    float tolerance = 10.0f;      //Percent
+    bool bImmediate = false;
+  };
+
+  /**
+   * @brief Runs the benchmarks against the active context of the render API
+   *        and drops the recorded commands between samples.
+   */
+  class BenchRunner
+  {
+   public:
+    BenchRunner(DX11RenderAPI& renderAPI,
+                D3DDeviceContext* pDeferredContext,
+                const BenchOptions& options)
+      : m_renderAPI(renderAPI),
+        m_pDeferredContext(pDeferredContext),
+        m_options(options)
+    {}
+
+    template<class Fn>
+    void
+    run(const char* name, Fn&& benchFn) {
+      using Clock = std::chrono::steady_clock;
+
+      //Warm up the caches and the lazily created views
+      for (uint32 i = 0; i < m_options.batchSize; ++i) {
+        benchFn(i);
+      }
+      _flush();
+
+      Vector<double> samples;
+      samples.reserve(m_options.numSamples);
+      for (uint32 sample = 0; sample < m_options.numSamples; ++sample) {
+        auto start = Clock::now();
+        for (uint32 i = 0; i < m_options.batchSize; ++i) {
+          benchFn(i);
+        }
+        auto end = Clock::now();
+        _flush();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        samples.push_back(elapsed.count() / m_options.batchSize);
+      }
+
+      addResult(name, samples, static_cast<uint64>(m_options.numSamples) * m_options.batchSize);
+    }
+
+    /**
+     * @brief Adds a result measured outside of run().
+     * @param samples ns per call of every sample.
+     */
+    void
+    addResult(const char* name, Vector<double> samples, uint64 calls) {
+      std::sort(samples.begin(), samples.end());
+
+      BenchResult result;
+      result.name = name;
+      result.calls = calls;
+      result.medianNs = samples[samples.size() / 2];
+      result.minNs = samples.front();
+      result.maxNs = samples.back();
+      m_results.push_back(result);
+
+      fprintf(stderr, "%-40s %10.1f ns/call\n", name, result.medianNs);
+    }
+
+    const Vector<BenchResult>&
+    getResults() const {
+      return m_results;
+    }
+
+   private:
+    void
+    _flush() {
+      if (!m_pDeferredContext) {
+        return;
+      }
+
+      //Drop what was recorded, this also clears the state of the context
+      ID3D11CommandList* pCommandList = nullptr;
+      m_pDeferredContext->FinishCommandList(FALSE, &pCommandList);
+      safeRelease(pCommandList);
+      m_renderAPI.setActiveContext(m_pDeferredContext);
+    }
+
+    DX11RenderAPI& m_renderAPI;
+    D3DDeviceContext* m_pDeferredContext;
+    const BenchOptions& m_options;
+    Vector<BenchResult> m_results;
+  };
+
+  HWND
+  createBenchWindow() {
+    WNDCLASSEXA wc;
+    memset(&wc, 0, sizeof(wc));
+    wc.cbSize = sizeof(wc);
+    wc.lpfnWndProc = DefWindowProcA;
+    wc.hInstance = GetModuleHandleA(nullptr);
+    wc.lpszClassName = "geRenderBench";
+    RegisterClassExA(&wc);
+
+    return CreateWindowExA(0,
+                           wc.lpszClassName,
+                           "geRenderBench",
+                           WS_OVERLAPPEDWINDOW,
+                           0, 0, 1280, 720,
+                           nullptr,
+                           nullptr,
+                           wc.hInstance,
+                           nullptr);
+  }
+
+  void
+  runBenchmarks(DX11RenderAPI& renderAPI, BenchRunner& runner) {
+    //Resources, two of each so the alternating binds aren't skipped
+    Vector<VertexElement> elements = {
+      VertexElement(0, 0, VERTEX_ELEMENT_TYPE::FLOAT3, VERTEX_ELEMENT_SEMANTIC::POSITION)
+    };
+    auto pDecl = renderAPI.createVertexDeclaration(elements);
+    SPtr<VertexBuffer> pVBs[2];
+    SPtr<Texture> pTextures[2];
+    SPtr<ConstantBuffer> pCBs[2];
+    SPtr<Texture> pTargets[2];
+    SPtr<Texture> pDepths[2];
+    for (uint32 i = 0; i < 2; ++i) {
+      pVBs[i] = renderAPI.createVertexBuffer(pDecl, sizeof(float) * 3 * 1024);
+      pTextures[i] = renderAPI.createTexture(256, 256, GRAPHICS_FORMAT::kR8G8B8A8_UNORM);
+      pCBs[i] = renderAPI.createConstantBuffer(256);
+      pTargets[i] = renderAPI.createTexture(1280,
+                                            720,
+                                            GRAPHICS_FORMAT::kR8G8B8A8_UNORM,
+                                            BIND_FLAG::RENDER_TARGET |
+                                              BIND_FLAG::SHADER_RESOURCE);
+      pDepths[i] = renderAPI.createTexture(1280,
+                                           720,
+                                           GRAPHICS_FORMAT::kD24_UNORM_S8_UINT,
+                                           BIND_FLAG::DEPTH_STENCIL);
+    }
+    auto pIB = renderAPI.createIndexBuffer(sizeof(uint32) * 36);
+
+    Vector<RenderTarget> targetSets[2] = { { {pTargets[0], 0} }, { {pTargets[1], 0} } };
+
+    Vector<GRAPHICS_VIEWPORT> viewports[2];
+    for (uint32 i = 0; i < 2; ++i) {
+      GRAPHICS_VIEWPORT viewport;
+      viewport.x = 0.0f;
+      viewport.y = 0.0f;
+      viewport.width = 1280.0f / (i + 1);
+      viewport.height = 720.0f / (i + 1);
+      viewport.zNear = 0.0f;
+      viewport.zFar = 1.0f;
+      viewports[i].push_back(viewport);
+    }
+
+    runner.run("setVertexBuffer", [&](uint32 i) {
+      renderAPI.setVertexBuffer(pVBs[i & 1], 0, 0);
+    });
+    runner.run("setVertexBuffer/redundant", [&](uint32) {
+      renderAPI.setVertexBuffer(pVBs[0], 0, 0);
+    });
+
+    runner.run("_setShaderResource", [&](uint32 i) {
+      renderAPI.psSetShaderResource(pTextures[i & 1], 0);
+    });
+    runner.run("_setShaderResource/redundant", [&](uint32) {
+      renderAPI.psSetShaderResource(pTextures[0], 0);
+    });
+
+    runner.run("_setConstantBuffer", [&](uint32 i) {
+      renderAPI.psSetConstantBuffer(pCBs[i & 1], 0);
+    });
+    runner.run("_setConstantBuffer/redundant", [&](uint32) {
+      renderAPI.psSetConstantBuffer(pCBs[0], 0);
+    });
+
+    runner.run("setRenderTargets", [&](uint32 i) {
+      renderAPI.setRenderTargets(targetSets[i & 1], pDepths[i & 1]);
+    });
+    runner.run("setRenderTargets/redundant", [&](uint32) {
+      renderAPI.setRenderTargets(targetSets[0], pDepths[0]);
+    });
+
+    runner.run("setViewports", [&](uint32 i) {
+      renderAPI.setViewports(viewports[i & 1]);
+    });
+    runner.run("setViewports/redundant", [&](uint32) {
+      renderAPI.setViewports(viewports[0]);
+    });
+
+    renderAPI.setVertexBuffer(pVBs[0], 0, 0);
+    renderAPI.setIndexBuffer(pIB);
+    runner.run("drawIndexed", [&](uint32) {
+      renderAPI.drawIndexed(36, 0, 0);
+    });
+
+    runner.run("savePipelineState", [&](uint32) {
+      auto pState = renderAPI.savePipelineState();
+    });
+    runner.run("savePipelineState+restorePipelineState", [&](uint32) {
+      auto pState = renderAPI.savePipelineState();
+      renderAPI.restorePipelineState(pState);
+    });
+  }
+
+  /**
+   * @brief Name lookups used while parsing materials and reflecting shaders.
+   *        The linear variants are what the lookups did before the hashed
+   *        tables, kept as a reference.
+   */
+  void
+  runLookupBenchmarks(BenchRunner& runner) {
+    Vector<String> formatNames;
+    for (uint32 i = 0; i <= DXGI_FORMAT_A4B4G4R4_UNORM; ++i) {
+      const auto& info = TranslateUtils::getFormatInfo(static_cast<DXGI_FORMAT>(i));
+      if (static_cast<uint32>(info.format) == i) {
+        formatNames.push_back(info.name);
+      }
+    }
+    const auto numFormats = static_cast<uint32>(formatNames.size());
+
+    static const char* s_semantics[] = {
+      "POSITION", "NORMAL", "TANGENT", "BINORMAL", "TEXCOORD",
+      "COLOR", "BLENDWEIGHT", "BLENDINDICES", "PSIZE", "POSITIONT"
+    };
+    const uint32 numSemantics = sizeof(s_semantics) / sizeof(s_semantics[0]);
+
+    volatile uint32 sink = 0;
+    runner.run("TranslateUtils::fromString", [&](uint32 i) {
+      sink = sink + TranslateUtils::fromString(formatNames[i % numFormats]);
+    });
+    runner.run("TranslateUtils::fromString/linear", [&](uint32 i) {
+      const String& name = formatNames[i % numFormats];
+      for (const auto& candidate : formatNames) {
+        if (name == candidate) {
+          sink = sink + 1;
+          break;
+        }
+      }
+    });
+
+    runner.run("TranslateUtils::get(semantic)", [&](uint32 i) {
+      sink = sink + TranslateUtils::get(s_semantics[i % numSemantics]);
+    });
+    runner.run("TranslateUtils::get(semantic)/linear", [&](uint32 i) {
+      const char* name = s_semantics[i % numSemantics];
+      for (uint32 j = 0; j < numSemantics; ++j) {
+        if (0 == strcmp(name, s_semantics[j])) {
+          sink = sink + j;
+          break;
+        }
+      }
+    });
+  }
+
+  SPtr<void>
+  createShader(DX11RenderAPI& renderAPI, const ShaderArchiveSource& source) {
+    const String stage = source.shaderModel.substr(0, 2);
+    if ("vs" == stage) {
+      return renderAPI.createVertexShader(source.fileName, source.macros,
+                                          source.entryPoint, source.shaderModel);
+    }
+    if ("ps" == stage) {
+      return renderAPI.createPixelShader(source.fileName, source.macros,
+                                         source.entryPoint, source.shaderModel);
+    }
+    if ("gs" == stage) {
+      return renderAPI.createGeometryShader(source.fileName, source.macros,
+                                            source.entryPoint, source.shaderModel);
+    }
+    if ("hs" == stage) {
+      return renderAPI.createHullShader(source.fileName, source.macros,
+                                        source.entryPoint, source.shaderModel);
+    }
+    if ("ds" == stage) {
+      return renderAPI.createDomainShader(source.fileName, source.macros,
+                                          source.entryPoint, source.shaderModel);
+    }
+    if ("cs" == stage) {
+      return renderAPI.createComputeShader(source.fileName, source.macros,
+                                           source.entryPoint, source.shaderModel);
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Creates the shaders of a manifest as a startup would, compiling
+   *        them and then from the archive. Compiling takes long, so fewer
+   *        samples are taken than for the other benchmarks.
+   */
+  void
+  runShaderStartupBenchmarks(DX11RenderAPI& renderAPI,
+                             BenchRunner& runner,
+                             const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+
+    Vector<ShaderArchiveSource> sources;
+    if (!DXShaderArchive::readManifest(Path(options.shaderManifestPath), sources) ||
+        sources.empty()) {
+      fprintf(stderr, "No shaders in %s\n", options.shaderManifestPath);
+      return;
+    }
+    const auto numShaders = static_cast<uint32>(sources.size());
+    const uint32 numSamples = Math::min(options.numSamples, 5U);
+
+    for (uint32 bUseArchive = 0; bUseArchive < 2; ++bUseArchive) {
+      Vector<double> samples;
+      for (uint32 sample = 0; sample < numSamples; ++sample) {
+        renderAPI.closeShaderArchive();
+
+        Vector<SPtr<void>> shaders;
+        shaders.reserve(numShaders);
+        auto start = Clock::now();
+        if (bUseArchive && !renderAPI.openShaderArchive(Path(options.shaderArchivePath))) {
+          return;
+        }
+        for (const auto& source : sources) {
+          shaders.push_back(createShader(renderAPI, source));
+        }
+        auto end = Clock::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        samples.push_back(elapsed.count() / numShaders);
+      }
+
+      if (bUseArchive) {
+        uint32 numArchived = 0;
+        for (const auto& source : sources) {
+          SIZE_T size = 0;
+          auto key = DXShaderArchive::makeKey(source.fileName,
+                                              source.macros,
+                                              source.entryPoint,
+                                              source.shaderModel);
+          numArchived += renderAPI.getShaderArchive().find(key, size) ? 1 : 0;
+        }
+        fprintf(stderr, "%u of %u shaders found in the archive\n", numArchived, numShaders);
+      }
+
+      runner.addResult(bUseArchive ? "ShaderStartup/archive" : "ShaderStartup/compile",
+                       samples,
+                       static_cast<uint64>(numSamples) * numShaders);
+    }
+    renderAPI.closeShaderArchive();
+  }
+
+  bool
+  writeResults(const BenchOptions& options, const Vector<BenchResult>& results) {
+    FILE* pFile = stdout;
+    if (options.outPath) {
+      pFile = fopen(options.outPath, "wt");
+      if (!pFile) {
+        fprintf(stderr, "Failed to create %s\n", options.outPath);
+        return false;
+      }
+    }
+
+    //One result per line, the baseline reader depends on it
+    fprintf(pFile, "{\n");
+    fprintf(pFile, "  \"suite\": \"geRenderBench\",\n");
+    fprintf(pFile, "  \"context\": \"%s\",\n", options.bImmediate ? "immediate" : "deferred");
+    fprintf(pFile, "  \"samples\": %u,\n", options.numSamples);
+    fprintf(pFile, "  \"batch\": %u,\n", options.batchSize);
+    fprintf(pFile, "  \"results\": [\n");
+    for (SIZE_T i = 0; i < results.size(); ++i) {
+      const BenchResult& result = results[i];
+      fprintf(pFile,
+              "    {\"name\": \"%s\", \"median_ns\": %.2f, \"min_ns\": %.2f, "
+              "\"max_ns\": %.2f, \"calls\": %llu}%s\n",
+              result.name.c_str(),
+              result.medianNs,
+              result.minNs,
+              result.maxNs,
+              static_cast<unsigned long long>(result.calls),
+              i + 1 < results.size() ? "," : "");
+    }
+    fprintf(pFile, "  ]\n");
+    fprintf(pFile, "}\n");
+
+    if (pFile != stdout) {
+      fclose(pFile);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Compares the medians with the ones of a previous run.
+   * @return False if any benchmark got slower than the tolerance.
+   */
+  bool
+  compareWithBaseline(const BenchOptions& options, const Vector<BenchResult>& results) {
+    std::ifstream file(options.baselinePath);
+    if (!file) {
+      fprintf(stderr, "Failed to open the baseline %s\n", options.baselinePath);
+      return false;
+    }
+
+    static const String NAME_KEY = "\"name\": \"";
+    static const String MEDIAN_KEY = "\"median_ns\": ";
+
+    bool bPassed = true;
+    String line;
+    while (std::getline(file, line)) {
+      auto namePos = line.find(NAME_KEY);
+      auto medianPos = line.find(MEDIAN_KEY);
+      if (namePos == String::npos || medianPos == String::npos) {
+        continue;
+      }
+
+      namePos += NAME_KEY.size();
+      String name = line.substr(namePos, line.find('"', namePos) - namePos);
+      double baselineNs = atof(line.c_str() + medianPos + MEDIAN_KEY.size());
+
+      auto it = std::find_if(results.begin(), results.end(),
+                             [&name](const BenchResult& result) {
+                               return result.name == name;
+                             });
+      if (it == results.end() || baselineNs <= 0.0) {
+        continue;
+      }
+
+      double change = (it->medianNs - baselineNs) / baselineNs * 100.0;
+      if (change > options.tolerance) {
+        fprintf(stderr,
+                "REGRESSION %s: %.1f ns -> %.1f ns (+%.1f%%)\n",
+                name.c_str(),
+                baselineNs,
+                it->medianNs,
+                change);
+        bPassed = false;
+      }
+    }
+
+    return bPassed;
+  }
+
+  void
+  printUsage() {
+    printf("Usage: geRenderBench [--out file.json] [--samples N] [--batch N]\n"
+           "                     [--immediate] [--baseline file.json] [--tolerance %%]\n"
+           "                     [--shaders manifest --archive file]\n");
+  }
+}
+
+int
+main(int argc, char** argv) {
+  BenchOptions options;
+  for (int i = 1; i < argc; ++i) {
+    bool bHasValue = i + 1 < argc;
+    if (0 == strcmp(argv[i], "--out") && bHasValue) {
+      options.outPath = argv[++i];
+    }
+    else if (0 == strcmp(argv[i], "--samples") && bHasValue) {
+      options.numSamples = Math::max(1U, static_cast<uint32>(atoi(argv[++i])));
+    }
+    else if (0 == strcmp(argv[i], "--batch") && bHasValue) {
+      options.batchSize = Math::max(1U, static_cast<uint32>(atoi(argv[++i])));
+    }
+    else if (0 == strcmp(argv[i], "--immediate")) {
+      options.bImmediate = true;
+    }
+    else if (0 == strcmp(argv[i], "--baseline") && bHasValue) {
+      options.baselinePath = argv[++i];
+    }
+    else if (0 == strcmp(argv[i], "--tolerance") && bHasValue) {
+      options.tolerance = static_cast<float>(atof(argv[++i]));
+    }
+    else if (0 == strcmp(argv[i], "--shaders") && bHasValue) {
+      options.shaderManifestPath = argv[++i];
+    }
+    else if (0 == strcmp(argv[i], "--archive") && bHasValue) {
+      options.shaderArchivePath = argv[++i];
+    }
+    else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  if (!options.shaderManifestPath != !options.shaderArchivePath) {
+    printUsage();
+    return 1;
+  }
+
+  if (!GameConfig::isStarted()) {
+    GameConfig::startUp();
+  }
+
+  HWND hWnd = createBenchWindow();
+  RenderAPI::startUp<DX11RenderAPI>();
+  auto& renderAPI = static_cast<DX11RenderAPI&>(RenderAPI::instance());
+
+  int result = 0;
+  if (renderAPI.initRenderAPI(hWnd, false)) {
+    D3DDeviceContext* pDeferredContext = nullptr;
+    if (!options.bImmediate) {
+      ID3D11DeviceContext* pContext = nullptr;
+      if (SUCCEEDED(renderAPI.getDevice()->CreateDeferredContext(0, &pContext))) {
+        pDeferredContext = getAs<D3DDeviceContext>(pContext);
+      }
+      safeRelease(pContext);
+
+      if (!pDeferredContext) {
+        fprintf(stderr, "Deferred contexts not available, using the immediate one\n");
+        options.bImmediate = true;
+      }
+    }
+    renderAPI.setActiveContext(pDeferredContext);
+
+    {
+      BenchRunner runner(renderAPI, pDeferredContext, options);
+      runBenchmarks(renderAPI, runner);
+      runLookupBenchmarks(runner);
+      if (options.shaderManifestPath) {
+        runShaderStartupBenchmarks(renderAPI, runner, options);
+      }
+
+      if (!writeResults(options, runner.getResults())) {
+        result = 1;
+      }
+      else if (options.baselinePath &&
+               !compareWithBaseline(options, runner.getResults())) {
+        result = 2;
+      }
+    }
+
+    renderAPI.setImmediateContext();
+    safeRelease(pDeferredContext);
+  }
+  else {
+    fprintf(stderr, "Failed to initialize the render API\n");
+    result = 1;
+  }
+
+  RenderAPI::shutDown();
+  DestroyWindow(hWnd);
+
+  return result;
+}
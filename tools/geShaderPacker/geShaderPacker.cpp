@@ -0,0 +1,157 @@
+/*****************************************************************************/
+/**
+ * @file    geShaderPacker.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Compiles the shaders of a manifest into a shader archive.
+ *
+ * Usage: geShaderPacker <manifest> <archive>
+ *
+ * Every shader of the manifest (see DXShaderArchive.h for its format) is
+ * compiled with the options the render API uses at runtime and written to
+ * the archive, keyed by its source file, entry point, shader model and
+ * macros. The render API finds them there when RenderAPI.ShaderArchive
+ * points to the archive and doesn't compile them again.
+ *
+ * The compilation doesn't need a device, the render API is started but not
+ * initialized. Nothing is written if any shader fails to compile.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geGameConfig.h>
+#include <chrono>
+#include <cstdio>
+
+#include "DX11RenderAPI.h"
+#include "DXShaderArchive.h"
+
+using namespace geEngineSDK;
+
+namespace {
+  void
+  printUsage() {
+    printf("Usage: geShaderPacker <manifest> <archive>\n");
+  }
+
+  /**
+   * @brief Compiles the shaders of the manifest.
+   * @return False if any of them failed, the blobs are released then.
+   */
+  bool
+  compileShaders(DX11RenderAPI& renderAPI,
+                 const Vector<ShaderArchiveSource>& sources,
+                 Vector<ShaderArchiveEntry>& entries,
+                 Vector<ID3DBlob*>& blobs) {
+    bool bSucceeded = true;
+    for (const auto& source : sources) {
+      ID3DBlob* pBlob = nullptr;
+      if (!renderAPI.compileShader(source.fileName,
+                                   source.macros,
+                                   source.entryPoint,
+                                   source.shaderModel,
+                                   &pBlob)) {
+        printf("Failed to compile %s of %s\n",
+               source.entryPoint.c_str(),
+               source.fileName.toString().c_str());
+        bSucceeded = false;
+        continue;
+      }
+
+      if (DXBC_PROGRAM_TYPE::kUnknown ==
+            DXShader::getProgramType(pBlob->GetBufferPointer(), pBlob->GetBufferSize())) {
+        printf("%s of %s isn't DXBC bytecode (%s)\n",
+               source.entryPoint.c_str(),
+               source.fileName.toString().c_str(),
+               source.shaderModel.c_str());
+        safeRelease(pBlob);
+        bSucceeded = false;
+        continue;
+      }
+
+      ShaderArchiveEntry entry;
+      entry.key = DXShaderArchive::makeKey(source.fileName,
+                                           source.macros,
+                                           source.entryPoint,
+                                           source.shaderModel);
+      entry.offset = 0;
+      entry.size = static_cast<uint32>(pBlob->GetBufferSize());
+      entries.push_back(entry);
+      blobs.push_back(pBlob);
+    }
+
+    if (!bSucceeded) {
+      for (auto& pBlob : blobs) {
+        safeRelease(pBlob);
+      }
+      blobs.clear();
+      entries.clear();
+    }
+    return bSucceeded;
+  }
+}
+
+int
+main(int argc, char** argv) {
+  if (3 != argc) {
+    printUsage();
+    return 1;
+  }
+
+  if (!GameConfig::isStarted()) {
+    GameConfig::startUp();
+  }
+
+  Vector<ShaderArchiveSource> sources;
+  if (!DXShaderArchive::readManifest(Path(argv[1]), sources)) {
+    printf("Failed to read the manifest %s\n", argv[1]);
+    return 1;
+  }
+
+  RenderAPI::startUp<DX11RenderAPI>();
+  auto& renderAPI = static_cast<DX11RenderAPI&>(RenderAPI::instance());
+
+  using Clock = std::chrono::steady_clock;
+  auto start = Clock::now();
+
+  int result = 0;
+  Vector<ShaderArchiveEntry> entries;
+  Vector<ID3DBlob*> blobs;
+  if (compileShaders(renderAPI, sources, entries, blobs)) {
+    Vector<const void*> blobData;
+    SIZE_T totalSize = 0;
+    for (auto pBlob : blobs) {
+      blobData.push_back(pBlob->GetBufferPointer());
+      totalSize += pBlob->GetBufferSize();
+    }
+
+    if (DXShaderArchive::write(Path(argv[2]), entries, blobData)) {
+      std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+      printf("%s: %u shaders, %llu bytes of bytecode, %.1f ms\n",
+             argv[2],
+             static_cast<uint32>(entries.size()),
+             static_cast<unsigned long long>(totalSize),
+             elapsed.count());
+    }
+    else {
+      result = 1;
+    }
+
+    for (auto& pBlob : blobs) {
+      safeRelease(pBlob);
+    }
+  }
+  else {
+    result = 1;
+  }
+
+  RenderAPI::shutDown();
+  return result;
+}
@@ -0,0 +1,145 @@
+/*****************************************************************************/
+/**
+ * @file    geTraceReplay.cpp
+ * @author  Samuel Prince (samuel.prince.quezada@gmail.com)
+ * @date    2026/10/18
+ * @brief   Plays a render API trace and reports its frame times.
+ *
+ * Usage: geTraceReplay <trace file> [--null | --dx11] [--loops N]
+ *
+ * The trace is replayed as fast as possible (no vsync, no throttling) and
+ * the CPU time of every frame is reported as percentiles. With --null the
+ * calls go to the null render API, which measures the cost of the engine
+ * side of the calls without a driver.
+ *
+ * @bug	    No known bugs.
+ */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * Includes
+ */
+/*****************************************************************************/
+#include <gePrerequisitesCore.h>
+#include <geGameConfig.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "DX11RenderAPI.h"
+#include "geNullRenderAPI.h"
+#include "geRenderTrace.h"
+
+using namespace geEngineSDK;
+
+namespace {
+  void
+  printUsage() {
+    printf("Usage: geTraceReplay <trace file> [--null | --dx11] [--loops N]\n");
+  }
+
+  /**
+   * @brief Hidden window for the swap chain of the DX11 backend.
+   */
+  HWND
+  createReplayWindow() {
+    WNDCLASSEXA wc;
+    memset(&wc, 0, sizeof(wc));
+    wc.cbSize = sizeof(wc);
+    wc.lpfnWndProc = DefWindowProcA;
+    wc.hInstance = GetModuleHandleA(nullptr);
+    wc.lpszClassName = "geTraceReplay";
+    RegisterClassExA(&wc);
+
+    return CreateWindowExA(0,
+                           wc.lpszClassName,
+                           "geTraceReplay",
+                           WS_OVERLAPPEDWINDOW,
+                           0, 0, 1920, 1080,
+                           nullptr,
+                           nullptr,
+                           wc.hInstance,
+                           nullptr);
+  }
+}
+
+int
+main(int argc, char** argv) {
+  if (argc < 2) {
+    printUsage();
+    return 1;
+  }
+
+  const char* tracePath = argv[1];
+  bool bNullDevice = false;
+  uint32 numLoops = 1;
+  for (int i = 2; i < argc; ++i) {
+    if (0 == strcmp(argv[i], "--null")) {
+      bNullDevice = true;
+    }
+    else if (0 == strcmp(argv[i], "--dx11")) {
+      bNullDevice = false;
+    }
+    else if (0 == strcmp(argv[i], "--loops") && i + 1 < argc) {
+      numLoops = static_cast<uint32>(atoi(argv[++i]));
+      numLoops = numLoops ? numLoops : 1;
+    }
+    else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  if (!GameConfig::isStarted()) {
+    GameConfig::startUp();
+  }
+
+  RenderTrace trace;
+  if (!trace.load(Path(tracePath))) {
+    printf("Failed to load %s\n", tracePath);
+    return 1;
+  }
+
+  HWND hWnd = nullptr;
+  if (bNullDevice) {
+    RenderAPI::startUp<NullRenderAPI>();
+  }
+  else {
+    hWnd = createReplayWindow();
+    RenderAPI::startUp<DX11RenderAPI>();
+  }
+
+  int result = 0;
+  if (RenderAPI::instance().initRenderAPI(hWnd, false)) {
+    RenderTraceReplayer replayer(RenderAPI::instance());
+    RenderTraceReplayStats stats = replayer.replay(trace, numLoops);
+    replayer.reset();
+
+    printf("Backend:  %s\n", bNullDevice ? "null" : "dx11");
+    printf("Frames:   %u (%u setup frames, %u loops)\n",
+           static_cast<uint32>(stats.frameTimesMs.size()),
+           trace.getNumSetupFrames(),
+           numLoops);
+    printf("Commands: %u\n", stats.numCommands);
+    printf("Total:    %.3f ms\n", stats.totalMs);
+    printf("Mean:     %.3f ms\n", stats.meanMs);
+    printf("Min:      %.3f ms\n", stats.minMs);
+    printf("P50:      %.3f ms\n", stats.p50Ms);
+    printf("P90:      %.3f ms\n", stats.p90Ms);
+    printf("P95:      %.3f ms\n", stats.p95Ms);
+    printf("P99:      %.3f ms\n", stats.p99Ms);
+    printf("Max:      %.3f ms\n", stats.maxMs);
+  }
+  else {
+    printf("Failed to initialize the render API\n");
+    result = 1;
+  }
+
+  RenderAPI::shutDown();
+  if (hWnd) {
+    DestroyWindow(hWnd);
+  }
+
+  return result;
+}